@@ -130,6 +130,31 @@ DE_API_TYPEDEF(MPE)
     int             (*PlaneCreate)(int sector, coord_t height, const char *materialUri, float matOffsetX, float matOffsetY, float r, float g, float b, float a, float normalX, float normalY, float normalZ, int archiveIndex);
     int             (*PolyobjCreate)(const int *lines, int linecount, int tag, int sequenceType, coord_t originX, coord_t originY, int archiveIndex);
     dd_bool         (*GameObjProperty)(const char *objName, int idx, const char *propName, valuetype_t type, void *data);
+
+    /**
+     * Looks up a game object property for use with GameObjProperties(). The lookup
+     * only needs to be done once per property rather than once per value.
+     *
+     * @param objName   Name of the game object type, e.g., "Thing".
+     * @param propName  Name of the property.
+     *
+     * @return  Identifier of the property, or @c -1 if there is no such property.
+     */
+    int             (*GameObjPropertyId)(const char *objName, const char *propName);
+
+    /**
+     * Sets the value of a game object property for a range of consecutive
+     * game objects.
+     *
+     * @param propertyId  Property identifier from GameObjPropertyId().
+     * @param type        Type of the values.
+     * @param firstIdx    Index of the first game object.
+     * @param count       Number of values.
+     * @param values      Array of @a count values of @a type.
+     *
+     * @return  @c true iff all the values were set.
+     */
+    dd_bool         (*GameObjProperties)(int propertyId, valuetype_t type, int firstIdx, int count, const void *values);
 }
 DE_API_T(MPE);
 
@@ -146,6 +171,8 @@ DE_API_T(MPE);
 #define MPE_PlaneCreate     _api_MPE.PlaneCreate
 #define MPE_PolyobjCreate   _api_MPE.PolyobjCreate
 #define MPE_GameObjProperty _api_MPE.GameObjProperty
+#define MPE_GameObjPropertyId _api_MPE.GameObjPropertyId
+#define MPE_GameObjProperties _api_MPE.GameObjProperties
 #endif
 
 #ifdef __DOOMSDAY__
@@ -183,6 +183,8 @@ enum {
     DD_MAP_MAX_Y,
     DD_MAP_POLYOBJ_COUNT,
     DD_MAP_GRAVITY,
+    DD_MAP_GEOMETRY_STAMP,      ///< Changes whenever plane heights or polyobjs move.
+    DD_MAP_REJECT_MATRIX,       ///< Sector LOS reject matrix (built on first request).
 };
 
 //------------------------------------------------------------------------
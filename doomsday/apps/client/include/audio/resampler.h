@@ -0,0 +1,66 @@
+/** @file resampler.h  Band-limited sample rate conversion.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef AUDIO_RESAMPLER_H
+#define AUDIO_RESAMPLER_H
+
+#include <de/libcore.h>
+
+namespace audio {
+
+/**
+ * Converts mono PCM samples between arbitrary sample rates with a polyphase
+ * windowed-sinc filter. When the rate is reduced, the filter cutoff is lowered
+ * accordingly so that no aliasing is introduced.
+ *
+ * Samples may be 8-bit unsigned or 16-bit signed, both for input and output.
+ * A Resampler has no mutable state, so the same instance can be used by several
+ * threads at once.
+ */
+class Resampler
+{
+public:
+    Resampler(int srcRate, int dstRate);
+
+    int srcRate() const;
+    int dstRate() const;
+
+    /**
+     * Number of output samples produced from @a srcNumSamples input samples.
+     */
+    int outputLength(int srcNumSamples) const;
+
+    /**
+     * Converts a sample.
+     *
+     * @param dst            Destination buffer with room for outputLength() samples.
+     * @param dstBytesPer    Bytes per output sample (1 or 2).
+     * @param src            Source samples.
+     * @param srcBytesPer    Bytes per input sample (1 or 2).
+     * @param srcNumSamples  Number of input samples.
+     */
+    void process(void *dst, int dstBytesPer,
+                 const void *src, int srcBytesPer, int srcNumSamples) const;
+
+private:
+    DE_PRIVATE(d)
+};
+
+}  // namespace audio
+
+#endif  // AUDIO_RESAMPLER_H
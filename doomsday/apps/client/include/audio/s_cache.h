@@ -22,6 +22,7 @@
 #define AUDIO_SFXSAMPLECACHE_H
 
 #include "api_audiod_sfx.h"  // sfxsample_t
+#include <de/list.h>
 #include <de/observers.h>
 
 namespace audio {
@@ -90,6 +91,15 @@ public:
      */
     sfxsample_t *cache(int soundId);
 
+    /**
+     * Caches all the given sounds ahead of time, so that they don't need to be
+     * loaded and converted when first played. The samples are converted in
+     * background workers; this returns when all of them are in the cache.
+     *
+     * @param soundIds  Sound sample identifiers. Already cached ones are skipped.
+     */
+    void precache(const de::List<int> &soundIds);
+
     /**
      * Register a cache hit on the sound sample associated with @a id.
      *
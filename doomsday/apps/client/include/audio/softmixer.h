@@ -0,0 +1,117 @@
+/** @file softmixer.h  Software mixer of the softmix audio driver.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef DE_AUDIO_SOFTMIXER_H
+#define DE_AUDIO_SOFTMIXER_H
+
+#include <de/libcore.h>
+#include <de/list.h>
+#include <de/lockable.h>
+
+#include <atomic>
+#include <vector>
+
+/// Frames mixed at a time. Gains are ramped over one block.
+static const de::dint SOFTMIX_BLOCK_FRAMES = 256;
+
+/**
+ * Playback state of one sound buffer.
+ *
+ * The parameters are atomic so that the game thread can update them while the
+ * mixer is running, without taking the mixer lock. Everything else is only
+ * accessed while holding the lock.
+ */
+struct SoftMixVoice
+{
+    std::atomic<de::dfloat> volume;
+    std::atomic<de::dfloat> pan;
+    std::atomic<de::dfloat> pitch;
+    std::atomic<de::dfloat> minDistance;
+    std::atomic<de::dfloat> maxDistance;
+    std::atomic<de::dfloat> position[3];
+    std::atomic<bool>       relative;
+    std::atomic<bool>       finished; ///< Set by the mixer when the sample has ended.
+
+    bool                    positional;
+    bool                    repeat;
+    bool                    playing = false;
+    bool                    rampFromZero = true;
+    std::vector<de::dfloat> data;     ///< Sample in floating point, with one extra sample for interpolation.
+    de::dint                rate = 0;
+    de::duint64             cursor = 0;   ///< Fixed point 32.32 position in the sample.
+    de::dfloat              gain[2] = { 0, 0 }; ///< Gains applied at the end of the previous block.
+
+    SoftMixVoice(bool positional, bool repeat);
+
+    /**
+     * Converts a sample to floating point.
+     *
+     * @param samples   Unsigned 8-bit or signed 16-bit mono samples.
+     * @param bytesPer  Bytes per sample (1 or 2).
+     * @param count     Number of samples.
+     * @param rate      Sample rate in Hz.
+     */
+    void setSample(const void *samples, de::dint bytesPer, de::dint count, de::dint rate);
+
+    de::dint sampleCount() const;
+};
+
+struct SoftMixListener
+{
+    std::atomic<de::dfloat> position[3];
+    std::atomic<de::dfloat> yaw; ///< Degrees, world angle convention.
+
+    SoftMixListener();
+};
+
+/**
+ * Mixes a set of voices into 16-bit stereo output.
+ *
+ * Voices are first resampled into a mono scratch buffer, and then accumulated
+ * into the left and right channels with linearly ramped gains. The accumulation
+ * and output conversion loops have no dependencies between iterations so the
+ * compiler vectorizes them for the target's SIMD instruction set.
+ */
+struct SoftMixer : public de::Lockable
+{
+    de::dint                 outputRate;
+    SoftMixListener          listener;
+    de::List<SoftMixVoice *> voices; ///< Not owned.
+    std::vector<de::dfloat>  mono;
+    std::vector<de::dfloat>  left;
+    std::vector<de::dfloat>  right;
+
+    SoftMixer(de::dint rate);
+
+    /// Mixes @a frames frames of interleaved stereo into @a out.
+    void mix(de::dint16 *out, de::dint frames);
+
+    void targetGains(const SoftMixVoice &voice, de::dfloat gains[2]) const;
+
+    /**
+     * Resamples the next @a frames frames of the voice into the mono buffer with
+     * linear interpolation. The position is stepped in fixed point so that long
+     * sounds do not drift.
+     * @return Number of frames produced; less than requested if the sample ended.
+     */
+    de::dint fetch(SoftMixVoice &voice, de::dint frames);
+
+    void mixBlock(de::dint16 *out, de::dint frames);
+};
+
+#endif // DE_AUDIO_SOFTMIXER_H
@@ -0,0 +1,72 @@
+/** @file sys_audiod_softmix.h  Built-in software mixing audio driver.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+/**
+ * The software mixer mixes all playing sound buffers into a 16-bit stereo
+ * stream without any audio device. It is used for measuring audio performance
+ * and for rendering the game's sound effects into a file.
+ *
+ * In realtime mode (the default) a mixer thread follows the wall clock. In
+ * offline mode (@c -softmix-render or @c -softmix-offline) the output advances
+ * with game time at the end of each frame, so rendering runs as fast as the
+ * engine does and the result only depends on the sequence of frames.
+ *
+ * Music and CD interfaces are not provided.
+ */
+
+#ifndef DE_SYSTEM_AUDIO_SOFTMIX_H
+#define DE_SYSTEM_AUDIO_SOFTMIX_H
+
+#include <de/liblegacy.h>
+#include "api_audiod.h"
+#include "api_audiod_sfx.h"
+
+#ifdef __cplusplus
+#  include <de/block.h>
+#endif
+
+DE_EXTERN_C audiodriver_t        audiod_softmix;
+DE_EXTERN_C audiointerface_sfx_t audiod_softmix_sfx;
+
+#ifdef __cplusplus
+
+/**
+ * Mixes the next @a frames frames in offline mode and returns them as
+ * interleaved 16-bit stereo PCM. Nothing is returned in realtime mode.
+ */
+de::Block DS_SoftMix_Render(int frames);
+
+/**
+ * Returns everything rendered so far in offline mode, and clears the
+ * internal buffer. The data is interleaved 16-bit stereo PCM at
+ * DS_SoftMix_OutputRate().
+ */
+de::Block DS_SoftMix_TakeOutput();
+
+int DS_SoftMix_OutputRate();
+
+/**
+ * Composes a WAV file out of interleaved 16-bit stereo PCM data.
+ */
+de::Block DS_SoftMix_ComposeWav(const de::Block &pcm, int rate);
+
+void DS_SoftMix_ConsoleRegister();
+
+#endif // __cplusplus
+
+#endif // DE_SYSTEM_AUDIO_SOFTMIX_H
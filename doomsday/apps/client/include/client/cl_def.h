@@ -52,4 +52,10 @@ int Cl_GameReady();
  */
 void Cl_SendHello();
 
+/**
+ * Asks the server to send the complete world state in the next frame, without a
+ * new handshake. Used for demo keyframes.
+ */
+void Cl_RequestFullFrame();
+
 #endif // DE_CLIENT_H
@@ -0,0 +1,91 @@
+/** @file texfilter.h  Vectorized and multithreaded texture filter kernels.
+ *
+ * @ingroup gl
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef DE_GL_TEXFILTER_H
+#define DE_GL_TEXFILTER_H
+
+#include <cstdint>
+
+/**
+ * Pixel filters used when preparing textures (see gl_tex.h).
+ *
+ * Each kernel has a scalar implementation and, where it pays off, SSE2 and NEON
+ * implementations. The instruction set is chosen at runtime according to what the
+ * CPU supports. Large images are processed in bands of rows on the TaskPool.
+ *
+ * All implementations produce output that is bit-for-bit identical to the scalar
+ * one, including its quirks. Kernels whose arithmetic could be contracted into
+ * fused multiply-adds by the compiler are only vectorized for SSE2.
+ */
+namespace texfilter {
+
+enum InstructionSet { Scalar, SSE2, NEON };
+
+/**
+ * Returns the best instruction set supported by the CPU.
+ */
+InstructionSet availableInstructionSet();
+
+/**
+ * Returns the instruction set currently used by the kernels.
+ */
+InstructionSet instructionSet();
+
+/**
+ * Changes the instruction set used by the kernels. If the CPU does not support
+ * @a isa, the scalar implementation is used instead.
+ */
+void setInstructionSet(InstructionSet isa);
+
+const char *instructionSetName(InstructionSet isa);
+
+/**
+ * Enables or disables processing large images concurrently (enabled by default).
+ */
+void setMultithreaded(bool enable);
+
+bool isMultithreaded();
+
+/**
+ * Bilinear magnification or box filter minification of a floating-point image.
+ * This is the resampling step of GL_ScaleBufferEx().
+ */
+void scale(const float *in, int widthIn, int heightIn, int comps,
+           float *out, int widthOut, int heightOut);
+
+/// @see GL_DownMipmap32()
+void downMipmap32(uint8_t *pixels, int width, int height, int comps);
+
+/// @see EqualizeLuma()
+void equalizeLuma(uint8_t *pixels, int width, int height,
+                  float *rBaMul, float *rHiMul, float *rLoMul);
+
+/// @see SharpenPixels()
+void sharpen(uint8_t *pixels, int width, int height, int comps);
+
+/// @see ColorOutlinesIdx()
+void colorOutlinesIdx(uint8_t *pixels, int width, int height);
+
+/// @see ColorOutlinesRGBA()
+void colorOutlinesRGBA(uint8_t *pixels, int width, int height);
+
+} // namespace texfilter
+
+#endif // DE_GL_TEXFILTER_H
@@ -49,10 +49,12 @@ void            Demo_PauseRecording(int playernum);
 void            Demo_ResumeRecording(int playernum);
 void            Demo_WritePacket(int playernum);
 void            Demo_BroadcastPacket(void);
+void            Demo_MapChanged(void);
 void            Demo_ReadLocalCamera(void); // PKT_DEMOCAM
 
 dd_bool         Demo_BeginPlayback(const char* filename);
 dd_bool         Demo_ReadPacket(void);
+dd_bool         Demo_Seek(int tic);
 void            Demo_StopPlayback(void);
 
 #ifdef __cplusplus
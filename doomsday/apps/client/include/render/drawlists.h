@@ -29,11 +29,22 @@ class DrawLists
 public:
     typedef de::List<DrawList *> FoundLists;
 
+    /// Counters for the current frame (since reset()).
+    struct Stats
+    {
+        de::duint finds         = 0; ///< Calls to find() for textured geometry.
+        de::duint memoHits      = 0; ///< Finds resolved without searching.
+        de::duint listsSearched = 0; ///< Candidate lists compared while searching.
+        de::duint listsCreated  = 0;
+    };
+
 public:
     DrawLists();
 
     /**
-     * Locate an appropriate draw list for the given specification.
+     * Locate an appropriate draw list for the given specification. The list
+     * chosen for each distinct specification is remembered until the next
+     * reset(), so repeated writes with the same material skip the search.
      *
      * @param spec  Draw list specification.
      *
@@ -57,6 +68,8 @@ public:
      */
     void reset();
 
+    const Stats &stats() const;
+
     /**
      * All lists will be destroyed.
      */
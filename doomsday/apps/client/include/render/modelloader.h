@@ -46,6 +46,12 @@ public:
 
     void glDeinit();
 
+    /**
+     * Makes the full upload budget available again for preparing models for
+     * drawing. Call this once per frame.
+     */
+    void beginFrame();
+
     /**
      * Looks up the name of a shader based on a GLProgram instance.
      *
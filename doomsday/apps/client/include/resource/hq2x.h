@@ -3,6 +3,7 @@
  *
  * @author Copyright &copy; 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
  * @author Copyright &copy; 2009-2013 Daniel Swanson <danij@dengine.net>
+ * @author Copyright &copy; 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -28,11 +29,6 @@ extern "C" {
 /// @addtogroup resource
 ///@{
 
-/**
- * Initialize the lookup tables used in the hq2x algorithm.
- */
-void GL_InitSmartFilterHQ2x(void);
-
 /**
  * Upscales an image to 2x the original size using an intelligent scaling
  * algorithm that avoids blurriness.
@@ -48,6 +44,8 @@ void GL_InitSmartFilterHQ2x(void);
  * @param width  Width of the source image in pixels.
  * @param height  Height of the source image in pixels.
  * @param flags  @ref imageConversionFlags
+ *
+ * @return  Newly allocated image, or @c NULL if the source image is empty.
  */
 uint8_t *GL_SmartFilterHQ2x(const uint8_t *src, int width, int height, int flags);
 
@@ -0,0 +1,49 @@
+/** @file hqx.h  hq2x smart upscaling filter.
+ *
+ * @ingroup resource
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef DE_RESOURCE_HQX_H
+#define DE_RESOURCE_HQX_H
+
+#include <cstdint>
+
+/**
+ * Reentrant implementation of the hq2x filter (see hq2x.h).
+ *
+ * The image is processed in bands of rows on the TaskPool. The neighbor
+ * comparisons are evaluated with SSE2 or NEON where available. Threading and the
+ * instruction set follow the settings of the texture filter kernels (texfilter.h).
+ */
+namespace hqx {
+
+/**
+ * Upscales an image to twice its size with hq2x.
+ *
+ * @param src     R8G8B8A8 source image.
+ * @param width   Width of the source image in pixels.
+ * @param height  Height of the source image in pixels.
+ * @param wrapH   Neighbors are sampled across the left and right edges.
+ * @param wrapV   Neighbors are sampled across the top and bottom edges.
+ * @param dst     Output image of (width * 2) x (height * 2) pixels.
+ */
+void upscale(const uint8_t *src, int width, int height, bool wrapH, bool wrapV, uint8_t *dst);
+
+} // namespace hqx
+
+#endif // DE_RESOURCE_HQX_H
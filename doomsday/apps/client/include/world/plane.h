@@ -46,7 +46,7 @@ public:
     DE_ERROR(MissingGeneratorError);
 
     /// Notified whenever a @em smoothed height change occurs.
-    DE_DEFINE_AUDIENCE(HeightSmoothedChange, void planeHeightSmoothedChanged(Plane &plane))
+    DE_DEFINE_LIGHT_AUDIENCE(HeightSmoothedChange, void planeHeightSmoothedChanged(Plane &plane))
 
 public:
     Plane(world::Sector &sector, const de::Vec3f &normal = de::Vec3f(0, 0, 1), double height = 0);
@@ -130,6 +130,8 @@ public:
      */
     bool receivesShadow() const;
 
+    de::dsize memoryUsage() const override;
+
 private:
     Generator *tryFindGenerator() const;
     void notifySmoothedHeightChanged();
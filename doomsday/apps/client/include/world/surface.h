@@ -46,7 +46,7 @@ public:
 //- Origin smoothing --------------------------------------------------------------------
 
     /// Notified when the @em sharp material origin changes.
-    DE_DEFINE_AUDIENCE(OriginSmoothedChange, void surfaceOriginSmoothedChanged(Surface &surface))
+    DE_DEFINE_LIGHT_AUDIENCE(OriginSmoothedChange, void surfaceOriginSmoothedChanged(Surface &surface))
 
     void notifyOriginSmoothedChanged();
 
@@ -102,6 +102,8 @@ public:
 
     Map &map() const;
 
+    de::dsize memoryUsage() const override;
+
 private:
     de::Vec2f _oldOrigin[2];                      ///< Old @em sharp surface space material origins, for smoothing.
     de::Vec2f _originSmoothed;                    ///< @em smoothed surface space material origin.
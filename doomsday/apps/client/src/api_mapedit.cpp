@@ -273,6 +273,64 @@ dd_bool MPE_GameObjProperty(const char *entityName, int elementIndex,
     return false;
 }
 
+#undef MPE_GameObjPropertyId
+int MPE_GameObjPropertyId(const char *entityName, const char *propertyName)
+{
+    LOG_AS("MPE_GameObjPropertyId");
+
+    if(!entityName || !propertyName)
+        return -1;
+
+    MapEntityDef *entityDef = P_MapEntityDefByName(entityName);
+    if(!entityDef)
+    {
+        LOG_WARNING("Unknown entity name:\"%s\", ignoring.") << entityName;
+        return -1;
+    }
+
+    const int propIndex = MapEntityDef_PropertyByName(entityDef, propertyName);
+    if(propIndex < 0)
+    {
+        LOG_WARNING("Entity \"%s\" has no \"%s\" property, ignoring.")
+                << entityName << propertyName;
+        return -1;
+    }
+
+    // Both parts are small: entity IDs are the games' MO_* constants and
+    // entities only have a handful of properties.
+    return (entityDef->id << 16) | propIndex;
+}
+
+#undef MPE_GameObjProperties
+dd_bool MPE_GameObjProperties(int propertyId, valuetype_t valueType, int firstIndex,
+                              int count, const void *values)
+{
+    LOG_AS("MPE_GameObjProperties");
+
+    if(propertyId < 0 || count <= 0 || !values)
+        return false;
+
+    MapEntityDef *entityDef = P_MapEntityDef(propertyId >> 16);
+    const uint propIndex = uint(propertyId & 0xffff);
+    if(!entityDef || propIndex >= entityDef->numProps)
+    {
+        LOG_WARNING("Invalid property identifier %x, ignoring.") << propertyId;
+        return false;
+    }
+
+    try
+    {
+        EntityDatabase &entities = editMap->entityDatabase();
+        entities.setProperties(&entityDef->props[propIndex], firstIndex, count, valueType, values);
+        return true;
+    }
+    catch(const Error &er)
+    {
+        LOG_WARNING("%s. Ignoring.") << er.asText();
+    }
+    return false;
+}
+
 DE_DECLARE_API(MPE) =
 {
     { DE_API_MAP_EDIT },
@@ -286,5 +344,7 @@ DE_DECLARE_API(MPE) =
     MPE_SectorCreate,
     MPE_PlaneCreate,
     MPE_PolyobjCreate,
-    MPE_GameObjProperty
+    MPE_GameObjProperty,
+    MPE_GameObjPropertyId,
+    MPE_GameObjProperties
 };
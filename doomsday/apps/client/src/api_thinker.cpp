@@ -35,19 +35,14 @@ void Thinker_Init()
     }
 }
 
-static void unlinkThinkerFromList(thinker_t *th)
-{
-    th->next->prev = th->prev;
-    th->prev->next = th->next;
-}
-
 #undef Thinker_Run
 void Thinker_Run()
 {
     /// @todo fixme: Do not assume the current map.
     if (!World::get().hasMap()) return;
 
-    World::get().map().thinkers().forAll(0x1 | 0x2, [](thinker_t *th) {
+    auto &thinkers = World::get().map().thinkers();
+    thinkers.forAll(0x1 | 0x2, [&thinkers](thinker_t *th) {
         try
         {
             if (Thinker_InStasis(th)) return LoopContinue; // Skip.
@@ -55,7 +50,7 @@ void Thinker_Run()
             // Time to remove it?
             if (th->function == thinkfunc_t(-1))
             {
-                unlinkThinkerFromList(th);
+                thinkers.unlink(*th);
 
                 if (th->id)
                 {
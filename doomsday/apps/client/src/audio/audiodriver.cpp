@@ -22,6 +22,7 @@
 
 #include "dd_main.h"
 #include "audio/sys_audiod_dummy.h"
+#include "audio/sys_audiod_softmix.h"
 #ifndef DE_DISABLE_SDLMIXER
 #  include "audio/sys_audiod_sdlmixer.h"
 #endif
@@ -92,6 +93,17 @@ DE_PIMPL(AudioDriver)
         std::memcpy(&iCd,    &audiod_dummy_cd,    sizeof(iCd));
     }
 
+    void getSoftMixInterfaces()
+    {
+        DE_ASSERT(!initialized);
+
+        extension.clear();
+        std::memcpy(&iBase, &audiod_softmix,     sizeof(iBase));
+        std::memcpy(&iSfx,  &audiod_softmix_sfx, sizeof(iSfx));
+        zap(iMusic);
+        zap(iCd);
+    }
+
 #ifndef DE_DISABLE_SDLMIXER
     void getSdlMixerInterfaces()
     {
@@ -222,6 +234,11 @@ void AudioDriver::load(const String &identifier)
         d->getDummyInterfaces();
         return;
     }
+    if (!identifier.compareWithoutCase("softmix"))
+    {
+        d->getSoftMixInterfaces();
+        return;
+    }
 #ifndef DE_DISABLE_SDLMIXER
     if (!identifier.compareWithoutCase("sdlmixer"))
     {
@@ -288,6 +305,7 @@ String AudioDriver::extensionName() const
 bool AudioDriver::isAvailable(const String &identifier)
 {
     if (identifier == "dummy") return true;
+    if (identifier == "softmix") return true;
 #ifndef DE_DISABLE_SDLMIXER
     if (identifier == "sdlmixer") return true;
 #else
@@ -365,7 +383,8 @@ String AudioDriver_GetName(audiodriverid_t id)
         /* AUDIOD_FMOD */       "FMOD",
         /* AUDIOD_FLUIDSYNTH */ "FluidSynth",
         /* AUDIOD_DSOUND */     "DirectSound",        // Win32 only
-        /* AUDIOD_WINMM */      "Windows Multimedia"  // Win32 only
+        /* AUDIOD_WINMM */      "Windows Multimedia", // Win32 only
+        /* AUDIOD_SOFTMIX */    "SoftMix"
     };
     if(VALID_AUDIODRIVER_IDENTIFIER(id))
         return audioDriverNames[id];
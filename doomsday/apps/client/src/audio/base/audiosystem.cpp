@@ -23,6 +23,7 @@
 #include "audio/audiosystem.h"
 
 #include "dd_share.h"      // SF_* flags
+#include "dd_def.h"        // gx
 #include "dd_main.h"       // ::isDedicated
 #include "def_main.h"      // ::defs
 #include <doomsday/api_map.h>
@@ -34,6 +35,7 @@
 #  include "audio/m_mus2midi.h"
 #  include "audio/sfxchannel.h"
 #  include "audio/sys_audiod_dummy.h"
+#  include "audio/sys_audiod_softmix.h"
 #  include "world/audioenvironment.h"
 #  include "world/subsector.h"
 #  include <doomsday/defs/music.h>
@@ -64,6 +66,7 @@
 #include <de/legacy/memory.h>
 
 #include <de/hash.h>
+#include <de/set.h>
 
 using namespace de;
 using namespace res;
@@ -117,7 +120,8 @@ static const char *driverIdentifier[AUDIODRIVER_COUNT] = {
     "fmod",
     "fluidsynth",
     "dsound",
-    "winmm"
+    "winmm",
+    "softmix"
 };
 
 static audiodriverid_t identifierToDriverId(String name)
@@ -220,6 +224,9 @@ DE_PIMPL(AudioSystem)
         if (cmdLine.has("-dummy"))
             return AUDIOD_DUMMY;
 
+        if (cmdLine.has("-softmix") || cmdLine.has("-softmix-render") || cmdLine.has("-softmix-offline"))
+            return AUDIOD_SOFTMIX;
+
         if (cmdLine.has("-fmod"))
             return AUDIOD_FMOD;
 
@@ -269,6 +276,7 @@ DE_PIMPL(AudioSystem)
             case AUDIOD_OPENAL:
             case AUDIOD_FMOD:
             case AUDIOD_FLUIDSYNTH:
+            case AUDIOD_SOFTMIX:
                 driver.load(idStr);
                 break;
 #ifndef DE_DISABLE_SDLMIXER
@@ -2500,6 +2508,27 @@ void AudioSystem::worldMapChanged()
 {
     // Update who is listening now.
     setSfxListener(S_GetListenerMobj());
+
+    // Convert the sounds of the things in the map now rather than when they are
+    // first heard.
+    if (sfxIsAvailable() && world::World::get().hasMap())
+    {
+        Set<dint> soundIds;
+        const auto &thinkers = world::World::get().map().thinkers();
+        thinkers.forAll(reinterpret_cast<thinkfunc_t>(gx.MobjThinker), 0x1, [&soundIds] (thinker_t *th)
+        {
+            if (const mobjinfo_t *info = reinterpret_cast<mobj_t *>(th)->info)
+            {
+                for (dint id : {info->seeSound, info->attackSound, info->painSound,
+                                info->deathSound, info->activeSound})
+                {
+                    if (id > 0) soundIds << id;
+                }
+            }
+            return LoopContinue;
+        });
+        d->sfxSampleCache.precache(compose<List<dint>>(soundIds.begin(), soundIds.end()));
+    }
 }
 #endif
 
@@ -2700,6 +2729,8 @@ void AudioSystem::consoleRegister()  // static
 
     C_CMD("reverbparams", "ffff", ReverbParameters);
 
+    DS_SoftMix_ConsoleRegister();
+
     // Debug:
     C_VAR_INT     ("sound-info",          &showSoundInfo,         0, 0, 1);
 #endif
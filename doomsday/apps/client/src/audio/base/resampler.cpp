@@ -0,0 +1,201 @@
+/** @file resampler.cpp  Band-limited sample rate conversion.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "audio/resampler.h"
+
+#include <de/math.h>
+#include <cmath>
+#include <vector>
+
+using namespace de;
+
+namespace audio {
+
+/// Maximum number of filter phases. Ratios needing more are rounded to the nearest phase.
+static const dint RESAMPLER_MAX_PHASES = 1024;
+
+/// Filter half-width in source samples when the rate is not reduced.
+static const dint RESAMPLER_HALF_WIDTH = 8;
+
+/// Passband edge relative to the Nyquist frequency; leaves room for the transition band.
+static const ddouble RESAMPLER_CUTOFF = 0.91;
+
+static inline dfloat resamplerInput(const void *src, dint bytesPer, dint index)
+{
+    if (bytesPer == 1)
+    {
+        return (dint(static_cast<const duint8 *>(src)[index]) - 0x80) / 128.f;
+    }
+    return static_cast<const dint16 *>(src)[index] / 32768.f;
+}
+
+static inline void resamplerOutput(void *dst, dint bytesPer, dint index, dfloat value)
+{
+    if (bytesPer == 1)
+    {
+        const dint v = dint(std::lround(value * 128.f)) + 0x80;
+        static_cast<duint8 *>(dst)[index] = duint8(de::clamp(0, v, 255));
+    }
+    else
+    {
+        const dint v = dint(std::lround(value * 32768.f));
+        static_cast<dint16 *>(dst)[index] = dint16(de::clamp(-32768, v, 32767));
+    }
+}
+
+DE_PIMPL_NOREF(Resampler)
+{
+    dint srcRate;
+    dint dstRate;
+    dint64 up   = 1;  ///< Output samples per @a down input samples.
+    dint64 down = 1;
+    dint phases = 1;
+    dint half   = RESAMPLER_HALF_WIDTH;
+    dint taps   = 2 * RESAMPLER_HALF_WIDTH; ///< Always a multiple of four.
+    std::vector<dfloat> bank;     ///< phases * taps coefficients.
+
+    Impl(dint srcRate, dint dstRate) : srcRate(srcRate), dstRate(dstRate)
+    {
+        DE_ASSERT(srcRate > 0 && dstRate > 0);
+
+        dint g = srcRate;
+        for (dint r = dstRate; r; )
+        {
+            const dint t = g % r;
+            g = r;
+            r = t;
+        }
+        up   = dstRate / g;
+        down = srcRate / g;
+        if (up == down) return;
+
+        phases = dint(de::min(up, dint64(RESAMPLER_MAX_PHASES)));
+
+        // When reducing the rate, the filter must be wider to reach a lower cutoff.
+        const ddouble scale = de::min(1.0, ddouble(dstRate) / ddouble(srcRate));
+        half = dint(std::ceil(RESAMPLER_HALF_WIDTH / scale));
+        taps = (2 * half + 3) & ~3;
+        half = taps / 2;
+
+        const ddouble fc = scale * RESAMPLER_CUTOFF;
+        bank.resize(std::size_t(phases) * taps);
+        for (dint p = 0; p < phases; ++p)
+        {
+            dfloat *h = &bank[std::size_t(p) * taps];
+            const ddouble frac = ddouble(p) / phases;
+            ddouble sum = 0;
+            for (dint k = 0; k < taps; ++k)
+            {
+                // Distance from the output position to source sample (i - half + 1 + k).
+                const ddouble x = (k - half + 1) - frac;
+                const ddouble t = x / half;
+                ddouble value = 0;
+                if (std::abs(t) < 1)
+                {
+                    const ddouble window = 0.42 + 0.5 * std::cos(PI * t) + 0.08 * std::cos(2 * PI * t);
+                    const ddouble arg    = PI * fc * x;
+                    const ddouble sinc   = (std::abs(arg) < 1.0e-9 ? 1.0 : std::sin(arg) / arg);
+                    value = fc * sinc * window;
+                }
+                h[k] = dfloat(value);
+                sum += value;
+            }
+            // Unity gain at DC for every phase.
+            for (dint k = 0; k < taps; ++k) h[k] = dfloat(h[k] / sum);
+        }
+    }
+
+    /**
+     * Filters the padded input at the given position. Written with four independent
+     * accumulators so that compilers can keep the loop in vector registers on
+     * any architecture.
+     */
+    static inline dfloat convolve(const dfloat *x, const dfloat *h, dint taps)
+    {
+        dfloat a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+        for (dint k = 0; k < taps; k += 4)
+        {
+            a0 += x[k]     * h[k];
+            a1 += x[k + 1] * h[k + 1];
+            a2 += x[k + 2] * h[k + 2];
+            a3 += x[k + 3] * h[k + 3];
+        }
+        return (a0 + a1) + (a2 + a3);
+    }
+};
+
+Resampler::Resampler(dint srcRate, dint dstRate)
+    : d(new Impl(srcRate, dstRate))
+{}
+
+dint Resampler::srcRate() const
+{
+    return d->srcRate;
+}
+
+dint Resampler::dstRate() const
+{
+    return d->dstRate;
+}
+
+dint Resampler::outputLength(dint srcNumSamples) const
+{
+    return dint((dint64(srcNumSamples) * d->up + d->down - 1) / d->down);
+}
+
+void Resampler::process(void *dst, dint dstBytesPer,
+                        const void *src, dint srcBytesPer, dint srcNumSamples) const
+{
+    DE_ASSERT(dst && src);
+    DE_ASSERT(dstBytesPer == 1 || dstBytesPer == 2);
+    DE_ASSERT(srcBytesPer == 1 || srcBytesPer == 2);
+
+    if (d->up == d->down)
+    {
+        // Only the sample format may change.
+        for (dint i = 0; i < srcNumSamples; ++i)
+        {
+            resamplerOutput(dst, dstBytesPer, i, resamplerInput(src, srcBytesPer, i));
+        }
+        return;
+    }
+
+    // Convert the input to floating point, with silence around it so the filter
+    // never reads outside the buffer.
+    const dint taps = d->taps;
+    std::vector<dfloat> input(std::size_t(srcNumSamples + taps + 1), 0.f);
+    for (dint i = 0; i < srcNumSamples; ++i)
+    {
+        input[std::size_t(d->half - 1 + i)] = resamplerInput(src, srcBytesPer, i);
+    }
+
+    const dint count = outputLength(srcNumSamples);
+    for (dint n = 0; n < count; ++n)
+    {
+        const dint64 pos   = dint64(n) * d->down;
+        const dint64 whole = pos / d->up;
+        const dint64 rem   = pos % d->up;
+        const dint   phase = dint(d->phases == d->up ? rem : rem * d->phases / d->up);
+
+        const dfloat *x = &input[std::size_t(whole)];
+        const dfloat *h = &d->bank[std::size_t(phase) * taps];
+        resamplerOutput(dst, dstBytesPer, n, Impl::convolve(x, h, taps));
+    }
+}
+
+}  // namespace audio
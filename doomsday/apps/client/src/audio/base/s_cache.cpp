@@ -23,11 +23,15 @@
 #include "dd_main.h"  // App_AudioSystem()
 #include "def_main.h"  // Def_Get*()
 #include "audio/audiosystem.h"
+#include "audio/resampler.h"
 
 #include <doomsday/filesys/fs_main.h>
 #include <doomsday/wav.h>
 #include <de/legacy/timer.h>
+#include <de/taskpool.h>
+#include <de/time.h>
 #include <cstring>
+#include <vector>
 
 using namespace de;
 using namespace res;
@@ -51,229 +55,80 @@ static const dint MAX_CACHE_KB     = 4096;
 // Even one minute of silence is quite a long time during gameplay.
 static const dint MAX_CACHE_TICS   = TICSPERSEC * 60 * 4;  // 4 minutes.
 
-#if 0
 /**
- * Determines the necessary upsample factor for the given sample @a rate.
+ * Sample data loaded from a file or a lump, waiting to be converted to the format
+ * it will be cached in.
  */
-static dint upsampleFactor(dint rate)
+struct SourceSample
 {
-    dint factor = 1;
-#ifdef __CLIENT__
-    // The (up)sampling factor.
-    if (App_AudioSystem().mustUpsampleToSfxRate())
-    {
-        factor = de::max(1, ::sfxRate / rate);
-    }
-#else
-    DE_UNUSED(rate);
-#endif
-    return factor;
-}
+    dint soundId    = 0;
+    dint group      = 0;
+    Block data;
+    dint numSamples = 0;
+    dint bytesPer   = 0;
+    dint rate       = 0;
 
-// Utility for converting an unsigned byte to signed short (for resampling).
-static dshort inline U8_S16(duchar b)
-{
-    return (b - 0x80) << 8;
-}
+    // Format of the cached sample.
+    dint cachedBytesPer = 0;
+    dint cachedRate     = 0;
+};
 
 /**
- * Simple linear resampling with possible conversion to 16 bits. The destination sample
- * must be initialized and it must have a large enough buffer. We won't reduce rate or
- * bits here.
- *
- * @note This is not a clean way to resample a sound. If you read about DSP a bit, you'll
- * find out that interpolation adds a lot of extra frequencies in the sample. It should
- * be low-pass filtered after the interpolation.
+ * Determines the format the sample will be cached in. Sounds are resampled upwards to
+ * the minimum resolution and bits (specified in the user Config), if the driver needs
+ * it. (You can play higher resolution sounds than the current setting, but not lower
+ * resolution ones.)
  */
-static void resample(void *dst, dint dstBytesPer, dint dstRate, const void *src,
-    dint srcBytesPer, dint srcRate, dint srcNumSamples, duint srcSize)
+static void chooseCachedFormat(SourceSample &src)
 {
-    DE_ASSERT(src && dst);
-
-    // Let's first check for the easy cases.
-    if (dstRate == srcRate)
-    {
-        if (srcBytesPer == dstBytesPer)
-        {
-            // A simple copy will suffice.
-            std::memcpy(dst, src, srcSize);
-        }
-        else if (srcBytesPer == 1 && dstBytesPer == 2)
-        {
-            // Just changing the bytes won't do much good...
-            const duchar *sp = (const duchar *) src;
-            dshort *dp       = (dshort *) dst;
+    src.cachedBytesPer = src.bytesPer;
+    src.cachedRate     = src.rate;
 
-            for (dint i = 0; i < srcNumSamples; ++i)
-            {
-                *dp++ = (*sp++ - 0x80) << 8;
-            }
-        }
-        return;
-    }
-
-    // 2x resampling.
-    if (dstRate == 2 * srcRate)
+#ifdef __CLIENT__
+    // We won't reduce the rate here.
+    if (App_AudioSystem().mustUpsampleToSfxRate() && src.rate < ::sfxRate)
     {
-        if (dstBytesPer == 1)
-        {
-            // The source has a byte per sample as well.
-            const duchar *sp = (const duchar *) src;
-            duchar *dp       = (duchar *) dst;
-
-            for (dint i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                *dp++ = *sp;
-                *dp++ = (*sp + sp[1]) >> 1;
-            }
-
-            // Fill in the last two as well.
-            dp[0] = dp[1] = *sp;
-        }
-        else if (srcBytesPer == 1)
-        {
-            // Destination is signed 16bit. Source is 8bit.
-            const duchar *sp = (const duchar *) src;
-            dshort *dp       = (dshort *) dst;
-
-            for (dint i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                const dshort first = U8_S16(*sp);
-
-                *dp++ = first;
-                *dp++ = (first + U8_S16(sp[1])) >> 1;
-            }
-
-            // Fill in the last two as well.
-            dp[0] = dp[1] = U8_S16(*sp);
-        }
-        else if (srcBytesPer == 2)
-        {
-            // Destination is signed 16bit. Source is 16bit.
-            const dshort *sp = (const dshort *) src;
-            dshort *dp       = (dshort *) dst;
-
-            for (dint i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                *dp++ = *sp;
-                *dp++ = (*sp + sp[1]) >> 1;
-            }
-
-            dp[0] = dp[1] = *sp;
-        }
-        return;
+        src.cachedRate = ::sfxRate;
     }
+#endif
 
-    // 4x resampling (11Khz => 44KHz only).
-    if (dstRate == 4 * srcRate)
+    // Resample to 16bit?
+    if (::sfxBits == 16 && src.bytesPer == 1)
     {
-        if (dstBytesPer == 1)
-        {
-            // The source has a byte per sample as well.
-            const duchar *sp = (const duchar *) src;
-            duchar *dp       = (duchar *) dst;
-
-            for (dint i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                const duchar mid = (*sp + sp[1]) >> 1;
-
-                *dp++ = *sp;
-                *dp++ = (*sp + mid) >> 1;
-                *dp++ = mid;
-                *dp++ = (mid + sp[1]) >> 1;
-            }
-
-            // Fill in the last four as well.
-            dp[0] = dp[1] = dp[2] = dp[3] = *sp;
-        }
-        else if (srcBytesPer == 1)
-        {
-            // Destination is signed 16bit. Source is 8bit.
-            const duchar *sp = (const duchar *) src;
-            dshort *dp       = (dshort *) dst;
-
-            for (int i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                const dshort first = U8_S16(*sp);
-                const dshort last  = U8_S16(sp[1]);
-                const dshort mid   = (first + last) >> 1;
-
-                *dp++ = first;
-                *dp++ = (first + mid) >> 1;
-                *dp++ = mid;
-                *dp++ = (mid + last) >> 1;
-            }
-
-            // Fill in the last four as well.
-            dp[0] = dp[1] = dp[2] = dp[3] = U8_S16(*sp);
-        }
-        else if (srcBytesPer == 2)
-        {
-            // Destination is signed 16bit. Source is 16bit.
-            const dshort *sp = (const dshort *) src;
-            dshort *dp       = (dshort *) dst;
-
-            for (dint i = 0; i < srcNumSamples - 1; ++i, sp++)
-            {
-                const dshort mid = (*sp + sp[1]) >> 1;
-
-                *dp++ = *sp;
-                *dp++ = (*sp + mid) >> 1;
-                *dp++ = mid;
-                *dp++ = (mid + sp[1]) >> 1;
-            }
-
-            // Fill in the last four as well.
-            dp[0] = dp[1] = dp[2] = dp[3] = *sp;
-        }
+        src.cachedBytesPer = 2;
     }
 }
-#endif
 
 /**
- * Prepare the given sound sample @a smp for caching.
- *
- * If the sample @a data is already in the right format, just make a copy of it.
+ * Converts the @a src sample data to its cached format and writes it to a (M_Malloc()
+ * allocated) buffer in @a smp (ownership is given to the sfxsample_t). If the data is
+ * already in the right format, just makes a copy of it.
  *
- * If necessary, resample the sound @a data upwards to the minimum resolution and
- * bits (specified in the user Config). (You can play higher resolution sounds
- * than the current setting, but not lower resolution ones.)
- *
- * Converts the sample @a data and writes it to the (M_Malloc() allocated) buffer in @a smp
- * (ownership is given to the sfxsample_t).
- *
- * @param data        Actual sample data.
- * @param size        Size in bytes.
- * @param numSamples  Number of samples.
- * @param bytesPer    Bytes per sample (1 or 2).
- * @param rate        Samples per second.
+ * This does not access the cache or the file system, so it can be done in a
+ * background thread.
  */
-void configureSample(sfxsample_t &smp, const void *data, duint size,
-                     dint numSamples, dint bytesPer, dint rate)
+static void convertSample(sfxsample_t &smp, const SourceSample &src)
 {
-    DE_UNUSED(data);
-    DE_UNUSED(size);
-
     zap(smp);
-    smp.bytesPer   = bytesPer;
-    smp.size       = numSamples * bytesPer;
-    smp.rate       = rate;
-    smp.numSamples = numSamples;
-
-#if 0
-    // Apply the upsample factor.
-    const dint rsfactor = upsampleFactor(rate);
-    smp.rate       *= rsfactor;
-    smp.numSamples *= rsfactor;
-    smp.size       *= rsfactor;
+    smp.id       = src.soundId;
+    smp.group    = src.group;
+    smp.bytesPer = src.cachedBytesPer;
+    smp.rate     = src.cachedRate;
 
-    // Resample to 16bit?
-    if (::sfxBits == 16 && smp.bytesPer == 1)
+    if (smp.rate == src.rate && smp.bytesPer == src.bytesPer)
     {
-        smp.bytesPer = 2;
-        smp.size     *= 2;
+        smp.numSamples = src.numSamples;
+        smp.size       = duint(src.data.size());
+        smp.data       = M_Malloc(smp.size);
+        std::memcpy(smp.data, src.data.data(), smp.size);
+        return;
     }
-#endif
+
+    const Resampler resampler(src.rate, smp.rate);
+    smp.numSamples = resampler.outputLength(src.numSamples);
+    smp.size       = smp.numSamples * smp.bytesPer;
+    smp.data       = M_Malloc(smp.size);
+    resampler.process(smp.data, smp.bytesPer, src.data.data(), src.bytesPer, src.numSamples);
 }
 
 SfxSampleCache::CacheItem::CacheItem()
@@ -401,33 +256,26 @@ DE_PIMPL(SfxSampleCache)
         delete &item;
     }
     /**
-     * Caches a copy of the given sample. If it's already in the cache and has the
-     * same format, nothing is done.
+     * Caches the given converted sample. If a sample with the same ID and format is
+     * already in the cache, nothing is done.
      *
-     * @param soundId       Id number of the sound sample.
-     * @param data          Actual sample data.
-     * @param size          Size in bytes.
-     * @param numSamples    Number of samples.
-     * @param bytesPer      Bytes per sample (1 or 2).
-     * @param rate          Samples per second.
-     * @param group         Exclusion group (0, if none).
+     * @param cached  Converted sample. Ownership of the data is taken.
      *
-     * @returns             Ptr to the cached sample. Always valid.
+     * @returns  The cache item of the sample. Always valid.
      */
-    CacheItem &insert(dint soundId, const void *data, duint size, dint numSamples,
-        dint bytesPer, dint rate, dint group)
+    CacheItem &insert(sfxsample_t &cached)
     {
-        sfxsample_t cached;
-        configureSample(cached, data, size, numSamples, bytesPer, rate);
-
         // Have we already cached a comparable sample?
-        CacheItem *item = tryFind(soundId);
+        CacheItem *item = tryFind(cached.id);
         if (item)
         {
             // A sample is already in the cache.
             // If the existing sample is in the same format - use it.
-            if (cached.bytesPer * 8 == ::sfxBits && cached.rate == ::sfxRate)
+            if (item->sample.bytesPer == cached.bytesPer && item->sample.rate == cached.rate)
+            {
+                M_Free(cached.data);
                 return *item;
+            }
 
             // Sample format differs - uncache it (we'll reuse this CacheItem).
             notifyRemove(*item);
@@ -435,27 +283,164 @@ DE_PIMPL(SfxSampleCache)
         else
         {
             // Add a new CacheItem for the sample.
-            item = &insertCacheItem(soundId);
+            item = &insertCacheItem(cached.id);
         }
 
-        // Attribute the sample with tracking identifiers.
-        cached.id    = soundId;
-        cached.group = group;
-
-#if 0
-        // Perform resampling if necessary.
-        resample(cached.data = M_Malloc(cached.size), cached.bytesPer, cached.rate,
-                 data, bytesPer, rate, numSamples, size);
-#endif
-        cached.data = M_Malloc(cached.size);
-        std::memcpy(cached.data, data, size);
-
         // Replace the cached sample.
         item->replaceSample(cached);
 
         return *item;
     }
 
+    /**
+     * Loads the sample data of a sound. It might be from a data file such as a WAD or
+     * external sound resources. The definition and the configuration settings will
+     * help us in making the decision.
+     *
+     * @return @c true if the sample was loaded into @a src.
+     */
+    bool load(dint soundId, SourceSample &src)
+    {
+        // Lookup info for this sound.
+        sfxinfo_t *info = Def_GetSoundInfo(soundId, 0, 0);
+        if (!info)
+        {
+            LOG_AUDIO_WARNING("Ignoring sound id:%i (missing sfxinfo_t)") << soundId;
+            return false;
+        }
+
+        LOG_AUDIO_VERBOSE("Caching sample '%s' (id:%i)...") << info->id << soundId;
+
+        src.soundId = soundId;
+        src.group   = info->group;
+
+        dint bytesPer = 0;
+        dint rate = 0;
+        dint numSamples = 0;
+        void *data = nullptr;
+
+        /// Has an external sound file been defined?
+        /// @note Path is relative to the base path.
+        if (!Str_IsEmpty(&info->external))
+        {
+            String searchPath = App_BasePath() / String(Str_Text(&info->external));
+            // Try loading.
+            data = WAV_Load(searchPath, &bytesPer, &rate, &numSamples);
+            if (data)
+            {
+                bytesPer /= 8; // Was returned as bits.
+            }
+        }
+
+        // If external didn't succeed, let's try the default resource dir.
+        if (!data)
+        {
+            /**
+             * If the sound has an invalid lumpname, search external anyway. If the
+             * original sound is from a PWAD, we won't look for an external resource
+             * (probably a custom sound).
+             *
+             * @todo should be a cvar.
+             */
+            if (info->lumpNum < 0 || !App_FileSystem().lump(info->lumpNum).container().hasCustom())
+            {
+                try
+                {
+                    String foundPath = App_FileSystem().findPath(res::Uri(info->lumpName, RC_SOUND),
+                                                                 RLF_DEFAULT, App_ResourceClass(RC_SOUND));
+                    foundPath = App_BasePath() / foundPath;  // Ensure the path is absolute.
+
+                    data = WAV_Load(foundPath, &bytesPer, &rate, &numSamples);
+                    if (data)
+                    {
+                        // Loading was successful.
+                        bytesPer /= 8;  // Was returned as bits.
+                    }
+                }
+                catch (const FS1::NotFoundError &)
+                {}  // Ignore this error.
+            }
+        }
+
+        // No sample loaded yet?
+        if (!data)
+        {
+            // Try loading from the lump.
+            if (info->lumpNum < 0)
+            {
+                LOG_AUDIO_WARNING("Failed to locate lump resource '%s' for sample '%s'")
+                    << info->lumpName << info->id;
+                return false;
+            }
+
+            File1 &lump = App_FileSystem().lump(info->lumpNum);
+            if (lump.size() <= 8) return false;
+
+            char hdr[12];
+            lump.read((duint8 *)hdr, 0, 12);
+
+            // Is this perhaps a WAV sound?
+            if (WAV_CheckFormat(hdr))
+            {
+                // Load as WAV, then.
+                const duint8 *sp = lump.cache();
+                data = WAV_MemoryLoad((const byte *) sp, lump.size(), &bytesPer, &rate, &numSamples);
+                lump.unlock();
+
+                if (!data)
+                {
+                    // Abort...
+                    LOG_AUDIO_WARNING("Unknown WAV format in lump '%s'") << info->lumpName;
+                    return false;
+                }
+
+                bytesPer /= 8;
+            }
+        }
+
+        if (data)  // Loaded!
+        {
+            src.data       = Block(data, bytesPer * numSamples);
+            src.numSamples = numSamples;
+            src.bytesPer   = bytesPer;
+            src.rate       = rate;
+            Z_Free(data);
+            chooseCachedFormat(src);
+            return true;
+        }
+
+        // Probably an old-fashioned DOOM sample.
+        if (info->lumpNum >= 0)
+        {
+            File1 &lump = App_FileSystem().lump(info->lumpNum);
+
+            if (lump.size() > 8)
+            {
+                duint8 hdr[8];
+                lump.read(hdr, 0, 8);
+                dint head  = DD_SHORT(*(const dshort *) (hdr));
+                rate       = DD_SHORT(*(const dshort *) (hdr + 2));
+                numSamples = de::max(0, DD_LONG(*(const dint *) (hdr + 4)));
+                bytesPer   = 1; // 8-bit.
+
+                if (head == 3 && numSamples > 0 && dsize(numSamples) <= lump.size() - 8)
+                {
+                    // The sample data can be used as-is - copy it from the lump cache.
+                    src.data       = Block(lump.cache() + 8, bytesPer * numSamples);  // Skip the header.
+                    src.numSamples = numSamples;
+                    src.bytesPer   = bytesPer;
+                    src.rate       = rate;
+                    lump.unlock();
+                    chooseCachedFormat(src);
+                    return true;
+                }
+            }
+        }
+
+        LOG_AUDIO_WARNING("Unknown lump '%s' sound format") << info->lumpName;
+        return false;
+    }
+
     /**
      * Remove @em all CacheItems and their sample data.
      */
@@ -609,149 +594,58 @@ sfxsample_t *SfxSampleCache::cache(dint soundId)
     if (CacheItem *existing = d->tryFind(soundId))
         return &existing->sample;
 
-    // Lookup info for this sound.
-    sfxinfo_t *info = Def_GetSoundInfo(soundId, 0, 0);
-    if (!info)
-    {
-        LOG_AUDIO_WARNING("Ignoring sound id:%i (missing sfxinfo_t)") << soundId;
-        return nullptr;
-    }
-
     // Attempt to cache this now.
-    LOG_AUDIO_VERBOSE("Caching sample '%s' (id:%i)...") << info->id << soundId;
+    SourceSample src;
+    if (!d->load(soundId, src)) return nullptr;
 
-    dint bytesPer = 0;
-    dint rate = 0;
-    dint numSamples = 0;
+    sfxsample_t cached;
+    convertSample(cached, src);
+    return &d->insert(cached).sample;
+}
 
-    /**
-     * Figure out where to get the sample data for this sound. It might be from a
-     * data file such as a WAD or external sound resources. The definition and the
-     * configuration settings will help us in making the decision.
-     */
-    void *data = nullptr;
+void SfxSampleCache::precache(const List<dint> &soundIds)
+{
+    LOG_AS("SfxSampleCache");
 
-    /// Has an external sound file been defined?
-    /// @note Path is relative to the base path.
-    if (!Str_IsEmpty(&info->external))
-    {
-        String searchPath = App_BasePath() / String(Str_Text(&info->external));
-        // Try loading.
-        data = WAV_Load(searchPath, &bytesPer, &rate, &numSamples);
-        if (data)
-        {
-            bytesPer /= 8; // Was returned as bits.
-        }
-    }
+#ifdef __CLIENT__
+    if (!App_AudioSystem().sfxIsAvailable()) return;
+#endif
 
-    // If external didn't succeed, let's try the default resource dir.
-    if (!data)
-    {
-        /**
-         * If the sound has an invalid lumpname, search external anyway. If the
-         * original sound is from a PWAD, we won't look for an external resource
-         * (probably a custom sound).
-         *
-         * @todo should be a cvar.
-         */
-        if (info->lumpNum < 0 || !App_FileSystem().lump(info->lumpNum).container().hasCustom())
-        {
-            try
-            {
-                String foundPath = App_FileSystem().findPath(res::Uri(info->lumpName, RC_SOUND),
-                                                             RLF_DEFAULT, App_ResourceClass(RC_SOUND));
-                foundPath = App_BasePath() / foundPath;  // Ensure the path is absolute.
+    const Time startedAt;
 
-                data = WAV_Load(foundPath, &bytesPer, &rate, &numSamples);
-                if (data)
-                {
-                    // Loading was successful.
-                    bytesPer /= 8;  // Was returned as bits.
-                }
-            }
-            catch (const FS1::NotFoundError &)
-            {}  // Ignore this error.
-        }
-    }
-
-    // No sample loaded yet?
-    if (!data)
+    // Loading uses the file system, so it is done here.
+    List<SourceSample> sources;
+    for (const dint soundId : soundIds)
     {
-        // Try loading from the lump.
-        if (info->lumpNum < 0)
-        {
-            LOG_AUDIO_WARNING("Failed to locate lump resource '%s' for sample '%s'")
-                << info->lumpName << info->id;
-            return nullptr;
-        }
+        if (soundId <= 0 || d->tryFind(soundId)) continue;
 
-        File1 &lump = App_FileSystem().lump(info->lumpNum);
-        if (lump.size() <= 8) return nullptr;
-
-        char hdr[12];
-        lump.read((duint8 *)hdr, 0, 12);
-
-        // Is this perhaps a WAV sound?
-        if (WAV_CheckFormat(hdr))
+        SourceSample src;
+        if (d->load(soundId, src))
         {
-            // Load as WAV, then.
-            const duint8 *sp = lump.cache();
-            data = WAV_MemoryLoad((const byte *) sp, lump.size(), &bytesPer, &rate, &numSamples);
-            lump.unlock();
-
-            if (!data)
-            {
-                // Abort...
-                LOG_AUDIO_WARNING("Unknown WAV format in lump '%s'") << info->lumpName;
-                return nullptr;
-            }
-
-            bytesPer /= 8;
+            sources << std::move(src);
         }
     }
+    if (sources.isEmpty()) return;
 
-    if (data)  // Loaded!
+    // Resampling is the expensive part; it is done concurrently by the workers.
+    std::vector<sfxsample_t> converted(sources.size());
+    TaskPool::forBatches(sources.sizei(), [&sources, &converted] (int, int begin, int end)
     {
-        // Insert a copy of this into the cache.
-        CacheItem &item = d->insert(soundId, data, bytesPer * numSamples, numSamples,
-                                    bytesPer, rate, info->group);
-        Z_Free(data);
-        return &item.sample;
-    }
-
-    // Probably an old-fashioned DOOM sample.
-    dsize lumpLength = 0;
-    if (info->lumpNum >= 0)
-    {
-        File1 &lump = App_FileSystem().lump(info->lumpNum);
-
-        if (lump.size() > 8)
+        for (int i = begin; i < end; ++i)
         {
-            duint8 hdr[8];
-            lump.read(hdr, 0, 8);
-            dint head  = DD_SHORT(*(const dshort *) (hdr));
-            rate       = DD_SHORT(*(const dshort *) (hdr + 2));
-            numSamples = de::max(0, DD_LONG(*(const dint *) (hdr + 4)));
-            bytesPer   = 1; // 8-bit.
-
-            if (head == 3 && numSamples > 0 && (unsigned) numSamples <= lumpLength - 8)
-            {
-                // The sample data can be used as-is - load directly from the lump cache.
-                const duint8 *data = lump.cache() + 8;  // Skip the header.
-
-                // Insert a copy of this into the cache.
-                CacheItem &item = d->insert(soundId, data, bytesPer * numSamples, numSamples,
-                                            bytesPer, rate, info->group);
-
-                lump.unlock();
-
-                return &item.sample;
-            }
+            convertSample(converted[i], sources[i]);
         }
+    });
+
+    duint totalSize = 0;
+    for (auto &cached : converted)
+    {
+        totalSize += cached.size;
+        d->insert(cached);
     }
 
-    LOG_AUDIO_WARNING("Unknown lump '%s' sound format") << info->lumpName;
-    return nullptr;
+    LOG_AUDIO_VERBOSE("Precached %i samples (%i KB) in %.2f seconds")
+        << sources.sizei() << dint(totalSize / 1024) << ddouble(startedAt.since());
 }
 
 }  // namespace audio
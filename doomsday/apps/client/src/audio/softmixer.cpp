@@ -0,0 +1,212 @@
+/** @file softmixer.cpp  Software mixer of the softmix audio driver.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "audio/softmixer.h"
+
+#include <de/guard.h>
+#include <de/math.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace de;
+
+SoftMixVoice::SoftMixVoice(bool positional, bool repeat)
+    : volume(1), pan(0), pitch(1), minDistance(256), maxDistance(2025)
+    , relative(false), finished(false)
+    , positional(positional), repeat(repeat)
+{
+    for (auto &p : position) p.store(0);
+}
+
+void SoftMixVoice::setSample(const void *samples, dint bytesPer, dint count, dint sampleRate)
+{
+    data.resize(std::size_t(count + 1));
+    if (bytesPer == 1)
+    {
+        const auto *src = static_cast<const duint8 *>(samples);
+        for (dint i = 0; i < count; ++i) data[i] = (dint(src[i]) - 0x80) / 128.f;
+    }
+    else
+    {
+        const auto *src = static_cast<const dint16 *>(samples);
+        for (dint i = 0; i < count; ++i) data[i] = src[i] / 32768.f;
+    }
+    // Interpolation past the last sample wraps around or fades to silence.
+    data[count] = (repeat && count > 0 ? data[0] : 0.f);
+    rate = sampleRate;
+}
+
+dint SoftMixVoice::sampleCount() const
+{
+    return data.empty() ? 0 : dint(data.size()) - 1;
+}
+
+SoftMixListener::SoftMixListener() : yaw(0)
+{
+    for (auto &p : position) p.store(0);
+}
+
+SoftMixer::SoftMixer(dint rate)
+    : outputRate(rate)
+    , mono(SOFTMIX_BLOCK_FRAMES)
+    , left(SOFTMIX_BLOCK_FRAMES)
+    , right(SOFTMIX_BLOCK_FRAMES)
+{}
+
+void SoftMixer::mix(dint16 *out, dint frames)
+{
+    DE_GUARD(this);
+    while (frames > 0)
+    {
+        const dint count = de::min(frames, SOFTMIX_BLOCK_FRAMES);
+        mixBlock(out, count);
+        out    += 2 * count;
+        frames -= count;
+    }
+}
+
+void SoftMixer::targetGains(const SoftMixVoice &voice, dfloat gains[2]) const
+{
+    dfloat volume = voice.volume.load(std::memory_order_relaxed);
+    if (volume < 0)
+    {
+        // Negative volume is attenuation in hundredths of a decibel.
+        volume = std::pow(10.f, volume / 2000.f);
+    }
+    dfloat pan = 0;
+    if (voice.positional)
+    {
+        dfloat delta[3];
+        const bool rel = voice.relative.load(std::memory_order_relaxed);
+        for (int i = 0; i < 3; ++i)
+        {
+            delta[i] = voice.position[i].load(std::memory_order_relaxed) -
+                       (rel ? 0.f : listener.position[i].load(std::memory_order_relaxed));
+        }
+        const dfloat dist = std::sqrt(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+        const dfloat minDist = voice.minDistance.load(std::memory_order_relaxed);
+        const dfloat maxDist = voice.maxDistance.load(std::memory_order_relaxed);
+
+        // Same roll-off as the engine uses for 2D sounds.
+        if (dist >= maxDist)
+        {
+            volume = 0;
+        }
+        else if (dist > minDist)
+        {
+            const dfloat normDist = (dist - minDist) / (maxDist - minDist);
+            volume *= .125f / (.125f + normDist) * (1 - normDist);
+        }
+
+        if (dist > 1)
+        {
+            const dfloat yaw = degreeToRadian(listener.yaw.load(std::memory_order_relaxed));
+            // Component along the listener's right-hand vector.
+            pan = (delta[0] * std::sin(yaw) - delta[1] * std::cos(yaw)) / dist;
+        }
+    }
+    else
+    {
+        pan = voice.pan.load(std::memory_order_relaxed);
+    }
+    pan = de::clamp(-1.f, pan, 1.f);
+    gains[0] = volume * de::min(1.f, 1 - pan);
+    gains[1] = volume * de::min(1.f, 1 + pan);
+}
+
+dint SoftMixer::fetch(SoftMixVoice &voice, dint frames)
+{
+    const duint64 count = duint64(voice.sampleCount()) << 32;
+    const dfloat *src   = voice.data.data();
+    const duint64 step  = duint64(ddouble(voice.pitch.load(std::memory_order_relaxed)) *
+                                  voice.rate / outputRate * 4294967296.0);
+    duint64       pos   = voice.cursor;
+    dint          n     = 0;
+
+    if (count > 0 && step > 0)
+    {
+        while (n < frames)
+        {
+            if (pos >= count)
+            {
+                if (!voice.repeat) break;
+                pos %= count;
+            }
+            // Frames that can be produced before reaching the end of the sample.
+            const dint run = dint(de::min(duint64(frames - n), (count - pos + step - 1) / step));
+            for (dint i = 0; i < run; ++i)
+            {
+                const dint   idx  = dint(pos >> 32);
+                const dfloat frac = dfloat(pos & 0xffffffff) * (1.f / 4294967296.f);
+                mono[n + i] = src[idx] + (src[idx + 1] - src[idx]) * frac;
+                pos += step;
+            }
+            n += run;
+        }
+    }
+    voice.cursor = pos;
+    if (n < frames)
+    {
+        voice.playing = false;
+        voice.finished.store(true);
+    }
+    return n;
+}
+
+void SoftMixer::mixBlock(dint16 *out, dint frames)
+{
+    std::fill(left.begin(),  left.begin()  + frames, 0.f);
+    std::fill(right.begin(), right.begin() + frames, 0.f);
+
+    dfloat *l = left.data();
+    dfloat *r = right.data();
+    const dfloat *m = mono.data();
+
+    for (SoftMixVoice *voice : voices)
+    {
+        if (!voice->playing) continue;
+
+        dfloat target[2];
+        targetGains(*voice, target);
+        if (voice->rampFromZero)
+        {
+            voice->gain[0] = voice->gain[1] = 0;
+            voice->rampFromZero = false;
+        }
+
+        const dint n = fetch(*voice, frames);
+        const dfloat gl = voice->gain[0], dgl = (target[0] - gl) / frames;
+        const dfloat gr = voice->gain[1], dgr = (target[1] - gr) / frames;
+        for (dint i = 0; i < n; ++i)
+        {
+            l[i] += m[i] * (gl + dgl * i);
+            r[i] += m[i] * (gr + dgr * i);
+        }
+        voice->gain[0] = target[0];
+        voice->gain[1] = target[1];
+    }
+
+    for (dint i = 0; i < frames; ++i)
+    {
+        const dfloat sl = de::clamp(-32768.f, l[i] * 32768.f, 32767.f);
+        const dfloat sr = de::clamp(-32768.f, r[i] * 32768.f, 32767.f);
+        out[2 * i]     = dint16(sl);
+        out[2 * i + 1] = dint16(sr);
+    }
+}
@@ -0,0 +1,522 @@
+/** @file sys_audiod_softmix.cpp  Built-in software mixing audio driver.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "de_base.h"
+#include "audio/sys_audiod_softmix.h"
+#include "audio/softmixer.h"
+#include "dd_loop.h"  // gameTime
+
+#include <doomsday/console/cmd.h>
+#include <de/commandline.h>
+#include <de/fixedbytearray.h>
+#include <de/guard.h>
+#include <de/legacy/concurrency.h>
+#include <de/list.h>
+#include <de/math.h>
+#include <de/nativefile.h>
+#include <de/nativepath.h>
+#include <de/time.h>
+#include <de/writer.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace de;
+
+int  DS_SoftMixInit(void);
+void DS_SoftMixShutdown(void);
+void DS_SoftMixEvent(int type);
+
+int          DS_SoftMix_SFX_Init(void);
+sfxbuffer_t *DS_SoftMix_SFX_CreateBuffer(int flags, int bits, int rate);
+void         DS_SoftMix_SFX_DestroyBuffer(sfxbuffer_t *buf);
+void         DS_SoftMix_SFX_Load(sfxbuffer_t *buf, struct sfxsample_s *sample);
+void         DS_SoftMix_SFX_Reset(sfxbuffer_t *buf);
+void         DS_SoftMix_SFX_Play(sfxbuffer_t *buf);
+void         DS_SoftMix_SFX_Stop(sfxbuffer_t *buf);
+void         DS_SoftMix_SFX_Refresh(sfxbuffer_t *buf);
+void         DS_SoftMix_SFX_Set(sfxbuffer_t *buf, int prop, float value);
+void         DS_SoftMix_SFX_Setv(sfxbuffer_t *buf, int prop, float *values);
+void         DS_SoftMix_SFX_Listener(int prop, float value);
+void         DS_SoftMix_SFX_Listenerv(int prop, float *values);
+int          DS_SoftMix_SFX_Getv(int prop, void *values);
+
+audiodriver_t audiod_softmix = {
+    DS_SoftMixInit,
+    DS_SoftMixShutdown,
+    DS_SoftMixEvent,
+    0
+};
+
+audiointerface_sfx_t audiod_softmix_sfx = {
+    {
+        DS_SoftMix_SFX_Init,
+        DS_SoftMix_SFX_CreateBuffer,
+        DS_SoftMix_SFX_DestroyBuffer,
+        DS_SoftMix_SFX_Load,
+        DS_SoftMix_SFX_Reset,
+        DS_SoftMix_SFX_Play,
+        DS_SoftMix_SFX_Stop,
+        DS_SoftMix_SFX_Refresh,
+        DS_SoftMix_SFX_Set,
+        DS_SoftMix_SFX_Setv,
+        DS_SoftMix_SFX_Listener,
+        DS_SoftMix_SFX_Listenerv,
+        DS_SoftMix_SFX_Getv
+    }
+};
+
+static const dint SOFTMIX_DEFAULT_RATE = 44100;
+
+static SoftMixer *softMixer;
+static bool       softMixOffline;
+static NativePath softMixRenderPath;
+static Block      softMixOutput;      ///< Offline output not yet taken.
+static dint64     softMixFramesDone;  ///< Offline frames rendered so far.
+static thread_t   softMixThread;
+static std::atomic<bool> softMixThreadRunning;
+
+static SoftMixVoice &voiceOf(sfxbuffer_t *buf)
+{
+    DE_ASSERT(buf && buf->ptr);
+    return *static_cast<SoftMixVoice *>(buf->ptr);
+}
+
+/**
+ * Realtime mixing follows the wall clock. The output is discarded because
+ * there is no audio device.
+ */
+static int softMixThreadFunc(void *)
+{
+    std::vector<dint16> scratch(2 * SOFTMIX_BLOCK_FRAMES);
+    const TimeSpan started = TimeSpan::sinceStartOfProcess();
+    dint64 done = 0;
+    while (softMixThreadRunning)
+    {
+        const ddouble elapsed = TimeSpan::sinceStartOfProcess() - started;
+        const dint64 due = dint64(elapsed * softMixer->outputRate);
+        while (done < due)
+        {
+            const dint count = dint(de::min(due - done, dint64(SOFTMIX_BLOCK_FRAMES)));
+            softMixer->mix(scratch.data(), count);
+            done += count;
+        }
+        Thread_Sleep(5);
+    }
+    return 0;
+}
+
+static void softMixRenderTo(Block &dest, dint frames)
+{
+    if (frames <= 0) return;
+    const dsize offset = dest.size();
+    dest.resize(offset + dsize(frames) * 4);
+    softMixer->mix(reinterpret_cast<dint16 *>(dest.data() + offset), frames);
+}
+
+int DS_SoftMixInit(void)
+{
+    if (softMixer) return true; // Already initialized.
+
+    CommandLine &cmdLine = CommandLine::get();
+
+    dint rate = SOFTMIX_DEFAULT_RATE;
+    if (auto arg = cmdLine.check("-softmix-rate", 1))
+    {
+        rate = de::clamp(8000, arg.params.at(0).toInt(), 192000);
+    }
+    softMixRenderPath = NativePath();
+    if (auto arg = cmdLine.check("-softmix-render", 1))
+    {
+        cmdLine.makeAbsolutePath(arg.pos + 1);
+        softMixRenderPath = cmdLine.at(arg.pos + 1);
+    }
+    softMixOffline    = !softMixRenderPath.isEmpty() || cmdLine.has("-softmix-offline");
+    softMixFramesDone = 0;
+    softMixOutput.clear();
+
+    softMixer = new SoftMixer(rate);
+
+    if (!softMixOffline)
+    {
+        softMixThreadRunning = true;
+        softMixThread = Sys_StartThread(softMixThreadFunc, nullptr, nullptr);
+    }
+
+    LOG_AUDIO_NOTE("Software mixer: %i Hz stereo, %s")
+        << rate
+        << (softMixOffline ? "offline rendering" : "realtime");
+    return true;
+}
+
+void DS_SoftMixShutdown(void)
+{
+    if (!softMixer) return;
+
+    if (softMixThread)
+    {
+        softMixThreadRunning = false;
+        Sys_WaitThread(softMixThread, 1000, nullptr);
+        softMixThread = nullptr;
+    }
+
+    if (!softMixRenderPath.isEmpty())
+    {
+        try
+        {
+            std::unique_ptr<NativeFile> file(NativeFile::newStandalone(softMixRenderPath));
+            file->setMode(File::Write | File::Truncate);
+            *file << DS_SoftMix_ComposeWav(softMixOutput, softMixer->outputRate);
+            LOG_AUDIO_MSG("Rendered %.1f seconds of audio to \"%s\"")
+                << ddouble(softMixOutput.size() / 4) / softMixer->outputRate
+                << softMixRenderPath.pretty();
+        }
+        catch (const Error &er)
+        {
+            LOG_AUDIO_ERROR("Failed to write \"%s\": %s") << softMixRenderPath << er.asText();
+        }
+    }
+    softMixOutput.clear();
+
+    delete softMixer;
+    softMixer = nullptr;
+}
+
+/**
+ * In offline mode, the output is rendered up to the current game time at the
+ * end of each frame, after the channels and the listener have been updated.
+ */
+void DS_SoftMixEvent(int type)
+{
+    if (!softMixer || !softMixOffline || type != SFXEV_END) return;
+
+    const dint64 due = dint64(gameTime * softMixer->outputRate);
+    if (due > softMixFramesDone)
+    {
+        softMixRenderTo(softMixOutput, dint(due - softMixFramesDone));
+        softMixFramesDone = due;
+    }
+}
+
+int DS_SoftMix_SFX_Init(void)
+{
+    return softMixer != nullptr;
+}
+
+sfxbuffer_t *DS_SoftMix_SFX_CreateBuffer(int flags, int bits, int rate)
+{
+    auto *buf = (sfxbuffer_t *) Z_Calloc(sizeof(sfxbuffer_t), PU_APPSTATIC, 0);
+
+    buf->bytes = bits / 8;
+    buf->rate  = rate;
+    buf->flags = flags;
+    buf->freq  = rate; // Modified by calls to Set(SFXBP_FREQUENCY).
+
+    auto *voice = new SoftMixVoice((flags & SFXBF_3D) != 0, (flags & SFXBF_REPEAT) != 0);
+    buf->ptr = voice;
+    {
+        DE_GUARD(softMixer);
+        softMixer->voices << voice;
+    }
+    return buf;
+}
+
+void DS_SoftMix_SFX_DestroyBuffer(sfxbuffer_t *buf)
+{
+    if (!buf) return;
+
+    auto *voice = &voiceOf(buf);
+    {
+        DE_GUARD(softMixer);
+        softMixer->voices.removeOne(voice);
+    }
+    delete voice;
+    Z_Free(buf);
+}
+
+void DS_SoftMix_SFX_Load(sfxbuffer_t *buf, struct sfxsample_s *sample)
+{
+    if (!buf || !sample) return;
+
+    if (buf->sample && buf->sample->id == sample->id && !(buf->flags & SFXBF_RELOAD))
+    {
+        return; // Already loaded.
+    }
+
+    // Convert outside the lock; the mixer is only blocked for the swap.
+    SoftMixVoice converted(false, (buf->flags & SFXBF_REPEAT) != 0);
+    converted.setSample(sample->data, sample->bytesPer, sample->numSamples, sample->rate);
+
+    SoftMixVoice &voice = voiceOf(buf);
+    {
+        DE_GUARD(softMixer);
+        voice.data.swap(converted.data);
+        voice.rate    = converted.rate;
+        voice.cursor  = 0;
+        voice.playing = false;
+    }
+
+    buf->sample  = sample;
+    buf->written = sample->size;
+    buf->flags  &= ~SFXBF_RELOAD;
+}
+
+void DS_SoftMix_SFX_Reset(sfxbuffer_t *buf)
+{
+    if (!buf) return;
+
+    DS_SoftMix_SFX_Stop(buf);
+    {
+        DE_GUARD(softMixer);
+        voiceOf(buf).data.clear();
+    }
+    buf->sample = nullptr;
+    buf->flags &= ~SFXBF_RELOAD;
+}
+
+void DS_SoftMix_SFX_Play(sfxbuffer_t *buf)
+{
+    // Playing is quite impossible without a sample.
+    if (!buf || !buf->sample) return;
+
+    SoftMixVoice &voice = voiceOf(buf);
+    {
+        DE_GUARD(softMixer);
+        if (!voice.playing)
+        {
+            voice.cursor       = 0;
+            voice.rampFromZero = true;
+            voice.playing      = true;
+        }
+        voice.finished = false;
+    }
+    buf->flags |= SFXBF_PLAYING;
+}
+
+void DS_SoftMix_SFX_Stop(sfxbuffer_t *buf)
+{
+    if (!buf) return;
+
+    SoftMixVoice &voice = voiceOf(buf);
+    {
+        DE_GUARD(softMixer);
+        voice.playing = false;
+    }
+    buf->flags &= ~SFXBF_PLAYING;
+}
+
+/**
+ * Called by the Sfx refresh thread. Notices when the mixer has reached the end
+ * of a non-repeating sample.
+ */
+void DS_SoftMix_SFX_Refresh(sfxbuffer_t *buf)
+{
+    if (!buf || !(buf->flags & SFXBF_PLAYING)) return;
+
+    if (voiceOf(buf).finished.exchange(false))
+    {
+        buf->flags &= ~SFXBF_PLAYING;
+    }
+}
+
+void DS_SoftMix_SFX_Set(sfxbuffer_t *buf, int prop, float value)
+{
+    if (!buf) return;
+
+    SoftMixVoice &voice = voiceOf(buf);
+    switch (prop)
+    {
+    case SFXBP_VOLUME:       voice.volume.store(value, std::memory_order_relaxed); break;
+    case SFXBP_PAN:          voice.pan.store(value, std::memory_order_relaxed); break;
+    case SFXBP_MIN_DISTANCE: voice.minDistance.store(value, std::memory_order_relaxed); break;
+    case SFXBP_MAX_DISTANCE: voice.maxDistance.store(value, std::memory_order_relaxed); break;
+    case SFXBP_RELATIVE_MODE: voice.relative.store(value != 0, std::memory_order_relaxed); break;
+
+    case SFXBP_FREQUENCY:
+        voice.pitch.store(value, std::memory_order_relaxed);
+        buf->freq = buf->rate * value;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * Positions are in map space. Velocity (i.e., Doppler) is not simulated.
+ */
+void DS_SoftMix_SFX_Setv(sfxbuffer_t *buf, int prop, float *values)
+{
+    if (!buf || !values) return;
+
+    if (prop == SFXBP_POSITION)
+    {
+        SoftMixVoice &voice = voiceOf(buf);
+        for (int i = 0; i < 3; ++i)
+        {
+            voice.position[i].store(values[i], std::memory_order_relaxed);
+        }
+    }
+}
+
+void DS_SoftMix_SFX_Listener(int /*prop*/, float /*value*/)
+{
+    // Parameters are applied on the next mixed block; nothing to commit.
+}
+
+void DS_SoftMix_SFX_Listenerv(int prop, float *values)
+{
+    if (!softMixer || !values) return;
+
+    switch (prop)
+    {
+    case SFXLP_POSITION:
+        for (int i = 0; i < 3; ++i)
+        {
+            softMixer->listener.position[i].store(values[i], std::memory_order_relaxed);
+        }
+        break;
+
+    case SFXLP_ORIENTATION:
+        softMixer->listener.yaw.store(values[0], std::memory_order_relaxed);
+        break;
+
+    default:
+        break;
+    }
+}
+
+int DS_SoftMix_SFX_Getv(int prop, void *values)
+{
+    switch (prop)
+    {
+    case SFXIP_DISABLE_CHANNEL_REFRESH:
+        // The refresh thread is needed for noticing when sounds end.
+        if (values) *(int *) values = false;
+        break;
+
+    case SFXIP_ANY_SAMPLE_RATE_ACCEPTED:
+        // Samples are resampled while mixing.
+        if (values) *(int *) values = true;
+        break;
+
+    default:
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+
+Block DS_SoftMix_Render(int frames)
+{
+    Block pcm;
+    if (softMixer && softMixOffline)
+    {
+        softMixRenderTo(pcm, frames);
+        softMixFramesDone += frames;
+    }
+    return pcm;
+}
+
+Block DS_SoftMix_TakeOutput()
+{
+    Block taken;
+    std::swap(taken, softMixOutput);
+    return taken;
+}
+
+int DS_SoftMix_OutputRate()
+{
+    return softMixer ? softMixer->outputRate : SOFTMIX_DEFAULT_RATE;
+}
+
+Block DS_SoftMix_ComposeWav(const Block &pcm, int rate)
+{
+    const Block riff("RIFF"), wave("WAVE"), fmt("fmt "), data("data");
+    Block wav;
+    Writer writer(wav, littleEndianByteOrder);
+    writer << FixedByteArray(riff) << duint32(36 + pcm.size())
+           << FixedByteArray(wave)
+           << FixedByteArray(fmt) << duint32(16)
+           << duint16(1)            // PCM
+           << duint16(2)            // Channels
+           << duint32(rate)
+           << duint32(rate * 4)     // Bytes per second
+           << duint16(4)            // Block align
+           << duint16(16)           // Bits per sample
+           << FixedByteArray(data) << duint32(pcm.size())
+           << FixedByteArray(pcm);
+    return wav;
+}
+
+/**
+ * Measures the mixer with synthetic voices. Half of the voices are positional,
+ * and all have different pitches so every voice needs resampling.
+ */
+D_CMD(SoftMixBench)
+{
+    DE_UNUSED(src);
+
+    const dint voiceCount = (argc >= 2 ? de::clamp(1, String(argv[1]).toInt(), 4096) : 256);
+    const dint seconds    = (argc >= 3 ? de::clamp(1, String(argv[2]).toInt(), 600) : 10);
+
+    SoftMixer mixer(SOFTMIX_DEFAULT_RATE);
+    List<SoftMixVoice *> voices;
+
+    duint32 seed = 0x1234567;
+    auto random = [&seed] () { seed = seed * 1664525u + 1013904223u; return (seed >> 8) / dfloat(1 << 24); };
+
+    std::vector<dint16> noise(11025);
+    for (auto &s : noise) s = dint16((random() * 2 - 1) * 16000);
+
+    for (dint i = 0; i < voiceCount; ++i)
+    {
+        auto *voice = new SoftMixVoice(i % 2 == 1, true);
+        voice->setSample(noise.data(), 2, dint(noise.size()), 11025);
+        voice->pitch = .5f + random() * 1.5f;
+        voice->pan   = random() * 2 - 1;
+        voice->volume = 1.f / voiceCount;
+        for (auto &p : voice->position) p = random() * 2048 - 1024;
+        voice->playing = true;
+        voices << voice;
+        mixer.voices << voice;
+    }
+
+    const dint frames = seconds * mixer.outputRate;
+    std::vector<dint16> out(2 * SOFTMIX_BLOCK_FRAMES);
+    const Time startedAt;
+    for (dint done = 0; done < frames; done += SOFTMIX_BLOCK_FRAMES)
+    {
+        mixer.mix(out.data(), de::min(SOFTMIX_BLOCK_FRAMES, frames - done));
+    }
+    const ddouble elapsed = de::max(ddouble(startedAt.since()), 1.0e-6);
+
+    LOG_SCR_MSG("Mixed %i voices for %i seconds in %.3f s: %.1fx realtime, %.1f M voice-frames/s")
+        << voiceCount << seconds << elapsed
+        << seconds / elapsed
+        << ddouble(frames) * voiceCount / elapsed / 1.0e6;
+
+    deleteAll(voices);
+    return true;
+}
+
+void DS_SoftMix_ConsoleRegister()
+{
+    C_CMD("softmixbench", nullptr, SoftMixBench);
+}
@@ -138,6 +138,14 @@ void Cl_SendHello()
     Net_SendBuffer(0, 0);
 }
 
+void Cl_RequestFullFrame()
+{
+    Msg_Begin(PCL_FULL_FRAME_REQUEST);
+    Msg_End();
+
+    Net_SendBuffer(0, 0);
+}
+
 void Cl_AnswerHandshake()
 {
     LOG_AS("Cl_AnswerHandshake");
@@ -32,7 +32,7 @@ using namespace de;
 
 thinker_s *ClPlaneMover::newThinker(Plane &plane, coord_t dest, float speed) // static
 {
-    Thinker th(Thinker::AllocateMemoryZone);
+    Thinker th(Thinker::AllocatePooled);
     th.setData(new ClPlaneMover(plane, dest, speed));
 
     // Add to the map.
@@ -42,7 +42,7 @@ thinker_s *ClPolyMover::newThinker(Polyobj &polyobj, bool moving, bool rotating)
         return &mover->thinker();
     }
 
-    Thinker th(Thinker::AllocateMemoryZone);
+    Thinker th(Thinker::AllocatePooled);
     th.setData(new ClPolyMover(polyobj, moving, rotating));
 
     thinker_s *ptr = th.take();
@@ -40,6 +40,7 @@
 #include "render/rendersystem.h"
 #include "render/classicworldrenderer.h"
 #include "render/gloomworldrenderer.h"
+#include "render/modelrenderer.h"
 #include "sys_system.h"
 #include "ui/alertmask.h"
 #include "ui/b_main.h"
@@ -785,6 +786,12 @@ void ClientApp::preFrame()
     // Frame synchronous I/O operations.
     App_AudioSystem().startFrame();
 
+    if (hasRender())
+    {
+        // Models are uploaded to GL a few pieces per frame.
+        render().modelRenderer().loader().beginFrame();
+    }
+
     if (gx.BeginFrame) /// @todo Move to GameSystem::timeChanged().
     {
         gx.BeginFrame();
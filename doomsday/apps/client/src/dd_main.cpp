@@ -1695,6 +1695,9 @@ dint DD_GetInteger(dint ddvalue)
         }
         return -1;
 
+    case DD_MAP_GEOMETRY_STAMP:
+        return World::geometryStamp;
+
     default: break;
     }
 
@@ -1788,6 +1791,13 @@ void *DD_GetVariable(dint ddvalue)
         valueD = World::get().hasMap()? World::get().map().gravity() : 0;
         return &valueD;
 
+    case DD_MAP_REJECT_MATRIX:
+        if (World::get().hasMap() && World::get().map().sectorCount() > 0)
+        {
+            return const_cast<Byte *>(World::get().map().rejectMatrix().data());
+        }
+        return nullptr;
+
 #ifdef __CLIENT__
     case DD_PSPRITE_OFFSET_X:
         return &pspOffset[0];
@@ -32,6 +32,9 @@
 #  include "render/rend_particle.h"
 #  include "resource/lightmaterialdecoration.h"
 #endif
+#ifdef __SERVER__
+#  include "server/sv_def.h"
+#endif
 
 #include <doomsday/console/cmd.h>
 #include <doomsday/defs/decoration.h>
@@ -1203,6 +1206,11 @@ void Def_Read()
         defsInited = false;
     }
 
+#ifdef __SERVER__
+    // Clients will need to be told about the new thing types and states.
+    Sv_InvalidateHandshake();
+#endif
+
     auto &defs = *DED_Definitions();
 
     // Now we can clear all existing definitions and re-init.
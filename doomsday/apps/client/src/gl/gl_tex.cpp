@@ -2,6 +2,7 @@
  *
  * @authors Copyright © 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
  * @authors Copyright © 2005-2013 Daniel Swanson <danij@dengine.net>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -23,6 +24,7 @@
 #include "render/r_main.h"
 #include "resource/clientresources.h"
 #include "gl/sys_opengl.h"
+#include "gl/texfilter.h"
 
 #include <doomsday/color.h>
 #include <doomsday/res/colorpalette.h>
@@ -337,7 +339,6 @@ void* GL_ScaleBufferEx(const void* dataIn, int widthIn, int heightIn, int bpp,
 
     int    i, j, k, sizeIn, sizeOut, rowStride, rowLen;
     float *tempIn, *tempOut;
-    float  sx, sy;
     void * dataOut;
 
     // Determine bytes per input datum.
@@ -524,98 +525,7 @@ void* GL_ScaleBufferEx(const void* dataIn, int widthIn, int heightIn, int bpp,
     /**
      * Scale the image!
      */
-
-    if(widthOut > 1)
-        sx = (float) (widthIn - 1) / (float) (widthOut - 1);
-    else
-        sx = (float) (widthIn - 1);
-    if(heightOut > 1)
-        sy = (float) (heightIn - 1) / (float) (heightOut - 1);
-    else
-        sy = (float) (heightIn - 1);
-
-    if(sx < 1.0 && sy < 1.0)
-    {
-        // Magnify both width and height: use weighted sample of 4 pixels.
-        int i0, i1, j0, j1;
-        float alpha, beta;
-        float* src00, *src01, *src10, *src11;
-        float s1, s2;
-        float* dst;
-
-        for(i = 0; i < heightOut; ++i)
-        {
-            i0 = i * sy;
-            i1 = i0 + 1;
-            if(i1 >= heightIn)
-                i1 = heightIn - 1;
-            alpha = i * sy - i0;
-            for(j = 0; j < widthOut; ++j)
-            {
-                j0 = j * sx;
-                j1 = j0 + 1;
-                if(j1 >= widthIn)
-                    j1 = widthIn - 1;
-                beta = j * sx - j0;
-
-                // Compute weighted average of pixels in rect (i0,j0)-(i1,j1)
-                src00 = tempIn + (i0 * widthIn + j0) * bpp;
-                src01 = tempIn + (i0 * widthIn + j1) * bpp;
-                src10 = tempIn + (i1 * widthIn + j0) * bpp;
-                src11 = tempIn + (i1 * widthIn + j1) * bpp;
-
-                dst = tempOut + (i * widthOut + j) * bpp;
-
-                for (k = 0; k < bpp; ++k)
-                {
-                    s1 = *src00++ * (1.0 - beta) + *src01++ * beta;
-                    s2 = *src10++ * (1.0 - beta) + *src11++ * beta;
-                    *dst++ = s1 * (1.0 - alpha) + s2 * alpha;
-                }
-            }
-        }
-    }
-    else
-    {
-        // Shrink width and/or height:  use an unweighted box filter.
-        int i0, i1;
-        int j0, j1;
-        int ii, jj;
-        float sum, *dst;
-
-        for(i = 0; i < heightOut; ++i)
-        {
-            i0 = i * sy;
-            i1 = i0 + 1;
-            if(i1 >= heightIn)
-                i1 = heightIn - 1;
-
-            for(j = 0; j < widthOut; ++j)
-            {
-                j0 = j * sx;
-                j1 = j0 + 1;
-                if(j1 >= widthIn)
-                    j1 = widthIn - 1;
-
-                dst = tempOut + (i * widthOut + j) * bpp;
-
-                // Compute average of pixels in the rectangle (i0,j0)-(i1,j1)
-                for(k = 0; k < bpp; ++k)
-                {
-                    sum = 0.0;
-                    for(ii = i0; ii <= i1; ++ii)
-                    {
-                        for(jj = j0; jj <= j1; ++jj)
-                        {
-                            sum += *(tempIn + (ii * widthIn + jj) * bpp + k);
-                        }
-                    }
-                    sum /= (j1 - j0 + 1) * (i1 - i0 + 1);
-                    *dst++ = sum;
-                }
-            }
-        }
-    }
+    texfilter::scale(tempIn, widthIn, heightIn, bpp, tempOut, widthOut, heightOut);
 
     // Free temporary image storage.
     free(tempIn);
@@ -670,9 +580,6 @@ uint8_t* GL_ScaleBufferNearest(const uint8_t* in, int width, int height, int com
 void GL_DownMipmap32(uint8_t* in, int width, int height, int comps)
 {
     assert(in);
-    {
-    int x, y, c, outW = width >> 1, outH = height >> 1;
-    uint8_t* out;
 
     if(width <= 0 || height <= 0 || comps <= 0)
         return;
@@ -683,26 +590,7 @@ void GL_DownMipmap32(uint8_t* in, int width, int height, int comps)
         return;
     }
 
-    // Limited, 1x2|2x1 -> 1x1 reduction?
-    if(!outW || !outH)
-    {
-        int outDim = (width > 1 ? outW : outH);
-
-        out = in;
-        for(x = 0; x < outDim; ++x, in += comps * 2)
-            for(c = 0; c < comps; ++c, out++)
-                *out = (uint8_t)((in[c] + in[comps + c]) >> 1);
-        return;
-    }
-
-    // Unconstrained, 2x2 -> 1x1 reduction?
-    out = in;
-    for(y = 0; y < outH; ++y, in += width * comps)
-        for(x = 0; x < outW; ++x, in += comps * 2)
-            for(c = 0; c < comps; ++c, out++)
-                *out = (uint8_t)((in[c] + in[comps + c] + in[comps * width + c] +
-                              in[comps * (width + 1) + c]) >> 2);
-    }
+    texfilter::downMipmap32(in, width, height, comps);
 }
 
 void GL_DownMipmap8(uint8_t* in, uint8_t* fadedOut, int width, int height, float fade)
@@ -1221,168 +1109,20 @@ void BlackOutlines(uint8_t* pixels, int width, int height)
 void ColorOutlinesIdx(uint8_t* buffer, int width, int height)
 {
     DE_ASSERT(buffer);
-
-    const int numpels = width * height;
-    uint8_t* w[5];
-    int x, y;
-
-    if(width <= 0 || height <= 0)
-        return;
-
-    //      +----+
-    //      | w0 |
-    // +----+----+----+
-    // | w1 | w2 | w3 |
-    // +----+----+----+
-    //      | w4 |
-    //      +----+
-
-    /// @todo Not a very efficient algorithm...
-
-    for(y = 0; y < height; ++y)
-    {
-        for(x = 0; x < width; ++x)
-        {
-            // Only solid pixels spread.
-            if(!buffer[numpels + x + y * width])
-                continue;
-
-            w[2] = buffer + x + y * width;
-
-            w[0] = buffer + x + (y +        (y == 0? 0 : -1)) * width;
-            w[4] = buffer + x + (y + (y == height-1? 0 :  1)) * width;
-
-            w[1] = buffer + x +       (x == 0? 0 : -1) + (y)  * width;
-            w[3] = buffer + x + (x == width-1? 0 :  1) + (y)  * width;
-
-            if(w[0] != w[2] && !(*(w[0]+numpels)))
-                *(w[0]) = *(w[2]);
-
-            if(w[4] != w[2] && !(*(w[4]+numpels)))
-                *(w[4]) = *(w[2]);
-
-            if(w[1] != w[2] && !(*(w[1]+numpels)))
-                *(w[1]) = *(w[2]);
-
-            if(w[3] != w[2] && !(*(w[3]+numpels)))
-                *(w[3]) = *(w[2]);
-        }
-    }
+    texfilter::colorOutlinesIdx(buffer, width, height);
 }
 
 void ColorOutlinesRGBA(uint8_t *buffer, int width, int height)
 {
-    using namespace de;
-
-    uint32_t *buffer32 = reinterpret_cast<uint32_t *>(buffer);
-
-    for (int y = 0; y < height; ++y)
-    {
-        uint32_t *row = buffer32 + y * width;
-        for (int x = 0; x < width; ++x)
-        {
-            if ((row[x] & 0xff000000) == 0) // transparent pixel
-            {
-                int average[3]{};
-                int count = 0;
-                for (int dy = -1; dy <= 1; ++dy)
-                {
-                    for (int dx = -1; dx <= 1; ++dx)
-                    {
-                        if (!(dx || dy)) continue; // the current pixel
-
-                        const Vec2i pos(x + dx, y + dy);
-                        if (pos.x >= 0 && pos.y >= 0 && pos.x < width && pos.y < height)
-                        {
-                            const uint32_t adjacent = buffer32[pos.y * width + pos.x];
-                            if (adjacent & 0xff000000) // non-transparent pixel
-                            {
-                                average[0] += adjacent & 0xff;
-                                average[1] += (adjacent >> 8) & 0xff;
-                                average[2] += (adjacent >> 16) & 0xff;
-                                ++count;
-                            }
-                        }
-                    }
-                }
-                if (count)
-                {
-                    for (int &c : average) c /= count;
-                }
-                row[x] = average[0] | (average[1] << 8) | (average[2] << 16);
-            }
-        }
-    }
+    DE_ASSERT(buffer);
+    texfilter::colorOutlinesRGBA(buffer, width, height);
 }
 
 void EqualizeLuma(uint8_t* pixels, int width, int height, float* rBaMul,
     float* rHiMul, float* rLoMul)
 {
     assert(pixels);
-    {
-    float hiMul, loMul, baMul;
-    long wideAvg, numpels;
-    uint8_t min, max, avg;
-    uint8_t* pix;
-
-    if(width <= 0 || height <= 0)
-        return;
-
-    numpels = width * height;
-    min = 255;
-    max = 0;
-    wideAvg = 0;
-
-    { long i;
-    for(i = 0, pix = pixels; i < numpels; ++i, pix += 1)
-    {
-        if(*pix < min) min = *pix;
-        if(*pix > max) max = *pix;
-        wideAvg += *pix;
-    }}
-
-    if(max <= min || max == 0 || min == 255)
-    {
-        if(rBaMul) *rBaMul = -1;
-        if(rHiMul) *rHiMul = -1;
-        if(rLoMul) *rLoMul = -1;
-        return; // Nothing we can do.
-    }
-
-    avg = MIN_OF(255, wideAvg / numpels);
-
-    // Allow a small margin of variance with the balance multiplier.
-    baMul = (!INRANGE_OF(avg, 127, 4)? (float)127/avg : 1);
-    if(baMul != 1)
-    {
-        if(max < 255)
-            max = (uint8_t) MINMAX_OF(1, (float)max - (255-max) * baMul, 255);
-        if(min > 0)
-            min = (uint8_t) MINMAX_OF(0, (float)min + min * baMul, 255);
-    }
-
-    hiMul = (max < 255?    (float)255/max  : 1);
-    loMul = (min > 0  ? 1-((float)min/255) : 1);
-
-    if(!(baMul == 1 && hiMul == 1 && loMul == 1))
-    {
-        long i;
-        for(i = 0, pix = pixels; i < numpels; ++i, pix += 1)
-        {
-            // First balance.
-            float val = baMul * (*pix);
-            // Now amplify.
-            if(val > 127) val *= hiMul;
-            else          val *= loMul;
-
-            *pix = (uint8_t) MINMAX_OF(0, val, 255);
-        }
-    }
-
-    if(rBaMul) *rBaMul = baMul;
-    if(rHiMul) *rHiMul = hiMul;
-    if(rLoMul) *rLoMul = loMul;
-    }
+    texfilter::equalizeLuma(pixels, width, height, rBaMul, rHiMul, rLoMul);
 }
 
 void Desaturate(uint8_t* pixels, int width, int height, int comps)
@@ -1495,11 +1235,6 @@ void EnhanceContrast(uint8_t* pixels, int width, int height, int comps)
 void SharpenPixels(uint8_t* pixels, int width, int height, int comps)
 {
     assert(pixels);
-    {
-    const float strength = .05f;
-    uint8_t* result;
-    float A, B, C;
-    int x, y;
 
     if(width <= 0 || height <= 0)
         return;
@@ -1511,33 +1246,7 @@ void SharpenPixels(uint8_t* pixels, int width, int height, int comps)
         return;
     }
 
-    result = (uint8_t *) M_Calloc(comps * width * height);
-
-    A = strength;
-    B = .70710678f * strength; // 1/sqrt(2)
-    C = 1 + 4*A + 4*B;
-
-    for(y = 1; y < height - 1; ++y)
-        for(x = 1; x < width -1; ++x)
-        {
-            const uint8_t* pix = pixels + (x + y*width) * comps;
-            uint8_t* out = result + (x + y*width) * comps;
-            int c;
-            for(c = 0; c < 3; ++c)
-            {
-                int r = (C*pix[c] - A*pix[c - width] - A*pix[c + comps] - A*pix[c - comps] -
-                         A*pix[c + width] - B*pix[c + comps - width] - B*pix[c + comps + width] -
-                         B*pix[c - comps - width] - B*pix[c - comps + width]);
-                out[c] = MINMAX_OF(0, r, 255);
-            }
-
-            if(comps == 4)
-                out[3] = pix[3];
-        }
-
-    memcpy(pixels, result, comps * width * height);
-    free(result);
-    }
+    texfilter::sharpen(pixels, width, height, comps);
 }
 
 /**
@@ -44,7 +44,6 @@
 #include "render/rend_main.h"  // misc global vars
 #include "render/rend_particle.h"  // Rend_ParticleLoadSystemTextures()
 
-#include "resource/hq2x.h"
 
 #include "ui/progress.h"
 
@@ -89,8 +88,6 @@ void GL_InitTextureManager()
     zap(sysFlareTextures);
     zap(lightingTextures);
 
-    GL_InitSmartFilterHQ2x();
-
     // Initialization done.
     initedOk = true;
 }
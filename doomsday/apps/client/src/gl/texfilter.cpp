@@ -0,0 +1,1056 @@
+/** @file texfilter.cpp  Vectorized and multithreaded texture filter kernels.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "gl/texfilter.h"
+
+#include <de/taskpool.h>
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define TEXFILTER_X86
+#  include <emmintrin.h>
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  endif
+#  if defined(__GNUC__) && !defined(__SSE2__)
+     // SSE2 is not enabled for the whole build; the CPU is checked at runtime.
+#    define TEXFILTER_SSE2_FUNC __attribute__((target("sse2")))
+#  else
+#    define TEXFILTER_SSE2_FUNC
+#  endif
+   // Floating-point kernels are vectorized only if scalar float arithmetic is done
+   // in single precision, too (i.e., not on the x87 FPU).
+#  if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#    define TEXFILTER_SSE2_FLOAT
+#  endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#  define TEXFILTER_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace texfilter {
+
+/// Images smaller than this (in pixels) are not split between threads.
+static const int MIN_BAND_PIXELS = 32 * 1024;
+
+static InstructionSet detectInstructionSet()
+{
+#if defined(TEXFILTER_X86)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    return SSE2;
+#  elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26))? SSE2 : Scalar;
+#  else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2")? SSE2 : Scalar;
+#  endif
+#elif defined(TEXFILTER_NEON)
+    return NEON; // Part of the AArch64 baseline.
+#else
+    return Scalar;
+#endif
+}
+
+static InstructionSet activeIsa   = availableInstructionSet();
+static bool           multithread = true;
+
+InstructionSet availableInstructionSet()
+{
+    static const InstructionSet detected = detectInstructionSet();
+    return detected;
+}
+
+InstructionSet instructionSet()
+{
+    return activeIsa;
+}
+
+void setInstructionSet(InstructionSet isa)
+{
+    activeIsa = (isa == availableInstructionSet()? isa : Scalar);
+}
+
+const char *instructionSetName(InstructionSet isa)
+{
+    switch (isa)
+    {
+    case SSE2: return "SSE2";
+    case NEON: return "NEON";
+    default:   return "scalar";
+    }
+}
+
+void setMultithreaded(bool enable)
+{
+    multithread = enable;
+}
+
+bool isMultithreaded()
+{
+    return multithread;
+}
+
+static inline int minBandRows(int rowPixels)
+{
+    return std::max(1, MIN_BAND_PIXELS / std::max(1, rowPixels));
+}
+
+/**
+ * Returns the number of bands that forRowBands() will use.
+ */
+static int rowBandCount(int rows, int rowPixels)
+{
+    const int minRows = minBandRows(rowPixels);
+    if (!multithread || rows < 2 * minRows) return 1;
+    return de::TaskPool::batchCount(rows, minRows);
+}
+
+/**
+ * Calls @a func for bands of rows, concurrently if the image is large enough.
+ * The function is called with the band index and the row range.
+ */
+template <typename Func>
+static void forRowBands(int rows, int rowPixels, Func func)
+{
+    if (rowBandCount(rows, rowPixels) <= 1)
+    {
+        func(0, 0, rows);
+        return;
+    }
+    de::TaskPool::forBatches(rows, [&func] (int band, int begin, int end) {
+        func(band, begin, end);
+    }, minBandRows(rowPixels));
+}
+
+#if defined(TEXFILTER_X86)
+TEXFILTER_SSE2_FUNC static inline __m128i selectBytes(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+TEXFILTER_SSE2_FUNC static inline __m128i loadBytes(const uint8_t *bytes)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+}
+
+/// Converts 16 bytes to four vectors of floats.
+TEXFILTER_SSE2_FUNC static inline void loadFloats(const uint8_t *bytes, __m128 f[4])
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+    const __m128i lo   = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi   = _mm_unpackhi_epi8(v, zero);
+    f[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    f[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    f[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    f[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+}
+
+/// Truncates four vectors of floats to integers and packs them to 16 bytes
+/// with saturation.
+TEXFILTER_SSE2_FUNC static inline __m128i packTruncated(const __m128 f[4])
+{
+    return _mm_packus_epi16(_mm_packs_epi32(_mm_cvttps_epi32(f[0]), _mm_cvttps_epi32(f[1])),
+                            _mm_packs_epi32(_mm_cvttps_epi32(f[2]), _mm_cvttps_epi32(f[3])));
+}
+#endif
+
+//---------------------------------------------------------------------------------------
+// Scaling
+//---------------------------------------------------------------------------------------
+
+static void magnifyRow(const float *in, int widthIn, int heightIn, int comps,
+                   float *out, int widthOut, float sx, float sy, int i)
+{
+    int i0 = i * sy;
+    int i1 = i0 + 1;
+    if (i1 >= heightIn) i1 = heightIn - 1;
+    const float alpha = i * sy - i0;
+
+    for (int j = 0; j < widthOut; ++j)
+    {
+        int j0 = j * sx;
+        int j1 = j0 + 1;
+        if (j1 >= widthIn) j1 = widthIn - 1;
+        const float beta = j * sx - j0;
+
+        // Compute weighted average of pixels in rect (i0,j0)-(i1,j1)
+        const float *src00 = in + (i0 * widthIn + j0) * comps;
+        const float *src01 = in + (i0 * widthIn + j1) * comps;
+        const float *src10 = in + (i1 * widthIn + j0) * comps;
+        const float *src11 = in + (i1 * widthIn + j1) * comps;
+
+        float *dst = out + (i * widthOut + j) * comps;
+
+        for (int k = 0; k < comps; ++k)
+        {
+            const float s1 = *src00++ * (1.0 - beta) + *src01++ * beta;
+            const float s2 = *src10++ * (1.0 - beta) + *src11++ * beta;
+            *dst++ = s1 * (1.0 - alpha) + s2 * alpha;
+        }
+    }
+}
+
+static void shrinkRow(const float *in, int widthIn, int heightIn, int comps,
+                  float *out, int widthOut, float sx, float sy, int i)
+{
+    int i0 = i * sy;
+    int i1 = i0 + 1;
+    if (i1 >= heightIn) i1 = heightIn - 1;
+
+    for (int j = 0; j < widthOut; ++j)
+    {
+        int j0 = j * sx;
+        int j1 = j0 + 1;
+        if (j1 >= widthIn) j1 = widthIn - 1;
+
+        float *dst = out + (i * widthOut + j) * comps;
+
+        // Compute average of pixels in the rectangle (i0,j0)-(i1,j1)
+        for (int k = 0; k < comps; ++k)
+        {
+            float sum = 0.0;
+            for (int ii = i0; ii <= i1; ++ii)
+            {
+                for (int jj = j0; jj <= j1; ++jj)
+                {
+                    sum += *(in + (ii * widthIn + jj) * comps + k);
+                }
+            }
+            sum /= (j1 - j0 + 1) * (i1 - i0 + 1);
+            *dst++ = sum;
+        }
+    }
+}
+
+#if defined(TEXFILTER_SSE2_FLOAT)
+/**
+ * Bilinear interpolation of one row of four-component pixels. The arithmetic
+ * matches magnifyRow() exactly: the weights are applied partly in double precision.
+ */
+TEXFILTER_SSE2_FUNC static inline __m128 lerpMixed(__m128 a, __m128 b, float t)
+{
+    // a * (1.0 - t) + b * t, where the first product is in double precision.
+    const __m128d invT = _mm_set1_pd(1.0 - t);
+    const __m128  bt   = _mm_mul_ps(b, _mm_set1_ps(t));
+    const __m128d lo   = _mm_add_pd(_mm_mul_pd(_mm_cvtps_pd(a), invT), _mm_cvtps_pd(bt));
+    const __m128d hi   = _mm_add_pd(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)), invT),
+                                    _mm_cvtps_pd(_mm_movehl_ps(bt, bt)));
+    return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+}
+
+TEXFILTER_SSE2_FUNC static void magnifyRowSSE2(const float *in, int widthIn, int heightIn,
+                                           float *out, int widthOut, float sx, float sy, int i)
+{
+    int i0 = i * sy;
+    int i1 = i0 + 1;
+    if (i1 >= heightIn) i1 = heightIn - 1;
+    const float alpha = i * sy - i0;
+
+    float *dst = out + i * widthOut * 4;
+    for (int j = 0; j < widthOut; ++j, dst += 4)
+    {
+        int j0 = j * sx;
+        int j1 = j0 + 1;
+        if (j1 >= widthIn) j1 = widthIn - 1;
+        const float beta = j * sx - j0;
+
+        const __m128 s1 = lerpMixed(_mm_loadu_ps(in + (i0 * widthIn + j0) * 4),
+                                    _mm_loadu_ps(in + (i0 * widthIn + j1) * 4), beta);
+        const __m128 s2 = lerpMixed(_mm_loadu_ps(in + (i1 * widthIn + j0) * 4),
+                                    _mm_loadu_ps(in + (i1 * widthIn + j1) * 4), beta);
+        _mm_storeu_ps(dst, lerpMixed(s1, s2, alpha));
+    }
+}
+
+TEXFILTER_SSE2_FUNC static void shrinkRowSSE2(const float *in, int widthIn, int heightIn,
+                                          float *out, int widthOut, float sx, float sy, int i)
+{
+    int i0 = i * sy;
+    int i1 = i0 + 1;
+    if (i1 >= heightIn) i1 = heightIn - 1;
+
+    float *dst = out + i * widthOut * 4;
+    for (int j = 0; j < widthOut; ++j, dst += 4)
+    {
+        int j0 = j * sx;
+        int j1 = j0 + 1;
+        if (j1 >= widthIn) j1 = widthIn - 1;
+
+        __m128 sum = _mm_setzero_ps();
+        for (int ii = i0; ii <= i1; ++ii)
+        {
+            for (int jj = j0; jj <= j1; ++jj)
+            {
+                sum = _mm_add_ps(sum, _mm_loadu_ps(in + (ii * widthIn + jj) * 4));
+            }
+        }
+        const float count = float((j1 - j0 + 1) * (i1 - i0 + 1));
+        _mm_storeu_ps(dst, _mm_div_ps(sum, _mm_set1_ps(count)));
+    }
+}
+#endif
+
+void scale(const float *in, int widthIn, int heightIn, int comps,
+       float *out, int widthOut, int heightOut)
+{
+    float sx, sy;
+    if (widthOut > 1)
+        sx = (float) (widthIn - 1) / (float) (widthOut - 1);
+    else
+        sx = (float) (widthIn - 1);
+    if (heightOut > 1)
+        sy = (float) (heightIn - 1) / (float) (heightOut - 1);
+    else
+        sy = (float) (heightIn - 1);
+
+    // Magnify both width and height: use weighted sample of 4 pixels.
+    // Otherwise shrink width and/or height: use an unweighted box filter.
+    const bool magnify = (sx < 1.0 && sy < 1.0);
+
+    forRowBands(heightOut, widthOut, [=] (int, int begin, int end)
+    {
+#if defined(TEXFILTER_SSE2_FLOAT)
+        if (activeIsa == SSE2 && comps == 4)
+        {
+            for (int i = begin; i < end; ++i)
+            {
+                if (magnify) magnifyRowSSE2(in, widthIn, heightIn, out, widthOut, sx, sy, i);
+                else         shrinkRowSSE2 (in, widthIn, heightIn, out, widthOut, sx, sy, i);
+            }
+            return;
+        }
+#endif
+        for (int i = begin; i < end; ++i)
+        {
+            if (magnify) magnifyRow(in, widthIn, heightIn, comps, out, widthOut, sx, sy, i);
+            else         shrinkRow (in, widthIn, heightIn, comps, out, widthOut, sx, sy, i);
+        }
+    });
+}
+
+//---------------------------------------------------------------------------------------
+// Mipmaps
+//---------------------------------------------------------------------------------------
+
+#if defined(TEXFILTER_X86)
+/// Returns the number of output pixels done.
+TEXFILTER_SSE2_FUNC static int downMipmapRowSSE2(const uint8_t *in, int width, int outW, uint8_t *out)
+{
+    int x = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= outW; x += 4, in += 32, out += 16)
+    {
+        // Separate the even and odd pixels of both rows.
+        const __m128 a0 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in)));
+        const __m128 a1 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16)));
+        const __m128 b0 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * width)));
+        const __m128 b1 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * width + 16)));
+        const __m128i ae = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i ao = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128i be = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i bo = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+        __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(ae, zero), _mm_unpacklo_epi8(ao, zero)),
+                                   _mm_add_epi16(_mm_unpacklo_epi8(be, zero), _mm_unpacklo_epi8(bo, zero)));
+        __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(ae, zero), _mm_unpackhi_epi8(ao, zero)),
+                                   _mm_add_epi16(_mm_unpackhi_epi8(be, zero), _mm_unpackhi_epi8(bo, zero)));
+        lo = _mm_srli_epi16(lo, 2);
+        hi = _mm_srli_epi16(hi, 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(lo, hi));
+    }
+    return x;
+}
+#endif
+
+/**
+ * Averages 2x2 blocks of one input row pair. @a out may point to the beginning
+ * of the same buffer as @a in, since it never overtakes the input.
+ */
+static void downMipmapRow(const uint8_t *in, int width, int comps, int outW, uint8_t *out)
+{
+    int x = 0;
+#if defined(TEXFILTER_X86)
+    if (activeIsa == SSE2 && comps == 4)
+    {
+        x = downMipmapRowSSE2(in, width, outW, out);
+        in  += 8 * x;
+        out += 4 * x;
+    }
+#elif defined(TEXFILTER_NEON)
+    if (activeIsa == NEON && comps == 4)
+    {
+        for (; x + 4 <= outW; x += 4, in += 32, out += 16)
+        {
+            // Separate the even and odd pixels of both rows.
+            const uint32x4x2_t a = vuzpq_u32(vreinterpretq_u32_u8(vld1q_u8(in)),
+                                             vreinterpretq_u32_u8(vld1q_u8(in + 16)));
+            const uint32x4x2_t b = vuzpq_u32(vreinterpretq_u32_u8(vld1q_u8(in + 4 * width)),
+                                             vreinterpretq_u32_u8(vld1q_u8(in + 4 * width + 16)));
+            const uint8x16_t ae = vreinterpretq_u8_u32(a.val[0]);
+            const uint8x16_t ao = vreinterpretq_u8_u32(a.val[1]);
+            const uint8x16_t be = vreinterpretq_u8_u32(b.val[0]);
+            const uint8x16_t bo = vreinterpretq_u8_u32(b.val[1]);
+
+            const uint16x8_t lo = vaddq_u16(vaddl_u8(vget_low_u8(ae), vget_low_u8(ao)),
+                                            vaddl_u8(vget_low_u8(be), vget_low_u8(bo)));
+            const uint16x8_t hi = vaddq_u16(vaddl_u8(vget_high_u8(ae), vget_high_u8(ao)),
+                                            vaddl_u8(vget_high_u8(be), vget_high_u8(bo)));
+            vst1q_u8(out, vcombine_u8(vmovn_u16(vshrq_n_u16(lo, 2)), vmovn_u16(vshrq_n_u16(hi, 2))));
+        }
+    }
+#endif
+    for (; x < outW; ++x, in += comps * 2)
+    {
+        for (int c = 0; c < comps; ++c, out++)
+        {
+            *out = (uint8_t)((in[c] + in[comps + c] + in[comps * width + c] +
+                              in[comps * (width + 1) + c]) >> 2);
+        }
+    }
+}
+
+void downMipmap32(uint8_t *in, int width, int height, int comps)
+{
+    const int outW = width >> 1, outH = height >> 1;
+
+    if (width <= 0 || height <= 0 || comps <= 0)
+        return;
+
+    // Limited, 1x2|2x1 -> 1x1 reduction?
+    if (!outW || !outH)
+    {
+        const int outDim = (width > 1 ? outW : outH);
+        uint8_t *out = in;
+        for (int x = 0; x < outDim; ++x, in += comps * 2)
+            for (int c = 0; c < comps; ++c, out++)
+                *out = (uint8_t)((in[c] + in[comps + c]) >> 1);
+        return;
+    }
+
+    // Unconstrained, 2x2 -> 1x1 reduction. Note that the input rows are
+    // (2 * outW + width) pixels apart, which differs from two rows for odd widths.
+    const int inRowStep  = (2 * outW + width) * comps;
+    const int outRowSize = outW * comps;
+
+    if (rowBandCount(outH, outW) > 1)
+    {
+        // Each band writes to its own part of a separate buffer.
+        std::vector<uint8_t> out(size_t(outRowSize) * outH);
+        forRowBands(outH, outW, [&] (int, int begin, int end) {
+            for (int y = begin; y < end; ++y)
+            {
+                downMipmapRow(in + y * inRowStep, width, comps, outW, &out[y * outRowSize]);
+            }
+        });
+        std::memcpy(in, out.data(), out.size());
+        return;
+    }
+    for (int y = 0; y < outH; ++y)
+    {
+        downMipmapRow(in + y * inRowStep, width, comps, outW, in + y * outRowSize);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+// Luma equalization
+//---------------------------------------------------------------------------------------
+
+namespace {
+struct LumaStats
+{
+    uint8_t min = 255;
+    uint8_t max = 0;
+    int64_t sum = 0;
+};
+}
+
+#if defined(TEXFILTER_X86)
+/// Returns the number of pixels done.
+TEXFILTER_SSE2_FUNC static long lumaStatsSSE2(const uint8_t *pix, long count, LumaStats &stats)
+{
+    long i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vmin = _mm_set1_epi8(char(0xff));
+    __m128i vmax = zero;
+    __m128i vsum = zero;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pix + i));
+        vmin = _mm_min_epu8(vmin, v);
+        vmax = _mm_max_epu8(vmax, v);
+        vsum = _mm_add_epi64(vsum, _mm_sad_epu8(v, zero));
+    }
+    uint8_t mins[16], maxs[16];
+    int64_t sums[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(mins), vmin);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxs), vmax);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums), vsum);
+    for (int k = 0; k < 16; ++k)
+    {
+        stats.min = std::min(stats.min, mins[k]);
+        stats.max = std::max(stats.max, maxs[k]);
+    }
+    stats.sum = sums[0] + sums[1];
+    return i;
+}
+
+/// Returns the number of pixels done.
+TEXFILTER_SSE2_FUNC static long applyLumaSSE2(uint8_t *pix, long count, float baMul, float hiMul, float loMul)
+{
+    long i = 0;
+    const __m128 ba   = _mm_set1_ps(baMul);
+    const __m128 hi   = _mm_set1_ps(hiMul);
+    const __m128 lo   = _mm_set1_ps(loMul);
+    const __m128 mid  = _mm_set1_ps(127);
+    const __m128 top  = _mm_set1_ps(255);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128 val[4];
+        loadFloats(pix + i, val);
+        for (__m128 &v : val)
+        {
+            // First balance, then amplify.
+            v = _mm_mul_ps(ba, v);
+            const __m128 isHigh = _mm_cmpgt_ps(v, mid);
+            v = _mm_mul_ps(v, _mm_or_ps(_mm_and_ps(isHigh, hi), _mm_andnot_ps(isHigh, lo)));
+            v = _mm_min_ps(_mm_max_ps(v, zero), top);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pix + i), packTruncated(val));
+    }
+    return i;
+}
+#endif
+
+static LumaStats lumaStats(const uint8_t *pix, long count)
+{
+    LumaStats stats;
+    long i = 0;
+#if defined(TEXFILTER_X86)
+    if (activeIsa == SSE2)
+    {
+        i = lumaStatsSSE2(pix, count, stats);
+    }
+#elif defined(TEXFILTER_NEON)
+    if (activeIsa == NEON)
+    {
+        uint8x16_t vmin = vdupq_n_u8(255);
+        uint8x16_t vmax = vdupq_n_u8(0);
+        uint64x2_t vsum = vdupq_n_u64(0);
+        for (; i + 16 <= count; i += 16)
+        {
+            const uint8x16_t v = vld1q_u8(pix + i);
+            vmin = vminq_u8(vmin, v);
+            vmax = vmaxq_u8(vmax, v);
+            vsum = vpadalq_u32(vsum, vpaddlq_u16(vpaddlq_u8(v)));
+        }
+        stats.min = vminvq_u8(vmin);
+        stats.max = vmaxvq_u8(vmax);
+        stats.sum = int64_t(vaddvq_u64(vsum));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        if (pix[i] < stats.min) stats.min = pix[i];
+        if (pix[i] > stats.max) stats.max = pix[i];
+        stats.sum += pix[i];
+    }
+    return stats;
+}
+
+static void applyLuma(uint8_t *pix, long count, float baMul, float hiMul, float loMul)
+{
+    long i = 0;
+#if defined(TEXFILTER_X86)
+    if (activeIsa == SSE2)
+    {
+        i = applyLumaSSE2(pix, count, baMul, hiMul, loMul);
+    }
+#elif defined(TEXFILTER_NEON)
+    if (activeIsa == NEON)
+    {
+        // Only multiplications, so there is nothing to contract.
+        const float32x4_t ba   = vdupq_n_f32(baMul);
+        const float32x4_t hi   = vdupq_n_f32(hiMul);
+        const float32x4_t lo   = vdupq_n_f32(loMul);
+        const float32x4_t mid  = vdupq_n_f32(127);
+        const float32x4_t top  = vdupq_n_f32(255);
+        const float32x4_t zero = vdupq_n_f32(0);
+        for (; i + 16 <= count; i += 16)
+        {
+            const uint8x16_t v = vld1q_u8(pix + i);
+            const uint16x8_t halves[2] = { vmovl_u8(vget_low_u8(v)), vmovl_u8(vget_high_u8(v)) };
+            uint16x4_t result[4];
+            for (int k = 0; k < 4; ++k)
+            {
+                const uint16x8_t h = halves[k / 2];
+                float32x4_t f = vcvtq_f32_u32(vmovl_u16(k & 1? vget_high_u16(h) : vget_low_u16(h)));
+                f = vmulq_f32(ba, f);
+                f = vmulq_f32(f, vbslq_f32(vcgtq_f32(f, mid), hi, lo));
+                f = vminq_f32(vmaxq_f32(f, zero), top);
+                result[k] = vmovn_u32(vcvtq_u32_f32(f));
+            }
+            vst1q_u8(pix + i, vcombine_u8(vmovn_u16(vcombine_u16(result[0], result[1])),
+                                          vmovn_u16(vcombine_u16(result[2], result[3]))));
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        // First balance.
+        float val = baMul * pix[i];
+        // Now amplify.
+        if (val > 127) val *= hiMul;
+        else           val *= loMul;
+
+        pix[i] = (uint8_t) (val < 0? 0 : val > 255? 255 : val);
+    }
+}
+
+void equalizeLuma(uint8_t *pixels, int width, int height,
+                  float *rBaMul, float *rHiMul, float *rLoMul)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    const long numpels = long(width) * height;
+
+    std::vector<LumaStats> bandStats(size_t(rowBandCount(height, width)));
+    forRowBands(height, width, [&] (int band, int begin, int end) {
+        bandStats[size_t(band)] = lumaStats(pixels + long(begin) * width, long(end - begin) * width);
+    });
+
+    uint8_t min = 255, max = 0;
+    int64_t wideAvg = 0;
+    for (const auto &stats : bandStats)
+    {
+        min = std::min(min, stats.min);
+        max = std::max(max, stats.max);
+        wideAvg += stats.sum;
+    }
+
+    if (max <= min || max == 0 || min == 255)
+    {
+        if (rBaMul) *rBaMul = -1;
+        if (rHiMul) *rHiMul = -1;
+        if (rLoMul) *rLoMul = -1;
+        return; // Nothing we can do.
+    }
+
+    const uint8_t avg = uint8_t(std::min(int64_t(255), wideAvg / numpels));
+
+    // Allow a small margin of variance with the balance multiplier.
+    const float baMul = (!(avg >= 127 - 4 && avg <= 127 + 4)? (float)127/avg : 1);
+    if (baMul != 1)
+    {
+        if (max < 255)
+        {
+            const float val = (float)max - (255-max) * baMul;
+            max = (uint8_t) (val < 1? 1 : val > 255? 255 : val);
+        }
+        if (min > 0)
+        {
+            const float val = (float)min + min * baMul;
+            min = (uint8_t) (val < 0? 0 : val > 255? 255 : val);
+        }
+    }
+
+    const float hiMul = (max < 255?    (float)255/max  : 1);
+    const float loMul = (min > 0  ? 1-((float)min/255) : 1);
+
+    if (!(baMul == 1 && hiMul == 1 && loMul == 1))
+    {
+        forRowBands(height, width, [=] (int, int begin, int end) {
+            applyLuma(pixels + long(begin) * width, long(end - begin) * width, baMul, hiMul, loMul);
+        });
+    }
+
+    if (rBaMul) *rBaMul = baMul;
+    if (rHiMul) *rHiMul = hiMul;
+    if (rLoMul) *rLoMul = loMul;
+}
+
+//---------------------------------------------------------------------------------------
+// Sharpening
+//---------------------------------------------------------------------------------------
+
+namespace {
+struct SharpenWeights
+{
+    float A, B, C;
+
+    SharpenWeights()
+    {
+        const float strength = .05f;
+        A = strength;
+        B = .70710678f * strength; // 1/sqrt(2)
+        C = 1 + 4*A + 4*B;
+    }
+};
+}
+
+/**
+ * Sharpens one color component. Note that the vertical neighbors are @a width
+ * bytes away rather than a full row.
+ */
+static inline uint8_t sharpenComponent(const uint8_t *pix, int width, int comps,
+                                       const SharpenWeights &w)
+{
+    const float A = w.A, B = w.B, C = w.C;
+    const int r = (C*pix[0] - A*pix[-width] - A*pix[comps] - A*pix[-comps] -
+                   A*pix[width] - B*pix[comps - width] - B*pix[comps + width] -
+                   B*pix[-comps - width] - B*pix[-comps + width]);
+    return uint8_t(r < 0? 0 : r > 255? 255 : r);
+}
+
+/// Sharpens the bytes [@a begin, @a end) of the image.
+static void sharpenBytes(const uint8_t *pixels, uint8_t *result, int width, int comps,
+                         int begin, int end, const SharpenWeights &w)
+{
+    for (int b = begin; b < end; ++b)
+    {
+        if (comps == 4 && (b & 3) == 3)
+            result[b] = pixels[b]; // Alpha is kept as is.
+        else
+            result[b] = sharpenComponent(pixels + b, width, comps, w);
+    }
+}
+
+#if defined(TEXFILTER_SSE2_FLOAT)
+/**
+ * Sharpens 16-byte spans of the bytes [@a begin, @a end) and returns the position
+ * where the remaining bytes begin.
+ */
+TEXFILTER_SSE2_FUNC static int sharpenBytesSSE2(const uint8_t *pixels, uint8_t *result,
+                                                int width, int comps, int begin, int end,
+                                                const SharpenWeights &w)
+{
+    const __m128 A = _mm_set1_ps(w.A);
+    const __m128 B = _mm_set1_ps(w.B);
+    const __m128 C = _mm_set1_ps(w.C);
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+
+    // The neighbors are subtracted in the same order as in sharpenComponent().
+    const int offsets[8] = {
+        -width, comps, -comps, width,
+        comps - width, comps + width, -comps - width, -comps + width
+    };
+
+    int b = begin;
+    for (; b + 16 <= end; b += 16)
+    {
+        const uint8_t *pix = pixels + b;
+
+        __m128 r[4], n[4];
+        loadFloats(pix, r);
+        for (__m128 &v : r) v = _mm_mul_ps(C, v);
+        for (int k = 0; k < 8; ++k)
+        {
+            const __m128 weight = (k < 4? A : B);
+            loadFloats(pix + offsets[k], n);
+            for (int q = 0; q < 4; ++q)
+            {
+                r[q] = _mm_sub_ps(r[q], _mm_mul_ps(weight, n[q]));
+            }
+        }
+        __m128i out = packTruncated(r);
+        if (comps == 4)
+        {
+            // Alpha is kept as is.
+            out = selectBytes(alphaMask,
+                              _mm_loadu_si128(reinterpret_cast<const __m128i *>(pix)), out);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + b), out);
+    }
+    return b;
+}
+#endif
+
+void sharpen(uint8_t *pixels, int width, int height, int comps)
+{
+    if (width <= 0 || height <= 0 || (comps != 3 && comps != 4))
+        return;
+
+    // The outermost pixels of the result are left black.
+    std::vector<uint8_t> result(size_t(comps) * width * height);
+    const SharpenWeights weights;
+
+    if (height > 2)
+    {
+        forRowBands(height - 2, width, [&] (int, int begin, int end) {
+            for (int y = 1 + begin; y < 1 + end; ++y)
+            {
+                int       b      = (1 + y * width) * comps;
+                const int rowEnd = (width - 1 + y * width) * comps;
+#if defined(TEXFILTER_SSE2_FLOAT)
+                if (activeIsa == SSE2)
+                {
+                    b = sharpenBytesSSE2(pixels, result.data(), width, comps, b, rowEnd, weights);
+                }
+#endif
+                sharpenBytes(pixels, result.data(), width, comps, b, rowEnd, weights);
+            }
+        });
+    }
+    std::memcpy(pixels, result.data(), result.size());
+}
+
+//---------------------------------------------------------------------------------------
+// Outlines
+//---------------------------------------------------------------------------------------
+
+#if defined(TEXFILTER_X86)
+/**
+ * Gathers the colors of 16-pixel spans of the row interior, starting from @a x.
+ * Returns the position where the remaining pixels begin.
+ */
+TEXFILTER_SSE2_FUNC static int outlineIdxSpanSSE2(const uint8_t *src, uint8_t *dst,
+                                                  const uint8_t *alpha, int width, int rowStart,
+                                                  bool hasUp, bool hasDown, int x)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 16 <= width - 1; x += 16)
+    {
+        const int i = rowStart + x;
+        const __m128i own = loadBytes(src + i);
+        __m128i color = own;
+        if (hasUp)
+            color = selectBytes(_mm_cmpeq_epi8(loadBytes(alpha + i - width), zero), color, loadBytes(src + i - width));
+        color = selectBytes(_mm_cmpeq_epi8(loadBytes(alpha + i - 1), zero), color, loadBytes(src + i - 1));
+        color = selectBytes(_mm_cmpeq_epi8(loadBytes(alpha + i + 1), zero), color, loadBytes(src + i + 1));
+        if (hasDown)
+            color = selectBytes(_mm_cmpeq_epi8(loadBytes(alpha + i + width), zero), color, loadBytes(src + i + width));
+        color = selectBytes(_mm_cmpeq_epi8(loadBytes(alpha + i), zero), color, own);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), color);
+    }
+    return x;
+}
+
+/**
+ * Skips groups of four non-transparent pixels starting from @a x. Returns the
+ * position of the first group that has a transparent pixel.
+ */
+TEXFILTER_SSE2_FUNC static int skipOpaqueSSE2(const uint32_t *row, int width, int x)
+{
+    const __m128i alphaMask = _mm_set1_epi32(int(0xff000000));
+    const __m128i zero      = _mm_setzero_si128();
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + x));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, alphaMask), zero)))
+            break;
+    }
+    return x;
+}
+#endif
+
+/**
+ * Spreads solid colors to the transparent pixels of one row of a paletted image.
+ *
+ * ColorOutlinesIdx() used to scatter each solid color to the four neighbors in
+ * scan order, so a transparent pixel ends up with the color of the last solid
+ * neighbor visited: below, right, left, or above, in this order of precedence.
+ * Gathering the colors this way makes rows independent of each other.
+ *
+ * The alpha plane is never changed and the colors of solid pixels are only read,
+ * so @a src may be the same as @a dst.
+ */
+static void outlineIdxRow(const uint8_t *src, uint8_t *dst, const uint8_t *alpha,
+                          int width, int height, int y)
+{
+    const int rowStart = y * width;
+    const bool hasUp   = y > 0;
+    const bool hasDown = y < height - 1;
+
+    auto gather = [=] (int x)
+    {
+        const int i = rowStart + x;
+        if (alpha[i]) return; // Only solid pixels spread.
+
+        int from = -1;
+        if (hasUp && alpha[i - width])          from = i - width;
+        if (x > 0 && alpha[i - 1])              from = i - 1;
+        if (x < width - 1 && alpha[i + 1])      from = i + 1;
+        if (hasDown && alpha[i + width])        from = i + width;
+        if (from >= 0) dst[i] = src[from];
+    };
+
+    int x = 0;
+    if (width > 2)
+    {
+        gather(x++); // The left edge.
+
+#if defined(TEXFILTER_X86)
+        if (activeIsa == SSE2)
+        {
+            x = outlineIdxSpanSSE2(src, dst, alpha, width, rowStart, hasUp, hasDown, x);
+        }
+#elif defined(TEXFILTER_NEON)
+        if (activeIsa == NEON)
+        {
+            for (; x + 16 <= width - 1; x += 16)
+            {
+                const int i = rowStart + x;
+                const uint8x16_t own = vld1q_u8(src + i);
+                uint8x16_t color = own;
+                if (hasUp)
+                    color = vbslq_u8(vceqzq_u8(vld1q_u8(alpha + i - width)), color, vld1q_u8(src + i - width));
+                color = vbslq_u8(vceqzq_u8(vld1q_u8(alpha + i - 1)), color, vld1q_u8(src + i - 1));
+                color = vbslq_u8(vceqzq_u8(vld1q_u8(alpha + i + 1)), color, vld1q_u8(src + i + 1));
+                if (hasDown)
+                    color = vbslq_u8(vceqzq_u8(vld1q_u8(alpha + i + width)), color, vld1q_u8(src + i + width));
+                color = vbslq_u8(vceqzq_u8(vld1q_u8(alpha + i)), color, own);
+                vst1q_u8(dst + i, color);
+            }
+        }
+#endif
+    }
+    for (; x < width; ++x)
+    {
+        gather(x);
+    }
+}
+
+void colorOutlinesIdx(uint8_t *pixels, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    const uint8_t *alpha = pixels + width * height;
+
+    if (rowBandCount(height, width) > 1)
+    {
+        // Read the colors from a copy, so no band reads what another one writes.
+        const std::vector<uint8_t> src(pixels, pixels + width * height);
+        forRowBands(height, width, [&] (int, int begin, int end) {
+            for (int y = begin; y < end; ++y)
+            {
+                outlineIdxRow(src.data(), pixels, alpha, width, height, y);
+            }
+        });
+        return;
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        outlineIdxRow(pixels, pixels, alpha, width, height, y);
+    }
+}
+
+/**
+ * Replaces transparent pixels with the average color of their non-transparent
+ * neighbors. Only transparent pixels are changed and they remain transparent, so
+ * @a src may be the same as @a dst.
+ */
+static void outlineRGBAPixel(const uint32_t *src, uint32_t *dst, int width, int height,
+                             int x, int y)
+{
+    int average[3]{};
+    int count = 0;
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            if (!(dx || dy)) continue; // the current pixel
+
+            const int px = x + dx, py = y + dy;
+            if (px >= 0 && py >= 0 && px < width && py < height)
+            {
+                const uint32_t adjacent = src[py * width + px];
+                if (adjacent & 0xff000000) // non-transparent pixel
+                {
+                    average[0] += adjacent & 0xff;
+                    average[1] += (adjacent >> 8) & 0xff;
+                    average[2] += (adjacent >> 16) & 0xff;
+                    ++count;
+                }
+            }
+        }
+    }
+    if (count)
+    {
+        for (int &c : average) c /= count;
+    }
+    dst[y * width + x] = average[0] | (average[1] << 8) | (average[2] << 16);
+}
+
+static void outlineRGBARow(const uint32_t *src, uint32_t *dst, int width, int height, int y)
+{
+    const uint32_t *row = src + y * width;
+    int x = 0;
+    while (x < width)
+    {
+        // Skip quickly over spans of non-transparent pixels.
+#if defined(TEXFILTER_X86)
+        if (activeIsa == SSE2)
+        {
+            x = skipOpaqueSSE2(row, width, x);
+        }
+#elif defined(TEXFILTER_NEON)
+        if (activeIsa == NEON)
+        {
+            const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+            for (; x + 4 <= width; x += 4)
+            {
+                if (vmaxvq_u32(vceqzq_u32(vandq_u32(vld1q_u32(row + x), alphaMask))))
+                    break;
+            }
+        }
+#endif
+        const int spanEnd = std::min(width, x + 4);
+        for (; x < spanEnd; ++x)
+        {
+            if ((row[x] & 0xff000000) == 0) // transparent pixel
+            {
+                outlineRGBAPixel(src, dst, width, height, x, y);
+            }
+        }
+    }
+}
+
+void colorOutlinesRGBA(uint8_t *buffer, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    uint32_t *buffer32 = reinterpret_cast<uint32_t *>(buffer);
+
+    if (rowBandCount(height, width) > 1)
+    {
+        // Read the neighbors from a copy, so no band reads what another one writes.
+        const std::vector<uint32_t> src(buffer32, buffer32 + width * height);
+        forRowBands(height, width, [&] (int, int begin, int end) {
+            for (int y = begin; y < end; ++y)
+            {
+                outlineRGBARow(src.data(), buffer32, width, height, y);
+            }
+        });
+        return;
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        outlineRGBARow(buffer32, buffer32, width, height, y);
+    }
+}
+
+} // namespace texfilter
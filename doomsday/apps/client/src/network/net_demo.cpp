@@ -26,8 +26,14 @@
 #include <doomsday/console/cmd.h>
 #include <doomsday/filesys/fs_util.h>
 #include <doomsday/net.h>
+#include <doomsday/network/demofile.h>
 #include <doomsday/network/protocol.h>
 
+#include <de/app.h>
+#include <de/bytearrayfile.h>
+#include <de/filesystem.h>
+
+#include "client/cl_def.h"
 #include "client/cl_player.h"
 
 #include "api_filesys.h"
@@ -39,6 +45,8 @@
 #include "render/rend_main.h"
 #include "render/viewports.h"
 
+#include "sys_system.h"
+
 #include "world/p_object.h"
 #include "world/p_players.h"
 
@@ -51,20 +59,20 @@ using namespace de;
 #define LCAMF_FOV           0x2  ///< FOV has changed (short).
 #define LCAMF_CAMERA        0x4  ///< Camera mode.
 
-#pragma pack(1)
-struct demopacket_header_t
-{
-    dushort length;
-};
-#pragma pack()
+/// Interval between world keyframes in a demo being recorded.
+#define KEYFRAME_INTERVAL   (30 * TICSPERSEC)
 
 extern dfloat netConnectTime;
 
 static const char *demoPath = "/home/demo/";
 
-#if 0
-LZFILE *playdemo;
-#endif
+static std::unique_ptr<network::DemoWriter> recorders[DDMAXPLAYERS];
+static String recordPaths[DDMAXPLAYERS];
+static File *recordFiles[DDMAXPLAYERS]; ///< Demos being written.
+static dint keyframeRequestTic[DDMAXPLAYERS];
+static bool mapSetupPending[DDMAXPLAYERS]; ///< A map is being loaded; no keyframes until the first frame.
+static std::unique_ptr<network::DemoReader> playdemo;
+
 dint playback;
 dint viewangleDelta;
 dfloat lookdirDelta;
@@ -78,6 +86,48 @@ static dint demoStartTic;
 
 void Demo_WriteLocalCamera(dint plrNum);
 
+static String demoFilePath(const String &fileName)
+{
+    if (fileName.beginsWith("/")) return fileName;
+    return String(demoPath) / fileName;
+}
+
+static Block loadDemo(const String &path)
+{
+    Block data;
+    App::rootFolder().locate<const File>(path) >> data;
+    return data;
+}
+
+static File &createDemo(const String &path)
+{
+    FS::get().makeFolder(path.fileNamePath());
+    return App::rootFolder().replaceFile(path);
+}
+
+static void saveDemo(const String &path, const Block &data)
+{
+    File &file = createDemo(path);
+    file << data;
+    file.release();
+}
+
+/**
+ * Stops a recording that can no longer be written.
+ */
+static void abortRecording(dint playerNum, const Error &er)
+{
+    LOG_ERROR("Failed to write demo \"%s\": %s") << recordPaths[playerNum] << er.asText();
+
+    DD_Player(playerNum)->recording = false;
+    recorders[playerNum].reset();
+    if (recordFiles[playerNum])
+    {
+        recordFiles[playerNum]->release();
+        recordFiles[playerNum] = nullptr;
+    }
+}
+
 void Demo_Init()
 {
     // Make sure the demo path is there.
@@ -85,63 +135,52 @@ void Demo_Init()
 }
 
 /**
- * Open a demo file and begin recording.
+ * Begin recording a demo. The packets are written to @a fileName as they are
+ * received, and the keyframe index when the recording stops.
+ *
  * Returns @c false if the recording can't be begun.
  */
-dd_bool Demo_BeginRecording(const char * /*fileName*/, dint /*plrNum*/)
+dd_bool Demo_BeginRecording(const char *fileName, dint plrNum)
 {
-    return false;
+    DE_ASSERT(plrNum >= 0 && plrNum < DDMAXPLAYERS);
+    auto &cl = *DD_Player(plrNum);
 
-#if 0
-    client_t *cl  = &::clients[plrNum];
-    player_t *plr = &DD_Player(plrNum);
-
-    // Is a demo already being recorded for this client?
-    if(cl->recording || ::playback || (::isDedicated && !plrNum) || !plr->shared.inGame)
+    // Is a demo already being recorded for this client? Only a client of a
+    // multiplayer game receives the packets that make up a demo.
+    if (cl.recording || ::playback || !netState.isClient || !cl.publicData().inGame)
         return false;
 
-    // Compose the real file name.
-    ddstring_t buf; Str_Appendf(Str_InitStd(&buf), "%s%s", ::demoPath, fileName);
-    F_ExpandBasePath(&buf, &buf);
-    F_ToNativeSlashes(&buf, &buf);
-
-    // Open the demo file.
-    cl->demo = lzOpen(Str_Text(&buf), "wp");
-    Str_Free(&buf);
-    if(!cl->demo)
+    recordPaths[plrNum] = demoFilePath(fileName);
+    try
     {
-        return false;  // Couldn't open it!
+        recordFiles[plrNum] = &createDemo(recordPaths[plrNum]);
+        recorders[plrNum].reset(
+            new network::DemoWriter(recordFiles[plrNum]->source()->as<ByteArrayFile>()));
+    }
+    catch (const Error &er)
+    {
+        LOG_ERROR("Cannot record demo \"%s\": %s") << recordPaths[plrNum] << er.asText();
+        recordFiles[plrNum] = nullptr;
+        return false;
     }
 
-    cl->recording    = true;
-    cl->recordPaused = false;
+    cl.recording    = true;
+    cl.recordPaused = false;
 
-    ::writeInfo[plrNum].first       = true;
-    ::writeInfo[plrNum].canwrite    = false;
-    ::writeInfo[plrNum].cameratimer = 0;
-    ::writeInfo[plrNum].fov         = -1;  // Must be written in the first packet.
+    DemoTimer &inf = cl.demoTimer();
+    inf.first       = true;
+    inf.canwrite    = false;
+    inf.cameratimer = 0;
+    inf.fov         = -1;  // Must be written in the first packet.
 
-    if(netState.isServer)
-    {
-        // Playing demos alters gametic. This'll make sure we're going to get updates.
-        ::clients[0].lastTransmit = -1;
-        // Servers need to send a handshake packet.
-        // It only needs to recorded in the demo file, though.
-        ::allowSending = false;
-        Sv_Handshake(plrNum, false);
-        // Enable sending to network.
-        ::allowSending = true;
-    }
-    else
-    {
-        // Clients need a Handshake packet.
-        // Request a new one from the server.
-        Cl_SendHello();
-    }
+    // Clients need a Handshake packet. Request a new one from the server.
+    // Everything the server sends after it makes up the first keyframe.
+    keyframeRequestTic[plrNum] = 0;
+    mapSetupPending[plrNum]    = true;
+    Cl_SendHello();
 
     // The operation is a success.
     return true;
-#endif
 }
 
 void Demo_PauseRecording(dint playerNum)
@@ -189,15 +228,26 @@ void Demo_StopRecording(dint playerNum)
     // A demo is not being recorded?
     if(!cl.recording) return;
 
-    // Close demo file.
-    //lzClose(cl.demo); cl.demo = nullptr;
     cl.recording = false;
+
+    // Finish the demo file with its keyframe index.
+    auto &writer = *recorders[playerNum];
+    try
+    {
+        writer.close();
+        recordFiles[playerNum]->release();
+        LOG_MSG("Demo saved to \"%s\" (%i keyframes)") << recordPaths[playerNum] << writer.keyframeCount();
+    }
+    catch (const Error &er)
+    {
+        LOG_ERROR("Failed to write demo \"%s\": %s") << recordPaths[playerNum] << er.asText();
+    }
+    recorders[playerNum].reset();
+    recordFiles[playerNum] = nullptr;
 }
 
 void Demo_WritePacket(dint playerNum)
 {
-    DE_UNUSED(playerNum);
-#if 0
     if(playerNum < 0)
     {
         Demo_BroadcastPacket();
@@ -212,9 +262,10 @@ void Demo_WritePacket(dint playerNum)
     if(!cl.recording)
         return;
 
+    const bool isHandshake = (::netBuffer.msg.type == PSV_HANDSHAKE);
     if(!inf.canwrite)
     {
-        if(::netBuffer.msg.type != PSV_HANDSHAKE)
+        if(!isHandshake)
             return;
 
         // The handshake has arrived. Now we can begin writing.
@@ -229,13 +280,7 @@ void Demo_WritePacket(dint playerNum)
             return;
     }
 
-    // This counts as an update. (We know the client is alive.)
-    //::clients[playerNum].updateCount = UPDATECOUNT;
-
-    LZFILE *file = cl.demo;
-    if(!file) App_Error("Demo_WritePacket: No demo file!\n");
-
-    byte ptime;
+    dint ptime;
     if(!inf.first)
     {
         ptime = (cl.recordPaused ? inf.pausetime : DEMOTIC)
@@ -247,19 +292,56 @@ void Demo_WritePacket(dint playerNum)
         inf.first     = false;
         inf.begintime = DEMOTIC;
     }
-    lzWrite(&ptime, 1, file);
 
-    demopacket_header_t hdr;  // The header.
-    if(::netBuffer.length >= sizeof(hdr.length))
-        App_Error("Demo_WritePacket: Write buffer too large!\n");
+    auto &writer = *recorders[playerNum];
+    try
+    {
+        if(isHandshake)
+        {
+            // A handshake is followed by the map and the complete world state.
+            writer.beginKeyframe(ptime);
+            mapSetupPending[playerNum] = true;
+        }
+        else if(::netBuffer.msg.type == PSV_FIRST_FRAME2)
+        {
+            // The first frame after a map change or a full frame request contains
+            // the complete world state relative to the start of the map.
+            writer.beginWorldKeyframe(ptime);
+            mapSetupPending[playerNum] = false;
+        }
 
-    hdr.length = (dushort) 1 + ::netBuffer.length;
-    lzWrite(&hdr, sizeof(hdr), file);
+        // Write the packet itself (type and data).
+        writer.writePacket(ptime, Block(&::netBuffer.msg, 1 + ::netBuffer.length));
+    }
+    catch(const Error &er)
+    {
+        abortRecording(playerNum, er);
+    }
+}
 
-    // Write the packet itself.
-    lzPutC(::netBuffer.msg.type, file);
-    lzWrite(::netBuffer.msg.data, (long) netBuffer.length, file);
-#endif
+/**
+ * Called when a new map has been loaded. If the map was changed by the packet
+ * that was just recorded, it begins a new restart keyframe.
+ */
+void Demo_MapChanged()
+{
+    for(dint i = 0; i < DDMAXPLAYERS; ++i)
+    {
+        auto &cl = *DD_Player(i);
+        if(!cl.recording || !cl.demoTimer().canwrite || mapSetupPending[i])
+            continue;
+
+        try
+        {
+            recorders[i]->insertKeyframeBeforeLastPacket();
+        }
+        catch(const Error &er)
+        {
+            abortRecording(i, er);
+            continue;
+        }
+        mapSetupPending[i] = true;
+    }
 }
 
 void Demo_BroadcastPacket()
@@ -285,25 +367,17 @@ dd_bool Demo_BeginPlayback(const char *fileName)
             return false;
     }
 
-    // Compose the real file name.
-    ddstring_t buf; Str_Set(Str_InitStd(&buf), fileName);
-    if(!F_IsAbsolute(&buf))
+    // Open the demo file.
+    const String path = demoFilePath(fileName);
+    try
     {
-        Str_Prepend(&buf, demoPath);
+        playdemo.reset(new network::DemoReader(loadDemo(path)));
     }
-    F_ExpandBasePath(&buf, &buf);
-    F_ToNativeSlashes(&buf, &buf);
-
-    // Open the demo file.
-#if 0
-    playdemo = lzOpen(Str_Text(&buf), "rp");
-#endif
-    Str_Free(&buf);
-
-#if 0
-    if(!playdemo)
-#endif
+    catch (const Error &er)
+    {
+        LOG_ERROR("Cannot play demo \"%s\": %s") << path << er.asText();
         return false;
+    }
 
     // OK, let's begin the demo.
     ::playback       = true;
@@ -331,13 +405,12 @@ void Demo_StopPlayback()
 {
     if(!::playback) return;
 
-#if 0
     LOG_MSG("Demo was %.2f seconds (%i tics) long.")
         << ((DEMOTIC - ::demoStartTic) / dfloat( TICSPERSEC ))
         << (DEMOTIC - ::demoStartTic);
 
     ::playback = false;
-    lzClose(::playdemo); playdemo = nullptr;
+    playdemo.reset();
     //::fieldOfView = ::startFOV;
     Net_StopGame();
 
@@ -355,20 +428,17 @@ void Demo_StopPlayback()
     // "Play demo once" mode?
     if(CommandLine_Check("-playdemo"))
         Sys_Quit();
-#endif
 }
 
 dd_bool Demo_ReadPacket()
 {
-    return false;
-#if 0
-    static byte ptime;
     dint nowtime = DEMOTIC;
 
     if(!playback)
         return false;
 
-    if(lzEOF(::playdemo))
+    const dint ptime = playdemo->nextTic();
+    if(ptime < 0)
     {
         Demo_StopPlayback();
         // Any interested parties?
@@ -379,30 +449,55 @@ dd_bool Demo_ReadPacket()
     if(::readInfo.first)
     {
         ::readInfo.first = false;
-        ::readInfo.begintime = nowtime;
-        ptime = lzGetC(::playdemo);
+        ::readInfo.begintime = nowtime - ptime;
     }
 
     // Check if the packet can be read.
     if(Net_TimeDelta(nowtime - ::readInfo.begintime, ptime) < 0)
         return false;  // Can't read yet.
 
-    // Read the packet.
-    demopacket_header_t hdr;
-    lzRead(&hdr, sizeof(hdr), ::playdemo);
-
     // Get the packet.
-    ::netBuffer.length = hdr.length - 1;
+    dint tic;
+    Block packet;
+    if(!playdemo->readPacket(tic, packet))
+        return false;
+
+    if(packet.size() > sizeof(::netBuffer.msg))
+    {
+        LOG_NET_WARNING("Demo packet at tic %i is too large (%i bytes); skipping it")
+            << tic << packet.size();
+        return false;
+    }
+
+    ::netBuffer.length = packet.size() - 1;
     ::netBuffer.player = 0; // From the server.
-    ::netBuffer.msg.type = lzGetC(::playdemo);
-    lzRead(::netBuffer.msg.data, (long) ::netBuffer.length, ::playdemo);
-    //::netBuffer.cursor = ::netBuffer.msg.data;
+    std::memcpy(&::netBuffer.msg, packet.data(), packet.size());
+
+    return true;
+}
+
+/**
+ * Moves demo playback to @a tic. Playback continues from the nearest preceding
+ * keyframe, whose packets restart the map and rebuild the world; the packets
+ * between the keyframe and @a tic are then read without delay.
+ */
+dd_bool Demo_Seek(dint tic)
+{
+    if(!::playback) return false;
 
-    // Read the next packet time.
-    ptime = lzGetC(::playdemo);
+    tic = de::max(0, tic);
+    const dint keyframeTic = playdemo->seek(tic);
 
+    // Packets up to the target time are immediately due.
+    ::readInfo.first     = false;
+    ::readInfo.begintime = DEMOTIC - tic;
+    ::demoFrameZ         = 1;
+    ::demoZ              = 0;
+    de::zap(::posDelta);
+
+    LOG_MSG("Demo playback continues from the keyframe at %.1f seconds")
+        << keyframeTic / dfloat( TICSPERSEC );
     return true;
-#endif
 }
 
 /**
@@ -569,13 +664,29 @@ void Demo_Ticker(timespan_t /*time*/)
             player_t   &plr  = *DD_Player(i);
             ddplayer_t &ddpl = plr.publicData();
 
-            if(ddpl.inGame && plr.recording && !plr.recordPaused &&
-               ++plr.demoTimer().cameratimer >= LOCALCAM_WRITE_TICS)
+            if(!ddpl.inGame || !plr.recording || plr.recordPaused)
+                continue;
+
+            DemoTimer &inf = plr.demoTimer();
+            if(++inf.cameratimer >= LOCALCAM_WRITE_TICS)
             {
                 // It's time to write local view angles and coords.
-                plr.demoTimer().cameratimer = 0;
+                inf.cameratimer = 0;
                 Demo_WriteLocalCamera(i);
             }
+
+            if(inf.canwrite && !inf.first && !mapSetupPending[i])
+            {
+                // Periodically ask for the complete world state so the demo gets
+                // another keyframe to seek to.
+                const dint now = DEMOTIC - inf.begintime;
+                if(now - de::max(recorders[i]->lastKeyframeTic(), keyframeRequestTic[i])
+                   >= KEYFRAME_INTERVAL)
+                {
+                    keyframeRequestTic[i] = now;
+                    Cl_RequestFullFrame();
+                }
+            }
         }
     }
 }
@@ -588,6 +699,41 @@ D_CMD(PlayDemo)
     return Demo_BeginPlayback(argv[1]);
 }
 
+D_CMD(SeekDemo)
+{
+    DE_UNUSED(src, argc);
+
+    if(!::playback)
+    {
+        LOG_SCR_ERROR("No demo is being played");
+        return false;
+    }
+    return Demo_Seek(dint(String(argv[1]).toFloat() * TICSPERSEC));
+}
+
+D_CMD(CutDemo)
+{
+    DE_UNUSED(src, argc);
+
+    // Extract a time range into a new demo without playing it.
+    const String from = demoFilePath(argv[1]);
+    const String to   = demoFilePath(argv[4]);
+    try
+    {
+        const network::DemoReader demo(loadDemo(from));
+        const dint startTic = dint(String(argv[2]).toFloat() * TICSPERSEC);
+        const dint endTic   = dint(String(argv[3]).toFloat() * TICSPERSEC);
+        saveDemo(to, demo.extract(startTic, endTic));
+        LOG_SCR_MSG("Wrote demo \"%s\"") << to;
+        return true;
+    }
+    catch(const Error &er)
+    {
+        LOG_SCR_ERROR("Failed to cut demo \"%s\": %s") << from << er.asText();
+    }
+    return false;
+}
+
 D_CMD(RecordDemo)
 {
     DE_UNUSED(src);
@@ -719,5 +865,7 @@ void Demo_Register()
     C_CMD_FLAGS("pausedemo",    nullptr,    PauseDemo,  CMDF_NO_NULLGAME);
     C_CMD_FLAGS("playdemo",     "s",        PlayDemo,   CMDF_NO_NULLGAME);
     C_CMD_FLAGS("recorddemo",   nullptr,    RecordDemo, CMDF_NO_NULLGAME);
+    C_CMD_FLAGS("seekdemo",     "f",        SeekDemo,   CMDF_NO_NULLGAME);
+    C_CMD_FLAGS("cutdemo",      "sffs",     CutDemo,    0);
     C_CMD_FLAGS("stopdemo",     nullptr,    StopDemo,   CMDF_NO_NULLGAME);
 }
@@ -25,10 +25,15 @@
 #include <de/legacy/memoryzone.h>
 #include <de/hash.h>
 
+#include <cstring>
+
 using namespace de;
 
 typedef std::unordered_multimap<GLuint, DrawList *> DrawListHash;
 
+/// Lists chosen during the current frame, keyed by DrawListSpec key().
+typedef std::unordered_map<duint64, DrawList *> DrawListMemo;
+
 DE_PIMPL(DrawLists)
 {
     std::unique_ptr<DrawList> skyMaskList;
@@ -37,6 +42,8 @@ DE_PIMPL(DrawLists)
     DrawListHash dynHash;
     DrawListHash shinyHash;
     DrawListHash shadowHash;
+    DrawListMemo memo;
+    Stats        stats;
 
     Impl(Public *i) : Base(i)
     {
@@ -84,6 +91,7 @@ void DrawLists::clear()
     clearAllLists(d->shadowHash);
     clearAllLists(d->shinyHash);
     d->skyMaskList->clear();
+    d->memo.clear();
 }
 
 static void resetList(DrawList &list)
@@ -118,6 +126,10 @@ void DrawLists::reset()
     resetAllLists(d->shadowHash);
     resetAllLists(d->shinyHash);
     resetList(*d->skyMaskList);
+
+    // The interpolation targets were cleared, so the chosen lists may no longer apply.
+    d->memo.clear();
+    d->stats = Stats();
 }
 
 /**
@@ -142,6 +154,60 @@ static bool compareTexUnit(const GLTextureUnit &lhs, const GLTextureUnit &rhs)
     return true;
 }
 
+/// Mixes the properties compared by compareTexUnit() into @a key.
+static void hashTexUnit(duint64 &key, const GLTextureUnit &unit)
+{
+    const auto mix = [&key] (duint64 value)
+    {
+        key ^= value + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+    };
+    if (unit.texture)
+    {
+        mix(duint64(reinterpret_cast<uintptr_t>(unit.texture)));
+    }
+    else
+    {
+        mix(unit.unmanaged.glName);
+        mix(duint64(unit.unmanaged.wrapS) | (duint64(unit.unmanaged.wrapT) << 8) |
+            (duint64(unit.unmanaged.filter) << 16));
+    }
+    duint32 opacityBits;
+    std::memcpy(&opacityBits, &unit.opacity, sizeof(opacityBits));
+    mix(opacityBits);
+}
+
+/**
+ * Compact key over all the texture unit properties that determine which list
+ * a primitive is written to. Equal specs always have equal keys; the rare
+ * collisions are caught by the comparison in find().
+ */
+static duint64 specKey(const DrawListSpec &spec)
+{
+    duint64 key = duint64(spec.group);
+    hashTexUnit(key, spec.unit(TU_PRIMARY));
+    hashTexUnit(key, spec.unit(TU_INTER));
+    if (spec.group != ShineGeom)
+    {
+        hashTexUnit(key, spec.unit(TU_PRIMARY_DETAIL));
+        hashTexUnit(key, spec.unit(TU_INTER_DETAIL));
+    }
+    return key;
+}
+
+static bool matchesPrimary(const DrawListSpec &listSpec, const DrawListSpec &spec)
+{
+    return compareTexUnit(listSpec.unit(TU_PRIMARY), spec.unit(TU_PRIMARY)) &&
+           (spec.group == ShineGeom ||
+            compareTexUnit(listSpec.unit(TU_PRIMARY_DETAIL), spec.unit(TU_PRIMARY_DETAIL)));
+}
+
+static bool matchesInter(const DrawListSpec &listSpec, const DrawListSpec &spec)
+{
+    return compareTexUnit(listSpec.unit(TU_INTER), spec.unit(TU_INTER)) &&
+           (spec.group == ShineGeom ||
+            compareTexUnit(listSpec.unit(TU_INTER_DETAIL), spec.unit(TU_INTER_DETAIL)));
+}
+
 DrawList &DrawLists::find(const DrawListSpec &spec)
 {
     // Sky masked geometry is never textured; therefore no draw list hash.
@@ -151,27 +217,44 @@ DrawList &DrawLists::find(const DrawListSpec &spec)
         return *d->skyMaskList;
     }
 
-    DrawList *convertable = 0;
+    d->stats.finds++;
+
+    // The same material is usually written many times per frame.
+    const duint64 memoKey = specKey(spec);
+    const auto memoFound = d->memo.find(memoKey);
+    if (memoFound != d->memo.end())
+    {
+        const DrawListSpec &listSpec = memoFound->second->spec();
+        if (matchesPrimary(listSpec, spec) &&
+            ((!listSpec.unit(TU_INTER).hasTexture() && !spec.unit(TU_INTER).hasTexture()) ||
+             matchesInter(listSpec, spec)))
+        {
+            d->stats.memoHits++;
+            return *memoFound->second;
+        }
+    }
+
+    DrawList *chosen      = nullptr;
+    DrawList *convertable = nullptr;
 
     // Find/create a list in the hash.
     const GLuint key  = spec.unit(TU_PRIMARY).getTextureGLName();
     DrawListHash &hash = d->listHash(spec.group);
     const auto    keys = hash.equal_range(key);
-    for (auto it = keys.first; it != keys.second; ++it)
+    for (auto it = keys.first; it != keys.second && !chosen; ++it)
     {
         DrawList *          list     = it->second;
         const DrawListSpec &listSpec = list->spec();
 
-        if ((spec.group == ShineGeom &&
-             compareTexUnit(listSpec.unit(TU_PRIMARY), spec.unit(TU_PRIMARY))) ||
-            (spec.group != ShineGeom &&
-             compareTexUnit(listSpec.unit(TU_PRIMARY), spec.unit(TU_PRIMARY)) &&
-             compareTexUnit(listSpec.unit(TU_PRIMARY_DETAIL), spec.unit(TU_PRIMARY_DETAIL))))
+        d->stats.listsSearched++;
+
+        if (matchesPrimary(listSpec, spec))
         {
             if (!listSpec.unit(TU_INTER).hasTexture() && !spec.unit(TU_INTER).hasTexture())
             {
                 // This will do great.
-                return *list;
+                chosen = list;
+                break;
             }
 
             // Is this eligible for conversion to a blended list?
@@ -182,36 +265,41 @@ DrawList &DrawLists::find(const DrawListSpec &spec)
             }
 
             // Possibly an exact match?
-            if ((spec.group == ShineGeom &&
-                 compareTexUnit(listSpec.unit(TU_INTER), spec.unit(TU_INTER))) ||
-                (spec.group != ShineGeom &&
-                 compareTexUnit(listSpec.unit(TU_INTER), spec.unit(TU_INTER)) &&
-                 compareTexUnit(listSpec.unit(TU_INTER_DETAIL), spec.unit(TU_INTER_DETAIL))))
+            if (matchesInter(listSpec, spec))
             {
-                return *list;
+                chosen = list;
             }
         }
     }
 
-    // Did we find a convertable list?
-    if(convertable)
+    if (!chosen)
     {
-        // This list is currently empty.
-        if(spec.group == ShineGeom)
+        // Did we find a convertable list?
+        if(convertable)
         {
+            // This list is currently empty.
             convertable->spec().unit(TU_INTER) = spec.unit(TU_INTER);
+            if(spec.group != ShineGeom)
+            {
+                convertable->spec().unit(TU_INTER_DETAIL) = spec.unit(TU_INTER_DETAIL);
+            }
+            chosen = convertable;
         }
         else
         {
-            convertable->spec().unit(TU_INTER) = spec.unit(TU_INTER);
-            convertable->spec().unit(TU_INTER_DETAIL) = spec.unit(TU_INTER_DETAIL);
+            // Create a new list.
+            chosen = hash.insert(std::make_pair(key, new DrawList(spec)))->second;
+            d->stats.listsCreated++;
         }
-
-        return *convertable;
     }
 
-    // Create a new list.
-    return *hash.insert(std::make_pair(key, new DrawList(spec)))->second;
+    d->memo[memoKey] = chosen;
+    return *chosen;
+}
+
+const DrawLists::Stats &DrawLists::stats() const
+{
+    return d->stats;
 }
 
 int DrawLists::findAll(GeomGroup group, FoundLists &found)
@@ -67,6 +67,7 @@ DE_STATIC_STRING(VAR_U_PROJECTION_MATRIX, "uProjectionMatrix");
 DE_STATIC_STRING(VAR_U_VIEW_MATRIX      , "uViewMatrix");
 
 static constexpr Atlas::Size MAX_ATLAS_SIZE(8192, 8192);
+static constexpr int MODEL_UPLOADS_PER_FRAME = 8; ///< Texture sets or vertex buffers.
 
 DE_PIMPL(ModelLoader)
 , DE_OBSERVES(filesys::AssetObserver, Availability)
@@ -78,6 +79,7 @@ DE_PIMPL(ModelLoader)
     MultiAtlas atlasPool{*this};
 
     filesys::AssetObserver observer{"model\\..*"};
+    ModelDrawable::UploadBudget uploadBudget{MODEL_UPLOADS_PER_FRAME}; ///< Shared by all models.
     ModelBank bank {
         // Using render::Model instances.
         []() -> ModelDrawable * { return new render::Model; }
@@ -211,6 +213,9 @@ DE_PIMPL(ModelLoader)
      * Initializes one or more uninitialized models for rendering.
      * Must be called from the main thread.
      *
+     * A model remains pending until it is ready. If the upload budget of the
+     * current frame runs out, the rest of the models wait for the next frame.
+     *
      * @param maxCount  Maximum number of models to initialize.
      */
     void initPendingModels(int maxCount)
@@ -232,6 +237,12 @@ DE_PIMPL(ModelLoader)
             auto &model = bank.model<render::Model>(identifier);
             model.glInit();
 
+            if (!model.isReady())
+            {
+                // Continue in a later frame.
+                pendingModels.value.insert(identifier);
+                break;
+            }
             --maxCount;
         }
     }
@@ -634,6 +645,9 @@ DE_PIMPL(ModelLoader)
         // Textures of the model will be kept here.
         model.textures.reset(new MultiAtlas::AllocGroup(atlasPool));
 
+        // Spread the GL uploads of large models over several frames.
+        model.setUploadBudget(&uploadBudget);
+
         // Initialize for rendering at a later time.
         {
             DE_GUARD(pendingModels);
@@ -738,6 +752,11 @@ void ModelLoader::glDeinit()
     d->deinit();
 }
 
+void ModelLoader::beginFrame()
+{
+    d->uploadBudget.beginFrame();
+}
+
 String ModelLoader::shaderName(const GLProgram &program) const
 {
     return static_cast<const Impl::Program &>(program).shaderName;
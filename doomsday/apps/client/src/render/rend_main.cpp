@@ -3820,6 +3820,13 @@ static void makeCurrent(ConvexSubspace &subspace)
     }
 }
 
+/**
+ * @todo Geometry is written while the tree is traversed, because the angle clipper
+ * is updated with the walls that were written opaque. Building the geometry of the
+ * visible subspaces in parallel would first need the writers to stop sharing the
+ * current subspace and light color, the static index arrays, R_AllocRendVertices(),
+ * the projection and vector light lists, and the masked poly (vissprite) list.
+ */
 static void traverseBspTreeAndDrawSubspaces(const world::BspTree *bspTree)
 {
     DE_ASSERT(bspTree);
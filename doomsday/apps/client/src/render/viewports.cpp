@@ -80,6 +80,7 @@ static dint rendCameraSmooth = true;  ///< Smoothed by default.
 static dbyte showFrameTimePos;
 static dbyte showViewAngleDeltas;
 static dbyte showViewPosDeltas;
+static dbyte showDrawListStats;
 
 dint rendInfoTris;
 
@@ -1144,6 +1145,13 @@ void ClassicWorldRenderer::renderPlayerView(int num)
     }
 
     R_PrintRendPoolInfo();
+
+    if (showDrawListStats)
+    {
+        const auto &stats = ClientApp::render().drawLists().stats();
+        LOGDEV_GL_MSG("DrawLists: %u finds, %u memoized, %u lists searched, %u created")
+            << stats.finds << stats.memoHits << stats.listsSearched << stats.listsCreated;
+    }
 }
 
 #undef R_RenderPlayerView
@@ -1512,6 +1520,7 @@ void Viewports_Register()
 
     C_VAR_BYTE("rend-info-deltas-angles",   &showViewAngleDeltas,   0, 0, 1);
     C_VAR_BYTE("rend-info-deltas-pos",      &showViewPosDeltas,     0, 0, 1);
+    C_VAR_BYTE("rend-info-drawlists",       &showDrawListStats,     CVF_NO_ARCHIVE, 0, 1);
     C_VAR_BYTE("rend-info-frametime",       &showFrameTimePos,      0, 0, 1);
     C_VAR_BYTE("rend-info-rendpolys",       &rendInfoRPolys,        CVF_NO_ARCHIVE, 0, 1);
     //C_VAR_INT ("rend-info-tris",            &rendInfoTris,          0, 0, 1); // not implemented atm
@@ -0,0 +1,2041 @@
+/** @file hqx.cpp  hq2x smart upscaling filter.
+ *
+ * @authors Copyright © 2003 Maxim Stepin <maxst@hiend3d.com>
+ * @authors Copyright © 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2009-2015 Daniel Swanson <danij@dengine.net>
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "resource/hqx.h"
+#include "gl/texfilter.h"
+
+#include <de/taskpool.h>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define HQX_SSE2
+#  include <emmintrin.h>
+#  if defined(__GNUC__) && !defined(__SSE2__)
+#    define HQX_SSE2_FUNC __attribute__((target("sse2")))
+#  else
+#    define HQX_SSE2_FUNC
+#  endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#  define HQX_NEON
+#  include <arm_neon.h>
+#endif
+
+/*
+ * Colors are ABGR8888: red is in the lowest byte.
+ */
+#define ABGR8888_PACK(a, b, g, r) ( ((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(g) << 8) | (uint32_t)(r) )
+#define ABGR8888_COMP(n, c)   ( ((c) >> ((n) << 3)) & 0xFF )
+
+/*
+ * YUV colors are packed like YUV888, with a flag in the highest byte that is
+ * 0xFF for non-transparent pixels.
+ */
+#define YUV_PACK(f, y, u, v)  ( ((uint32_t)(f) << 24) | ((uint32_t)(y) << 16) | ((uint32_t)(u) << 8) | (uint32_t)(v) )
+
+// Thresholds for detecting a difference.
+#define trY                 (48)
+#define trU                 (7)
+#define trV                 (6)
+
+#define PIXEL00_0         Transl(pOut,       w[5]);
+#define PIXEL00_10       Interp1(pOut,       w[5], w[1]);
+#define PIXEL00_11       Interp1(pOut,       w[5], w[4]);
+#define PIXEL00_12       Interp1(pOut,       w[5], w[2]);
+#define PIXEL00_20       Interp2(pOut,       w[5], w[4], w[2]);
+#define PIXEL00_21       Interp2(pOut,       w[5], w[1], w[2]);
+#define PIXEL00_22       Interp2(pOut,       w[5], w[1], w[4]);
+#define PIXEL00_60       Interp6(pOut,       w[5], w[2], w[4]);
+#define PIXEL00_61       Interp6(pOut,       w[5], w[4], w[2]);
+#define PIXEL00_70       Interp7(pOut,       w[5], w[4], w[2]);
+#define PIXEL00_90       Interp9(pOut,       w[5], w[4], w[2]);
+#define PIXEL00_100     Interp10(pOut,       w[5], w[4], w[2]);
+#define PIXEL01_0         Transl(pOut+4,     w[5]);
+#define PIXEL01_10       Interp1(pOut+4,     w[5], w[3]);
+#define PIXEL01_11       Interp1(pOut+4,     w[5], w[2]);
+#define PIXEL01_12       Interp1(pOut+4,     w[5], w[6]);
+#define PIXEL01_20       Interp2(pOut+4,     w[5], w[2], w[6]);
+#define PIXEL01_21       Interp2(pOut+4,     w[5], w[3], w[6]);
+#define PIXEL01_22       Interp2(pOut+4,     w[5], w[3], w[2]);
+#define PIXEL01_60       Interp6(pOut+4,     w[5], w[6], w[2]);
+#define PIXEL01_61       Interp6(pOut+4,     w[5], w[2], w[6]);
+#define PIXEL01_70       Interp7(pOut+4,     w[5], w[2], w[6]);
+#define PIXEL01_90       Interp9(pOut+4,     w[5], w[2], w[6]);
+#define PIXEL01_100     Interp10(pOut+4,     w[5], w[2], w[6]);
+#define PIXEL10_0         Transl(pOut+BpL,   w[5]);
+#define PIXEL10_10       Interp1(pOut+BpL,   w[5], w[7]);
+#define PIXEL10_11       Interp1(pOut+BpL,   w[5], w[8]);
+#define PIXEL10_12       Interp1(pOut+BpL,   w[5], w[4]);
+#define PIXEL10_20       Interp2(pOut+BpL,   w[5], w[8], w[4]);
+#define PIXEL10_21       Interp2(pOut+BpL,   w[5], w[7], w[4]);
+#define PIXEL10_22       Interp2(pOut+BpL,   w[5], w[7], w[8]);
+#define PIXEL10_60       Interp6(pOut+BpL,   w[5], w[4], w[8]);
+#define PIXEL10_61       Interp6(pOut+BpL,   w[5], w[8], w[4]);
+#define PIXEL10_70       Interp7(pOut+BpL,   w[5], w[8], w[4]);
+#define PIXEL10_90       Interp9(pOut+BpL,   w[5], w[8], w[4]);
+#define PIXEL10_100     Interp10(pOut+BpL,   w[5], w[8], w[4]);
+#define PIXEL11_0         Transl(pOut+BpL+4, w[5]);
+#define PIXEL11_10       Interp1(pOut+BpL+4, w[5], w[9]);
+#define PIXEL11_11       Interp1(pOut+BpL+4, w[5], w[6]);
+#define PIXEL11_12       Interp1(pOut+BpL+4, w[5], w[8]);
+#define PIXEL11_20       Interp2(pOut+BpL+4, w[5], w[6], w[8]);
+#define PIXEL11_21       Interp2(pOut+BpL+4, w[5], w[9], w[8]);
+#define PIXEL11_22       Interp2(pOut+BpL+4, w[5], w[9], w[6]);
+#define PIXEL11_60       Interp6(pOut+BpL+4, w[5], w[8], w[6]);
+#define PIXEL11_61       Interp6(pOut+BpL+4, w[5], w[6], w[8]);
+#define PIXEL11_70       Interp7(pOut+BpL+4, w[5], w[6], w[8]);
+#define PIXEL11_90       Interp9(pOut+BpL+4, w[5], w[6], w[8]);
+#define PIXEL11_100     Interp10(pOut+BpL+4, w[5], w[6], w[8]);
+
+namespace hqx {
+
+/// Images smaller than this (in pixels) are not split between threads.
+static const int MIN_BAND_PIXELS = 8 * 1024;
+
+static inline void LerpColor(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3, uint32_t f1,
+    uint32_t f2, uint32_t f3)
+{
+    uint32_t out[4] = { 0, 0, 0, 0 }, total = f1 + f2 + f3;
+    if(0 != f1)
+    {
+        out[0] += f1 * ABGR8888_COMP(0, c1);
+        out[1] += f1 * ABGR8888_COMP(1, c1);
+        out[2] += f1 * ABGR8888_COMP(2, c1);
+        out[3] += f1 * ABGR8888_COMP(3, c1);
+    }
+    if(0 != f2)
+    {
+        out[0] += f2 * ABGR8888_COMP(0, c2);
+        out[1] += f2 * ABGR8888_COMP(1, c2);
+        out[2] += f2 * ABGR8888_COMP(2, c2);
+        out[3] += f2 * ABGR8888_COMP(3, c2);
+    }
+    if(0 != f3)
+    {
+        out[0] += f3 * ABGR8888_COMP(0, c3);
+        out[1] += f3 * ABGR8888_COMP(1, c3);
+        out[2] += f3 * ABGR8888_COMP(2, c3);
+        out[3] += f3 * ABGR8888_COMP(3, c3);
+    }
+    if(0 != total)
+    {
+        out[0] /= total;
+        out[1] /= total;
+        out[2] /= total;
+        out[3] /= total;
+    }
+    pc[0] = uint8_t(out[0]);
+    pc[1] = uint8_t(out[1]);
+    pc[2] = uint8_t(out[2]);
+    pc[3] = uint8_t(out[3]);
+}
+
+static inline void Transl(uint8_t* pc, uint32_t c)
+{
+    pc[0] = ABGR8888_COMP(0, c);
+    pc[1] = ABGR8888_COMP(1, c);
+    pc[2] = ABGR8888_COMP(2, c);
+    pc[3] = ABGR8888_COMP(3, c);
+}
+
+static inline void Interp1(uint8_t* pc, uint32_t c1, uint32_t c2)
+{
+    if(c1 == c2)
+    {
+        Transl(pc, c1);
+        return;
+    }
+    LerpColor(pc, c1, c2, 0, 3, 1, 0);
+}
+
+static inline void Interp2(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    LerpColor(pc, c1, c2, c3, 2, 1, 1);
+}
+
+static inline void Interp6(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    LerpColor(pc, c1, c2, c3, 5, 2, 1);
+}
+
+static inline void Interp7(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    LerpColor(pc, c1, c2, c3, 6, 1, 1);
+}
+
+static inline void Interp9(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    LerpColor(pc, c1, c2, c3, 2, 3, 3);
+}
+
+static inline void Interp10(uint8_t* pc, uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    LerpColor(pc, c1, c2, c3, 14, 1, 1);
+}
+
+/**
+ * Converts a color to YUV. The color is first reduced to 16 bits (RGB565), like
+ * the lookup table of the original implementation did.
+ */
+static uint32_t toYUV(uint32_t c)
+{
+    const double r = double(c & 0xF8);
+    const double g = double((c >> 8) & 0xFC);
+    const double b = double((c >> 16) & 0xF8);
+    const uint32_t y = (uint32_t) std::min(std::max(( 0.299*r + 0.587*g + 0.114*b),       0.0), 255.0);
+    const uint32_t u = (uint32_t) std::min(std::max((-0.169*r - 0.331*g + 0.5  *b) + 128, 0.0), 255.0);
+    const uint32_t v = (uint32_t) std::min(std::max(( 0.5  *r - 0.419*g - 0.081*b) + 128, 0.0), 255.0);
+    return YUV_PACK(ABGR8888_COMP(3, c) != 0? 0xFF : 0, y, u, v);
+}
+
+static inline bool yuvDiffers(uint32_t yuv1, uint32_t yuv2)
+{
+    return ((yuv1 ^ yuv2) & 0xFF000000) ||
+           std::abs(int((yuv1 >> 16) & 0xFF) - int((yuv2 >> 16) & 0xFF)) > trY ||
+           std::abs(int((yuv1 >>  8) & 0xFF) - int((yuv2 >>  8) & 0xFF)) > trU ||
+           std::abs(int( yuv1        & 0xFF) - int( yuv2        & 0xFF)) > trV;
+}
+
+/**
+ * Colors and YUV values of the source image with a border of one pixel on each
+ * side, so that the neighbors of every pixel are at fixed offsets. The border
+ * contains the wrapped or clamped neighbors. Rows have one extra pixel on the
+ * right so that four neighbors can be loaded at once.
+ */
+namespace {
+struct Planes
+{
+    int stride;
+    std::vector<uint32_t> color;
+    std::vector<uint32_t> yuv;
+
+    Planes(int width, int height)
+        : stride(width + 3)
+        , color(size_t(width + 3) * (height + 2))
+        , yuv  (size_t(width + 3) * (height + 2))
+    {}
+};
+}
+
+static inline int wrapOrClamp(int pos, int size, bool wrap)
+{
+    if (pos < 0)     return wrap? size - 1 : 0;
+    if (pos >= size) return wrap && pos == size? 0 : size - 1;
+    return pos;
+}
+
+static void fillPlaneRow(Planes &planes, const uint8_t *src, int width, int height,
+                         bool wrapH, bool wrapV, int py)
+{
+    const int sy = wrapOrClamp(py - 1, height, wrapV);
+    uint32_t *color = &planes.color[size_t(py) * planes.stride];
+    uint32_t *yuv   = &planes.yuv  [size_t(py) * planes.stride];
+    for (int px = 0; px < planes.stride; ++px)
+    {
+        const uint8_t *pix = src + 4 * (size_t(sy) * width + wrapOrClamp(px - 1, width, wrapH));
+        color[px] = ABGR8888_PACK(pix[3], pix[2], pix[1], pix[0]);
+        if (px > 0 && color[px] == color[px - 1])
+            yuv[px] = yuv[px - 1];
+        else
+            yuv[px] = toYUV(color[px]);
+    }
+}
+
+/*
+ * The neighbors are numbered as follows. Bit k-1 (or k-2, for k > 5) of the
+ * pattern is set if neighbor k differs from the center.
+ *
+ * +----+----+----+
+ * | w1 | w2 | w3 |
+ * +----+----+----+
+ * | w4 | w5 | w6 |
+ * +----+----+----+
+ * | w7 | w8 | w9 |
+ * +----+----+----+
+ */
+static int patternScalar(const uint32_t *up, const uint32_t *mid, const uint32_t *down)
+{
+    const uint32_t center = mid[1];
+    const uint32_t neighbors[8] = { up[0], up[1], up[2], mid[0], mid[2], down[0], down[1], down[2] };
+    int pattern = 0;
+    for (int k = 0; k < 8; ++k)
+    {
+        if (yuvDiffers(center, neighbors[k])) pattern |= 1 << k;
+    }
+    return pattern;
+}
+
+#if defined(HQX_SSE2)
+/// Returns a bit for each of the four YUV values that differs from @a center.
+HQX_SSE2_FUNC static inline int differingSSE2(const uint32_t *yuv, __m128i center, __m128i limits)
+{
+    const __m128i v       = _mm_loadu_si128(reinterpret_cast<const __m128i *>(yuv));
+    const __m128i absDiff = _mm_or_si128(_mm_subs_epu8(v, center), _mm_subs_epu8(center, v));
+    const __m128i same    = _mm_cmpeq_epi32(_mm_subs_epu8(absDiff, limits), _mm_setzero_si128());
+    return ~_mm_movemask_ps(_mm_castsi128_ps(same)) & 0xF;
+}
+
+HQX_SSE2_FUNC static int patternSSE2(const uint32_t *up, const uint32_t *mid, const uint32_t *down)
+{
+    const __m128i center = _mm_set1_epi32(int(mid[1]));
+    const __m128i limits = _mm_set1_epi32(YUV_PACK(0, trY, trU, trV));
+    const int u = differingSSE2(up,   center, limits);
+    const int m = differingSSE2(mid,  center, limits);
+    const int d = differingSSE2(down, center, limits);
+    return (u & 7) | ((m & 1) << 3) | ((m & 4) << 2) | ((d & 7) << 5);
+}
+#elif defined(HQX_NEON)
+/// Returns a bit for each of the four YUV values that differs from @a center.
+static inline int differingNEON(const uint32_t *yuv, uint8x16_t center, uint8x16_t limits)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    const uint8x16_t over = vqsubq_u8(vabdq_u8(vreinterpretq_u8_u32(vld1q_u32(yuv)), center), limits);
+    const uint32x4_t differs = vtstq_u32(vreinterpretq_u32_u8(over), vreinterpretq_u32_u8(over));
+    return int(vaddvq_u32(vandq_u32(differs, vld1q_u32(bits))));
+}
+
+static int patternNEON(const uint32_t *up, const uint32_t *mid, const uint32_t *down)
+{
+    const uint8x16_t center = vreinterpretq_u8_u32(vdupq_n_u32(mid[1]));
+    const uint8x16_t limits = vreinterpretq_u8_u32(vdupq_n_u32(YUV_PACK(0, trY, trU, trV)));
+    const int u = differingNEON(up,   center, limits);
+    const int m = differingNEON(mid,  center, limits);
+    const int d = differingNEON(down, center, limits);
+    return (u & 7) | ((m & 1) << 3) | ((m & 4) << 2) | ((d & 7) << 5);
+}
+#endif
+
+/**
+ * Writes the 2x2 block of output pixels of one source pixel.
+ *
+ * @param pattern  Neighbors that differ from the center.
+ * @param w        Colors of the neighborhood (indices 1...9).
+ * @param yuv      YUV values of the neighborhood (indices 1...9).
+ * @param pOut     First output pixel.
+ * @param BpL      Bytes per output line.
+ */
+static void hq2xBlock(int pattern, const uint32_t *w, const uint32_t *yuv, uint8_t *pOut, int BpL)
+{
+#define Diff(a, b) yuvDiffers(yuv[a], yuv[b])
+
+    switch(pattern)
+    {
+    case 0:
+    case 1:
+    case 4:
+    case 32:
+    case 128:
+    case 5:
+    case 132:
+    case 160:
+    case 33:
+    case 129:
+    case 36:
+    case 133:
+    case 164:
+    case 161:
+    case 37:
+    case 165: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 2:
+    case 34:
+    case 130:
+    case 162: {
+            PIXEL00_22 PIXEL01_21 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 16:
+    case 17:
+    case 48:
+    case 49: {
+            PIXEL00_20 PIXEL01_22 PIXEL10_20 PIXEL11_21 break;
+      }
+    case 64:
+    case 65:
+    case 68:
+    case 69: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_21 PIXEL11_22 break;
+      }
+    case 8:
+    case 12:
+    case 136:
+    case 140: {
+            PIXEL00_21 PIXEL01_20 PIXEL10_22 PIXEL11_20 break;
+      }
+    case 3:
+    case 35:
+    case 131:
+    case 163: {
+            PIXEL00_11 PIXEL01_21 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 6:
+    case 38:
+    case 134:
+    case 166: {
+            PIXEL00_22 PIXEL01_12 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 20:
+    case 21:
+    case 52:
+    case 53: {
+            PIXEL00_20 PIXEL01_11 PIXEL10_20 PIXEL11_21 break;
+      }
+    case 144:
+    case 145:
+    case 176:
+    case 177: {
+            PIXEL00_20 PIXEL01_22 PIXEL10_20 PIXEL11_12 break;
+      }
+    case 192:
+    case 193:
+    case 196:
+    case 197: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_21 PIXEL11_11 break;
+      }
+    case 96:
+    case 97:
+    case 100:
+    case 101: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_12 PIXEL11_22 break;
+      }
+    case 40:
+    case 44:
+    case 168:
+    case 172: {
+            PIXEL00_21 PIXEL01_20 PIXEL10_11 PIXEL11_20 break;
+      }
+    case 9:
+    case 13:
+    case 137:
+    case 141: {
+            PIXEL00_12 PIXEL01_20 PIXEL10_22 PIXEL11_20 break;
+      }
+    case 18:
+    case 50: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_20 PIXEL11_21 break;
+      }
+    case 80:
+    case 81: {
+            PIXEL00_20 PIXEL01_22 PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 72:
+    case 76: {
+            PIXEL00_21 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 10:
+    case 138: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 PIXEL10_22 PIXEL11_20 break;
+      }
+    case 66: {
+            PIXEL00_22 PIXEL01_21 PIXEL10_21 PIXEL11_22 break;
+      }
+    case 24: {
+            PIXEL00_21 PIXEL01_22 PIXEL10_22 PIXEL11_21 break;
+      }
+    case 7:
+    case 39:
+    case 135: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 148:
+    case 149:
+    case 180: {
+            PIXEL00_20 PIXEL01_11 PIXEL10_20 PIXEL11_12 break;
+      }
+    case 224:
+    case 228:
+    case 225: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 41:
+    case 169:
+    case 45: {
+            PIXEL00_12 PIXEL01_20 PIXEL10_11 PIXEL11_20 break;
+      }
+    case 22:
+    case 54: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_20 PIXEL11_21 break;
+      }
+    case 208:
+    case 209: {
+            PIXEL00_20 PIXEL01_22 PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 104:
+    case 108: {
+            PIXEL00_21 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 11:
+    case 139: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 PIXEL10_22 PIXEL11_20 break;
+      }
+    case 19:
+    case 51: {
+            if(Diff(2, 6))
+            {
+            PIXEL00_11 PIXEL01_10}
+            else {
+            PIXEL00_60 PIXEL01_90}
+            PIXEL10_20 PIXEL11_21 break;
+      }
+    case 146:
+    case 178: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_10 PIXEL11_12}
+            else {
+            PIXEL01_90 PIXEL11_61}
+            PIXEL10_20 break;
+      }
+    case 84:
+    case 85: {
+            PIXEL00_20 if(Diff(6, 8))
+            {
+            PIXEL01_11 PIXEL11_10}
+            else {
+            PIXEL01_60 PIXEL11_90}
+            PIXEL10_21 break;
+      }
+    case 112:
+    case 113: {
+            PIXEL00_20 PIXEL01_22 if(Diff(6, 8))
+            {
+            PIXEL10_12 PIXEL11_10}
+            else {
+            PIXEL10_61 PIXEL11_90}
+            break;
+      }
+    case 200:
+    case 204: {
+            PIXEL00_21 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_10 PIXEL11_11}
+            else {
+            PIXEL10_90 PIXEL11_60}
+            break;
+      }
+    case 73:
+    case 77: {
+            if(Diff(8, 4))
+            {
+            PIXEL00_12 PIXEL10_10}
+            else {
+            PIXEL00_61 PIXEL10_90}
+            PIXEL01_20 PIXEL11_22 break;
+      }
+    case 42:
+    case 170: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10 PIXEL10_11}
+            else {
+            PIXEL00_90 PIXEL10_60}
+            PIXEL01_21 PIXEL11_20 break;
+      }
+    case 14:
+    case 142: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10 PIXEL01_12}
+            else {
+            PIXEL00_90 PIXEL01_61}
+            PIXEL10_22 PIXEL11_20 break;
+      }
+    case 67: {
+            PIXEL00_11 PIXEL01_21 PIXEL10_21 PIXEL11_22 break;
+      }
+    case 70: {
+            PIXEL00_22 PIXEL01_12 PIXEL10_21 PIXEL11_22 break;
+      }
+    case 28: {
+            PIXEL00_21 PIXEL01_11 PIXEL10_22 PIXEL11_21 break;
+      }
+    case 152: {
+            PIXEL00_21 PIXEL01_22 PIXEL10_22 PIXEL11_12 break;
+      }
+    case 194: {
+            PIXEL00_22 PIXEL01_21 PIXEL10_21 PIXEL11_11 break;
+      }
+    case 98: {
+            PIXEL00_22 PIXEL01_21 PIXEL10_12 PIXEL11_22 break;
+      }
+    case 56: {
+            PIXEL00_21 PIXEL01_22 PIXEL10_11 PIXEL11_21 break;
+      }
+    case 25: {
+            PIXEL00_12 PIXEL01_22 PIXEL10_22 PIXEL11_21 break;
+      }
+    case 26:
+    case 31: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_22 PIXEL11_21 break;
+      }
+    case 82:
+    case 214: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 88:
+    case 248: {
+            PIXEL00_21 PIXEL01_22 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 74:
+    case 107: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 27: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_10 PIXEL10_22 PIXEL11_21 break;
+      }
+    case 86: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_21 PIXEL11_10 break;
+      }
+    case 216: {
+            PIXEL00_21 PIXEL01_22 PIXEL10_10 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 106: {
+            PIXEL00_10 PIXEL01_21 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 30: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_22 PIXEL11_21 break;
+      }
+    case 210: {
+            PIXEL00_22 PIXEL01_10 PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 120: {
+            PIXEL00_21 PIXEL01_22 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_10 break;
+      }
+    case 75: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 PIXEL10_10 PIXEL11_22 break;
+      }
+    case 29: {
+            PIXEL00_12 PIXEL01_11 PIXEL10_22 PIXEL11_21 break;
+      }
+    case 198: {
+            PIXEL00_22 PIXEL01_12 PIXEL10_21 PIXEL11_11 break;
+      }
+    case 184: {
+            PIXEL00_21 PIXEL01_22 PIXEL10_11 PIXEL11_12 break;
+      }
+    case 99: {
+            PIXEL00_11 PIXEL01_21 PIXEL10_12 PIXEL11_22 break;
+      }
+    case 57: {
+            PIXEL00_12 PIXEL01_22 PIXEL10_11 PIXEL11_21 break;
+      }
+    case 71: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_21 PIXEL11_22 break;
+      }
+    case 156: {
+            PIXEL00_21 PIXEL01_11 PIXEL10_22 PIXEL11_12 break;
+      }
+    case 226: {
+            PIXEL00_22 PIXEL01_21 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 60: {
+            PIXEL00_21 PIXEL01_11 PIXEL10_11 PIXEL11_21 break;
+      }
+    case 195: {
+            PIXEL00_11 PIXEL01_21 PIXEL10_21 PIXEL11_11 break;
+      }
+    case 102: {
+            PIXEL00_22 PIXEL01_12 PIXEL10_12 PIXEL11_22 break;
+      }
+    case 153: {
+            PIXEL00_12 PIXEL01_22 PIXEL10_22 PIXEL11_12 break;
+      }
+    case 58: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_11 PIXEL11_21 break;
+      }
+    case 83: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 92: {
+            PIXEL00_21 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 202: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            PIXEL01_21 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            PIXEL11_11 break;
+      }
+    case 78: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            PIXEL11_22 break;
+      }
+    case 154: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_22 PIXEL11_12 break;
+      }
+    case 114: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 89: {
+            PIXEL00_12 PIXEL01_22 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 90: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 55:
+    case 23: {
+            if(Diff(2, 6))
+            {
+            PIXEL00_11 PIXEL01_0}
+            else {
+            PIXEL00_60 PIXEL01_90}
+            PIXEL10_20 PIXEL11_21 break;
+      }
+    case 182:
+    case 150: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0 PIXEL11_12}
+            else {
+            PIXEL01_90 PIXEL11_61}
+            PIXEL10_20 break;
+      }
+    case 213:
+    case 212: {
+            PIXEL00_20 if(Diff(6, 8))
+            {
+            PIXEL01_11 PIXEL11_0}
+            else {
+            PIXEL01_60 PIXEL11_90}
+            PIXEL10_21 break;
+      }
+    case 241:
+    case 240: {
+            PIXEL00_20 PIXEL01_22 if(Diff(6, 8))
+            {
+            PIXEL10_12 PIXEL11_0}
+            else {
+            PIXEL10_61 PIXEL11_90}
+            break;
+      }
+    case 236:
+    case 232: {
+            PIXEL00_21 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_0 PIXEL11_11}
+            else {
+            PIXEL10_90 PIXEL11_60}
+            break;
+      }
+    case 109:
+    case 105: {
+            if(Diff(8, 4))
+            {
+            PIXEL00_12 PIXEL10_0}
+            else {
+            PIXEL00_61 PIXEL10_90}
+            PIXEL01_20 PIXEL11_22 break;
+      }
+    case 171:
+    case 43: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0 PIXEL10_11}
+            else {
+            PIXEL00_90 PIXEL10_60}
+            PIXEL01_21 PIXEL11_20 break;
+      }
+    case 143:
+    case 15: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0 PIXEL01_12}
+            else {
+            PIXEL00_90 PIXEL01_61}
+            PIXEL10_22 PIXEL11_20 break;
+      }
+    case 124: {
+            PIXEL00_21 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_10 break;
+      }
+    case 203: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 PIXEL10_10 PIXEL11_11 break;
+      }
+    case 62: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_11 PIXEL11_21 break;
+      }
+    case 211: {
+            PIXEL00_11 PIXEL01_10 PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 118: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_12 PIXEL11_10 break;
+      }
+    case 217: {
+            PIXEL00_12 PIXEL01_22 PIXEL10_10 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 110: {
+            PIXEL00_10 PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 155: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_10 PIXEL10_22 PIXEL11_12 break;
+      }
+    case 188: {
+            PIXEL00_21 PIXEL01_11 PIXEL10_11 PIXEL11_12 break;
+      }
+    case 185: {
+            PIXEL00_12 PIXEL01_22 PIXEL10_11 PIXEL11_12 break;
+      }
+    case 61: {
+            PIXEL00_12 PIXEL01_11 PIXEL10_11 PIXEL11_21 break;
+      }
+    case 157: {
+            PIXEL00_12 PIXEL01_11 PIXEL10_22 PIXEL11_12 break;
+      }
+    case 103: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_12 PIXEL11_22 break;
+      }
+    case 227: {
+            PIXEL00_11 PIXEL01_21 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 230: {
+            PIXEL00_22 PIXEL01_12 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 199: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_21 PIXEL11_11 break;
+      }
+    case 220: {
+            PIXEL00_21 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 158: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_22 PIXEL11_12 break;
+      }
+    case 234: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            PIXEL01_21 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_11 break;
+      }
+    case 242: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 59: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_11 PIXEL11_21 break;
+      }
+    case 121: {
+            PIXEL00_12 PIXEL01_22 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 87: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 79: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            PIXEL11_22 break;
+      }
+    case 122: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 94: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 218: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 91: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 229: {
+            PIXEL00_20 PIXEL01_20 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 167: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_20 PIXEL11_20 break;
+      }
+    case 173: {
+            PIXEL00_12 PIXEL01_20 PIXEL10_11 PIXEL11_20 break;
+      }
+    case 181: {
+            PIXEL00_20 PIXEL01_11 PIXEL10_20 PIXEL11_12 break;
+      }
+    case 186: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_11 PIXEL11_12 break;
+      }
+    case 115: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 93: {
+            PIXEL00_12 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 206: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            PIXEL11_11 break;
+      }
+    case 205:
+    case 201: {
+            PIXEL00_12 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_10}
+            else
+            {
+            PIXEL10_70}
+            PIXEL11_11 break;
+      }
+    case 174:
+    case 46: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_10}
+            else
+            {
+            PIXEL00_70}
+            PIXEL01_12 PIXEL10_11 PIXEL11_20 break;
+      }
+    case 179:
+    case 147: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_10}
+            else
+            {
+            PIXEL01_70}
+            PIXEL10_20 PIXEL11_12 break;
+      }
+    case 117:
+    case 116: {
+            PIXEL00_20 PIXEL01_11 PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_10}
+            else
+            {
+            PIXEL11_70}
+            break;
+      }
+    case 189: {
+            PIXEL00_12 PIXEL01_11 PIXEL10_11 PIXEL11_12 break;
+      }
+    case 231: {
+            PIXEL00_11 PIXEL01_12 PIXEL10_12 PIXEL11_11 break;
+      }
+    case 126: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_10 break;
+      }
+    case 219: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_10 PIXEL10_10 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 125: {
+            if(Diff(8, 4))
+            {
+            PIXEL00_12 PIXEL10_0}
+            else {
+            PIXEL00_61 PIXEL10_90}
+            PIXEL01_11 PIXEL11_10 break;
+      }
+    case 221: {
+            PIXEL00_12 if(Diff(6, 8))
+            {
+            PIXEL01_11 PIXEL11_0}
+            else {
+            PIXEL01_60 PIXEL11_90}
+            PIXEL10_10 break;
+      }
+    case 207: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0 PIXEL01_12}
+            else {
+            PIXEL00_90 PIXEL01_61}
+            PIXEL10_10 PIXEL11_11 break;
+      }
+    case 238: {
+            PIXEL00_10 PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_0 PIXEL11_11}
+            else {
+            PIXEL10_90 PIXEL11_60}
+            break;
+      }
+    case 190: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0 PIXEL11_12}
+            else {
+            PIXEL01_90 PIXEL11_61}
+            PIXEL10_11 break;
+      }
+    case 187: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0 PIXEL10_11}
+            else {
+            PIXEL00_90 PIXEL10_60}
+            PIXEL01_10 PIXEL11_12 break;
+      }
+    case 243: {
+            PIXEL00_11 PIXEL01_10 if(Diff(6, 8))
+            {
+            PIXEL10_12 PIXEL11_0}
+            else {
+            PIXEL10_61 PIXEL11_90}
+            break;
+      }
+    case 119: {
+            if(Diff(2, 6))
+            {
+            PIXEL00_11 PIXEL01_0}
+            else {
+            PIXEL00_60 PIXEL01_90}
+            PIXEL10_12 PIXEL11_10 break;
+      }
+    case 237:
+    case 233: {
+            PIXEL00_12 PIXEL01_20 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            PIXEL11_11 break;
+      }
+    case 175:
+    case 47: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            PIXEL01_12 PIXEL10_11 PIXEL11_20 break;
+      }
+    case 183:
+    case 151: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_20 PIXEL11_12 break;
+      }
+    case 245:
+    case 244: {
+            PIXEL00_20 PIXEL01_11 PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 250: {
+            PIXEL00_10 PIXEL01_10 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 123: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_10 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_10 break;
+      }
+    case 95: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_10 PIXEL11_10 break;
+      }
+    case 222: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_10 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 252: {
+            PIXEL00_21 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 249: {
+            PIXEL00_12 PIXEL01_22 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 235: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_21 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            PIXEL11_11 break;
+      }
+    case 111: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_22 break;
+      }
+    case 63: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_11 PIXEL11_21 break;
+      }
+    case 159: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_22 PIXEL11_12 break;
+      }
+    case 215: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_21 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 246: {
+            PIXEL00_22 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 254: {
+            PIXEL00_10 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 253: {
+            PIXEL00_12 PIXEL01_11 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 251: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            PIXEL01_10 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 239: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            PIXEL01_12 if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            PIXEL11_11 break;
+      }
+    case 127: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_20}
+            if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_20}
+            PIXEL11_10 break;
+      }
+    case 191: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_11 PIXEL11_12 break;
+      }
+    case 223: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_20}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_10 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_20}
+            break;
+      }
+    case 247: {
+            PIXEL00_11 if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            PIXEL10_12 if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    case 255: {
+            if(Diff(4, 2))
+            {
+            PIXEL00_0}
+            else
+            {
+            PIXEL00_100}
+            if(Diff(2, 6))
+            {
+            PIXEL01_0}
+            else
+            {
+            PIXEL01_100}
+            if(Diff(8, 4))
+            {
+            PIXEL10_0}
+            else
+            {
+            PIXEL10_100}
+            if(Diff(6, 8))
+            {
+            PIXEL11_0}
+            else
+            {
+            PIXEL11_100}
+            break;
+      }
+    }
+
+#undef Diff
+}
+
+/**
+ * Upscales the source rows [@a begin, @a end).
+ */
+static void upscaleRows(const Planes &planes, int width, int begin, int end, uint8_t *dst)
+{
+    const texfilter::InstructionSet isa = texfilter::instructionSet();
+    const int stride = planes.stride;
+    const int BpL    = 8 * width; // (Out) Bytes per Line.
+
+    for (int y = begin; y < end; ++y)
+    {
+        const uint32_t *colorUp   = &planes.color[size_t(y) * stride];
+        const uint32_t *colorMid  = colorUp + stride;
+        const uint32_t *colorDown = colorMid + stride;
+        const uint32_t *yuvUp     = &planes.yuv[size_t(y) * stride];
+        const uint32_t *yuvMid    = yuvUp + stride;
+        const uint32_t *yuvDown   = yuvMid + stride;
+
+        uint8_t *pOut = dst + size_t(y) * 2 * BpL;
+        for (int x = 0; x < width; ++x, pOut += 8)
+        {
+            int pattern;
+#if defined(HQX_SSE2)
+            if (isa == texfilter::SSE2)
+                pattern = patternSSE2(yuvUp + x, yuvMid + x, yuvDown + x);
+            else
+#elif defined(HQX_NEON)
+            if (isa == texfilter::NEON)
+                pattern = patternNEON(yuvUp + x, yuvMid + x, yuvDown + x);
+            else
+#endif
+                pattern = patternScalar(yuvUp + x, yuvMid + x, yuvDown + x);
+
+            const uint32_t w[10] = {
+                0,
+                colorUp[x],   colorUp[x + 1],   colorUp[x + 2],
+                colorMid[x],  colorMid[x + 1],  colorMid[x + 2],
+                colorDown[x], colorDown[x + 1], colorDown[x + 2]
+            };
+            const uint32_t yuv[10] = {
+                0,
+                yuvUp[x],   yuvUp[x + 1],   yuvUp[x + 2],
+                yuvMid[x],  yuvMid[x + 1],  yuvMid[x + 2],
+                yuvDown[x], yuvDown[x + 1], yuvDown[x + 2]
+            };
+
+            hq2xBlock(pattern, w, yuv, pOut, BpL);
+        }
+    }
+}
+
+/**
+ * Calls @a func for bands of rows, concurrently if the image is large enough.
+ */
+static void forRowBands(int rows, int rowPixels, const std::function<void (int, int)> &func)
+{
+    const int minRows = std::max(1, MIN_BAND_PIXELS / std::max(1, rowPixels));
+    if (!texfilter::isMultithreaded() || rows < 2 * minRows)
+    {
+        func(0, rows);
+        return;
+    }
+    de::TaskPool::forBatches(rows, [&func] (int, int begin, int end) {
+        func(begin, end);
+    }, minRows);
+}
+
+void upscale(const uint8_t *src, int width, int height, bool wrapH, bool wrapV, uint8_t *dst)
+{
+    if (width <= 0 || height <= 0) return;
+
+    Planes planes(width, height);
+    forRowBands(height + 2, width, [&] (int begin, int end) {
+        for (int py = begin; py < end; ++py)
+        {
+            fillPlaneRow(planes, src, width, height, wrapH, wrapV, py);
+        }
+    });
+    forRowBands(height, width, [&] (int begin, int end) {
+        upscaleRows(planes, width, begin, end, dst);
+    });
+}
+
+} // namespace hqx
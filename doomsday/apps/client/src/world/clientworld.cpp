@@ -25,6 +25,7 @@
 #include "dd_loop.h"
 #include "def_main.h"  // ::defs
 #include "api_player.h"
+#include "network/net_demo.h"
 #include "network/net_main.h"
 #include "api_mapedit.h"
 #include "world/p_players.h"
@@ -195,6 +196,7 @@ void ClientWorld::mapFinalized()
     // Prepare the client-side data.
     Cl_ResetFrame();
     Cl_InitPlayers();  // Player data, too (reset to zero).
+    Demo_MapChanged();
 
     auto &rendSys = ClientApp::render();
 
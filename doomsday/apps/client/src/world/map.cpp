@@ -73,6 +73,7 @@
 #include <de/logbuffer.h>
 #include <de/hash.h>
 #include <de/rectangle.h>
+#include <de/taskpool.h>
 #include <de/charsymbols.h>
 #include <de/legacy/aabox.h>
 #include <de/legacy/nodepile.h>
@@ -81,6 +82,7 @@
 
 #include <array>
 #include <map>
+#include <vector>
 
 using namespace de;
 using world::World;
@@ -414,13 +416,15 @@ DE_PIMPL(Map)
     {
         if (!self().hasManifest()) return;
 
+        const res::Uri mapUri = self().manifest().composeUri();
+
         for (int i = 0; i < DED_Definitions()->ptcGens.size(); ++i)
         {
             ded_ptcgen_t *genDef = &DED_Definitions()->ptcGens[i];
 
             if (!genDef->map) continue;
 
-            if (*genDef->map != self().manifest().composeUri())
+            if (*genDef->map != mapUri)
                 continue;
 
             // Are we still spawning using this generator?
@@ -663,10 +667,13 @@ void Map::initRadio()
 
     Time begunAt;
 
-    forAllVertices([](world::Vertex &vtx) {
-        vtx.as<Vertex>().updateShadowOffsets();
-        return LoopContinue;
-    });
+    // Each vertex only updates the shadow offsets of its own line owners.
+    TaskPool::forBatches(vertexCount(), [this](int, int begin, int end) {
+        for (int i = begin; i < end; ++i)
+        {
+            vertex(i).as<Vertex>().updateShadowOffsets();
+        }
+    }, 256);
 
     /// The algorithm:
     ///
@@ -675,49 +682,55 @@ void Map::initRadio()
     /// 2. Check the ConvexSubspaces whose sector is the same as the line.
     /// 3. If any of the shadow points are in the subspace, or any of the shadow edges cross one
     ///    of the subspace's edges (not parallel), link the line to the ConvexSubspace.
-    forAllLines([this](world::Line &wline)
+    ///
+    /// The blockmap queries are done concurrently for batches of lines. The found links are
+    /// collected per batch and applied afterwards in line order.
+    using ShadowLink  = std::pair<ConvexSubspace *, LineSide *>;
+    using ShadowLinks = std::vector<ShadowLink>;
+
+    std::vector<ShadowLinks> batchLinks(TaskPool::batchCount(lineCount(), 64));
+
+    TaskPool::forBatches(lineCount(), [this, &batchLinks](int batch, int begin, int end)
     {
-        Line &line = wline.as<Line>();
+        ShadowLinks &links = batchLinks[batch];
 
-        if (!line.isShadowCaster())
+        for (int lineIndex = begin; lineIndex < end; ++lineIndex)
         {
-            return LoopContinue;
-        }
+            Line &line = this->line(lineIndex).as<Line>();
 
-        // For each side of the line.
-        for (int i = 0; i < 2; ++i)
-        {
-            LineSide &side = line.side(i).as<LineSide>();
+            if (!line.isShadowCaster()) continue;
 
-            if (!side.hasSector()) continue;
-            if (!side.hasSections()) continue;
+            // For each side of the line.
+            for (int i = 0; i < 2; ++i)
+            {
+                LineSide &side = line.side(i).as<LineSide>();
 
-            // Skip sides which share one or more edge with malformed geometry.
-            if (!side.leftHEdge() || !side.rightHEdge()) continue;
+                if (!side.hasSector()) continue;
+                if (!side.hasSections()) continue;
 
-            const auto &vtx0 = line.vertex(i);
-            const auto &vtx1 = line.vertex(i ^ 1);
-            const auto *vo0  = line.vertexOwner(i) -> next();
-            const auto *vo1  = line.vertexOwner(i ^ 1) -> prev();
+                // Skip sides which share one or more edge with malformed geometry.
+                if (!side.leftHEdge() || !side.rightHEdge()) continue;
 
-            AABoxd bounds = line.bounds();
+                const auto &vtx0 = line.vertex(i);
+                const auto &vtx1 = line.vertex(i ^ 1);
+                const auto *vo0  = line.vertexOwner(i) -> next();
+                const auto *vo1  = line.vertexOwner(i ^ 1) -> prev();
 
-            // Use the extended points, they are wider than inoffsets.
-            const Vec2d sv0 = vtx0.origin() + vo0->extendedShadowOffset();
-            V2d_AddToBoxXY(bounds.arvec2, sv0.x, sv0.y);
+                AABoxd bounds = line.bounds();
 
-            const Vec2d sv1 = vtx1.origin() + vo1->extendedShadowOffset();
-            V2d_AddToBoxXY(bounds.arvec2, sv1.x, sv1.y);
+                // Use the extended points, they are wider than inoffsets.
+                const Vec2d sv0 = vtx0.origin() + vo0->extendedShadowOffset();
+                V2d_AddToBoxXY(bounds.arvec2, sv0.x, sv0.y);
 
-            // Link the shadowing line to all the subspaces whose axis-aligned bounding box
-            // intersects 'bounds'.
-            const int localValidCount = ++World::validCount;
-            subspaceBlockmap().forAllInBox(bounds, [&bounds, &side, &localValidCount] (void *object)
-            {
-                auto &sub = *reinterpret_cast<world::ConvexSubspace *>(object);
-                if (sub.validCount() != localValidCount)  // not yet processed
+                const Vec2d sv1 = vtx1.origin() + vo1->extendedShadowOffset();
+                V2d_AddToBoxXY(bounds.arvec2, sv1.x, sv1.y);
+
+                // Link the shadowing line to all the subspaces whose axis-aligned bounding
+                // box intersects 'bounds'. Subspaces spanning several blocks are found more
+                // than once; the shadow line set of the subspace ignores the duplicates.
+                subspaceBlockmap().forAllInBox(bounds, [&bounds, &side, &links] (void *object)
                 {
-                    sub.setValidCount(localValidCount);
+                    auto &sub = *reinterpret_cast<world::ConvexSubspace *>(object);
                     if (&sub.subsector().sector() == side.sectorPtr())
                     {
                         // Check the bounds.
@@ -727,22 +740,32 @@ void Map::initRadio()
                               || polyBox.minY > bounds.maxY
                               || polyBox.maxY < bounds.minY))
                         {
-                            sub.as<ConvexSubspace>().addShadowLine(side);
+                            links.emplace_back(&sub.as<ConvexSubspace>(), &side);
                         }
                     }
-                }
-                return LoopContinue;
-            });
+                    return LoopContinue;
+                });
+            }
         }
-        return LoopContinue;
-    });
+    }, 64);
+
+    for (const ShadowLinks &links : batchLinks)
+    {
+        for (const ShadowLink &link : links)
+        {
+            link.first->addShadowLine(*link.second);
+        }
+    }
 
     LOGDEV_GL_MSG("Completed in %.2f seconds") << begunAt.since();
 }
 
 void Map::initContactBlockmaps()
 {
+    LOG_AS("Map::initContactBlockmaps");
+    Time begunAt;
     d->initContactBlockmaps();
+    LOGDEV_MAP_VERBOSE("Completed in %.2f seconds") << begunAt.since();
 }
 
 void Map::spreadAllContacts(const AABoxd &region)
@@ -761,6 +784,8 @@ void Map::initGenerators()
 {
     LOG_AS("Map::initGenerators");
     Time begunAt;
+    // Spawning stays serial: the generators are allocated from the shared table and
+    // presimulation draws from the global random number generator in definition order.
     d->spawnTypeParticleGens();
     d->spawnMapParticleGens();
     LOGDEV_MAP_VERBOSE("Completed in %.2f seconds") << begunAt.since();
@@ -770,14 +795,45 @@ void Map::spawnPlaneParticleGens()
 {
     //if (!useParticles) return;
 
-    forAllSectors([](world::Sector &sector) {
-        auto &floor = sector.floor().as<Plane>();
-        floor.spawnParticleGen(Def_GetGenerator(floor.surface().composeMaterialUri()));
+    LOG_AS("Map::spawnPlaneParticleGens");
+    Time begunAt;
 
-        auto &ceiling = sector.ceiling().as<Plane>();
-        ceiling.spawnParticleGen(Def_GetGenerator(ceiling.surface().composeMaterialUri()));
-        return LoopContinue;
-    });
+    // Uri caches its resolved path. Resolve the definitions' material URIs in advance
+    // so they are only read when compared concurrently below.
+    auto &defs = *DED_Definitions();
+    for (int i = 0; i < defs.ptcGens.size(); ++i)
+    {
+        if (const res::Uri *material = defs.ptcGens[i].material)
+        {
+            try
+            {
+                material->resolved();
+            }
+            catch (const res::Uri::ResolveError &)
+            {}  // Ignore this error.
+        }
+    }
+
+    // Look up the generators of each plane in parallel. The generators are spawned
+    // afterwards in sector order.
+    std::vector<const ded_ptcgen_t *> planeGens(2 * sectorCount());
+    TaskPool::forBatches(sectorCount(), [this, &planeGens](int, int begin, int end) {
+        for (int i = begin; i < end; ++i)
+        {
+            const auto &sector = this->sector(i);
+            planeGens[2 * i]     = Def_GetGenerator(sector.floor  ().surface().composeMaterialUri());
+            planeGens[2 * i + 1] = Def_GetGenerator(sector.ceiling().surface().composeMaterialUri());
+        }
+    }, 64);
+
+    for (int i = 0; i < sectorCount(); ++i)
+    {
+        auto &sector = this->sector(i);
+        sector.floor  ().as<Plane>().spawnParticleGen(planeGens[2 * i]);
+        sector.ceiling().as<Plane>().spawnParticleGen(planeGens[2 * i + 1]);
+    }
+
+    LOGDEV_MAP_VERBOSE("Completed in %.2f seconds") << begunAt.since();
 }
 
 void Map::clearClMobjs()
@@ -800,7 +856,7 @@ mobj_t *Map::clMobjFor(thid_t id, bool canCreate) const
     // Create a new client mobj. This is a regular mobj that has network state
     // associated with it.
 
-    MobjThinker mob(Thinker::AllocateMemoryZone);
+    MobjThinker mob(Thinker::AllocatePooled);
     mob.id       = id;
     mob.function = reinterpret_cast<thinkfunc_t>(gx.MobjThinker);
 
@@ -884,83 +940,105 @@ void Map::initSkyFix()
 
     LOG_AS("Map::initSkyFix");
 
-    d->skyFloor  .setHeight(DDMAXFLOAT);
-    d->skyCeiling.setHeight(DDMINFLOAT);
+    /// Sky fix heights determined by one batch of sectors.
+    struct SkyFixHeights
+    {
+        ddouble floor   = DDMAXFLOAT;
+        ddouble ceiling = DDMINFLOAT;
+        List<world::Sector *> sectorsWithWalls; ///< In map order.
+    };
+
+    std::vector<SkyFixHeights> batchHeights(TaskPool::batchCount(sectorCount(), 64));
 
     // Update for sector plane heights and mobjs which intersect the ceiling.
     /// @todo Can't we defer this?
-    forAllSectors([this](world::Sector &sector)
+    TaskPool::forBatches(sectorCount(), [this, &batchHeights](int batch, int begin, int end)
     {
-        if (!sector.sideCount()) return LoopContinue;
+        SkyFixHeights &fix = batchHeights[batch];
 
-        const bool skyFloor = sector.floor  ().surface().hasSkyMaskedMaterial();
-        const bool skyCeil  = sector.ceiling().surface().hasSkyMaskedMaterial();
+        for (int i = begin; i < end; ++i)
+        {
+            auto &sector = this->sector(i);
 
-        if (!skyFloor && !skyCeil) return LoopContinue;
+            if (!sector.sideCount()) continue;
 
-        if (skyCeil)
-        {
-            // Adjust for the plane height.
-            if (sector.ceiling().as<Plane>().heightSmoothed() > d->skyCeiling.height())
-            {
-                // Must raise the skyfix ceiling.
-                d->skyCeiling.setHeight(sector.ceiling().as<Plane>().heightSmoothed());
-            }
+            const bool skyFloor = sector.floor  ().surface().hasSkyMaskedMaterial();
+            const bool skyCeil  = sector.ceiling().surface().hasSkyMaskedMaterial();
+
+            if (!skyFloor && !skyCeil) continue;
 
-            // Check that all the mobjs in the sector fit in.
-            for (mobj_t *mob = sector.firstMobj(); mob; mob = mob->sNext)
+            if (skyCeil)
             {
-                ddouble extent = mob->origin[2] + mob->height;
-                if (extent > d->skyCeiling.height())
+                // Adjust for the plane height.
+                fix.ceiling = de::max(fix.ceiling, sector.ceiling().as<Plane>().heightSmoothed());
+
+                // Check that all the mobjs in the sector fit in.
+                for (mobj_t *mob = sector.firstMobj(); mob; mob = mob->sNext)
                 {
-                    // Must raise the skyfix ceiling.
-                    d->skyCeiling.setHeight(extent);
+                    fix.ceiling = de::max(fix.ceiling, mob->origin[2] + mob->height);
                 }
             }
-        }
 
-        if (skyFloor)
-        {
-            // Adjust for the plane height.
-            if (sector.floor().as<Plane>().heightSmoothed() < d->skyFloor.height())
+            if (skyFloor)
             {
-                // Must lower the skyfix floor.
-                d->skyFloor.setHeight(sector.floor().as<Plane>().heightSmoothed());
+                // Adjust for the plane height.
+                fix.floor = de::min(fix.floor, sector.floor().as<Plane>().heightSmoothed());
             }
+
+            fix.sectorsWithWalls << &sector;
         }
+    }, 64);
+
+    ddouble skyFloorHeight   = DDMAXFLOAT;
+    ddouble skyCeilingHeight = DDMINFLOAT;
+    for (const SkyFixHeights &fix : batchHeights)
+    {
+        skyFloorHeight   = de::min(skyFloorHeight,   fix.floor);
+        skyCeilingHeight = de::max(skyCeilingHeight, fix.ceiling);
+    }
 
-        // Update for middle materials on lines which intersect the floor and/or ceiling
-        // on the front (i.e., sector) side.
-        sector.forAllSides([this, &skyCeil, &skyFloor](world::LineSide &side) {
-            if (!side.hasSections()) return LoopContinue;
-            if (!side.middle().hasMaterial()) return LoopContinue;
+    // Update for middle materials on lines which intersect the floor and/or ceiling
+    // on the front (i.e., sector) side. WallEdge is not thread-safe, so this is done
+    // serially for the sectors found above.
+    for (const SkyFixHeights &fix : batchHeights)
+    {
+        for (world::Sector *sector : fix.sectorsWithWalls)
+        {
+            const bool skyFloor = sector->floor  ().surface().hasSkyMaskedMaterial();
+            const bool skyCeil  = sector->ceiling().surface().hasSkyMaskedMaterial();
 
-            // There must be a sector on both sides.
-            if (!side.hasSector() || !side.back().hasSector()) return LoopContinue;
+            sector->forAllSides([&](world::LineSide &side) {
+                if (!side.hasSections()) return LoopContinue;
+                if (!side.middle().hasMaterial()) return LoopContinue;
 
-            // Possibility of degenerate BSP leaf.
-            if (!side.leftHEdge()) return LoopContinue;
+                // There must be a sector on both sides.
+                if (!side.hasSector() || !side.back().hasSector()) return LoopContinue;
 
-            WallEdge edge(WallSpec::fromMapSide(side.as<LineSide>(), LineSide::Middle), *side.leftHEdge(), Line::From);
+                // Possibility of degenerate BSP leaf.
+                if (!side.leftHEdge()) return LoopContinue;
 
-            if (edge.isValid() && edge.top().z() > edge.bottom().z())
-            {
-                if (skyCeil && edge.top().z() + edge.origin().y > d->skyCeiling.height())
-                {
-                    // Must raise the skyfix ceiling.
-                    d->skyCeiling.setHeight(edge.top().z() + edge.origin().y);
-                }
-                if (skyFloor && edge.bottom().z() + edge.origin().y < d->skyFloor.height())
+                WallEdge edge(WallSpec::fromMapSide(side.as<LineSide>(), LineSide::Middle), *side.leftHEdge(), Line::From);
+
+                if (edge.isValid() && edge.top().z() > edge.bottom().z())
                 {
-                    // Must lower the skyfix floor.
-                    d->skyFloor.setHeight(edge.bottom().z() + edge.origin().y);
+                    if (skyCeil)
+                    {
+                        // Must raise the skyfix ceiling?
+                        skyCeilingHeight = de::max(skyCeilingHeight, edge.top().z() + edge.origin().y);
+                    }
+                    if (skyFloor)
+                    {
+                        // Must lower the skyfix floor?
+                        skyFloorHeight = de::min(skyFloorHeight, edge.bottom().z() + edge.origin().y);
+                    }
                 }
-            }
-            return LoopContinue;
-        });
+                return LoopContinue;
+            });
+        }
+    }
 
-        return LoopContinue;
-    });
+    d->skyFloor  .setHeight(skyFloorHeight);
+    d->skyCeiling.setHeight(skyCeilingHeight);
 
     LOGDEV_MAP_VERBOSE("Completed in %.2f seconds") << begunAt.since();
 }
@@ -1238,6 +1316,10 @@ void Map::deserializeInternalState(Reader &from, const world::IThinkerMapping &t
 
 void Map::redecorate()
 {
+    LOG_AS("Map::redecorate");
+    Time begunAt;
+    // Marking is a single flag per subsector; batching it on the thread pool would
+    // cost more than it saves.
     forAllSectors([](world::Sector &sector)
     {
         sector.forAllSubsectors([](world::Subsector &subsec)
@@ -1247,6 +1329,7 @@ void Map::redecorate()
         });
         return LoopContinue;
     });
+    LOGDEV_MAP_VERBOSE("Completed in %.2f seconds") << begunAt.since();
 }
 
 void Map::worldFrameState(world::World::FrameState frameState)
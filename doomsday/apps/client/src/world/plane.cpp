@@ -219,6 +219,12 @@ bool Plane::receivesShadow() const
     return castsShadow();  // Qualification is the same as with casting.
 }
 
+dsize Plane::memoryUsage() const
+{
+    return world::Plane::memoryUsage() + sizeof(Plane) - sizeof(world::Plane)
+         + audienceForHeightSmoothedChange.allocatedSize();
+}
+
 Generator *Plane::tryFindGenerator() const
 {
     /// @todo Cache this result.
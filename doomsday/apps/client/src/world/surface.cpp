@@ -155,3 +155,9 @@ Map &Surface::map() const
 {
     return world::Surface::map().as<Map>();
 }
+
+dsize Surface::memoryUsage() const
+{
+    return world::Surface::memoryUsage() + sizeof(Surface) - sizeof(world::Surface)
+         + audienceForOriginSmoothedChange.allocatedSize();
+}
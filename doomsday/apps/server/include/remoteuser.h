@@ -64,6 +64,11 @@ public:
      */
     bool isFromLocalHost() const;
 
+    /**
+     * Returns the user's socket, or @c nullptr if it has been taken.
+     */
+    const de::Socket *socket() const;
+
     /**
      * Relinquishes ownership of the user's socket.
      * @return Caller gets ownership of the returned socket.
@@ -64,6 +64,12 @@ void Sv_PlayerLeaves(nodeid_t nodeID);
 
 void Sv_Handshake(int playernum, dd_bool newplayer);
 
+/**
+ * Discards the cached handshake messages. Must be called when the definitions
+ * are reloaded.
+ */
+void Sv_InvalidateHandshake();
+
 void Sv_GetPackets();
 
 /**
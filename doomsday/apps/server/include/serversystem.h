@@ -23,6 +23,7 @@
 #include <de/system.h>
 #include <de/id.h>
 #include <de/error.h>
+#include <de/record.h>
 #include "remoteuser.h"
 #include "dd_types.h"
 
@@ -88,6 +89,15 @@ public:
      */
     int userCount() const;
 
+    /**
+     * Composes a snapshot of the server's recent load: tick and frame
+     * transmission times (in milliseconds) over the last few seconds, output
+     * bandwidth and compression, thinker count, and memory zone usage. For each
+     * connected client, the outgoing data rate, compression ratio and number of
+     * unacknowledged deltas are included as parallel arrays.
+     */
+    de::Record loadStatus() const;
+
     /**
      * Prints the status of the server into the log.
      */
@@ -20,6 +20,7 @@
 #ifndef SERVER_SHELLUSER_H
 #define SERVER_SHELLUSER_H
 
+#include <de/record.h>
 #include <de/socket.h>
 #include <doomsday/network/link.h>
 #include "users.h"
@@ -55,6 +56,13 @@ public:
     void sendMapOutline();
     void sendPlayerInfo();
 
+    /**
+     * Sends the server's performance metrics to the shell user.
+     *
+     * @param metrics  Current metrics (see ServerSystem::loadStatus()).
+     */
+    void sendMetrics(const de::Record &metrics);
+
     de::Address address() const override;
 
 protected:
@@ -145,6 +145,18 @@ DE_PIMPL(RemoteUser)
         {
             self() << Block("Pong");
         }
+        else if (command == "Load?")
+        {
+            // Used for monitoring the server under load (e.g., by the loadgen tool).
+            // Like the shell, this is only available without a password locally.
+            if (strlen(netPassword) > 0 && !isFromLocal)
+            {
+                disconnect();
+                return false;
+            }
+            const Block msg = "Load\n" + composeJSON(App_ServerSystem().loadStatus());
+            self() << msg;
+        }
         else if (command == "MapOutline?")
         {
             network::MapOutlinePacket packet;
@@ -258,6 +270,11 @@ String RemoteUser::name() const
     return d->name;
 }
 
+const Socket *RemoteUser::socket() const
+{
+    return d->socket;
+}
+
 Socket *RemoteUser::takeSocket()
 {
     Socket *sock = d->socket;
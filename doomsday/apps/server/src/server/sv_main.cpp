@@ -45,6 +45,8 @@
 #include <de/logbuffer.h>
 
 #include <cmath>
+#include <cstring>
+#include <functional>
 
 using namespace de;
 
@@ -73,6 +75,19 @@ static timespan_t masterHeartbeat;
 
 static world::MaterialArchive *materialDict;
 
+/**
+ * Handshake messages whose contents are the same for every client. They are
+ * composed once and reused for all joining players, until the definitions or
+ * the material dictionary change.
+ */
+static struct HandshakeCache
+{
+    bool  isValid = false;
+    Block materialArchive;
+    Block thingTypeIds;
+    Block stateIds;
+} handshakeCache;
+
 /**
  * @return  gametic - cmdtime.
  */
@@ -425,6 +440,17 @@ void Sv_GetPackets(void)
             Net_PingResponse();
             break;
 
+        case PCL_FULL_FRAME_REQUEST:
+            // The client wants the complete world state (e.g., for a demo keyframe).
+            // Reset its register so the next frame is a first frame.
+            netconsole = netBuffer.player;
+            if (netconsole >= 0 && netconsole < DDMAXPLAYERS &&
+                DD_Player(netconsole)->publicData().inGame && !DD_Player(netconsole)->handshake)
+            {
+                Sv_InitPoolForClient(netconsole);
+            }
+            break;
+
         case PCL_HELLO:
         case PCL_HELLO2:
         case PKT_OK:
@@ -586,6 +612,62 @@ static StringArray *listStateIDs()
     return array;
 }
 
+/**
+ * Composes a complete message (type included) without touching the netBuffer.
+ */
+static Block composeMessage(dint type, const std::function<void (writer_s *)> &func)
+{
+    writer_s *writer = Writer_NewWithDynamicBuffer(1 /*type*/ + NETBUFFER_MAXSIZE);
+    Writer_WriteByte(writer, type);
+    func(writer);
+    Block msg(Writer_Data(writer), Writer_Size(writer));
+    Writer_Delete(writer);
+    return msg;
+}
+
+/**
+ * Sends a message composed with composeMessage().
+ */
+static void sendComposedMessage(const Block &msg, dint plrNum)
+{
+    DE_ASSERT(!msg.isEmpty());
+    ::netBuffer.length = msg.size() - 1 /*type*/;
+    std::memcpy(&::netBuffer.msg, msg.data(), msg.size());
+    Net_SendBuffer(plrNum, 0);
+}
+
+static void prepareHandshakeCache()
+{
+    if (handshakeCache.isValid) return;
+
+    DE_ASSERT(materialDict);
+
+    handshakeCache.materialArchive = composeMessage(PSV_MATERIAL_ARCHIVE, [] (writer_s *writer) {
+        materialDict->write(*writer);
+    });
+    handshakeCache.thingTypeIds = composeMessage(PSV_MOBJ_TYPE_ID_LIST, [] (writer_s *writer) {
+        StringArray *ar = listThingTypeIDs();
+        StringArray_Write(ar, writer);
+        StringArray_Delete(ar);
+    });
+    handshakeCache.stateIds = composeMessage(PSV_MOBJ_STATE_ID_LIST, [] (writer_s *writer) {
+        StringArray *ar = listStateIDs();
+        StringArray_Write(ar, writer);
+        StringArray_Delete(ar);
+    });
+    handshakeCache.isValid = true;
+
+    LOGDEV_NET_VERBOSE("Prepared handshake: %i bytes of materials, %i of thing types, %i of states")
+        << handshakeCache.materialArchive.size()
+        << handshakeCache.thingTypeIds.size()
+        << handshakeCache.stateIds.size();
+}
+
+void Sv_InvalidateHandshake()
+{
+    handshakeCache = HandshakeCache();
+}
+
 /**
  * The player will be sent the introductory handshake packets.
  */
@@ -609,31 +691,11 @@ void Sv_Handshake(dint plrNum, dd_bool newPlayer)
     Msg_End();
     Net_SendBuffer(plrNum, 0);
 
-    // Include the list of material Ids.
-    Msg_Begin(PSV_MATERIAL_ARCHIVE);
-    materialDict->write(*msgWriter);
-    Msg_End();
-    Net_SendBuffer(plrNum, 0);
-
-    // Include the list of thing Ids.
-    {
-        StringArray *ar = listThingTypeIDs();
-        Msg_Begin(PSV_MOBJ_TYPE_ID_LIST);
-        StringArray_Write(ar, msgWriter);
-        Msg_End();
-        Net_SendBuffer(plrNum, 0);
-        StringArray_Delete(ar);
-    }
-
-    // Include the list of state Ids.
-    {
-        StringArray *ar = listStateIDs();
-        Msg_Begin(PSV_MOBJ_STATE_ID_LIST);
-        StringArray_Write(ar, msgWriter);
-        Msg_End();
-        Net_SendBuffer(plrNum, 0);
-        StringArray_Delete(ar);
-    }
+    // Include the lists of material, thing, and state Ids.
+    prepareHandshakeCache();
+    sendComposedMessage(handshakeCache.materialArchive, plrNum);
+    sendComposedMessage(handshakeCache.thingTypeIds,    plrNum);
+    sendComposedMessage(handshakeCache.stateIds,        plrNum);
 
     if (newPlayer)
     {
@@ -704,6 +766,7 @@ void Sv_StartNetGame(void)
     allowSending = true;
 
     // Prepare the material dictionary we'll be using with clients.
+    Sv_InvalidateHandshake();
     materialDict = new world::MaterialArchive(false);
     materialDict->addWorldMaterials();
 
@@ -718,6 +781,7 @@ void Sv_StopNetGame(void)
         delete materialDict;
         materialDict = 0;
     }
+    Sv_InvalidateHandshake();
 }
 
 unsigned int Sv_IdForMaterial(world::Material *mat)
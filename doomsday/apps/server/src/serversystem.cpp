@@ -26,6 +26,7 @@
 #include "remotefeeduser.h"
 #include "server/sv_def.h"
 #include "server/sv_frame.h"
+#include "server/sv_pool.h"
 #include "network/net_main.h"
 #include "network/net_buf.h"
 #include "network/net_event.h"
@@ -36,14 +37,21 @@
 #include "world/p_players.h"
 
 #include <doomsday/world/map.h>
+#include <doomsday/world/thinkers.h>
 #include <de/c_wrapper.h>
+#include <de/legacy/memoryzone.h>
 #include <de/legacy/timer.h>
 #include <de/address.h>
+#include <de/arrayvalue.h>
 #include <de/beacon.h>
 #include <de/byterefarray.h>
 #include <de/garbage.h>
 #include <de/listensocket.h>
+#include <de/socket.h>
 #include <de/textapp.h>
+#include <de/textvalue.h>
+
+#include <algorithm>
 
 using namespace de;
 
@@ -57,6 +65,8 @@ static byte netShowLatencies = false;
 static byte netAllowJoin     = true;
 
 static constexpr TimeSpan BEACON_UPDATE_INTERVAL = 2.0_s;
+static constexpr int      LOAD_HISTORY_SIZE      = 175; // 5 seconds at 35 Hz
+static constexpr TimeSpan TRAFFIC_UPDATE_INTERVAL = 1.0_s;
 
 static duint16 Server_ListenPort()
 {
@@ -77,6 +87,26 @@ DE_PIMPL(ServerSystem)
     ShellUsers shellUsers;
     Users remoteFeedUsers;
 
+    /// Durations of the most recent server ticks (ring buffer).
+    struct LoadSample
+    {
+        TimeSpan tick;     ///< Running the game tics.
+        TimeSpan transmit; ///< Sv_TransmitFrame().
+    };
+    List<LoadSample> loadHistory;
+    dsize loadPos = 0;
+
+    /// Outgoing traffic of each joined user.
+    struct ClientTraffic
+    {
+        duint64 bytes            = 0;
+        duint64 uncompressed     = 0;
+        ddouble bytesPerSecond   = 0;
+        ddouble compressionRatio = 1;
+    };
+    Hash<Id::Type, ClientTraffic> traffic;
+    Time lastTrafficUpdateAt = Time::invalidTime();
+
     Impl(Public *i) : Base(i) {}
     ~Impl() { deinit(); }
 
@@ -158,6 +188,55 @@ DE_PIMPL(ServerSystem)
         }
     }
 
+    void recordLoad(const LoadSample &sample)
+    {
+        if (loadHistory.size() < LOAD_HISTORY_SIZE)
+        {
+            loadHistory << sample;
+        }
+        else
+        {
+            loadHistory[loadPos] = sample;
+        }
+        loadPos = (loadPos + 1) % LOAD_HISTORY_SIZE;
+    }
+
+    /**
+     * Updates the outgoing data rate of each joined user. The rates are measured
+     * over periods of TRAFFIC_UPDATE_INTERVAL.
+     */
+    void updateTraffic()
+    {
+        TimeSpan elapsed;
+        if (lastTrafficUpdateAt.isValid())
+        {
+            elapsed = lastTrafficUpdateAt.since();
+            if (elapsed < TRAFFIC_UPDATE_INTERVAL) return;
+        }
+        lastTrafficUpdateAt = Time();
+
+        Hash<Id::Type, ClientTraffic> updated;
+        for (const auto &user : users)
+        {
+            const Socket *sock = user.second->socket();
+            if (!user.second->isJoined() || !sock) continue;
+
+            ClientTraffic current;
+            current.bytes        = sock->bytesSent();
+            current.uncompressed = sock->uncompressedBytesSent();
+            if (traffic.contains(user.first))
+            {
+                const ClientTraffic &prev = traffic[user.first];
+                const duint64 sent = current.bytes - prev.bytes;
+                const duint64 uncompressed = current.uncompressed - prev.uncompressed;
+                current.bytesPerSecond   = sent / de::max(ddouble(elapsed), .001);
+                current.compressionRatio = uncompressed ? ddouble(sent) / uncompressed : 1.0;
+            }
+            updated.insert(user.first, current);
+        }
+        traffic = std::move(updated);
+    }
+
     /**
      * The client is removed from the game immediately. This is used when
      * the server needs to terminate a client's connection abnormally.
@@ -314,10 +393,20 @@ void ServerSystem::timeChanged(const Clock &clock)
     // Adjust loop rate depending on whether users are connected.
     DE_TEXT_APP->loop().setRate(userCount()? 35 : 3);
 
-    Loop_RunTics();
-
-    // Update clients at regular intervals.
-    Sv_TransmitFrame();
+    Impl::LoadSample sample;
+    {
+        const Time startedAt;
+        Loop_RunTics();
+        sample.tick = startedAt.since();
+    }
+    {
+        const Time startedAt;
+        // Update clients at regular intervals.
+        Sv_TransmitFrame();
+        sample.transmit = startedAt.since();
+    }
+    d->recordLoad(sample);
+    d->updateTraffic();
 
     d->updateBeacon(clock);
 
@@ -329,6 +418,80 @@ void ServerSystem::timeChanged(const Clock &clock)
     /// @todo Kick unjoined nodes who are silent for too long.
 }
 
+/**
+ * Returns the value below which @a fraction of the sorted @a values fall.
+ */
+static ddouble percentile(const List<ddouble> &sorted, ddouble fraction)
+{
+    if (sorted.isEmpty()) return 0;
+    return sorted.at(de::min(sorted.size() - 1, dsize(fraction * sorted.size())));
+}
+
+Record ServerSystem::loadStatus() const
+{
+    List<ddouble> ticks, transmits;
+    ddouble tickSum = 0, transmitSum = 0;
+    for (const auto &sample : d->loadHistory)
+    {
+        ticks     << sample.tick;
+        transmits << sample.transmit;
+        tickSum     += sample.tick;
+        transmitSum += sample.transmit;
+    }
+    std::sort(ticks.begin(), ticks.end());
+    std::sort(transmits.begin(), transmits.end());
+    const ddouble count = de::max(dsize(1), d->loadHistory.size());
+
+    Record status;
+    status.set("samples",         d->loadHistory.size());
+    status.set("tickTimeAvg",     1000 * tickSum / count);
+    status.set("tickTimeP50",     1000 * percentile(ticks, .50));
+    status.set("tickTimeP90",     1000 * percentile(ticks, .90));
+    status.set("tickTimeP99",     1000 * percentile(ticks, .99));
+    status.set("tickTimeMax",     1000 * (ticks.isEmpty()? 0.0 : ticks.back()));
+    status.set("transmitTimeAvg", 1000 * transmitSum / count);
+    status.set("transmitTimeP99", 1000 * percentile(transmits, .99));
+    status.set("transmitTimeMax", 1000 * (transmits.isEmpty()? 0.0 : transmits.back()));
+    status.set("outputBytesPerSecond", Socket::outputBytesPerSecond());
+    status.set("compressionRatio",
+               Socket::sentUncompressedBytes()
+                   ? ddouble(Socket::sentBytes()) / Socket::sentUncompressedBytes() : 1.0);
+
+    int thinkerCount = 0;
+    if (world::World::get().hasMap())
+    {
+        thinkerCount = App_World().map().thinkers().count();
+    }
+    status.set("thinkers", thinkerCount);
+
+    size_t zoneAllocated = 0, zoneTotal = 0;
+    Z_GetUsage(&zoneAllocated, &zoneTotal);
+    status.set("zoneAllocated", duint64(zoneAllocated));
+    status.set("zoneTotal",     duint64(zoneTotal));
+
+    // Traffic and delta pool depth of each connected client.
+    auto &consoles    = status.addArray("consoles").value<ArrayValue>();
+    auto &unacked     = status.addArray("unackedDeltas").value<ArrayValue>();
+    auto &bytesPerSec = status.addArray("bytesPerSecond").value<ArrayValue>();
+    auto &ratios      = status.addArray("clientCompressionRatios").value<ArrayValue>();
+    for (int i = 1; i < DDMAXPLAYERS; ++i)
+    {
+        const player_t *plr = DD_Player(i);
+        if (!plr->isConnected()) continue;
+
+        Impl::ClientTraffic traffic;
+        if (d->traffic.contains(plr->remoteUserId))
+        {
+            traffic = d->traffic[plr->remoteUserId];
+        }
+        consoles    << new NumberValue(i);
+        unacked     << new NumberValue(Sv_CountUnackedDeltas(i));
+        bytesPerSec << new NumberValue(traffic.bytesPerSecond);
+        ratios      << new NumberValue(traffic.compressionRatio);
+    }
+    return status;
+}
+
 void ServerSystem::handleIncomingConnection()
 {
     LOG_AS("ServerSystem");
@@ -185,6 +185,12 @@ void ShellUser::sendPlayerInfo()
     *this << *packet;
 }
 
+void ShellUser::sendMetrics(const Record &metrics)
+{
+    std::unique_ptr<RecordPacket> packet(protocol().newMetrics(metrics));
+    *this << *packet;
+}
+
 Address ShellUser::address() const
 {
     return Link::address();
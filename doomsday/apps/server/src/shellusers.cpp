@@ -18,6 +18,7 @@
  */
 
 #include "shellusers.h"
+#include "serversystem.h"
 #include "dd_main.h"
 #include <de/garbage.h>
 #include <de/timer.h>
@@ -25,14 +26,17 @@
 using namespace de;
 
 static constexpr TimeSpan PLAYER_INFO_INTERVAL = 2.5_s;
+static constexpr TimeSpan METRICS_INTERVAL     = 1.0_s;
 
 DE_PIMPL_NOREF(ShellUsers)
 {
     Timer infoTimer;
+    Timer metricsTimer;
 
     Impl()
     {
         infoTimer.setInterval(PLAYER_INFO_INTERVAL);
+        metricsTimer.setInterval(METRICS_INTERVAL);
     }
 };
 
@@ -46,6 +50,17 @@ ShellUsers::ShellUsers() : d(new Impl)
         });
     };
     d->infoTimer.start();
+
+    // Performance metrics are pushed more frequently.
+    d->metricsTimer += [this]() {
+        if (!count()) return;
+        const Record metrics = App_ServerSystem().loadStatus();
+        forUsers([&metrics](User &user) {
+            user.as<ShellUser>().sendMetrics(metrics);
+            return LoopContinue;
+        });
+    };
+    d->metricsTimer.start();
 }
 
 void ShellUsers::add(User *user)
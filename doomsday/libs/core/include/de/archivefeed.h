@@ -20,6 +20,7 @@
 #define LIBCORE_ARCHIVEFEED_H
 
 #include "de/feed.h"
+#include "de/block.h"
 #include "de/bytearrayfile.h"
 #include "de/string.h"
 
@@ -98,6 +99,16 @@ public:
      */
     void rewriteFile();
 
+    /**
+     * Overwrites the File associated with this feed with an archive that has already
+     * been serialized, for example in a background thread. The serialized archive
+     * should be the current contents of archive(), and the archive must have been
+     * detached from the file beforehand (see Archive::cache()).
+     *
+     * @param serializedArchive  Serialized archive.
+     */
+    void rewriteFile(const Block &serializedArchive);
+
     void uncache();
 
     /**
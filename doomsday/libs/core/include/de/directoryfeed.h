@@ -131,7 +131,8 @@ public:
 
 protected:
     void populateSubFolder(const Folder &folder, const String &entryName);
-    void populateFile(const Folder &folder, const String &entryName, PopulatedFiles &populated);
+    void populateFile(const Folder &folder, const String &entryName, const File::Status &status,
+                      PopulatedFiles &populated);
 
 private:
     DE_PRIVATE(d)
@@ -74,6 +74,7 @@ public:
         PopulateOnlyThisFolder = 0x2,   ///< Do not descend into subfolders while populating.
         PopulateAsync          = 0x4,   ///< Do not block until complete.
         PopulateAsyncFullTree  = PopulateAsync | PopulateFullTree,
+        PopulateConcurrently   = 0x8,   ///< Subfolders are populated concurrently on the TaskPool (blocking populations only).
 
         DisableNotification = 0x1000, // internal use: population audience not notified
         DisableIndexing     = 0x2000, // internal use: file is not added to the FS index
@@ -113,6 +114,10 @@ public:
      * when they apply changes to the source data, so population should not be
      * performed in that case.
      *
+     * With PopulateConcurrently, the subfolders of a full tree are populated in
+     * batches on the TaskPool. The resulting tree is the same as when populating
+     * one folder at a time. The flag has no effect together with PopulateAsync.
+     *
      * @param behavior  Behavior of the population operation, see
      *                  Folder::PopulationBehavior.
      */
@@ -178,6 +178,16 @@ DE_PUBLIC void *ZBlockSet_Allocate(zblockset_t *set);
 
 DE_PUBLIC void Z_PrintStatus(void);
 
+/**
+ * Determines how much of the zone is in use. Unlike Z_PrintStatus(), the heap
+ * is not checked, so this is cheap enough to be called periodically.
+ *
+ * @param allocated  Total size of the allocated blocks in all volumes (bytes).
+ *                   Can be @c NULL.
+ * @param total      Total size of all volumes (bytes). Can be @c NULL.
+ */
+DE_PUBLIC void Z_GetUsage(size_t *allocated, size_t *total);
+
 /**
  * Puts a region of memory allocated with Z_Malloc() or malloc() up for garbage
  * collection.
@@ -53,6 +53,16 @@ public:
 
     void setMetadata(const String &category, const Block &id, const Block &metadata);
 
+    /**
+     * Number of check() calls that found previously cached metadata.
+     */
+    duint32 cacheHitCount() const;
+
+    /**
+     * Number of check() calls that found no cached metadata.
+     */
+    duint32 cacheMissCount() const;
+
     Block metadata(const String &category, const Block &id) const;
 
     void clear();
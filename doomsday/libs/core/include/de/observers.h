@@ -25,6 +25,9 @@
 #include "de/guard.h"
 #include "de/pointerset.h"
 
+#include <atomic>
+#include <memory>
+
 /**
  * Macro that forms the name of an observer interface.
  */
@@ -98,6 +101,28 @@
     DE_DECLARE_AUDIENCE(Name, Method) \
     DE_AUDIENCE_METHOD_INLINE(Name)
 
+/*
+ * Variants of the audience macros that use de::LightObservers. These are meant for
+ * classes that have a very large number of instances, like map elements. The pimpl
+ * macros DE_PIMPL_AUDIENCE and DE_AUDIENCE_METHOD work with both.
+ */
+#define DE_LIGHT_AUDIENCE_VAR(Name) \
+    using Name##Audience = de::LightObservers<DE_AUDIENCE_INTERFACE(Name)>; \
+    Name##Audience audienceFor##Name;
+
+#define DE_DECLARE_LIGHT_AUDIENCE_METHOD(Name) \
+    using Name##Audience = de::LightObservers<DE_AUDIENCE_INTERFACE(Name)>; \
+    Name##Audience &audienceFor##Name(); \
+    const Name##Audience &audienceFor##Name() const;
+
+#define DE_DEFINE_LIGHT_AUDIENCE(Name, Method) \
+    DE_DECLARE_AUDIENCE(Name, Method) \
+    DE_LIGHT_AUDIENCE_VAR(Name)
+
+#define DE_LIGHT_AUDIENCE(Name, Method) \
+    DE_DECLARE_AUDIENCE(Name, Method) \
+    DE_DECLARE_LIGHT_AUDIENCE_METHOD(Name)
+
 // Variadic conveniences:
 
 #if !defined (_MSC_VER)
@@ -548,6 +573,332 @@ private:
     List<std::function<void()>> _callbacks;
 };
 
+/**
+ * Compact variant of Observers for objects that exist in very large numbers, such
+ * as the elements of a map. Nothing is allocated before the first member is added,
+ * and the storage is released when the last one is removed, so an empty audience
+ * only takes the space of two pointers. There is no mutex.
+ *
+ * A LightObservers must only be accessed by one thread at a time. Debug builds
+ * assert that accesses do not overlap.
+ *
+ * The interface is the same as in Observers, so the audience macros, including
+ * DE_FOR_OBSERVERS, work with both.
+ * @ingroup data
+ */
+template <typename Type>
+class LightObservers : public IAudience
+{
+public:
+    using Members        = PointerSetT<Type>;
+    using const_iterator = typename Members::const_iterator;
+    using size_type      = int;
+
+private:
+    struct Data
+    {
+        Members members;
+        List<std::function<void()>> callbacks;
+    };
+
+#ifdef DE_DEBUG
+    /// Asserts that the audience is not being accessed by another thread.
+    struct AccessCheck
+    {
+        std::atomic_bool &busy;
+        AccessCheck(const LightObservers &audience) : busy(audience._busy)
+        {
+            const bool wasBusy = busy.exchange(true);
+            DE_ASSERT(!wasBusy);
+            DE_UNUSED(wasBusy);
+        }
+        ~AccessCheck() { busy = false; }
+    };
+#  define DE_LIGHT_OBSERVERS_ACCESS(audience) AccessCheck _accessCheck(audience)
+#else
+#  define DE_LIGHT_OBSERVERS_ACCESS(audience)
+#endif
+
+public:
+    /**
+     * Iteration utility for observers. Like Observers::Loop, this is safe against
+     * observers removing themselves from the audience during the iteration.
+     */
+    class Loop : public PointerSet::IIterationObserver
+    {
+    public:
+        Loop(const LightObservers &observers)
+            : _members(observers._data ? &observers._data->members : nullptr)
+            , _prevObserver(nullptr)
+        {
+            if (!_members) return;
+            DE_LIGHT_OBSERVERS_ACCESS(observers);
+            if (_members->flags() & PointerSet::AllowInsertionDuringIteration)
+            {
+                _prevObserver = _members->iterationObserver();
+                _members->setIterationObserver(this);
+            }
+            _members->setBeingIterated(true);
+            _next = _members->begin();
+            next();
+        }
+        virtual ~Loop()
+        {
+            if (!_members) return;
+            _members->setBeingIterated(false);
+            if (_members->flags() & PointerSet::AllowInsertionDuringIteration)
+            {
+                _members->setIterationObserver(_prevObserver);
+            }
+        }
+        bool done() const { return !_members || _current >= _members->end(); }
+        void next()
+        {
+            _current = _next;
+            if (_current < _members->begin())
+            {
+                _current = _members->begin();
+                if (_next < _current) _next = _current;
+            }
+            if (_next < _members->end())
+            {
+                ++_next;
+            }
+        }
+        const const_iterator &get() const { return _current; }
+        Type *operator->() const { return *get(); }
+        Loop &operator++()
+        {
+            next();
+            return *this;
+        }
+        void pointerSetIteratorsWereInvalidated(const PointerSet::Pointer *oldBase,
+                                                const PointerSet::Pointer *newBase) override
+        {
+            if (_prevObserver)
+            {
+                _prevObserver->pointerSetIteratorsWereInvalidated(oldBase, newBase);
+            }
+            _current = reinterpret_cast<const_iterator>(newBase) +
+                       (_current - reinterpret_cast<const_iterator>(oldBase));
+            _next = reinterpret_cast<const_iterator>(newBase) +
+                    (_next - reinterpret_cast<const_iterator>(oldBase));
+        }
+
+    private:
+        const Members *                 _members;
+        PointerSet::IIterationObserver *_prevObserver;
+        const_iterator                  _current{};
+        const_iterator                  _next{};
+    };
+
+public:
+    LightObservers() {}
+
+    LightObservers(const LightObservers<Type> &other) { *this = other; }
+
+    virtual ~LightObservers()
+    {
+        _disassociateAllMembers();
+    }
+
+    void clear()
+    {
+        _disassociateAllMembers();
+    }
+
+    LightObservers<Type> &operator=(const LightObservers<Type> &other)
+    {
+        if (this == &other) return *this;
+        _disassociateAllMembers();
+        if (other._data)
+        {
+            _data.reset(new Data(*other._data));
+            for (Type *observer : _data->members)
+            {
+                observer->addMemberOf(*this);
+            }
+        }
+        return *this;
+    }
+
+    /// Add an observer into the set. The set does not receive
+    /// ownership of the observer instance.
+    void add(Type *observer)
+    {
+        _add(observer);
+        observer->addMemberOf(*this);
+    }
+
+    LightObservers<Type> &operator+=(Type *observer)
+    {
+        add(observer);
+        return *this;
+    }
+
+    LightObservers<Type> &operator+=(Type &observer)
+    {
+        add(&observer);
+        return *this;
+    }
+
+    const LightObservers<Type> &operator+=(const Type *observer) const
+    {
+        const_cast<LightObservers<Type> *>(this)->add(const_cast<Type *>(observer));
+        return *this;
+    }
+
+    const LightObservers<Type> &operator+=(const Type &observer) const
+    {
+        const_cast<LightObservers<Type> *>(this)->add(const_cast<Type *>(&observer));
+        return *this;
+    }
+
+    void remove(Type *observer)
+    {
+        _remove(observer);
+        observer->removeMemberOf(*this);
+    }
+
+    LightObservers<Type> &operator-=(Type *observer)
+    {
+        remove(observer);
+        return *this;
+    }
+
+    LightObservers<Type> &operator-=(Type &observer)
+    {
+        remove(&observer);
+        return *this;
+    }
+
+    const LightObservers<Type> &operator-=(Type *observer) const
+    {
+        const_cast<LightObservers<Type> *>(this)->remove(observer);
+        return *this;
+    }
+
+    const LightObservers<Type> &operator-=(Type &observer) const
+    {
+        const_cast<LightObservers<Type> *>(this)->remove(&observer);
+        return *this;
+    }
+
+    LightObservers<Type> &operator+=(const std::function<void()> &callback)
+    {
+        DE_LIGHT_OBSERVERS_ACCESS(*this);
+        data().callbacks << callback;
+        return *this;
+    }
+
+    void call() const
+    {
+        if (!_data || _data->callbacks.isEmpty()) return;
+        const auto cbs = _data->callbacks;
+        for (const auto &cb : cbs)
+        {
+            cb();
+        }
+    }
+
+    size_type size() const
+    {
+        return _data ? _data->members.size() : 0;
+    }
+
+    inline bool isEmpty() const { return size() == 0; }
+
+    bool contains(const Type *observer) const
+    {
+        return _data && _data->members.contains(const_cast<Type *>(observer));
+    }
+
+    bool contains(const Type &observer) const
+    {
+        return contains(&observer);
+    }
+
+    /**
+     * Allows or denies addition of audience members while the audience is being
+     * iterated. By default, addition is not allowed. If additions are allowed, only one
+     * Loop can be iterating the audience at a time.
+     *
+     * @param yes  @c true to allow additions, @c false to deny.
+     */
+    void setAdditionAllowedDuringIteration(bool yes)
+    {
+        DE_LIGHT_OBSERVERS_ACCESS(*this);
+        if (yes || _data)
+        {
+            data().members.setFlags(Members::AllowInsertionDuringIteration, yes);
+        }
+    }
+
+    /**
+     * Returns the number of bytes allocated for the audience in addition to the
+     * LightObservers instance itself.
+     */
+    dsize allocatedSize() const
+    {
+        if (!_data) return 0;
+        return sizeof(Data) + dsize(_data->members.allocatedSize()) * sizeof(PointerSet::Pointer) +
+               dsize(_data->callbacks.capacity()) * sizeof(std::function<void()>);
+    }
+
+    // Implements IAudience.
+    void addMember   (ObserverBase *member) { _add   (static_cast<Type *>(member)); }
+    void removeMember(ObserverBase *member) { _remove(static_cast<Type *>(member)); }
+
+private:
+    Data &data()
+    {
+        if (!_data) _data.reset(new Data);
+        return *_data;
+    }
+
+    void _disassociateAllMembers()
+    {
+        while (_data && !_data->members.isEmpty())
+        {
+            Type *observer;
+            {
+                DE_LIGHT_OBSERVERS_ACCESS(*this);
+                observer = _data->members.take();
+            }
+            observer->removeMemberOf(*this);
+        }
+        _data.reset();
+    }
+
+    void _add(Type *observer)
+    {
+        DE_LIGHT_OBSERVERS_ACCESS(*this);
+        DE_ASSERT(observer != 0);
+        data().members.insert(observer);
+    }
+
+    void _remove(Type *observer)
+    {
+        DE_LIGHT_OBSERVERS_ACCESS(*this);
+        if (!_data) return;
+        _data->members.remove(observer);
+        // The storage can be released unless it is still needed for something.
+        if (_data->members.isEmpty() && !_data->members.isBeingIterated() &&
+            !(_data->members.flags() & Members::AllowInsertionDuringIteration) &&
+            _data->callbacks.isEmpty())
+        {
+            _data.reset();
+        }
+    }
+
+#undef DE_LIGHT_OBSERVERS_ACCESS
+
+    std::unique_ptr<Data> _data;
+#ifdef DE_DEBUG
+    mutable std::atomic_bool _busy{false};
+#endif
+};
+
 } // namespace de
 
 #endif /* LIBCORE_OBSERVERS_H */
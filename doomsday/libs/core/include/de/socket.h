@@ -221,6 +221,18 @@ public:
      */
     void setQuiet(bool noLogOutput);
 
+    /**
+     * Returns the number of bytes written to this socket so far, including
+     * message headers. Payloads are counted after compression.
+     */
+    duint64 bytesSent() const;
+
+    /**
+     * Returns the total size of the messages sent via this socket, before
+     * compression.
+     */
+    duint64 uncompressedBytesSent() const;
+
     // Statistics:
     static void    resetCounters();
     static duint64 sentUncompressedBytes();
@@ -64,6 +64,9 @@ public:
 
     typedef std::function<void ()> TaskFunction;
 
+    /// Processes the elements @a begin (inclusive) ... @a end (exclusive) of a batch.
+    typedef std::function<void (int batch, int begin, int end)> BatchFunction;
+
     DE_AUDIENCE(Done, void taskPoolDone(TaskPool &))
 
 public:
@@ -121,6 +124,31 @@ public:
      */
     static void yield(const TimeSpan timeout);
 
+    /**
+     * Determines how many batches forBatches() will use for processing @a count
+     * elements. Can be used for allocating per-batch results in advance.
+     *
+     * @param count         Number of elements.
+     * @param minBatchSize  Minimum number of elements in a batch.
+     */
+    static int batchCount(int count, int minBatchSize = 1);
+
+    /**
+     * Processes the elements [0, @a count) concurrently in contiguous batches. The
+     * calling thread processes the first batch itself and the call returns once all
+     * the batches have been processed.
+     *
+     * The elements are always divided into batches the same way for the same
+     * @a count, so results accumulated separately for each batch can be merged in
+     * batch order to produce deterministic results. The batch function must not
+     * throw exceptions.
+     *
+     * @param count         Number of elements.
+     * @param func          Called once for each batch.
+     * @param minBatchSize  Minimum number of elements in a batch.
+     */
+    static void forBatches(int count, const BatchFunction &func, int minBatchSize = 1);
+
     /**
      * Called by de::App at shutdown.
      */
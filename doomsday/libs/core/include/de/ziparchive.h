@@ -98,6 +98,16 @@ public:
      */
     static bool recognize(const NativePath &path);
 
+    /**
+     * Enables or disables compressing the changed entries concurrently when an
+     * archive is serialized. When disabled, the entries are compressed one at a
+     * time in the serializing thread. The output is the same in both cases.
+     * Concurrent compression is enabled by default.
+     *
+     * @param enabled  @c true to compress concurrently.
+     */
+    static void setConcurrentDeflate(bool enabled);
+
     struct DE_PUBLIC Interpreter : public filesys::IInterpreter {
         File *interpretFile(File *sourceData) const override;
     };
@@ -27,6 +27,7 @@
 #include "de/waitable.h"
 
 #include <the_Foundation/threadpool.h>
+#include <thread>
 
 namespace de {
 namespace internal {
@@ -51,6 +52,12 @@ static iThreadPool *globalThreadPool()
     return s_pool;
 }
 
+/// Number of threads in the global pool (see the limits above).
+static int pooledThreadCount()
+{
+    return de::max(2, int(std::thread::hardware_concurrency()) - 3);
+}
+
 static void deleteThreadPool()
 {
     if (s_pool)
@@ -283,6 +290,38 @@ bool TaskPool::isDone() const
     return d->isEmpty();
 }
 
+int TaskPool::batchCount(int count, int minBatchSize) // static
+{
+    if (count <= 0) return 0;
+    // Pooled threads plus the calling thread.
+    return de::max(1, de::min(internal::pooledThreadCount() + 1,
+                              count / de::max(1, minBatchSize)));
+}
+
+void TaskPool::forBatches(int count, const BatchFunction &func, int minBatchSize) // static
+{
+    const int batches = batchCount(count, minBatchSize);
+    if (!batches) return;
+
+    const auto batchStart = [count, batches](int batch) {
+        return int(dint64(count) * batch / batches);
+    };
+    if (batches == 1)
+    {
+        func(0, 0, count);
+        return;
+    }
+    TaskPool pool;
+    for (int batch = 1; batch < batches; ++batch)
+    {
+        const int begin = batchStart(batch);
+        const int end   = batchStart(batch + 1);
+        pool.start([&func, batch, begin, end]() { func(batch, begin, end); }, HighPriority);
+    }
+    func(0, 0, batchStart(1));
+    pool.waitForDone();
+}
+
 void TaskPool::deleteThreadPool() // static
 {
     internal::deleteThreadPool();
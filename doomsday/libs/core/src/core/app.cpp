@@ -293,7 +293,7 @@ DE_PIMPL(App)
         metaBank.reset(new MetadataBank);
 
         // Populate the file system (blocking).
-        fs.root().populate(Folder::PopulateFullTree);
+        fs.root().populate(Folder::PopulateFullTree | Folder::PopulateConcurrently);
 
         // Ensure known subfolders exist:
         // - /home/configs is used by de::Profiles.
@@ -29,12 +29,14 @@
 #include "de/logbuffer.h"
 #include "de/metadatabank.h"
 #include "de/reader.h"
+#include "de/taskpool.h"
 #include "de/writer.h"
 #include "de/zeroed.h"
 
 // Interpretations:
 #include "de/archivefolder.h"
 
+#include <atomic>
 #include <cstring>
 #include <zlib.h>
 
@@ -635,6 +637,58 @@ const ZipArchive::Index &ZipArchive::index() const
     return static_cast<const Index &>(Archive::index());
 }
 
+/// Maximum amount of entry data (uncompressed) being deflated concurrently.
+static const dsize MAX_CONCURRENT_DEFLATE_SIZE = 64 * 1024 * 1024;
+
+static std::atomic_bool concurrentDeflate{true};
+
+/**
+ * Compresses @a data using raw deflate.
+ *
+ * @param data      Data to compress.
+ * @param archived  The compressed data is written here.
+ *
+ * @return @c true, if the data was compressed enough to be worth storing compressed.
+ */
+static bool deflateEntryData(const Block &data, Block &archived)
+{
+    archived.resize(Block::Size(REQUIRED_DEFLATE_PERCENTAGE * data.size()));
+
+    z_stream stream;
+    zap(stream);
+    stream.next_in = const_cast<IByteArray::Byte *>(data.data());
+    stream.avail_in = data.size();
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.next_out = const_cast<IByteArray::Byte *>(archived.data());
+    stream.avail_out = archived.size();
+
+    /*
+     * The deflation is done in raw mode. From zlib documentation:
+     *
+     * "windowBits can also be –8..–15 for raw deflate. In this case,
+     * -windowBits determines the window size. deflate() will then
+     * generate raw deflate data with no zlib header or trailer, and
+     * will not compute an adler32 check value."
+     */
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                    -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        /// @throw DeflateError  zlib error: could not initialize deflate operation.
+        throw ZipArchive::DeflateError("ZipArchive::operator >>", "Deflate init failed");
+    }
+
+    const bool ok = (deflate(&stream, Z_FINISH) == Z_STREAM_END);
+    if (ok)
+    {
+        archived.resize(stream.total_out);
+    }
+
+    // Clean up.
+    deflateEnd(&stream);
+    return ok;
+}
+
 void ZipArchive::operator >> (Writer &to) const
 {
     /**
@@ -643,88 +697,107 @@ void ZipArchive::operator >> (Writer &to) const
      */
     Writer writer(to, littleEndianByteOrder);
 
-    // First write the local headers and entry contents.
-    for (PathTreeIterator<Index> iter(index().leafNodes()); iter.hasNext(); )
+    /*
+     * Changed entries are compressed concurrently, a limited amount of data at a
+     * time. The entries are always written in index order and each one is
+     * deflated the same way regardless of threading, so the output is identical
+     * to compressing the entries one after another.
+     */
+    struct Pending
     {
-        // We will be updating relevant members of the entry.
-        ZipEntry &entry = iter.next();
-        entry.update();
-
-        const String fullPath = entry.path();
-
-        // This is where the local file header is located.
-        entry.localHeaderOffset = writer.offset();
-
-        LocalFileHeader header;
-        header.signature = SIG_LOCAL_FILE_HEADER;
-        header.requiredVersion = 20;
-        header.compression = entry.compression;
-        Date at(entry.modifiedAt);
-        header.lastModTime = DOSTime(at.hours(), at.minutes(), at.seconds());
-        header.lastModDate = DOSDate(at.year() - 1980, at.month(), at.dayOfMonth());
-        header.crc32 = entry.crc32;
-        header.compressedSize = entry.sizeInArchive;
-        header.size = entry.size;
-        header.fileNameSize = fullPath.size();
-
-        // Can we use the data already in the source archive?
-        if ((entry.dataInArchive || source()) && !entry.maybeChanged)
+        ZipEntry *entry;
+        bool reuse;         ///< Data already in the source archive can be used as is.
+        Block archived;
+        bool deflated = false;
+        String error;
+    };
+    List<Pending> window;
+    dsize windowSize = 0;
+
+    auto processWindow = [this, &writer, &window, &windowSize] ()
+    {
+        auto compress = [] (Pending &pending)
         {
-            // Yes, we can.
-            writer << header << FixedByteArray(fullPath.toLatin1());
-            IByteArray::Offset newOffset = writer.offset();
-            if (entry.dataInArchive)
+            // We will be updating relevant members of the entry.
+            pending.entry->update();
+            if (pending.reuse) return;
+
+            DE_ASSERT(pending.entry->data != NULL);
+            try
             {
-                writer << FixedByteArray(*entry.dataInArchive);
+                pending.deflated = deflateEntryData(*pending.entry->data, pending.archived);
             }
-            else
+            catch (const Error &er)
+            {
+                pending.error = er.asText();
+            }
+        };
+        if (concurrentDeflate)
+        {
+            TaskPool tasks;
+            for (Pending &pending : window)
             {
-                // Re-use the data in the source.
-                writer << FixedByteArray(*source(), entry.offset, entry.sizeInArchive);
+                tasks.start([&compress, &pending] () { compress(pending); },
+                            TaskPool::MediumPriority);
             }
-            // Written to new location.
-            entry.offset = newOffset;
+            tasks.waitForDone();
         }
         else
         {
-            DE_ASSERT(entry.data != NULL);
-
-            // Let's try and compress.
-            Block archived(Block::Size(REQUIRED_DEFLATE_PERCENTAGE * entry.data->size()));
-
-            z_stream stream;
-            zap(stream);
-            stream.next_in = const_cast<IByteArray::Byte *>(entry.data->data());
-            stream.avail_in = entry.data->size();
-            stream.zalloc = Z_NULL;
-            stream.zfree = Z_NULL;
-            stream.next_out = const_cast<IByteArray::Byte *>(archived.data());
-            stream.avail_out = archived.size();
-
-            /*
-             * The deflation is done in raw mode. From zlib documentation:
-             *
-             * "windowBits can also be –8..–15 for raw deflate. In this case,
-             * -windowBits determines the window size. deflate() will then
-             * generate raw deflate data with no zlib header or trailer, and
-             * will not compute an adler32 check value."
-             */
-            if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
-                            -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            for (Pending &pending : window) compress(pending);
+        }
+
+        // Then write the local headers and entry contents.
+        for (Pending &pending : window)
+        {
+            if (!pending.error.isEmpty())
             {
-                /// @throw DeflateError  zlib error: could not initialize deflate operation.
-                throw DeflateError("ZipArchive::operator >>", "Deflate init failed");
+                /// @throw DeflateError  Compressing an entry failed.
+                throw DeflateError("ZipArchive::operator >>", pending.error);
             }
 
-            int result = deflate(&stream, Z_FINISH);
-            if (result == Z_STREAM_END)
+            ZipEntry &entry = *pending.entry;
+            const String fullPath = entry.path();
+
+            // This is where the local file header is located.
+            entry.localHeaderOffset = writer.offset();
+
+            LocalFileHeader header;
+            header.signature = SIG_LOCAL_FILE_HEADER;
+            header.requiredVersion = 20;
+            header.compression = entry.compression;
+            Date at(entry.modifiedAt);
+            header.lastModTime = DOSTime(at.hours(), at.minutes(), at.seconds());
+            header.lastModDate = DOSDate(at.year() - 1980, at.month(), at.dayOfMonth());
+            header.crc32 = entry.crc32;
+            header.compressedSize = entry.sizeInArchive;
+            header.size = entry.size;
+            header.fileNameSize = fullPath.size();
+
+            if (pending.reuse)
+            {
+                writer << header << FixedByteArray(fullPath.toLatin1());
+                IByteArray::Offset newOffset = writer.offset();
+                if (entry.dataInArchive)
+                {
+                    writer << FixedByteArray(*entry.dataInArchive);
+                }
+                else
+                {
+                    // Re-use the data in the source.
+                    writer << FixedByteArray(*source(), entry.offset, entry.sizeInArchive);
+                }
+                // Written to new location.
+                entry.offset = newOffset;
+            }
+            else if (pending.deflated)
             {
                 // Compression was ok.
                 header.compression = entry.compression = DEFLATED;
-                header.compressedSize = entry.sizeInArchive = stream.total_out;
+                header.compressedSize = entry.sizeInArchive = pending.archived.size();
                 writer << header << FixedByteArray(fullPath.toLatin1());
                 entry.offset = writer.offset();
-                writer << FixedByteArray(archived, 0, entry.sizeInArchive);
+                writer << FixedByteArray(pending.archived);
             }
             else
             {
@@ -735,11 +808,29 @@ void ZipArchive::operator >> (Writer &to) const
                 entry.offset = writer.offset();
                 writer << FixedByteArray(*entry.data);
             }
+        }
+        window.clear();
+        windowSize = 0;
+    };
 
-            // Clean up.
-            deflateEnd(&stream);
+    for (PathTreeIterator<Index> iter(index().leafNodes()); iter.hasNext(); )
+    {
+        ZipEntry &entry = iter.next();
+
+        Pending pending;
+        pending.entry = &entry;
+        // Can we use the data already in the source archive?
+        pending.reuse = (entry.dataInArchive || source()) && !entry.maybeChanged;
+
+        const dsize size = (!pending.reuse && entry.data? entry.data->size() : 0);
+        if (!window.isEmpty() && windowSize + size > MAX_CONCURRENT_DEFLATE_SIZE)
+        {
+            processWindow();
         }
+        window.append(pending);
+        windowSize += size;
     }
+    processWindow();
 
     d->writeCentralDirectory(writer);
 
@@ -748,6 +839,11 @@ void ZipArchive::operator >> (Writer &to) const
     to.seek(writer.offset());
 }
 
+void ZipArchive::setConcurrentDeflate(bool enabled) // static
+{
+    concurrentDeflate = enabled;
+}
+
 static bool recognizeZipExtension(const String &ext)
 {    
     for (const char *e : {".pack", ".demo", ".save", ".addon", ".pk3", ".zip"})
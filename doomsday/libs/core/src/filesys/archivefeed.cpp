@@ -138,6 +138,20 @@ DE_PIMPL(ArchiveFeed)
         }
     }
 
+    void writeSerialized(const Block &serialized)
+    {
+        if (!file || !file->mode().testFlag(File::Write))
+        {
+            return;
+        }
+
+        LOG_RES_VERBOSE("Updating archive in ") << file->description();
+
+        DE_ASSERT(!arch || !arch->source());
+        file->clear();
+        *file << serialized;
+    }
+
     void fileBeingDeleted(const File &deleted)
     {
         if (file == &deleted)
@@ -340,6 +354,19 @@ void ArchiveFeed::rewriteFile()
     }
 }
 
+void ArchiveFeed::rewriteFile(const Block &serializedArchive)
+{
+    if (d->parentFeed)
+    {
+        DE_ASSERT(!d->arch);
+        d->parentFeed->rewriteFile(serializedArchive);
+    }
+    else
+    {
+        d->writeSerialized(serializedArchive);
+    }
+}
+
 void ArchiveFeed::uncache()
 {
     auto &table = d->entryTable();
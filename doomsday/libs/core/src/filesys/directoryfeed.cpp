@@ -24,7 +24,9 @@
 #include "de/filesystem.h"
 #include "de/date.h"
 #include "de/app.h"
+#include "de/set.h"
 
+#include <algorithm>
 #include <fstream>
 #include <the_Foundation/object.h>
 #include <the_Foundation/fileinfo.h>
@@ -33,6 +35,15 @@ namespace de {
 
 static const char *fileStatusSuffix = ".doomsday_file_status";
 
+/// Applies the modification time saved in a file status override file.
+static void readStatusOverride(const String &overrideName, File::Status &status)
+{
+    if (std::ifstream f{overrideName.c_str()})
+    {
+        status.modifiedAt = Time::fromText(Block::readAll(f), Time::ISOFormat);
+    }
+}
+
 DE_PIMPL_NOREF(DirectoryFeed)
 {
     NativePath nativePath;
@@ -91,31 +102,70 @@ Feed::PopulatedFiles DirectoryFeed::populate(const Folder &folder)
         throw NotFoundError("DirectoryFeed::populate", "Path '" + d->nativePath + "' inaccessible");
     }
 
-    PopulatedFiles populated;
-
+    // List the directory in a single pass. The listing includes the status of each
+    // entry, so the files don't need to be checked individually.
+    struct Entry
+    {
+        String name;
+        File::Status status;
+    };
+    List<Entry>  files;
+    StringList   subfolders;
+    Set<String>  statusOverrides;
     auto dirInfo = tF::make_ref(new_DirFileInfo(d->nativePath.toString()));
     iForEach(DirFileInfo, i, dirInfo)
     {
         const NativePath path(String(path_FileInfo(i.value)));
         const String name = path.fileName();
 
-        // Filter out some files.
-        if (!d->mode.testFlag(PopulateNativeSubfolders) && isDirectory_FileInfo(i.value))
+        if (isDirectory_FileInfo(i.value))
         {
-            continue;
+            // Filter out some files.
+            if (d->mode.testFlag(PopulateNativeSubfolders))
+            {
+                subfolders << name;
+            }
         }
-
-        if (isDirectory_FileInfo(i.value))
+        else if (name.endsWith(fileStatusSuffix)) // meta files
         {
-            populateSubFolder(folder, name);
+            statusOverrides.insert(name);
         }
         else
         {
-            if (!name.endsWith(fileStatusSuffix)) // ignore meta files
-            {
-                populateFile(folder, name, populated);
-            }
+            files << Entry{name, File::Status(File::Type::File,
+                                              dsize(size_FileInfo(i.value)),
+                                              Time(lastModified_FileInfo(i.value)))};
+        }
+    }
+
+    // The order of the native directory listing is unspecified, but the population
+    // should always produce the same results.
+    std::sort(subfolders.begin(), subfolders.end());
+    std::sort(files.begin(), files.end(), [] (const Entry &a, const Entry &b) {
+        return a.name < b.name;
+    });
+
+    for (const String &name : subfolders)
+    {
+        populateSubFolder(folder, name);
+    }
+
+    // Existing files are looked up from a snapshot instead of locking the folder
+    // separately for each entry.
+    const Folder::Contents existing = folder.contents();
+
+    PopulatedFiles populated;
+    for (auto &entry : files)
+    {
+        // Already has an entry for this, skip it (wasn't pruned so it's OK).
+        if (existing.contains(entry.name.lower())) continue;
+
+        const String overrideName = entry.name + fileStatusSuffix;
+        if (statusOverrides.contains(overrideName))
+        {
+            readStatusOverride((d->nativePath / overrideName).toString(), entry.status);
         }
+        populateFile(folder, entry.name, entry.status, populated);
     }
     return populated;
 }
@@ -146,21 +196,15 @@ void DirectoryFeed::populateSubFolder(const Folder &folder, const String &entryN
 }
 
 void DirectoryFeed::populateFile(const Folder &folder, const String &entryName,
-                                 PopulatedFiles &populated)
+                                 const File::Status &status, PopulatedFiles &populated)
 {
     try
     {
-        if (folder.has(entryName))
-        {
-            // Already has an entry for this, skip it (wasn't pruned so it's OK).
-            return;
-        }
-
         const NativePath entryPath = d->nativePath / entryName;
 
         // Open the native file.
         std::unique_ptr<NativeFile> nativeFile(new NativeFile(entryName, entryPath));
-        nativeFile->setStatus(fileStatus(entryPath));
+        nativeFile->setStatus(status);
         if (d->mode & AllowWrite)
         {
             nativeFile->setMode(File::Write);
@@ -303,10 +347,7 @@ File::Status DirectoryFeed::fileStatus(const NativePath &nativePath)
     const String overrideName = nativePath + fileStatusSuffix;
     if (fileExistsCStr_FileInfo(overrideName))
     {
-        if (std::ifstream f{overrideName.c_str()})
-        {
-            st.modifiedAt = Time::fromText(Block::readAll(f), Time::ISOFormat);
-        }
+        readStatusOverride(overrideName, st);
     }
     return st;
 }
@@ -31,6 +31,8 @@
 #include "de/taskpool.h"
 #include "de/unixinfo.h"
 
+#include <exception>
+
 namespace de {
 
 FolderPopulationAudience audienceForFolderPopulation; // public
@@ -50,6 +52,37 @@ struct PopulationNotifier : DE_OBSERVES(TaskPool, Done)
 
 static PopulationNotifier populationNotifier;
 
+/**
+ * Calls @a func for each of the elements [0, @a count), either in order in the
+ * calling thread or concurrently in batches on the TaskPool. In the latter case
+ * the batches run to completion, and then the exception thrown by the earliest
+ * failed batch is rethrown.
+ */
+static void forElements(int count, bool concurrently, int minBatchSize,
+                        const std::function<void (int)> &func)
+{
+    if (!concurrently)
+    {
+        for (int i = 0; i < count; ++i) func(i);
+        return;
+    }
+    std::vector<std::exception_ptr> errors(dsize(TaskPool::batchCount(count, minBatchSize)));
+    TaskPool::forBatches(count, [&func, &errors] (int batch, int begin, int end) {
+        try
+        {
+            for (int i = begin; i < end; ++i) func(i);
+        }
+        catch (...)
+        {
+            errors[dsize(batch)] = std::current_exception();
+        }
+    }, minBatchSize);
+    for (const auto &error : errors)
+    {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
 } // namespace internal
 
 DE_PIMPL(Folder)
@@ -216,6 +249,11 @@ void Folder::populate(PopulationBehaviors behavior)
         fileSystem().changeBusyLevel(+1);
     }
 
+    // Asynchronous populations already run in the background.
+    const bool concurrently = internal::enableBackgroundPopulation &&
+                              behavior.testFlag(PopulateConcurrently) &&
+                              !behavior.testFlag(PopulateAsync);
+
     LOG_AS("Folder");
     {
         DE_GUARD(this);
@@ -274,10 +312,12 @@ void Folder::populate(PopulationBehaviors behavior)
         }
     }
 
-    auto populationTask = [this, behavior]() {
+    auto populationTask = [this, behavior, concurrently]() {
         Feed::PopulatedFiles newFiles;
 
-        // Populate with new/updated ones.
+        // Populate with new/updated ones. The feeds are asked one at a time even
+        // when populating concurrently, because the first feed to create a subfolder
+        // gets to provide its contents.
         for (size_t i = 0; i < d->feeds.size(); ++i)
         {
             newFiles.append(d->feeds.atReverse(i)->populate(*this));
@@ -307,10 +347,10 @@ void Folder::populate(PopulationBehaviors behavior)
         if (behavior & PopulateFullTree)
         {
             // Call populate on subfolders.
-            for (Folder *folder : d->subfolders())
-            {
-                folder->populate(behavior | DisableNotification);
-            }
+            const List<Folder *> subs = d->subfolders();
+            internal::forElements(subs.sizei(), concurrently, 1, [&subs, behavior] (int i) {
+                subs[i]->populate(behavior | DisableNotification);
+            });
         }
 
         if (!behavior.testFlag(DisableIndexing))
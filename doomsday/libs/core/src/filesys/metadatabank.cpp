@@ -48,6 +48,9 @@ DE_PIMPL(MetadataBank), public Lockable
         }
     };
 
+    duint32 hitCount  = 0;
+    duint32 missCount = 0;
+
     Impl(Public *i) : Base(i) {}
 
     static DotPath pathFromId(const String &category, const Block &id)
@@ -82,7 +85,16 @@ Block MetadataBank::check(const String &category, const Block &id)
     {
         Bank::add(path, new Impl::Source(id));
     }
-    return data(path).as<Impl::Data>().metadata;
+    const Block &cached = data(path).as<Impl::Data>().metadata;
+    if (cached.isEmpty())
+    {
+        d->missCount++;
+    }
+    else
+    {
+        d->hitCount++;
+    }
+    return cached;
 }
 
 void MetadataBank::setMetadata(const String &category, const Block &id, const Block &metadata)
@@ -104,6 +116,18 @@ Block MetadataBank::metadata(const String &category, const Block &id) const
     return data(Impl::pathFromId(category, id)).as<Impl::Data>().metadata;
 }
 
+duint32 MetadataBank::cacheHitCount() const
+{
+    DE_GUARD(d);
+    return d->hitCount;
+}
+
+duint32 MetadataBank::cacheMissCount() const
+{
+    DE_GUARD(d);
+    return d->missCount;
+}
+
 void MetadataBank::clear()
 {
     DE_GUARD(d);
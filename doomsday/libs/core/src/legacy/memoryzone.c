@@ -1038,6 +1038,23 @@ size_t Z_FreeMemory(void)
     return free;
 }
 
+void Z_GetUsage(size_t *allocated, size_t *total)
+{
+    memvolume_t *volume;
+    size_t inUse = 0, size = 0;
+
+    lockZone();
+    for (volume = volumeRoot; volume; volume = volume->next)
+    {
+        inUse += allocatedMemoryInVolume(volume);
+        size  += volume->size;
+    }
+    unlockZone();
+
+    if (allocated) *allocated = inUse;
+    if (total)     *total     = size;
+}
+
 void Z_PrintStatus(void)
 {
     size_t allocated = Z_AllocatedMemory();
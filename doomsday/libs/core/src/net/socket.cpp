@@ -104,6 +104,9 @@ static const int MAX_SIZE_LARGE  = DE_SOCKET_MAX_PAYLOAD_SIZE;
 /// the Huffman coded payload is used (unless it doesn't fit in a medium-sized packet).
 static const int MAX_HUFFMAN_INPUT_SIZE = 4096; // bytes
 
+/// Number of recently deflated payloads that are kept for reuse.
+static const int DEFLATE_CACHE_SIZE = 4;
+
 #define TRMF_CONTINUE           0x80
 #define TRMF_DEFLATED           0x40
 #define TRMF_SIZE_MASK          0x7f
@@ -112,6 +115,54 @@ static const int MAX_HUFFMAN_INPUT_SIZE = 4096; // bytes
 
 namespace internal {
 
+/**
+ * Recently deflated large payloads. The same message is often sent to several
+ * recipients (broadcasts, or the handshake of each joining client), and it only
+ * needs to be deflated once.
+ */
+struct DeflateCache
+{
+    struct Entry
+    {
+        Block source;
+        Block deflated;
+    };
+    List<Entry> entries; ///< Most recently used first.
+};
+static LockableT<DeflateCache> deflateCache;
+
+static Block deflatePayload(const Block &payload, int level)
+{
+    if (payload.size() <= MAX_HUFFMAN_INPUT_SIZE)
+    {
+        // Small payloads are quick to compress.
+        return payload.compressed(level);
+    }
+    {
+        DE_GUARD(deflateCache);
+        auto &entries = deflateCache.value.entries;
+        for (dsize i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i].source == payload)
+            {
+                const DeflateCache::Entry found = entries[i];
+                entries.removeAt(i);
+                entries.prepend(found);
+                return found.deflated;
+            }
+        }
+    }
+    const Block deflated = payload.compressed(level);
+    if (deflated.size())
+    {
+        DE_GUARD(deflateCache);
+        auto &entries = deflateCache.value.entries;
+        entries.prepend(DeflateCache::Entry{payload, deflated});
+        if (entries.sizei() > DEFLATE_CACHE_SIZE) entries.removeLast();
+    }
+    return deflated;
+}
+
 /**
  * Network message header.
  */
@@ -226,6 +277,9 @@ DE_PIMPL_NOREF(Socket)
     /// Number of bytes written to the socket so far.
     dint64 totalBytesWritten = 0;
 
+    /// Size of the sent messages before compression.
+    dint64 totalUncompressedBytes = 0;
+
     TaskPool tasks;
     Dispatch dispatch;
 
@@ -254,14 +308,11 @@ DE_PIMPL_NOREF(Socket)
             // the deflated payload.
         }
 
-        /// @todo Messages broadcasted to multiple recipients are separately
-        /// compressed for each TCP send -- should do only one compression per
-        /// message.
-
         if (!header.size) // Try deflate.
         {
+            // Large messages sent to multiple recipients are deflated only once.
             const int level = 1; //(payload.size() < MAX_SIZE_BIG? 1 /*fast*/ : 9 /*best*/);
-            const Block deflated = payload.compressed(level);
+            const Block deflated = deflatePayload(payload, level);
 
             if (!deflated.size())
             {
@@ -327,6 +378,7 @@ DE_PIMPL_NOREF(Socket)
     void serializeAndSendMessage(const IByteArray &packet)
     {
         Block payload = packet;
+        totalUncompressedBytes += payload.size();
         {
             DE_GUARD(counters);
             counters.value.sentUncompressedBytes += payload.size();
@@ -730,6 +782,16 @@ void Socket::resetCounters()
     counters.value = Counters();
 }
 
+duint64 Socket::bytesSent() const
+{
+    return duint64(d->totalBytesWritten);
+}
+
+duint64 Socket::uncompressedBytesSent() const
+{
+    return duint64(d->totalUncompressedBytes);
+}
+
 duint64 Socket::sentUncompressedBytes()
 {
     DE_GUARD(counters);
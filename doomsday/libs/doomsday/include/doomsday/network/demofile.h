@@ -0,0 +1,181 @@
+/** @file doomsday/network/demofile.h  Seekable demo container.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef LIBDOOMSDAY_NETWORK_DEMOFILE_H
+#define LIBDOOMSDAY_NETWORK_DEMOFILE_H
+
+#include "../libdoomsday.h"
+
+#include <de/block.h>
+#include <de/error.h>
+#include <de/list.h>
+
+namespace network {
+
+/**
+ * Demo container layout (all values little-endian):
+ *
+ * - Header: magic "DDMO", format version (uint32), offset of the index
+ *   (uint32, zero while the demo is still being recorded), and the length of
+ *   the demo in tics (uint32).
+ * - Records: tic (int32), size (uint32), and @a size bytes of packet data
+ *   (message type followed by the payload).
+ * - A record with size zero marks a restart keyframe: the packets following it
+ *   load a map and rebuild the complete world state from scratch.
+ * - A record whose size has the high bit set marks a world keyframe. Its
+ *   payload is the offset of the restart keyframe of the current map (uint32).
+ *   The packets following it contain the complete world state relative to the
+ *   initial state of the map. To continue from a world keyframe, the packets of
+ *   the restart keyframe are replayed up to the next keyframe marker to load
+ *   the map, and then reading continues at the world keyframe.
+ * - Index: number of keyframes (uint32) followed by tic/offset/map offset
+ *   triplets (int32, uint32, uint32) pointing to the keyframe marker records.
+ *
+ * The keyframe markers are also present inline, so the index can be rebuilt by
+ * scanning the records if recording was interrupted before the index was written.
+ */
+struct LIBDOOMSDAY_PUBLIC DemoKeyframe
+{
+    de::dint32  tic;
+    de::duint32 offset;
+    de::duint32 mapOffset;  ///< Restart keyframe that loads the map (@a offset for restarts).
+
+    bool isRestart() const { return offset == mapOffset; }
+};
+
+/**
+ * Writes a demo container. The records are written to the output as they are
+ * made, except that the most recent packet is held back until the next record
+ * (see insertKeyframeBeforeLastPacket()). The keyframe index is written when
+ * the writer is closed.
+ */
+class LIBDOOMSDAY_PUBLIC DemoWriter
+{
+public:
+    /// Writes the demo into memory; see finish().
+    DemoWriter();
+
+    /**
+     * Writes the demo to @a output, beginning at offset zero. The output must
+     * remain available until the writer is closed.
+     */
+    DemoWriter(de::IByteArray &output);
+
+    /**
+     * Appends a packet to the demo.
+     *
+     * @param tic     Time of the packet, counted from the start of the recording.
+     * @param packet  Message type followed by the message payload.
+     */
+    void writePacket(de::dint32 tic, const de::IByteArray &packet);
+
+    /**
+     * Marks the start of a restart keyframe. All packets written after this must
+     * be enough to load the map and reconstruct the full world state at @a tic.
+     */
+    void beginKeyframe(de::dint32 tic);
+
+    /**
+     * Marks a restart keyframe before the most recently written packet. Used when
+     * it turns out only afterwards that the packet began loading a new map.
+     */
+    void insertKeyframeBeforeLastPacket();
+
+    /**
+     * Marks the start of a world keyframe. The packets written after this must
+     * contain the full world state at @a tic relative to the initial state of
+     * the map loaded by the latest restart keyframe. Ignored if there is no
+     * restart keyframe yet.
+     */
+    void beginWorldKeyframe(de::dint32 tic);
+
+    de::dint32 lastKeyframeTic() const;
+    int keyframeCount() const;
+
+    /**
+     * Writes the held-back packet, appends the keyframe index, and finalizes the
+     * header. Nothing may be written afterwards.
+     */
+    void close();
+
+    /**
+     * Closes a writer that writes into memory.
+     *
+     * @return The finished demo. The writer is left empty.
+     */
+    de::Block finish();
+
+private:
+    DE_PRIVATE(d)
+};
+
+/**
+ * Reads packets from a demo container and seeks using the keyframe index.
+ */
+class LIBDOOMSDAY_PUBLIC DemoReader
+{
+public:
+    /// The data is not a demo container. @ingroup errors
+    DE_ERROR(FormatError);
+
+public:
+    DemoReader(const de::Block &demo);
+
+    /// Length of the demo in tics (zero if the recording was not finished).
+    de::dint32 durationTics() const;
+
+    const de::List<DemoKeyframe> &keyframes() const;
+
+    /**
+     * Positions the reader at the latest keyframe at or before @a tic.
+     * Packets from the keyframe onwards must be replayed to reach @a tic; the
+     * amount of work is bounded by the keyframe interval. If the keyframe is a
+     * world keyframe, the packets that load its map are read first.
+     *
+     * @return Tic of the keyframe that playback continues from.
+     */
+    de::dint32 seek(de::dint32 tic);
+
+    /// Tic of the next packet, or -1 at the end of the demo.
+    de::dint32 nextTic() const;
+
+    /**
+     * Reads the next packet. Keyframe markers are skipped.
+     *
+     * @param tic     Time of the packet.
+     * @param packet  Packet contents (message type and payload).
+     *
+     * @return @c false at the end of the demo.
+     */
+    bool readPacket(de::dint32 &tic, de::Block &packet);
+
+    /**
+     * Composes a new demo from the time range [@a fromTic, @a toTic]. The new
+     * demo starts at the keyframe preceding @a fromTic, with times rebased so
+     * that it begins at tic zero. The packets of the first restart keyframe (the
+     * handshake) and of the map's restart keyframe are placed at the beginning.
+     */
+    de::Block extract(de::dint32 fromTic, de::dint32 toTic) const;
+
+private:
+    DE_PRIVATE(d)
+};
+
+} // namespace network
+
+#endif // LIBDOOMSDAY_NETWORK_DEMOFILE_H
@@ -71,6 +71,7 @@ enum {
     PCL_GOODBYE             = 31,
     PSV_MOBJ_TYPE_ID_LIST   = 32,
     PSV_MOBJ_STATE_ID_LIST  = 33,
+    PCL_FULL_FRAME_REQUEST  = 34, // Resend the complete world state (no handshake).
     PSV_SOUND               = 71,
 
     // Game specific events.
@@ -405,7 +406,8 @@ public:
         GameState,      ///< Current state of the game (mode, map).
         Leaderboard,    ///< Frags leaderboard.
         MapOutline,     ///< Sectors of the map for visual overview.
-        PlayerInfo      ///< Current player names, colors, positions.
+        PlayerInfo,     ///< Current player names, colors, positions.
+        Metrics         ///< Server performance metrics.
     };
 
 public:
@@ -456,6 +458,16 @@ public:
      */
     RecordPacket *newGameState(const String &mode, const String &rules, const String &mapId,
                                const String &mapTitle);
+
+    /**
+     * Constructs a packet with the server's current performance metrics.
+     * Sent periodically to shell users.
+     *
+     * @param metrics  Values of the metrics (see ServerSystem::loadStatus()).
+     *
+     * @return Packet. Caller gets ownership.
+     */
+    RecordPacket *newMetrics(const Record &metrics);
 };
 
 } // namespace network
@@ -24,6 +24,7 @@
 #include "../libdoomsday.h"
 #include <de/legacy/aabox.h>
 #include <de/vector.h>
+#include <vector>
 
 #ifdef WIN32
 #  undef max
@@ -148,15 +149,76 @@ public:
     void unlinkAll();
 
     /**
-     * Iterate through all objects in the given @a cell.
+     * Moves all linked elements into a single array ordered by cell. Iteration is
+     * fastest in this layout, so it is meant for blockmaps that are populated once
+     * and then only queried (lines, subspaces).
+     *
+     * Linking or unlinking afterwards returns the blockmap to the dynamic layout.
+     * This must not be done while the blockmap is being iterated, because the
+     * compacted element array is freed (asserted in debug builds).
      */
-    de::LoopResult forAllInCell(const Cell &cell, std::function<de::LoopResult (void *object)> func) const;
+    void compact();
+
+    /**
+     * Returns @c true if the blockmap is in the compacted layout (see compact()).
+     */
+    bool isCompact() const;
+
+    /**
+     * Iterate through all objects in the given @a cell. Objects may be linked and
+     * unlinked by @a func during the iteration; objects linked into the cell after
+     * the iteration began are not visited.
+     *
+     * @param func  Callback: `LoopResult (void *object)`.
+     */
+    template <typename Func>
+    de::LoopResult forAllInCell(const Cell &cell, Func func) const
+    {
+        const CellRange range = cellRange(cell);
+        if (range.elements)
+        {
+#ifdef DE_DEBUG
+            const IterationGuard guard(*this);
+#endif
+            for (de::dint i = 0; i < range.count; ++i)
+            {
+                if (auto result = func(range.elements[i])) return de::LoopResult(result);
+            }
+        }
+        else if (range.first >= 0)
+        {
+            // The callback may add nodes, reallocating the array, so nodes are
+            // accessed by index. A cell's list only grows at the end.
+            for (de::dint i = range.first; ; i = (*range.nodes)[i].next)
+            {
+                if (void *object = (*range.nodes)[i].elem)
+                {
+                    if (auto result = func(object)) return de::LoopResult(result);
+                }
+                if (i == range.last) break;
+            }
+        }
+        return de::LoopContinue;
+    }
 
     /**
      * Iterate through all objects in all cells which intercept the given map
      * space, axis-aligned bounding @a box.
+     *
+     * @param func  Callback: `LoopResult (void *object)`.
      */
-    de::LoopResult forAllInBox(const AABoxd &box, std::function<de::LoopResult (void *object)> func) const;
+    template <typename Func>
+    de::LoopResult forAllInBox(const AABoxd &box, Func func) const
+    {
+        const CellBlock cellBlock = clippedCellBlock(box);
+        Cell cell;
+        for (cell.y = cellBlock.min.y; cell.y < cellBlock.max.y; ++cell.y)
+        for (cell.x = cellBlock.min.x; cell.x < cellBlock.max.x; ++cell.x)
+        {
+            if (auto result = forAllInCell(cell, func)) return result;
+        }
+        return de::LoopContinue;
+    }
 
     /**
      * Iterate over all objects in cells which intercept the line specified by
@@ -167,11 +229,95 @@ public:
      *
      * @param from  Map space point defining the origin of the line.
      * @param to    Map space point defining the destination of the line.
+     * @param func  Callback: `LoopResult (void *object)`.
      */
-    de::LoopResult forAllInPath(const de::Vec2d &from, const de::Vec2d &to,
-                                std::function<de::LoopResult (void *object)> func) const;
+    template <typename Func>
+    de::LoopResult forAllInPath(const de::Vec2d &from, const de::Vec2d &to, Func func) const
+    {
+        PathWalk walk;
+        if (!beginPath(from, to, walk)) return de::LoopContinue;
+        do
+        {
+            if (auto result = forAllInCell(walk.cell, func)) return result;
+        } while (nextPathCell(walk));
+        return de::LoopContinue;
+    }
 
 private:
+    /**
+     * Element of a cell's list in the dynamic layout. The nodes of all cells share
+     * one array; @c nullptr elements are empty nodes that are reused by the cell.
+     */
+    struct Node
+    {
+        void *   elem;
+        de::dint next; ///< Index of the next node in the cell, or -1.
+    };
+
+    /**
+     * Elements of a cell. In the compacted layout @a elements points to @a count
+     * contiguous elements, otherwise the cell's nodes are @a first ... @a last.
+     */
+    struct CellRange
+    {
+        void *const *elements = nullptr;
+        de::dint count = 0;
+        const std::vector<Node> *nodes = nullptr;
+        de::dint first = -1;
+        de::dint last  = -1;
+    };
+
+    CellRange cellRange(const Cell &cell) const;
+
+    /// Position of a walk through the cells intercepted by a line (see forAllInPath()).
+    struct PathWalk
+    {
+        Cell      cell;
+        Cell      destCell;
+        de::Vec2i cellStep;
+        de::Vec2d intercept;
+        de::Vec2d interceptStep;
+        de::dint  pass = 0;
+    };
+
+    /**
+     * Clips the line from @a from to @a to to the blockmap and sets up @a walk at
+     * the first cell. Returns @c false if the line does not visit any cells.
+     */
+    bool beginPath(const de::Vec2d &from, const de::Vec2d &to, PathWalk &walk) const;
+
+    /// Moves @a walk to the next cell. Returns @c false when the walk is over.
+    static inline bool nextPathCell(PathWalk &walk)
+    {
+        // The pass limit prevents a round off error leading into an infinite loop.
+        if (walk.cell == walk.destCell || ++walk.pass == 64) return false;
+
+        if (walk.cell.y == de::duint(walk.intercept.y))
+        {
+            walk.cell.x      += walk.cellStep.x;
+            walk.intercept.y += walk.interceptStep.y;
+        }
+        else if (walk.cell.x == de::duint(walk.intercept.x))
+        {
+            walk.cell.y      += walk.cellStep.y;
+            walk.intercept.x += walk.interceptStep.x;
+        }
+        return true;
+    }
+
+    /// Marks the compacted elements as being iterated, for checking in expand().
+    struct IterationGuard
+    {
+        const Blockmap &bmap;
+        IterationGuard(const Blockmap &bmap) : bmap(bmap) { bmap.beginIteration(); }
+        ~IterationGuard() { bmap.endIteration(); }
+    };
+    void beginIteration() const;
+    void endIteration() const;
+
+    /// Cells intercepting @a box, clipped to the blockmap dimensions.
+    CellBlock clippedCellBlock(const AABoxd &box) const;
+
     DE_PRIVATE(d)
 };
 
@@ -1,6 +1,7 @@
 /** @file entitydatabase.h World map entity property value database.
  *
  * @authors Copyright © 2007-2013 Daniel Swanson <danij@dengine.net>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -37,11 +38,37 @@
  * at all about the values or indeed even what properties are registered; it is
  * simply a way of piping information from one part of the system to another.
  *
- * @todo C++ allows making this more generic: a set/map of polymorphic objects
- * e.g., QVariant.
+ * Values are stored in columns: each property of each entity type has one
+ * contiguous array indexed by element, using the value type of the property
+ * definition. Values given in another type are converted when stored. A bitmap
+ * tells which elements have a value.
  */
 class LIBDOOMSDAY_PUBLIC EntityDatabase
 {
+public:
+    /**
+     * Read-only view of the values of one property. Remains valid until the
+     * property is modified.
+     */
+    struct Column
+    {
+        valuetype_t        type    = DDVT_NONE; ///< Type of the values.
+        int                size    = 0;         ///< Number of elements in the arrays.
+        const void *       values  = nullptr;   ///< Array of @a size values of @a type.
+        const de::duint64 *present = nullptr;   ///< Bitmap of elements that have a value.
+
+        inline bool isSet(int elementIndex) const {
+            return elementIndex >= 0 && elementIndex < size &&
+                   ((present[elementIndex >> 6] >> (elementIndex & 63)) & 1) != 0;
+        }
+
+        /// Value of an element; elements without a value are zero.
+        template <typename Type>
+        inline Type at(int elementIndex) const {
+            return static_cast<const Type *>(values)[elementIndex];
+        }
+    };
+
 public:
     EntityDatabase();
 
@@ -60,12 +87,32 @@ public:
      * @param def           Definition of the property to lookup an element value for.
      * @param elementIndex  Unique element index of the value to lookup.
      *
-     * @return The found PropertyValue.
+     * @return The found PropertyValue. Remains valid until the property is modified.
      */
     const PropertyValue &property(const MapEntityPropertyDef *def, int elementIndex) const;
 
+    /**
+     * Lookup a known entity element property value in the database, without
+     * building a PropertyValue for it.
+     *
+     * @param def           Definition of the property to lookup an element value for.
+     * @param elementIndex  Unique element index of the value to lookup.
+     * @param valueType     Type of the value to return. Converted if necessary.
+     * @param valueAdr      The value is written here.
+     */
+    void property(const MapEntityPropertyDef *def, int elementIndex,
+                  valuetype_t valueType, void *valueAdr) const;
+
     bool hasPropertyValue(const MapEntityPropertyDef *def, int elementIndex) const;
 
+    /**
+     * Returns all the values of a property. Use this to read a property of every
+     * element without looking each one up separately.
+     *
+     * @param def  Definition of the property.
+     */
+    Column column(const MapEntityPropertyDef *def) const;
+
     /**
      * Replace/add a value for a known entity element property to the database.
      *
@@ -80,9 +127,22 @@ public:
     inline void setProperty(const MapEntityPropertyDef *def, int elementIndex,
                             valuetype_t valueType, void *valueAdr)
     {
-        setProperty(def, elementIndex, BuildPropertyValue(valueType, valueAdr));
+        setProperties(def, elementIndex, 1, valueType, valueAdr);
     }
 
+    /**
+     * Replace/add values of a property for a range of consecutive elements. This
+     * is considerably faster than setting the values one at a time.
+     *
+     * @param def           Definition of the property to add element values for.
+     * @param firstIndex    Element index of the first value.
+     * @param count         Number of values.
+     * @param valueType     Type of the values.
+     * @param values        Array of @a count values of @a valueType.
+     */
+    void setProperties(const MapEntityPropertyDef *def, int firstIndex, int count,
+                       valuetype_t valueType, const void *values);
+
 private:
     DE_PRIVATE(d)
 };
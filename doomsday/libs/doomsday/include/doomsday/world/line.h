@@ -429,6 +429,8 @@ public:
     inline Vertex       &vertex(int to);
     inline const Vertex &vertex(int to) const;
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
     int setProperty(const world::DmuArgs &args);
@@ -470,7 +472,7 @@ public:
     DE_ERROR(MissingPolyobjError);
 
     /// Notified whenever the flags change.
-    DE_DEFINE_AUDIENCE(FlagsChange, void lineFlagsChanged(Line &line, int oldFlags))
+    DE_DEFINE_LIGHT_AUDIENCE(FlagsChange, void lineFlagsChanged(Line &line, int oldFlags))
 
     // Logical edge identifiers:
     enum { From, To };
@@ -760,6 +762,8 @@ public:
      */
     static void consoleRegister();
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
     int setProperty(const world::DmuArgs &args);
@@ -30,9 +30,8 @@ namespace world {
 /**
  * Models the logic, parameters and state of a line (of) sight (LOS) test.
  *
- * FIXME: The state of a discrete trace is not fully encapsulated here
- * due to the manipulation of the validCount properties of the various map data elements.
- * (Which is used to avoid testing the same element multiple times during a trace.)
+ * The lines already tested during a trace are tracked per thread, so separate
+ * traces may be run concurrently as long as the map is not modified meanwhile.
  *
  * @todo Optimize: Make use of the blockmap to take advantage of the inherent spatial
  * locality in this data structure.
@@ -494,6 +494,16 @@ public:
      */
     const BspTree &bspTree() const;
 
+    /**
+     * Returns the sector-to-sector line-of-sight REJECT matrix of the map. The
+     * REJECT lump of the map is used if there is one and it is not empty.
+     * Otherwise, a matrix is built (and cached in "/home/cache/maps" for the next
+     * time the map is loaded). The matrix is kept with the map once requested.
+     *
+     * @see BuildRejectForMap()
+     */
+    const de::Block &rejectMatrix() const;
+
     /**
      * Determine the BSP leaf on the back side of the BS partition that lies in front of
      * the specified point within the map's coordinate space.
@@ -535,6 +545,12 @@ public:
      */
     de::String elementSummaryAsStyledText() const;
 
+    /**
+     * Returns a rich formatted, textual summary of the memory used by the map's
+     * elements, suitable for logging.
+     */
+    de::String memorySummaryAsStyledText() const;
+
     /**
      * Returns a rich formatted, textual summary of the map's objects, suitable for logging.
      */
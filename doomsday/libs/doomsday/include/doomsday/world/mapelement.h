@@ -198,6 +198,14 @@ public:
      */
     virtual int setProperty(const world::DmuArgs &args);
 
+    /**
+     * Returns the approximate number of bytes of memory used by the map element,
+     * including its private data and allocated audiences. Owned child elements (for
+     * instance the Surface of a Plane) are not included. Derived classes add their
+     * own share.
+     */
+    virtual de::dsize memoryUsage() const;
+
 private:
     DE_PRIVATE(d)
 
@@ -45,10 +45,10 @@ class LIBDOOMSDAY_PUBLIC Plane : public MapElement
 public:
 
     /// Notified when the plane is about to be deleted.
-    DE_AUDIENCE(Deletion, void planeBeingDeleted(const Plane &plane))
+    DE_LIGHT_AUDIENCE(Deletion, void planeBeingDeleted(const Plane &plane))
 
     /// Notified whenever a @em sharp height change occurs.
-    DE_AUDIENCE(HeightChange, void planeHeightChanged(Plane &plane))
+    DE_LIGHT_AUDIENCE(HeightChange, void planeHeightChanged(Plane &plane))
 
     /// Maximum speed for a smoothed plane.
     static const int MAX_SMOOTH_MOVE = 64;
@@ -158,6 +158,8 @@ public:
      */
     double speed() const;
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
     int setProperty(const world::DmuArgs &args);
@@ -23,7 +23,11 @@
 #ifndef DE_WORLD_REJECT_H
 #define DE_WORLD_REJECT_H
 
-#if 0 // Needs updating
+#include "../libdoomsday.h"
+#include <de/block.h>
+
+namespace world {
+
 class Map;
 
 /**
@@ -64,14 +68,20 @@ class Map;
  *
  *     ceiling(numSectors^2)
  *
- * For now we only do very basic reject processing, limited to determining
- * all isolated sector groups (islands that are surrounded by void space).
- *
  * @note Algorithm:
- * Initially all sectors are in individual groups. Next, we scan the line
- * list. For each 2-sectored line, merge the two sector groups into one.
+ * The convex subspaces of the map are the cells and the edges between them
+ * that a line of sight could cross (i.e., not one-sided lines) are the
+ * portals. For each sector, sight is flooded from its subspaces through the
+ * portals; each portal further away is clipped to the region reachable by
+ * straight lines passing through the first and the previous portal of the
+ * path. Plane heights are ignored as they may change during play, so the
+ * result is conservative: a pair is only rejected if no line of sight can
+ * ever exist between the sectors. If a sector's flood becomes too expensive,
+ * every sector is considered visible from it (and this is logged). The sectors
+ * are processed in parallel.
  */
-byte *BuildRejectForMap(const Map &map);
-#endif
+LIBDOOMSDAY_PUBLIC de::Block BuildRejectForMap(const Map &map);
+
+} // namespace world
 
 #endif // DE_WORLD_REJECT_H
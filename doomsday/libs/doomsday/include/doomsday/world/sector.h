@@ -68,10 +68,10 @@ public:
 //- Lighting ----------------------------------------------------------------------------
 
     /// Notified whenever a light level change occurs.
-    DE_AUDIENCE(LightLevelChange, void sectorLightLevelChanged(Sector &sector))
+    DE_LIGHT_AUDIENCE(LightLevelChange, void sectorLightLevelChanged(Sector &sector))
 
     /// Notified whenever a light color change occurs.
-    DE_AUDIENCE(LightColorChange, void sectorLightColorChanged(Sector &sector))
+    DE_LIGHT_AUDIENCE(LightColorChange, void sectorLightColorChanged(Sector &sector))
 
     /**
      * Returns the ambient light level in the sector. The LightLevelChange audience is
@@ -326,6 +326,8 @@ public:
      */
     static void consoleRegister();
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
     int setProperty(const world::DmuArgs &args);
@@ -49,16 +49,16 @@ public:
     };
 
     /// Notified whenever the tint color changes.
-    DE_AUDIENCE(ColorChange,   void surfaceColorChanged(Surface &sector))
+    DE_LIGHT_AUDIENCE(ColorChange,   void surfaceColorChanged(Surface &sector))
 
     /// Notified whenever the normal vector changes.
-    DE_AUDIENCE(NormalChange,  void surfaceNormalChanged(Surface &surface))
+    DE_LIGHT_AUDIENCE(NormalChange,  void surfaceNormalChanged(Surface &surface))
 
     /// Notified whenever the opacity changes.
-    DE_AUDIENCE(OpacityChange, void surfaceOpacityChanged(Surface &surface))
+    DE_LIGHT_AUDIENCE(OpacityChange, void surfaceOpacityChanged(Surface &surface))
 
     /// Notified whenever the @em sharp origin changes.
-    DE_AUDIENCE(OriginChange,  void surfaceOriginChanged(Surface &surface))
+    DE_LIGHT_AUDIENCE(OriginChange,  void surfaceOriginChanged(Surface &surface))
 
 public:
     /**
@@ -132,7 +132,7 @@ public:
     DE_ERROR(MissingMaterialError);
 
     /// Notified when the material changes.
-    DE_AUDIENCE(MaterialChange, void surfaceMaterialChanged(Surface &surface))
+    DE_LIGHT_AUDIENCE(MaterialChange, void surfaceMaterialChanged(Surface &surface))
 
     /**
      * Returns @c true iff a material is bound to the surface.
@@ -217,6 +217,8 @@ public:
 
     virtual void resetLookups();
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
     int setProperty(const world::DmuArgs &args);
@@ -33,6 +33,7 @@ typedef void (*thinkfunc_t) (void *);
 // Thinker flags:
 #define THINKF_STD_MALLOC  0x1     // allocated using M_Malloc rather than the zone
 #define THINKF_DISABLED    0x2     // thinker is disabled (in stasis)
+#define THINKF_POOLED      0x4     // allocated from a world::ThinkerPool
 
 /**
  * Base for all thinker objects.
@@ -132,7 +133,7 @@ public:
         DE_CAST_METHODS()
     };
 
-    enum AllocMethod { AllocateStandard, AllocateMemoryZone };
+    enum AllocMethod { AllocateStandard, AllocateMemoryZone, AllocatePooled };
 
 public:
     /**
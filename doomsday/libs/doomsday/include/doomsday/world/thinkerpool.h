@@ -0,0 +1,89 @@
+/** @file thinkerpool.h  Slab allocator for thinkers.
+ * @ingroup world
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#pragma once
+
+#include "../libdoomsday.h"
+#include <de/libcore.h>
+
+struct thinker_s;
+
+namespace world {
+
+/**
+ * Allocates thinkers of one size from slabs of many thinkers, so thinkers of the
+ * same type are next to each other in memory and allocating one is a free list
+ * pop. Pooled thinkers have the THINKF_POOLED flag and are returned to their pool
+ * by Thinker::destroy().
+ *
+ * There is one pool per thinker size (see forSize()). All of them are cleared when
+ * the map is unloaded, before the map's zone memory is freed. Thinkers released
+ * after clearAll() are ignored until the next allocation, because their memory is
+ * already gone.
+ *
+ * @ingroup world
+ */
+class LIBDOOMSDAY_PUBLIC ThinkerPool
+{
+public:
+    /**
+     * @param thinkerSize      Size of each thinker in bytes.
+     * @param thinkersPerSlab  Number of thinkers allocated at a time.
+     */
+    ThinkerPool(de::dsize thinkerSize, de::dsize thinkersPerSlab = 256);
+
+    de::dsize thinkerSize() const;
+
+    /**
+     * Returns the number of thinkers currently allocated from the pool.
+     */
+    de::dsize count() const;
+
+    /**
+     * Allocates a zeroed thinker that has the THINKF_POOLED flag set.
+     */
+    thinker_s *allocate();
+
+    /**
+     * Frees all slabs. Thinkers allocated from the pool become invalid and must not
+     * be released any more.
+     */
+    void clear();
+
+public:
+    /**
+     * Returns a thinker to the pool it was allocated from.
+     */
+    static void release(thinker_s *thinker);
+
+    /**
+     * Returns the pool for thinkers of @a thinkerSize bytes.
+     */
+    static ThinkerPool &forSize(de::dsize thinkerSize);
+
+    /**
+     * Clears all the pools returned by forSize().
+     */
+    static void clearAll();
+
+private:
+    DE_PRIVATE(d)
+};
+
+} // namespace world
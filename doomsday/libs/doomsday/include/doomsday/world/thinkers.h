@@ -77,6 +77,13 @@ public:
      */
     void remove(thinker_t &thinker);
 
+    /**
+     * Unlinks a thinker from its list. This is done when a removed thinker's
+     * thinking turn comes up, before its memory is released or recycled.
+     * Unlinking the thinker currently being visited by forAll() is allowed.
+     */
+    void unlink(thinker_t &thinker);
+
     /**
      * Iterate the list of thinkers making a callback for each.
      *
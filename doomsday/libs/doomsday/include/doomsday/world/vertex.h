@@ -46,7 +46,7 @@ class LIBDOOMSDAY_PUBLIC Vertex : public MapElement, public mesh::MeshElement
 
 public:
     /// Notified whenever the origin changes.
-    DE_DEFINE_AUDIENCE(OriginChange, void vertexOriginChanged(Vertex &vertex))
+    DE_DEFINE_LIGHT_AUDIENCE(OriginChange, void vertexOriginChanged(Vertex &vertex))
 
 public:
     Vertex(mesh::Mesh &mesh, const de::Vec2d &origin = {});
@@ -116,6 +116,8 @@ public:  //- Deprecated --------------------------------------------------------
      */
     LineOwner *firstLineOwner() const;
 
+    de::dsize memoryUsage() const override;
+
 protected:
     int property(world::DmuArgs &args) const;
 
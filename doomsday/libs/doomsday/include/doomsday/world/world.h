@@ -45,6 +45,7 @@ public:
 
     static int ddMapSetup; // map setup is in progress
     static int validCount;
+    static int geometryStamp; // changed whenever plane heights or polyobjs move
 
     enum FrameState
     {
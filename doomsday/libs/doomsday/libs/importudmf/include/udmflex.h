@@ -1,6 +1,7 @@
 /** @file udmflex.h  UDMF lexical analyzer.
  *
  * @authors Copyright (c) 2016-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -19,53 +20,82 @@
 #ifndef IMPORTUDMF_UDMFLEX_H
 #define IMPORTUDMF_UDMFLEX_H
 
-#include <de/scripting/lex.h>
-#include <de/scripting/tokenbuffer.h>
+#include <de/error.h>
+#include <de/string.h>
 
-class UDMFLex : public de::Lex
+/**
+ * Lexical analyzer for UDMF TEXTMAP source.
+ *
+ * Works directly on the raw bytes of the lump in a single pass. Tokens point to
+ * the source text, so nothing is copied or allocated while reading.
+ */
+class UDMFLex
 {
 public:
-    // Keywords.
-    static de::String const NAMESPACE;
-    static de::String const LINEDEF;
-    static de::String const SIDEDEF;
-    static de::String const VERTEX;
-    static de::String const SECTOR;
-    static de::String const THING;
-    static de::String const T_TRUE;
-    static de::String const T_FALSE;
-
-    // Operators.
-    static de::String const ASSIGN;
-
-    // Literals.
-    static de::String const BRACKET_OPEN;
-    static de::String const BRACKET_CLOSE;
-    static de::String const SEMICOLON;
+    /// The source has a lexical error. @ingroup errors
+    DE_ERROR(SyntaxError);
+
+    enum TokenType {
+        End,
+        Identifier,
+        Integer,
+        Float,
+        String,       ///< Quoted; the token includes the quotes.
+        True,
+        False,
+        Assign,
+        Semicolon,
+        BracketOpen,
+        BracketClose,
+    };
+
+    struct Token
+    {
+        TokenType   type;
+        const char *begin;
+        const char *end;
+
+        inline de::dsize size() const { return de::dsize(end - begin); }
+
+        /// Case-insensitive comparison with a lower-case keyword.
+        bool equals(const char *lowerCaseText) const;
+
+        /// Value of an Integer token (decimal, octal, or hexadecimal).
+        de::dint64 toInteger() const;
+
+        /// Value of an Integer or Float token.
+        double toDouble() const;
+
+        /// Contents of a String token without the quotes, escapes resolved.
+        de::String unescaped() const;
+
+        /// Contents of a String token without the quotes, escapes left as is.
+        inline const char *textBegin() const { return begin + 1; }
+        inline const char *textEnd() const   { return end - 1; }
+        bool hasEscapes() const;
+
+        de::String asText() const;
+    };
 
 public:
-    UDMFLex(const de::String &input = "");
+    UDMFLex(const char *begin, const char *end);
 
     /**
-     * Reads tokens from the source until the end of an expression. The opening bracket
-     * of a block ends an expression, and the closing bracket is treated as an expression
-     * of its own.
-     *
-     * @param output  The read tokens.
+     * Reads the next token.
      *
-     * @return Number of tokens in the @a output buffer.
+     * @throws SyntaxError  Invalid character or unterminated string/comment.
      */
-    de::dsize getExpressionFragment(de::TokenBuffer &output);
+    Token next();
 
-    /**
-     * Parse a string.
-     *
-     * @param output  Output token buffer.
-     */
-    void parseString(de::TokenBuffer &output);
+    int lineNumber() const;
+
+private:
+    void skipWhiteAndComments();
+    [[noreturn]] void fail(const char *message) const;
 
-    /// Determines whether a token is a keyword.
-    static bool isKeyword(const de::Token &token);
+    const char *_pos;
+    const char *_end;
+    int         _line = 1;
 };
 
 #endif // IMPORTUDMF_UDMFLEX_H
@@ -1,6 +1,7 @@
 /** @file udmfparser.h  UDMF parser.
  *
  * @authors Copyright (c) 2016-2018 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -20,56 +21,104 @@
 #define IMPORTUDMF_UDMFPARSER_H
 
 #include "udmflex.h"
-#include <de/scripting/tokenrange.h>
-#include <de/hash.h>
-#include <de/value.h>
+#include <de/block.h>
+#include <de/string.h>
 #include <functional>
+#include <vector>
 
 /**
  * UMDF parser.
  *
  * Reads input text and makes callbacks for each parsed block. The parsed contents are
  * not kept in memory.
+ *
+ * The parser only keeps the properties it was told about when constructed. Each of
+ * them is identified by its index in the list of names, so the importer can access
+ * block contents with plain array lookups. Values refer to the source text, which
+ * must remain unchanged while parsing.
  */
 class UDMFParser
 {
 public:
-    typedef de::Hash<de::String, std::shared_ptr<de::Value>> Block;
-    typedef std::function<void (const de::String &, const de::Value &)> AssignmentFunc;
-    typedef std::function<void (const de::String &, const Block &)> BlockFunc;
-
     DE_ERROR(SyntaxError);
 
+    enum BlockType { UnknownBlock, Thing, Vertex, Linedef, Sidedef, Sector };
+
+    /**
+     * Assigned value. A value that was not assigned is zero, false, and empty.
+     */
+    struct Value
+    {
+        enum Type { None, Integer, Number, Boolean, Text };
+
+        Type        type      = None;
+        de::dint64  integer   = 0;    ///< Integer and Boolean.
+        double      number    = 0;    ///< Number.
+        const char *textBegin = nullptr;
+        const char *textEnd   = nullptr;
+        bool        escaped   = false;
+
+        int        asInt() const;
+        double     asNumber() const;
+        bool       isTrue() const;
+        bool       isEmpty() const { return textBegin == textEnd; }
+        de::String asText() const;
+    };
+
+    /**
+     * Property values of a block, indexed by property identifier.
+     */
+    class Block
+    {
+    public:
+        inline const Value &operator[](int propertyId) const { return _values[propertyId]; }
+        inline bool contains(int propertyId) const { return _values[propertyId].type != Value::None; }
+
+    private:
+        friend class UDMFParser;
+        std::vector<Value> _values;
+        std::vector<int>   _assigned;
+    };
+
+    typedef std::function<void (const de::String &, const Value &)> AssignmentFunc;
+    typedef std::function<void (BlockType, const Block &)> BlockFunc;
+
 public:
-    UDMFParser();
+    /**
+     * @param propertyNames  Names of the block properties of interest. Property
+     *                       identifiers are indices to this list.
+     */
+    UDMFParser(const de::StringList &propertyNames);
 
     void setGlobalAssignmentHandler(AssignmentFunc func);
     void setBlockHandler(BlockFunc func);
 
-    const Block &globals() const;
-
     /**
      * Parse UDMF source and make callbacks for global assignments and blocks while
      * parsing.
      *
-     * @param input  UDMF source text.
+     * @param begin  Start of the UDMF source text.
+     * @param end    End of the UDMF source text.
      *
      * @throws SyntaxError  UDMF source text has a syntax error.
      */
-    void parse(const de::String &input);
+    void parse(const char *begin, const char *end);
 
-protected:
-    de::dsize nextFragment();
-    void parseBlock(Block &block);
-    void parseAssignment(Block &block);
+    inline void parse(const de::Block &input)
+    {
+        parse(input.c_str(), input.c_str() + input.size());
+    }
 
 private:
-    AssignmentFunc  _assignmentHandler;
-    BlockFunc       _blockHandler;
-    Block           _globals;
-    UDMFLex         _analyzer;
-    de::TokenBuffer _tokens;
-    de::TokenRange  _range;
+    int propertyId(const UDMFLex::Token &identifier) const;
+    Value parseValue(UDMFLex &lex);
+    void expect(UDMFLex &lex, UDMFLex::TokenType type, const char *what);
+
+    AssignmentFunc           _assignmentHandler;
+    BlockFunc                _blockHandler;
+    std::vector<std::string> _names;     ///< Lower case.
+    std::vector<int>         _lookup;    ///< Open addressing hash of property names.
+    Block                    _block;
 };
 
 #endif // IMPORTUDMF_UDMFPARSER_H
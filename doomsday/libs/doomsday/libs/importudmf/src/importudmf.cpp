@@ -1,6 +1,7 @@
 /** @file importudmf.cpp  Importer plugin for UDMF maps.
  *
  * @authors Copyright (c) 2016-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -25,26 +26,48 @@
 #include <de/app.h>
 #include <de/extension.h>
 #include <de/log.h>
+#include <vector>
 
 using namespace de;
 using namespace res;
 
-template <valuetype_t VALUE_TYPE, typename Type>
-void gmoSetThingProperty(int index, const char *propertyId, Type value)
-{
-    MPE_GameObjProperty("Thing", index, propertyId, VALUE_TYPE, &value);
-}
-
-template <valuetype_t VALUE_TYPE, typename Type>
-void gmoSetSectorProperty(int index, const char *propertyId, Type value)
-{
-    MPE_GameObjProperty("XSector", index, propertyId, VALUE_TYPE, &value);
-}
+/// Identifiers of the UDMF properties read by the importer.
+namespace prop {
+enum {
+    X, Y, Z, Angle, Type, Id, Special, Arg0, Arg1, Arg2, Arg3, Arg4,
+    Ambush, Single, Dm, Coop, Friend, Dormant, Class1, Class2, Class3,
+    Standing, StrifeAlly, Translucent, Invisible,
+    Skill1, Skill2, Skill3, Skill4, Skill5,
+    V1, V2, SideFront, SideBack, Blocking, DontPegTop, DontPegBottom, TwoSided,
+    Sector, OffsetX, OffsetY, TextureTop, TextureMiddle, TextureBottom,
+    LightLevel, HeightFloor, HeightCeiling, TextureFloor, TextureCeiling,
+    Count
+};
+} // namespace prop
+
+static const char *udmfPropertyNames[prop::Count] = {
+    "x", "y", "z", "angle", "type", "id", "special", "arg0", "arg1", "arg2", "arg3", "arg4",
+    "ambush", "single", "dm", "coop", "friend", "dormant", "class1", "class2", "class3",
+    "standing", "strifeally", "translucent", "invisible",
+    "skill1", "skill2", "skill3", "skill4", "skill5",
+    "v1", "v2", "sidefront", "sideback", "blocking", "dontpegtop", "dontpegbottom", "twosided",
+    "sector", "offsetx", "offsety", "texturetop", "texturemiddle", "texturebottom",
+    "lightlevel", "heightfloor", "heightceiling", "texturefloor", "textureceiling",
+};
 
+/**
+ * Sets the values of a game object property for all objects of the type at once.
+ * Properties the game does not have are ignored.
+ */
 template <valuetype_t VALUE_TYPE, typename Type>
-void gmoSetLineProperty(int index, const char *propertyId, Type value)
+void gmoSetProperties(const char *objName, const char *propertyId, const std::vector<Type> &values)
 {
-    MPE_GameObjProperty("XLinedef", index, propertyId, VALUE_TYPE, &value);
+    if (values.empty()) return;
+    const int id = MPE_GameObjPropertyId(objName, propertyId);
+    if (id >= 0)
+    {
+        MPE_GameObjProperties(id, VALUE_TYPE, 0, int(values.size()), values.data());
+    }
 }
 
 /**
@@ -63,7 +86,8 @@ static int importMapHook(int /*hookType*/, int /*parm*/, void *context)
             LOG_AS("importudmf");
             try
             {
-                // Read the contents of the TEXTMAP lump.
+                // Read the contents of the TEXTMAP lump. The parsed values refer to
+                // these bytes, so they must be kept around until the import is done.
                 auto found = recognizer->lumps().find(Id1MapRecognizer::UDMFTextmapData);
                 DE_ASSERT(found != recognizer->lumps().end());
                 auto *src = found->second;
@@ -71,25 +95,55 @@ static int importMapHook(int /*hookType*/, int /*parm*/, void *context)
                 src->read(bytes.data(), false);
 
                 // Parse the UDMF source and use the MPE API to create the map elements.
-                UDMFParser parser;
+                UDMFParser parser(makeList(prop::Count, udmfPropertyNames));
+
+                using Value = UDMFParser::Value;
+
+                struct SideRec
+                {
+                    int   sector;
+                    int   offsetx;
+                    int   offsety;
+                    Value top;
+                    Value middle;
+                    Value bottom;
+                };
+
+                struct LineRec
+                {
+                    int  v1;
+                    int  v2;
+                    int  sidefront;
+                    int  sideback;
+                    int  ddFlags;
+                    bool twosided;
+                };
 
                 struct ImportState
                 {
                     bool isHexen = false;
                     bool isDoom64 = false;
 
-                    int thingCount = 0;
-                    int vertexCount = 0;
-                    int sectorCount = 0;
+                    std::vector<coord_t> vertexCoords;
+
+                    // Game object properties.
+                    std::vector<double>  thingX, thingY, thingZ;
+                    std::vector<angle_t> thingAngle;
+                    std::vector<int>     thingDoomEdNum, thingFlags, thingSkillModes;
+                    std::vector<int>     thingId, thingSpecial, thingArgs[5];
+
+                    std::vector<int>     sectorType, sectorTag;
 
-                    de::List<UDMFParser::Block> linedefs;
-                    de::List<UDMFParser::Block> sidedefs;
+                    std::vector<int>     lineType, lineTag, lineArgs[5];
+
+                    std::vector<LineRec> linedefs;
+                    std::vector<SideRec> sidedefs;
                 };
                 ImportState importState;
 
                 parser.setGlobalAssignmentHandler([&importState] (const String &ident, const Value &value)
                 {
-                    if (ident == UDMFLex::NAMESPACE)
+                    if (ident == "namespace")
                     {
                         LOG_MAP_VERBOSE("UDMF namespace: %s") << value.asText();
                         const String ns = value.asText().lower();
@@ -104,94 +158,108 @@ static int importMapHook(int /*hookType*/, int /*parm*/, void *context)
                     }
                 });
 
-                parser.setBlockHandler([&importState] (const String &type, const UDMFParser::Block &block)
+                parser.setBlockHandler([&importState] (UDMFParser::BlockType type, const UDMFParser::Block &block)
                 {
-                    if (type == UDMFLex::THING)
-                    {
-                        const int index = importState.thingCount++;
+                    auto &st = importState;
 
+                    if (type == UDMFParser::Thing)
+                    {
                         // Properties common to all games.
-                        gmoSetThingProperty<DDVT_DOUBLE>(index, "X", block["x"]->asNumber());
-                        gmoSetThingProperty<DDVT_DOUBLE>(index, "Y", block["y"]->asNumber());
-                        gmoSetThingProperty<DDVT_DOUBLE>(index, "Z", block["z"]->asNumber());
-                        gmoSetThingProperty<DDVT_ANGLE>(index, "Angle", angle_t(double(block["angle"]->asInt()) / 180.0 * ANGLE_180));
-                        gmoSetThingProperty<DDVT_INT>(index, "DoomEdNum", block["type"]->asInt());
+                        st.thingX.push_back(block[prop::X].asNumber());
+                        st.thingY.push_back(block[prop::Y].asNumber());
+                        st.thingZ.push_back(block[prop::Z].asNumber());
+                        st.thingAngle.push_back(angle_t(double(block[prop::Angle].asInt()) / 180.0 * ANGLE_180));
+                        st.thingDoomEdNum.push_back(block[prop::Type].asInt());
 
                         // Map spot flags.
                         {
                             gfw_mapspot_flags_t gfwFlags = 0;
 
-                            if (block["ambush"]->isTrue())      gfwFlags |= GFW_MAPSPOT_DEAF;
-                            if (block["single"]->isTrue())      gfwFlags |= GFW_MAPSPOT_SINGLE;
-                            if (block["dm"]->isTrue())          gfwFlags |= GFW_MAPSPOT_DM;
-                            if (block["coop"]->isTrue())        gfwFlags |= GFW_MAPSPOT_COOP;
-                            if (block["friend"]->isTrue())      gfwFlags |= GFW_MAPSPOT_MBF_FRIEND;
-                            if (block["dormant"]->isTrue())     gfwFlags |= GFW_MAPSPOT_DORMANT;
-                            if (block["class1"]->isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS1;
-                            if (block["class2"]->isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS2;
-                            if (block["class3"]->isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS3;
-                            if (block["standing"]->isTrue())    gfwFlags |= GFW_MAPSPOT_STANDING;
-                            if (block["strifeally"]->isTrue())  gfwFlags |= GFW_MAPSPOT_STRIFE_ALLY;
-                            if (block["translucent"]->isTrue()) gfwFlags |= GFW_MAPSPOT_TRANSLUCENT;
-                            if (block["invisible"]->isTrue())   gfwFlags |= GFW_MAPSPOT_INVISIBLE;
-
-                            gmoSetThingProperty<DDVT_INT>(index, "Flags",
-                                    gfw_MapSpot_TranslateFlagsToInternal(gfwFlags));
+                            if (block[prop::Ambush].isTrue())      gfwFlags |= GFW_MAPSPOT_DEAF;
+                            if (block[prop::Single].isTrue())      gfwFlags |= GFW_MAPSPOT_SINGLE;
+                            if (block[prop::Dm].isTrue())          gfwFlags |= GFW_MAPSPOT_DM;
+                            if (block[prop::Coop].isTrue())        gfwFlags |= GFW_MAPSPOT_COOP;
+                            if (block[prop::Friend].isTrue())      gfwFlags |= GFW_MAPSPOT_MBF_FRIEND;
+                            if (block[prop::Dormant].isTrue())     gfwFlags |= GFW_MAPSPOT_DORMANT;
+                            if (block[prop::Class1].isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS1;
+                            if (block[prop::Class2].isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS2;
+                            if (block[prop::Class3].isTrue())      gfwFlags |= GFW_MAPSPOT_CLASS3;
+                            if (block[prop::Standing].isTrue())    gfwFlags |= GFW_MAPSPOT_STANDING;
+                            if (block[prop::StrifeAlly].isTrue())  gfwFlags |= GFW_MAPSPOT_STRIFE_ALLY;
+                            if (block[prop::Translucent].isTrue()) gfwFlags |= GFW_MAPSPOT_TRANSLUCENT;
+                            if (block[prop::Invisible].isTrue())   gfwFlags |= GFW_MAPSPOT_INVISIBLE;
+
+                            st.thingFlags.push_back(gfw_MapSpot_TranslateFlagsToInternal(gfwFlags));
                         }
 
                         // Skill level bits.
                         {
-                            static String const labels[5] = {
-                                "skill1", "skill2", "skill3", "skill4", "skill5",
-                            };
                             int skillModes = 0;
                             for (int skill = 0; skill < 5; ++skill)
                             {
-                                if (block[labels[skill]]->isTrue())
+                                if (block[prop::Skill1 + skill].isTrue())
                                     skillModes |= 1 << skill;
                             }
-                            gmoSetThingProperty<DDVT_INT>(index, "SkillModes", skillModes);
+                            st.thingSkillModes.push_back(skillModes);
                         }
 
-                        if (importState.isHexen || importState.isDoom64)
+                        st.thingId.push_back(block[prop::Id].asInt());
+                        st.thingSpecial.push_back(block[prop::Special].asInt());
+                        for (int i = 0; i < 5; ++i)
                         {
-                            gmoSetThingProperty<DDVT_INT>(index, "ID", block["id"]->asInt());
-                        }
-                        if (importState.isHexen)
-                        {
-                            gmoSetThingProperty<DDVT_INT>(index, "Special", block["special"]->asInt());
-                            gmoSetThingProperty<DDVT_INT>(index, "Arg0", block["arg0"]->asInt());
-                            gmoSetThingProperty<DDVT_INT>(index, "Arg1", block["arg1"]->asInt());
-                            gmoSetThingProperty<DDVT_INT>(index, "Arg2", block["arg2"]->asInt());
-                            gmoSetThingProperty<DDVT_INT>(index, "Arg3", block["arg3"]->asInt());
-                            gmoSetThingProperty<DDVT_INT>(index, "Arg4", block["arg4"]->asInt());
+                            st.thingArgs[i].push_back(block[prop::Arg0 + i].asInt());
                         }
                     }
-                    else if (type == UDMFLex::VERTEX)
+                    else if (type == UDMFParser::Vertex)
                     {
-                        const int index = importState.vertexCount++;
-
-                        MPE_VertexCreate(block["x"]->asNumber(), block["y"]->asNumber(), index);
+                        st.vertexCoords.push_back(block[prop::X].asNumber());
+                        st.vertexCoords.push_back(block[prop::Y].asNumber());
                     }
-                    else if (type == UDMFLex::LINEDEF)
+                    else if (type == UDMFParser::Linedef)
                     {
-                        importState.linedefs.append(block);
+                        int ddFlags = 0;
+                        if (block[prop::Blocking].isTrue())      ddFlags |= DDLF_BLOCKING;
+                        if (block[prop::DontPegTop].isTrue())    ddFlags |= DDLF_DONTPEGTOP;
+                        if (block[prop::DontPegBottom].isTrue()) ddFlags |= DDLF_DONTPEGBOTTOM;
+
+                        st.linedefs.push_back(LineRec{
+                            block[prop::V1].asInt(),
+                            block[prop::V2].asInt(),
+                            block[prop::SideFront].asInt(),
+                            block.contains(prop::SideBack) ? block[prop::SideBack].asInt() : -1,
+                            ddFlags,
+                            block[prop::TwoSided].isTrue()
+                        });
+
+                        st.lineType.push_back(block[prop::Special].asInt());
+                        st.lineTag.push_back(block.contains(prop::Id) ? block[prop::Id].asInt() : -1);
+                        for (int i = 0; i < 5; ++i)
+                        {
+                            st.lineArgs[i].push_back(block[prop::Arg0 + i].asInt());
+                        }
                     }
-                    else if (type == UDMFLex::SIDEDEF)
+                    else if (type == UDMFParser::Sidedef)
                     {
-                        importState.sidedefs.append(block);
+                        st.sidedefs.push_back(SideRec{
+                            block[prop::Sector].asInt(),
+                            block[prop::OffsetX].asInt(),
+                            block[prop::OffsetY].asInt(),
+                            block[prop::TextureTop],
+                            block[prop::TextureMiddle],
+                            block[prop::TextureBottom]
+                        });
                     }
-                    else if (type == UDMFLex::SECTOR)
+                    else if (type == UDMFParser::Sector)
                     {
-                        const int index = importState.sectorCount++;
-                        const int lightlevel = block.contains("lightlevel")? block["lightlevel"]->asInt() : 160;
+                        const int index = int(st.sectorType.size());
+                        const int lightlevel = block.contains(prop::LightLevel)? block[prop::LightLevel].asInt() : 160;
                         const struct de_api_sector_hacks_s hacks{{0, 0}, -1};
-                        
+
                         MPE_SectorCreate(float(lightlevel)/255.f, 1.f, 1.f, 1.f, &hacks, index);
 
                         MPE_PlaneCreate(index,
-                                        block["heightfloor"]->asNumber(),
-                                        de::Str("Flats:" + block["texturefloor"]->asText()),
+                                        block[prop::HeightFloor].asNumber(),
+                                        de::Str("Flats:" + block[prop::TextureFloor].asText()),
                                         0.f, 0.f,
                                         1.f, 1.f, 1.f,  // color
                                         1.f,            // opacity
@@ -199,93 +267,103 @@ static int importMapHook(int /*hookType*/, int /*parm*/, void *context)
                                         -1);            // index in archive
 
                         MPE_PlaneCreate(index,
-                                        block["heightceiling"]->asNumber(),
-                                        de::Str("Flats:" + block["textureceiling"]->asText()),
+                                        block[prop::HeightCeiling].asNumber(),
+                                        de::Str("Flats:" + block[prop::TextureCeiling].asText()),
                                         0.f, 0.f,
                                         1.f, 1.f, 1.f,  // color
                                         1.f,            // opacity
                                         0, 0, -1.f,     // normal
                                         -1);            // index in archive
 
-                        gmoSetSectorProperty<DDVT_INT>(index, "Type", block["special"]->asInt());
-                        gmoSetSectorProperty<DDVT_INT>(index, "Tag",  block["id"]->asInt());
+                        st.sectorType.push_back(block[prop::Special].asInt());
+                        st.sectorTag.push_back(block[prop::Id].asInt());
                     }
                 });
 
-                parser.parse(String::fromUtf8(bytes));
+                parser.parse(bytes);
+
+                // All vertices are created at once.
+                if (!importState.vertexCoords.empty())
+                {
+                    const int numVertices = int(importState.vertexCoords.size() / 2);
+                    std::vector<int> archiveIndices(numVertices);
+                    for (int i = 0; i < numVertices; ++i) archiveIndices[i] = i;
+                    MPE_VertexCreatev(numVertices, importState.vertexCoords.data(), archiveIndices.data(), nullptr);
+                }
 
                 // Now that all the linedefs and sidedefs are read, let's create them.
-                for (int index = 0; index < importState.linedefs.size(); ++index)
+                // Linedefs without a valid front sidedef are dropped, so the line
+                // properties are compacted to keep them in step with the created lines.
+                const int numSides = int(importState.sidedefs.size());
+                int numLines = 0;
+                for (int lineIndex = 0; lineIndex < int(importState.linedefs.size()); ++lineIndex)
                 {
-                    const UDMFParser::Block &linedef = importState.linedefs.at(index);
+                    const LineRec &linedef = importState.linedefs[lineIndex];
 
-                    int sidefront = linedef["sidefront"]->asInt();
-                    int sideback  = linedef.contains("sideback")? linedef["sideback"]->asInt() : -1;
+                    const int sidefront = linedef.sidefront;
+                    const int sideback  = linedef.sideback < numSides? linedef.sideback : -1;
+                    if (sidefront < 0 || sidefront >= numSides)
+                    {
+                        LOG_MAP_WARNING("Linedef %i has an invalid front sidedef %i")
+                                << lineIndex << sidefront;
+                        continue;
+                    }
 
-                    const UDMFParser::Block &front = importState.sidedefs.at(sidefront);
-                    const UDMFParser::Block *back  =
-                            (sideback >= 0? &importState.sidedefs.at(sideback) : nullptr);
+                    const int index = numLines++;
+                    if (index != lineIndex)
+                    {
+                        auto &st = importState;
+                        st.lineType[index] = st.lineType[lineIndex];
+                        st.lineTag [index] = st.lineTag [lineIndex];
+                        for (auto &args : st.lineArgs) args[index] = args[lineIndex];
+                    }
 
-                    int frontSectorIdx = front["sector"]->asInt();
-                    int backSectorIdx  = back? (*back)["sector"]->asInt() : -1;
+                    const SideRec &front = importState.sidedefs[sidefront];
+                    const SideRec *back  = (sideback >= 0? &importState.sidedefs[sideback] : nullptr);
 
                     // Line flags.
-                    int ddLineFlags = 0;
                     short sideFlags = 0;
+                    if (!linedef.twosided && back)
                     {
-                        const bool blocking      = linedef["blocking"]->isTrue();
-                        const bool dontpegtop    = linedef["dontpegtop"]->isTrue();
-                        const bool dontpegbottom = linedef["dontpegbottom"]->isTrue();
-                        const bool twosided      = linedef["twosided"]->isTrue();
-
-                        if (blocking)      ddLineFlags |= DDLF_BLOCKING;
-                        if (dontpegtop)    ddLineFlags |= DDLF_DONTPEGTOP;
-                        if (dontpegbottom) ddLineFlags |= DDLF_DONTPEGBOTTOM;
-
-                        if (!twosided && back)
-                        {
-                            sideFlags |= SDF_SUPPRESS_BACK_SECTOR;
-                        }
+                        sideFlags |= SDF_SUPPRESS_BACK_SECTOR;
                     }
 
-                    MPE_LineCreate(linedef["v1"]->asInt(),
-                                   linedef["v2"]->asInt(),
-                                   frontSectorIdx,
-                                   backSectorIdx,
-                                   ddLineFlags,
+                    MPE_LineCreate(linedef.v1,
+                                   linedef.v2,
+                                   front.sector,
+                                   back? back->sector : -1,
+                                   linedef.ddFlags,
                                    index);
 
                     auto texName = [] (const Value &tex) -> String {
-                        if (tex.asText().isEmpty()) return String();
+                        if (tex.isEmpty()) return String();
                         return "Textures:" + tex.asText();
                     };
 
                     auto addSide = [&texName, sideFlags](
-                                       int index, const UDMFParser::Block &side, int sideIndex)
+                                       int index, const SideRec &side, int sideIndex)
                     {
-                        const int offsetx = side["offsetx"]->asInt();
-                        const int offsety = side["offsety"]->asInt();
-                        float     opacity = 1.f;
+                        float opacity = 1.f;
 
-                        const auto topTex = texName(*side["texturetop"]   );
-                        const auto midTex = texName(*side["texturemiddle"]);
-                        const auto botTex = texName(*side["texturebottom"]);
+                        const auto topTex = texName(side.top   );
+                        const auto midTex = texName(side.middle);
+                        const auto botTex = texName(side.bottom);
 
                         struct de_api_side_section_s top = {
                             topTex,
-                            {float(offsetx), float(offsety)},
+                            {float(side.offsetx), float(side.offsety)},
                             {1, 1, 1, 1}
                         };
 
                         struct de_api_side_section_s mid = {
                             midTex,
-                            {float(offsetx), float(offsety)},
+                            {float(side.offsetx), float(side.offsety)},
                             {1, 1, 1, opacity}
                         };
 
                         struct de_api_side_section_s bot = {
                             botTex,
-                            {float(offsetx), float(offsety)},
+                            {float(side.offsetx), float(side.offsety)},
                             {1, 1, 1, 1}
                         };
 
@@ -307,33 +385,54 @@ static int importMapHook(int /*hookType*/, int /*parm*/, void *context)
                     {
                         addSide(index, *back, sideback);
                     }
+                }
+                importState.linedefs.resize(numLines);
+                importState.lineType.resize(numLines);
+                importState.lineTag.resize(numLines);
+                for (auto &args : importState.lineArgs) args.resize(numLines);
 
-                    // More line flags.
-                    {
-                        short flags = 0;
+                // Game object properties are set in bulk, one property at a time.
+                {
+                    auto &st = importState;
 
-                        // TODO: Check all the flags.
+                    gmoSetProperties<DDVT_DOUBLE>("Thing", "X",          st.thingX);
+                    gmoSetProperties<DDVT_DOUBLE>("Thing", "Y",          st.thingY);
+                    gmoSetProperties<DDVT_DOUBLE>("Thing", "Z",          st.thingZ);
+                    gmoSetProperties<DDVT_ANGLE> ("Thing", "Angle",      st.thingAngle);
+                    gmoSetProperties<DDVT_INT>   ("Thing", "DoomEdNum",  st.thingDoomEdNum);
+                    gmoSetProperties<DDVT_INT>   ("Thing", "Flags",      st.thingFlags);
+                    gmoSetProperties<DDVT_INT>   ("Thing", "SkillModes", st.thingSkillModes);
 
-                        gmoSetLineProperty<DDVT_SHORT>(index, "Flags", flags);
-                    }
+                    gmoSetProperties<DDVT_INT>("XSector", "Type", st.sectorType);
+                    gmoSetProperties<DDVT_INT>("XSector", "Tag",  st.sectorTag);
 
-                    gmoSetLineProperty<DDVT_INT>(index, "Type", linedef["special"]->asInt());
+                    // More line flags.
+                    // TODO: Check all the flags.
+                    gmoSetProperties<DDVT_SHORT>("XLinedef", "Flags",
+                                                 std::vector<short>(st.linedefs.size(), 0));
+                    gmoSetProperties<DDVT_INT>("XLinedef", "Type", st.lineType);
 
-                    if (!importState.isHexen)
+                    if (st.isHexen || st.isDoom64)
                     {
-                        gmoSetLineProperty<DDVT_INT>(index, "Tag",
-                                                     linedef.contains("id") ?
-                                                         linedef["id"]->asInt() : -1);
+                        gmoSetProperties<DDVT_INT>("Thing", "ID", st.thingId);
                     }
-                    if (importState.isHexen)
+                    if (st.isHexen)
                     {
-                        gmoSetLineProperty<DDVT_INT>(index, "Arg0", linedef["arg0"]->asInt());
-                        gmoSetLineProperty<DDVT_INT>(index, "Arg1", linedef["arg1"]->asInt());
-                        gmoSetLineProperty<DDVT_INT>(index, "Arg2", linedef["arg2"]->asInt());
-                        gmoSetLineProperty<DDVT_INT>(index, "Arg3", linedef["arg3"]->asInt());
-                        gmoSetLineProperty<DDVT_INT>(index, "Arg4", linedef["arg4"]->asInt());
+                        static const char *argNames[5] = { "Arg0", "Arg1", "Arg2", "Arg3", "Arg4" };
+
+                        gmoSetProperties<DDVT_INT>("Thing", "Special", st.thingSpecial);
+                        for (int i = 0; i < 5; ++i)
+                        {
+                            gmoSetProperties<DDVT_INT>("Thing",    argNames[i], st.thingArgs[i]);
+                            gmoSetProperties<DDVT_INT>("XLinedef", argNames[i], st.lineArgs[i]);
+                        }
+                    }
+                    else
+                    {
+                        gmoSetProperties<DDVT_INT>("XLinedef", "Tag", st.lineTag);
                     }
                 }
+
                 LOG_MAP_WARNING("Loading UDMF maps is an experimental feature");
                 return true;
             }
@@ -1,6 +1,7 @@
 /** @file udmflex.cpp  UDMF lexical analyzer.
  *
  * @authors Copyright (c) 2016-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -18,124 +19,221 @@
 
 #include "udmflex.h"
 
-#include <de/set.h>
+#include <cstdlib>
+#include <cstring>
 
 using namespace de;
 
-const String UDMFLex::NAMESPACE("namespace");
-const String UDMFLex::LINEDEF("linedef");
-const String UDMFLex::SIDEDEF("sidedef");
-const String UDMFLex::VERTEX("vertex");
-const String UDMFLex::SECTOR("sector");
-const String UDMFLex::THING("thing");
-const String UDMFLex::T_TRUE("true");
-const String UDMFLex::T_FALSE("false");
-const String UDMFLex::ASSIGN("=");
-const String UDMFLex::BRACKET_OPEN("{");
-const String UDMFLex::BRACKET_CLOSE("}");
-const String UDMFLex::SEMICOLON(";");
-
-UDMFLex::UDMFLex(const String &input)
-    : Lex(input, '/', '*', DoubleCharComment | NegativeNumbers)
-{}
+static inline bool isUdmfDigit(char c)      { return c >= '0' && c <= '9'; }
+static inline bool isUdmfIdentStart(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+static inline bool isUdmfIdentChar(char c)  { return isUdmfIdentStart(c) || isUdmfDigit(c); }
+static inline char udmfLower(char c)        { return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c; }
 
-dsize UDMFLex::getExpressionFragment(TokenBuffer &output)
+bool UDMFLex::Token::equals(const char *lowerCaseText) const
 {
-    output.clear();
+    const char *p = begin;
+    for (; p != end; ++p, ++lowerCaseText)
+    {
+        if (!*lowerCaseText || udmfLower(*p) != *lowerCaseText) return false;
+    }
+    return *lowerCaseText == 0;
+}
 
-    while (!atEnd())
+dint64 UDMFLex::Token::toInteger() const
+{
+    const char *p = begin;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p++ == '-');
+    }
+    dint64 value = 0;
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+    {
+        for (p += 2; p != end; ++p)
+        {
+            const char c = udmfLower(*p);
+            value = value * 16 + (isUdmfDigit(c) ? c - '0' : c - 'a' + 10);
+        }
+    }
+    else if (end - p > 1 && p[0] == '0')
     {
-        skipWhite();
+        for (++p; p != end; ++p) value = value * 8 + (*p - '0');
+    }
+    else
+    {
+        for (; p != end; ++p) value = value * 10 + (*p - '0');
+    }
+    return negative ? -value : value;
+}
 
-        if (atEnd() || (output.size() && peek() == '}')) break;
+double UDMFLex::Token::toDouble() const
+{
+    if (type == Integer) return double(toInteger());
+
+    // The source is not null-terminated.
+    char buf[64];
+    const dsize len = de::min(size(), sizeof(buf) - 1);
+    std::memcpy(buf, begin, len);
+    buf[len] = 0;
+    return std::strtod(buf, nullptr);
+}
 
-        // First character of the token.
-        Char c = get();
+bool UDMFLex::Token::hasEscapes() const
+{
+    return std::memchr(textBegin(), '\\', dsize(textEnd() - textBegin())) != nullptr;
+}
 
-        output.newToken(lineNumber());
-        output.appendChar(c);
+String UDMFLex::Token::unescaped() const
+{
+    if (!hasEscapes()) return de::String(textBegin(), textEnd());
 
-        // Single-character tokens.
-        if (c == '{' || c == '}' || c == '=' || c == ';')
+    std::string text;
+    text.reserve(dsize(textEnd() - textBegin()));
+    for (const char *p = textBegin(); p != textEnd(); ++p)
+    {
+        if (*p == '\\' && p + 1 != textEnd())
         {
-            output.setType(c == '='? Token::OPERATOR : Token::LITERAL);
-            output.endToken();
-
-            if (output.latest().type() != Token::OPERATOR) break;
+            ++p;
+            switch (*p)
+            {
+            case 'n': text += '\n'; break;
+            case 't': text += '\t'; break;
+            case 'r': text += '\r'; break;
+            default:  text += *p;   break;
+            }
             continue;
         }
+        text += *p;
+    }
+    return de::String(text);
+}
+
+String UDMFLex::Token::asText() const
+{
+    return de::String(begin, end);
+}
+
+UDMFLex::UDMFLex(const char *begin, const char *end)
+    : _pos(begin)
+    , _end(end)
+{}
+
+int UDMFLex::lineNumber() const
+{
+    return _line;
+}
+
+void UDMFLex::fail(const char *message) const
+{
+    throw SyntaxError("UDMFLex", Stringf("%s on line %i", message, _line));
+}
 
-        if (c == '"')
+void UDMFLex::skipWhiteAndComments()
+{
+    while (_pos != _end)
+    {
+        const char c = *_pos;
+        if (c == '\n')
         {
-            // Parse the string into one token.
-            output.setType(Token::LITERAL_STRING_QUOTED);
-            parseString(output);
-            output.endToken();
-            continue;
+            ++_line;
+            ++_pos;
         }
-
-        // Number literal?
-        if (parseLiteralNumber(c, output))
+        else if (c == ' ' || c == '\t' || c == '\r')
         {
-            continue;
+            ++_pos;
         }
-
-        // Alphanumeric characters are joined into a token.
-        if (c == '_' || isAlpha(c))
+        else if (c == '/' && _end - _pos > 1 && _pos[1] == '/')
         {
-            output.setType(Token::IDENTIFIER);
-
-            while (isAlphaNumeric((c = peek())))
-            {
-                output.appendChar(get());
-            }
-
-            // It might be that this is a keyword.
-            if (isKeyword(output.latest()))
+            while (_pos != _end && *_pos != '\n') ++_pos;
+        }
+        else if (c == '/' && _end - _pos > 1 && _pos[1] == '*')
+        {
+            for (_pos += 2; ; ++_pos)
             {
-                output.setType(Token::KEYWORD);
+                if (_end - _pos < 2) fail("Unterminated comment");
+                if (*_pos == '\n') ++_line;
+                if (_pos[0] == '*' && _pos[1] == '/') break;
             }
-
-            output.endToken();
-            continue;
+            _pos += 2;
+        }
+        else
+        {
+            break;
         }
     }
-
-    return output.size();
 }
 
-void UDMFLex::parseString(TokenBuffer &output)
+UDMFLex::Token UDMFLex::next()
 {
-    ModeSpan readingMode(*this, RetainComments);
+    skipWhiteAndComments();
 
-    // The token already contains the first quote char.
-    // This will throw an exception if the string is unterminated.
-    for (;;)
+    Token token{End, _pos, _pos};
+    if (_pos == _end) return token;
+
+    const char c = *_pos;
+    switch (c)
+    {
+    case '=': token.type = Assign;       token.end = ++_pos; return token;
+    case ';': token.type = Semicolon;    token.end = ++_pos; return token;
+    case '{': token.type = BracketOpen;  token.end = ++_pos; return token;
+    case '}': token.type = BracketClose; token.end = ++_pos; return token;
+    default: break;
+    }
+
+    if (c == '"')
+    {
+        token.type = String;
+        for (++_pos; ; ++_pos)
+        {
+            if (_pos == _end) fail("Unterminated string");
+            if (*_pos == '\\' && _end - _pos > 1) { ++_pos; continue; }
+            if (*_pos == '\n') ++_line;
+            if (*_pos == '"') break;
+        }
+        token.end = ++_pos;
+        return token;
+    }
+
+    if (isUdmfDigit(c) || c == '-' || c == '+' || c == '.')
     {
-        Char c = get();
-        output.appendChar(c);
-        if (c == '"')
+        token.type = Integer;
+        const char *p = _pos;
+        if (*p == '-' || *p == '+') ++p;
+        if (_end - p > 1 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
         {
-            return;
+            for (p += 2; p != _end && (isUdmfDigit(*p) || (udmfLower(*p) >= 'a' && udmfLower(*p) <= 'f')); ++p) {}
         }
-        if (c == '\\') // Escape.
+        else
         {
-            output.appendChar(get());
+            while (p != _end && isUdmfDigit(*p)) ++p;
+            if (p != _end && *p == '.')
+            {
+                token.type = Float;
+                for (++p; p != _end && isUdmfDigit(*p); ++p) {}
+            }
+            if (p != _end && (*p == 'e' || *p == 'E'))
+            {
+                token.type = Float;
+                ++p;
+                if (p != _end && (*p == '-' || *p == '+')) ++p;
+                while (p != _end && isUdmfDigit(*p)) ++p;
+            }
         }
+        if (p == _pos + 1 && !isUdmfDigit(c)) fail("Invalid number");
+        token.end = _pos = p;
+        return token;
     }
-}
 
-bool UDMFLex::isKeyword(const Token &token)
-{
-    static const StringList keywords{
-        NAMESPACE,
-        LINEDEF,
-        SIDEDEF,
-        VERTEX,
-        SECTOR,
-        THING,
-        T_TRUE,
-        T_FALSE,
-    };
-    return String::contains(keywords, token.str(), CaseInsensitive);
+    if (isUdmfIdentStart(c))
+    {
+        while (_pos != _end && isUdmfIdentChar(*_pos)) ++_pos;
+        token.end  = _pos;
+        token.type = token.equals("true")  ? True
+                   : token.equals("false") ? False
+                                           : Identifier;
+        return token;
+    }
+
+    fail(Stringf("Unexpected character '%c'", c).c_str());
 }
@@ -1,6 +1,7 @@
 /** @file udmfparser.cpp  UDMF parser.
  *
  * @authors Copyright (c) 2016-2018 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -18,152 +19,229 @@
 
 #include "udmfparser.h"
 
-#include <de/numbervalue.h>
-#include <de/textvalue.h>
-
 using namespace de;
 
-UDMFParser::UDMFParser()
-{}
-
-void UDMFParser::setGlobalAssignmentHandler(UDMFParser::AssignmentFunc func)
+static inline duint32 udmfHashChar(duint32 hash, char c)
 {
-    _assignmentHandler = std::move(func);
+    if (c >= 'A' && c <= 'Z') c = char(c - 'A' + 'a');
+    return (hash ^ duint8(c)) * 16777619u; // FNV-1a
 }
 
-void UDMFParser::setBlockHandler(UDMFParser::BlockFunc func)
+static duint32 udmfHash(const char *begin, const char *end)
 {
-    _blockHandler = std::move(func);
+    duint32 hash = 2166136261u;
+    for (const char *p = begin; p != end; ++p) hash = udmfHashChar(hash, *p);
+    return hash;
 }
 
-const UDMFParser::Block &UDMFParser::globals() const
+int UDMFParser::Value::asInt() const
 {
-    return _globals;
+    switch (type)
+    {
+    case Integer:
+    case Boolean: return int(integer);
+    case Number:  return int(number);
+    default:      return 0;
+    }
 }
 
-void UDMFParser::parse(const String &input)
+double UDMFParser::Value::asNumber() const
 {
-    // Lexical analyzer for Haw scripts.
-    _analyzer = UDMFLex(input);
-
-    while (nextFragment() > 0)
+    switch (type)
     {
-        if (_range.lastToken().equals(UDMFLex::BRACKET_OPEN))
-        {
-            const String blockType = _range.firstToken().str().lower();
-
-            Block block;
-            parseBlock(block);
-
-            if (_blockHandler)
-            {
-                _blockHandler(blockType, block);
-            }
-        }
-        else
-        {
-            parseAssignment(_globals);
-        }
+    case Integer:
+    case Boolean: return double(integer);
+    case Number:  return number;
+    default:      return 0;
     }
-
-    // We're done, free the remaining tokens.
-    _tokens.clear();
 }
 
-dsize UDMFParser::nextFragment()
+bool UDMFParser::Value::isTrue() const
 {
-    _analyzer.getExpressionFragment(_tokens);
+    return (type == Boolean || type == Integer) ? integer != 0
+         : type == Number                       ? number != 0
+                                                : false;
+}
 
-    // Begin with the whole thing.
-    _range = TokenRange(_tokens);
+String UDMFParser::Value::asText() const
+{
+    if (type != Text) return String();
+    if (!escaped) return String(textBegin, textEnd);
 
-    return _tokens.size();
+    // Token boundaries include the quotes.
+    const UDMFLex::Token token{UDMFLex::String, textBegin - 1, textEnd + 1};
+    return token.unescaped();
 }
 
-void UDMFParser::parseBlock(Block &block)
+UDMFParser::UDMFParser(const StringList &propertyNames)
 {
-    // Read all the assignments in the block.
-    while (nextFragment() > 0)
+    // Table size is a power of two at least twice the number of names.
+    dsize size = 16;
+    while (size < dsize(propertyNames.size()) * 2) size <<= 1;
+    _lookup.assign(size, -1);
+
+    for (const String &name : propertyNames)
     {
-        if (_range.firstToken().equals(UDMFLex::BRACKET_CLOSE))
-            break;
+        const int id = int(_names.size());
+        _names.push_back(name.lower().toStdString());
 
-        parseAssignment(block);
+        const std::string &lower = _names.back();
+        dsize slot = udmfHash(lower.data(), lower.data() + lower.size()) & (size - 1);
+        while (_lookup[slot] >= 0) slot = (slot + 1) & (size - 1);
+        _lookup[slot] = id;
     }
+
+    _block._values.resize(_names.size());
+}
+
+void UDMFParser::setGlobalAssignmentHandler(UDMFParser::AssignmentFunc func)
+{
+    _assignmentHandler = std::move(func);
 }
 
-void UDMFParser::parseAssignment(Block &block)
+void UDMFParser::setBlockHandler(UDMFParser::BlockFunc func)
 {
-    if (_range.isEmpty())
-        return; // Nothing here?
+    _blockHandler = std::move(func);
+}
 
-    if (!_range.lastToken().equals(UDMFLex::SEMICOLON))
+int UDMFParser::propertyId(const UDMFLex::Token &identifier) const
+{
+    const dsize mask = _lookup.size() - 1;
+    for (dsize slot = udmfHash(identifier.begin, identifier.end) & mask; ; slot = (slot + 1) & mask)
     {
-        throw SyntaxError("UDMFParser::parseAssignment",
-                          "Expected expression to end in a semicolon at " +
-                          _range.lastToken().asText());
+        const int id = _lookup[slot];
+        if (id < 0) return -1;
+        if (identifier.equals(_names[id].c_str())) return id;
     }
-    if (_range.size() == 1)
-        return; // Just a semicolon?
+}
 
-    if (!_range.token(1).equals(UDMFLex::ASSIGN))
+void UDMFParser::expect(UDMFLex &lex, UDMFLex::TokenType type, const char *what)
+{
+    const auto token = lex.next();
+    if (token.type != type)
     {
-        throw SyntaxError("UDMFParser::parseAssignment",
-                          "Expected expression to have an assignment operator at " +
-                          _range.token(1).asText());
+        throw SyntaxError("UDMFParser::parse",
+                          stringf("Expected %s on line %i, but got \"%s\"",
+                                  what, lex.lineNumber(), token.asText().c_str()));
     }
+}
 
-    const String identifier = _range.firstToken().str().lower();
-    const Token &valueToken = _range.token(2);
+UDMFParser::Value UDMFParser::parseValue(UDMFLex &lex)
+{
+    const auto token = lex.next();
 
-    // Store the assigned value into a variant.
-    std::shared_ptr<Value> value;
-    switch (valueToken.type())
+    Value value;
+    switch (token.type)
     {
-    case Token::KEYWORD:
-        if (valueToken.equals(UDMFLex::T_TRUE))
-        {
-            value.reset(new NumberValue(true));
-        }
-        else if (valueToken.equals(UDMFLex::T_FALSE))
-        {
-            value.reset(new NumberValue(false));
-        }
-        else
-        {
-            throw SyntaxError("UDMFParser::parseAssignment",
-                              "Unexpected value for assignment at " + valueToken.asText());
-        }
+    case UDMFLex::Integer:
+        value.type    = Value::Integer;
+        value.integer = token.toInteger();
         break;
 
-    case Token::LITERAL_NUMBER:
-        if (valueToken.isInteger())
-        {
-            value.reset(new NumberValue(valueToken.toInteger()));
-        }
-        else
-        {
-            value.reset(new NumberValue(valueToken.toDouble()));
-        }
+    case UDMFLex::Float:
+        value.type   = Value::Number;
+        value.number = token.toDouble();
         break;
 
-    case Token::LITERAL_STRING_QUOTED:
-        value.reset(new TextValue(valueToken.unescapeStringLiteral()));
+    case UDMFLex::True:
+    case UDMFLex::False:
+        value.type    = Value::Boolean;
+        value.integer = (token.type == UDMFLex::True);
         break;
 
-    case Token::IDENTIFIER:
-        value.reset(new TextValue(valueToken.str()));
+    case UDMFLex::String:
+        value.type      = Value::Text;
+        value.textBegin = token.textBegin();
+        value.textEnd   = token.textEnd();
+        value.escaped   = token.hasEscapes();
         break;
 
-    default:
-        DE_ASSERT_FAIL("[UMDFParser::parseAssignment] Invalid token type");
+    case UDMFLex::Identifier:
+        value.type      = Value::Text;
+        value.textBegin = token.begin;
+        value.textEnd   = token.end;
         break;
+
+    default:
+        throw SyntaxError("UDMFParser::parseValue",
+                          stringf("Unexpected value for assignment on line %i: \"%s\"",
+                                  lex.lineNumber(), token.asText().c_str()));
     }
+    return value;
+}
 
-    block.insert(identifier, value);
+void UDMFParser::parse(const char *begin, const char *end)
+{
+    UDMFLex lex(begin, end);
 
-    if (_assignmentHandler && (&block == &_globals))
+    for (;;)
     {
-        _assignmentHandler(identifier, *value);
+        const auto identifier = lex.next();
+        if (identifier.type == UDMFLex::End) break;
+        if (identifier.type == UDMFLex::Semicolon) continue;
+
+        if (identifier.type != UDMFLex::Identifier)
+        {
+            throw SyntaxError("UDMFParser::parse",
+                              stringf("Expected an identifier on line %i, but got \"%s\"",
+                                      lex.lineNumber(), identifier.asText().c_str()));
+        }
+
+        const auto op = lex.next();
+        if (op.type == UDMFLex::Assign)
+        {
+            const Value value = parseValue(lex);
+            expect(lex, UDMFLex::Semicolon, "a semicolon");
+            if (_assignmentHandler)
+            {
+                _assignmentHandler(identifier.asText().lower(), value);
+            }
+        }
+        else if (op.type == UDMFLex::BracketOpen)
+        {
+            const BlockType blockType = identifier.equals("thing")   ? Thing
+                                      : identifier.equals("vertex")  ? Vertex
+                                      : identifier.equals("linedef") ? Linedef
+                                      : identifier.equals("sidedef") ? Sidedef
+                                      : identifier.equals("sector")  ? Sector
+                                                                     : UnknownBlock;
+            // Forget the previous block's values.
+            for (int id : _block._assigned) _block._values[id] = Value();
+            _block._assigned.clear();
+
+            for (;;)
+            {
+                const auto key = lex.next();
+                if (key.type == UDMFLex::BracketClose) break;
+                if (key.type == UDMFLex::Semicolon) continue;
+                if (key.type != UDMFLex::Identifier)
+                {
+                    throw SyntaxError("UDMFParser::parse",
+                                      stringf("Expected a property on line %i, but got \"%s\"",
+                                              lex.lineNumber(), key.asText().c_str()));
+                }
+                expect(lex, UDMFLex::Assign, "an assignment");
+                const Value value = parseValue(lex);
+                expect(lex, UDMFLex::Semicolon, "a semicolon");
+
+                const int id = propertyId(key);
+                if (id >= 0)
+                {
+                    if (_block._values[id].type == Value::None) _block._assigned.push_back(id);
+                    _block._values[id] = value;
+                }
+            }
+
+            if (_blockHandler && blockType != UnknownBlock)
+            {
+                _blockHandler(blockType, _block);
+            }
+        }
+        else
+        {
+            throw SyntaxError("UDMFParser::parse",
+                              stringf("Expected an assignment or a block on line %i, but got \"%s\"",
+                                      lex.lineNumber(), op.asText().c_str()));
+        }
     }
 }
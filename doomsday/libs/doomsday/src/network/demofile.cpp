@@ -0,0 +1,415 @@
+/** @file demofile.cpp  Seekable demo container.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "doomsday/network/demofile.h"
+
+#include <de/byterefarray.h>
+#include <de/reader.h>
+#include <de/writer.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace network {
+
+using namespace de;
+
+static const char    DEMO_MAGIC[4]      = { 'D', 'D', 'M', 'O' };
+static const duint32 DEMO_VERSION       = 2;
+static const dsize   HEADER_SIZE        = 16;
+static const dsize   INDEX_OFFSET_POS   = 8;
+static const dsize   RECORD_HEADER_SIZE = 8;
+static const duint32 WORLD_KEYFRAME_BIT = 0x80000000;
+
+enum RecordKind { PacketRecord, RestartMarker, WorldMarker };
+
+DE_PIMPL_NOREF(DemoWriter)
+{
+    Block              memory;      ///< Destination of a writer without an output.
+    IByteArray &       out;
+    dsize              end = 0;     ///< Offset where the next record goes.
+    List<DemoKeyframe> keyframes;
+    dint32             lastTic = 0;
+    dsize              mapOffset = 0; ///< Latest restart keyframe (zero if none).
+
+    /// The most recent packet is held back until the next record is written, so
+    /// that a keyframe can still be inserted before it.
+    bool               hasPending = false;
+    dint32             pendingTic = 0;
+    Block              pendingPacket;
+
+    Impl(IByteArray *output) : out(output? *output : memory) { begin(); }
+
+    void begin()
+    {
+        keyframes.clear();
+        lastTic = 0;
+        mapOffset = 0;
+        hasPending = false;
+        pendingPacket.clear();
+        Writer(out, 0).writeBytes(ByteRefArray(DEMO_MAGIC, sizeof(DEMO_MAGIC)))
+                       << DEMO_VERSION << duint32(0) << duint32(0);
+        end = HEADER_SIZE;
+    }
+
+    void writeRecord(dint32 tic, duint32 sizeField, const IByteArray *payload)
+    {
+        Writer writer(out, end);
+        writer << tic << sizeField;
+        if (payload) writer.writeBytes(*payload);
+        end = writer.offset();
+        lastTic = de::max(lastTic, tic);
+    }
+
+    void flushPending()
+    {
+        if (!hasPending) return;
+        hasPending = false;
+        writeRecord(pendingTic, duint32(pendingPacket.size()), &pendingPacket);
+        pendingPacket.clear();
+    }
+
+    void writeKeyframe(dint32 tic)
+    {
+        mapOffset = end;
+        keyframes << DemoKeyframe{tic, duint32(mapOffset), duint32(mapOffset)};
+        writeRecord(tic, 0, nullptr);
+    }
+};
+
+DemoWriter::DemoWriter() : d(new Impl(nullptr))
+{}
+
+DemoWriter::DemoWriter(IByteArray &output) : d(new Impl(&output))
+{}
+
+void DemoWriter::writePacket(dint32 tic, const IByteArray &packet)
+{
+    DE_ASSERT(packet.size() > 0);
+    d->flushPending();
+    d->hasPending    = true;
+    d->pendingTic    = tic;
+    d->pendingPacket = Block(packet);
+}
+
+void DemoWriter::beginKeyframe(dint32 tic)
+{
+    d->flushPending();
+    d->writeKeyframe(tic);
+}
+
+void DemoWriter::insertKeyframeBeforeLastPacket()
+{
+    if (!d->hasPending) return;
+
+    d->hasPending = false;
+    d->writeKeyframe(d->pendingTic);
+    d->hasPending = true;
+}
+
+void DemoWriter::beginWorldKeyframe(dint32 tic)
+{
+    if (!d->mapOffset) return;
+
+    d->flushPending();
+    d->keyframes << DemoKeyframe{tic, duint32(d->end), duint32(d->mapOffset)};
+    Block payload;
+    Writer(payload) << duint32(d->mapOffset);
+    d->writeRecord(tic, WORLD_KEYFRAME_BIT | duint32(payload.size()), &payload);
+}
+
+dint32 DemoWriter::lastKeyframeTic() const
+{
+    return d->keyframes.isEmpty() ? -1 : d->keyframes.back().tic;
+}
+
+int DemoWriter::keyframeCount() const
+{
+    return d->keyframes.sizei();
+}
+
+void DemoWriter::close()
+{
+    d->flushPending();
+
+    const duint32 indexOffset = duint32(d->end);
+    Writer writer(d->out, indexOffset);
+    writer << duint32(d->keyframes.size());
+    for (const auto &kf : d->keyframes)
+    {
+        writer << kf.tic << kf.offset << kf.mapOffset;
+    }
+    d->end = writer.offset();
+    Writer(d->out, INDEX_OFFSET_POS) << indexOffset << duint32(d->lastTic);
+}
+
+Block DemoWriter::finish()
+{
+    DE_ASSERT(&d->out == &d->memory);
+    close();
+
+    Block finished = d->memory;
+    d->memory.clear();
+    d->begin();
+    return finished;
+}
+
+//---------------------------------------------------------------------------------------
+
+DE_PIMPL_NOREF(DemoReader)
+{
+    Block              data;
+    dsize              end = 0; ///< Offset where the records end.
+    dint32             duration = 0;
+    List<DemoKeyframe> keyframes;
+    dsize              pos = HEADER_SIZE;
+    dsize              resumeAt = 0; ///< World keyframe to jump to after the map is loaded.
+
+    Impl(const Block &demo) : data(demo)
+    {
+        if (data.size() < HEADER_SIZE || std::memcmp(data.data(), DEMO_MAGIC, sizeof(DEMO_MAGIC)))
+        {
+            throw FormatError("DemoReader", "Not a demo file");
+        }
+        Reader reader(data, littleEndianByteOrder, sizeof(DEMO_MAGIC));
+        duint32 version, indexOffset, durationTics;
+        reader >> version >> indexOffset >> durationTics;
+        if (version != DEMO_VERSION)
+        {
+            throw FormatError("DemoReader", Stringf("Unsupported demo version %i", dint(version)));
+        }
+        duration = dint32(durationTics);
+        end      = data.size();
+
+        if (indexOffset >= HEADER_SIZE && indexOffset + 4 <= data.size())
+        {
+            end = indexOffset;
+            reader.setOffset(indexOffset);
+            duint32 count;
+            reader >> count;
+            for (duint32 i = 0; i < count; ++i)
+            {
+                DemoKeyframe kf;
+                reader >> kf.tic >> kf.offset >> kf.mapOffset;
+                keyframes << kf;
+            }
+        }
+        else
+        {
+            rebuildIndex();
+        }
+    }
+
+    /// Scans all the records to find keyframes (the recording was interrupted).
+    void rebuildIndex()
+    {
+        pos = HEADER_SIZE;
+        for (;;)
+        {
+            const duint32 offset = duint32(pos);
+            dint32 tic;
+            RecordKind kind;
+            duint32 mapOffset = offset;
+            if (!readRecord(tic, nullptr, kind, &mapOffset))
+            {
+                // Possibly a truncated record.
+                end = offset;
+                break;
+            }
+            if (kind != PacketRecord) keyframes << DemoKeyframe{tic, offset, mapOffset};
+            duration = de::max(duration, tic);
+        }
+        pos = HEADER_SIZE;
+    }
+
+    /**
+     * Reads the record at the current position, including keyframe markers.
+     *
+     * @param tic        Time of the record.
+     * @param packet     Packet contents are written here (may be @c nullptr).
+     * @param kind       Type of the record.
+     * @param mapOffset  For world keyframe markers, the offset of the restart keyframe.
+     */
+    bool readRecord(dint32 &tic, Block *packet, RecordKind &kind, duint32 *mapOffset = nullptr)
+    {
+        if (pos + RECORD_HEADER_SIZE > end) return false;
+        Reader reader(data, littleEndianByteOrder, pos);
+        duint32 sizeField;
+        reader >> tic >> sizeField;
+        const duint32 size = sizeField & ~WORLD_KEYFRAME_BIT;
+        if (pos + RECORD_HEADER_SIZE + size > end) return false;
+        if (sizeField & WORLD_KEYFRAME_BIT)
+        {
+            kind = WorldMarker;
+            duint32 restart;
+            reader >> restart;
+            if (mapOffset) *mapOffset = restart;
+        }
+        else
+        {
+            kind = (size? PacketRecord : RestartMarker);
+            if (packet && size) reader.readBytes(size, *packet);
+        }
+        pos += RECORD_HEADER_SIZE + size;
+        return true;
+    }
+
+    dint32 peekTic() const
+    {
+        if (pos + RECORD_HEADER_SIZE > end) return -1;
+        dint32 tic;
+        Reader(data, littleEndianByteOrder, pos) >> tic;
+        return tic;
+    }
+
+    /// Index of the latest keyframe at or before @a tic, or -1 if there is none.
+    int keyframeAt(dint32 tic) const
+    {
+        auto found = std::upper_bound(keyframes.begin(), keyframes.end(), tic,
+                                      [](dint32 t, const DemoKeyframe &kf) { return t < kf.tic; });
+        return int(found - keyframes.begin()) - 1;
+    }
+
+    /**
+     * Copies the packets of a restart keyframe up to the next keyframe marker,
+     * i.e., the ones that load the map, at tic zero.
+     */
+    void copyMapSetup(DemoWriter &out, duint32 restartOffset)
+    {
+        const dsize oldPos = pos;
+        pos = restartOffset + RECORD_HEADER_SIZE;
+        dint32 tic;
+        RecordKind kind;
+        Block packet;
+        while (readRecord(tic, &packet, kind) && kind == PacketRecord)
+        {
+            out.writePacket(0, packet);
+            packet.clear();
+        }
+        pos = oldPos;
+    }
+};
+
+DemoReader::DemoReader(const Block &demo) : d(new Impl(demo))
+{}
+
+dint32 DemoReader::durationTics() const
+{
+    return d->duration;
+}
+
+const List<DemoKeyframe> &DemoReader::keyframes() const
+{
+    return d->keyframes;
+}
+
+dint32 DemoReader::seek(dint32 tic)
+{
+    d->resumeAt = 0;
+
+    const int index = d->keyframeAt(tic);
+    if (index < 0)
+    {
+        // Before the first keyframe; the demo must be played from the start.
+        d->pos = HEADER_SIZE;
+        return 0;
+    }
+    const DemoKeyframe &kf = d->keyframes.at(index);
+    if (kf.isRestart())
+    {
+        d->pos = kf.offset;
+    }
+    else
+    {
+        // Load the map first, skipping over the restart marker itself.
+        d->pos      = kf.mapOffset + RECORD_HEADER_SIZE;
+        d->resumeAt = kf.offset;
+    }
+    return kf.tic;
+}
+
+dint32 DemoReader::nextTic() const
+{
+    return d->peekTic();
+}
+
+bool DemoReader::readPacket(dint32 &tic, Block &packet)
+{
+    for (;;)
+    {
+        packet.clear();
+        RecordKind kind;
+        if (!d->readRecord(tic, &packet, kind)) return false;
+        if (kind == PacketRecord) return true;
+
+        // Skip keyframe markers. The map has been loaded when the next marker
+        // is reached, so continue from the world keyframe.
+        if (d->resumeAt)
+        {
+            d->pos = d->resumeAt;
+            d->resumeAt = 0;
+        }
+    }
+}
+
+Block DemoReader::extract(dint32 fromTic, dint32 toTic) const
+{
+    DemoReader source(d->data);
+    const dint32 startTic = source.seek(fromTic);
+    const int index = d->keyframeAt(fromTic);
+
+    DemoWriter out;
+    if (index > 0)
+    {
+        // The handshake and the map are needed before the starting keyframe.
+        const DemoKeyframe &kf = d->keyframes.at(index);
+        const duint32 first = d->keyframes.first().offset;
+        out.beginKeyframe(0);
+        source.d->copyMapSetup(out, first);
+        if (kf.mapOffset != first)
+        {
+            source.d->copyMapSetup(out, kf.mapOffset);
+        }
+        source.d->pos      = kf.offset;
+        source.d->resumeAt = 0;
+        if (kf.isRestart())
+        {
+            // Already restarting; the marker itself is not needed.
+            source.d->pos += RECORD_HEADER_SIZE;
+        }
+    }
+
+    dint32 tic;
+    RecordKind kind;
+    Block record;
+    while (source.d->readRecord(tic, &record, kind))
+    {
+        if (tic > toTic) break;
+        const dint32 outTic = de::max(0, tic - startTic);
+        switch (kind)
+        {
+        case RestartMarker: out.beginKeyframe(outTic); break;
+        case WorldMarker:   out.beginWorldKeyframe(outTic); break;
+        case PacketRecord:  out.writePacket(outTic, record); break;
+        }
+        record.clear();
+    }
+    return out.finish();
+}
+
+} // namespace network
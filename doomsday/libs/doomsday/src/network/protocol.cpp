@@ -29,6 +29,7 @@ namespace network {
 static const String PT_COMMAND    = "shell.command";
 static const String PT_LEXICON    = "shell.lexicon";
 static const String PT_GAME_STATE = "shell.game.state";
+static const String PT_METRICS    = "shell.metrics";
 
 // ChallengePacket -----------------------------------------------------------
 
@@ -305,6 +306,10 @@ Protocol::PacketType Protocol::recognize(const Packet *packet)
         {
             return GameState;
         }
+        else if (rec->name() == PT_METRICS)
+        {
+            return Metrics;
+        }
     }
     return Unknown;
 }
@@ -378,4 +383,11 @@ RecordPacket *Protocol::newGameState(const String &mode,
     return gs;
 }
 
+RecordPacket *Protocol::newMetrics(const Record &metrics)
+{
+    RecordPacket *packet = new RecordPacket(PT_METRICS);
+    packet->record().copyMembersFrom(metrics);
+    return packet;
+}
+
 } // namespace network
@@ -26,14 +26,18 @@
 #include <de/packageloader.h>
 #include <de/linkfile.h>
 #include <de/loop.h>
+#include <de/metadatabank.h>
 #include <de/taskpool.h>
 #include <de/regexp.h>
 
+#include <atomic>
+
 using namespace de;
 
 namespace res {
 
 static const int MATCH_MAXIMUM_SCORE = 4; // in case 5 specified, allow 1 to not match for flexibility
+static const int IDENTIFY_WORKER_COUNT = 4; // limits the number of bundles being read at once
 
 DE_STATIC_STRING(VAR_REQUIRED_SCORE, "requiredScore");
 
@@ -112,21 +116,46 @@ DE_PIMPL(Bundles)
 
         DE_ASSERT(App::rootFolder().has("/sys/bundles"));
 
-        bool wasIdentified = false;
-        int  count         = 0;
+        std::atomic_bool wasIdentified{false};
+        std::atomic_int  count{0};
+        auto &           metadataBank = MetadataBank::get();
+        const duint32    hitsBefore   = metadataBank.cacheHitCount();
+        const duint32    missesBefore = metadataBank.cacheMissCount();
         Time startedAt;
 
-        while (const auto *bundle = nextToIdentify())
+        // Workers keep taking bundles from the shared set until it runs out. Reading
+        // lump directories and matching them against the registry is the slow part;
+        // the amount of concurrent I/O is bounded by the number of workers.
+        auto identifyWorker = [this, &wasIdentified, &count] ()
         {
-            ++count;
-            if (bundle->identifyPackages())
+            while (const auto *bundle = nextToIdentify())
             {
-                wasIdentified = true;
+                ++count;
+                if (bundle->identifyPackages())
+                {
+                    wasIdentified = true;
+                }
             }
+        };
+        {
+            TaskPool workers;
+            for (int i = 1; i < IDENTIFY_WORKER_COUNT; ++i)
+            {
+                workers.start(identifyWorker, TaskPool::HighPriority);
+            }
+            identifyWorker(); // This thread participates, too.
+            workers.waitForDone();
         }
-        if (count)
+
+        if (const int total = count)
         {
-            LOG_RES_MSG("Identified %i data bundles in %.1f seconds") << count << startedAt.since();
+            const TimeSpan elapsed = startedAt.since();
+            LOG_RES_MSG("Identified %i data bundles in %.1f seconds (%.1f bundles/sec)")
+                << total << elapsed
+                << (elapsed > 0.0? total / ddouble(elapsed) : ddouble(total));
+            LOG_RES_VERBOSE("Bundle metadata cache: %i hits, %i misses")
+                << int(metadataBank.cacheHitCount()  - hitsBefore)
+                << int(metadataBank.cacheMissCount() - missesBefore);
         }
         return wasIdentified;
     }
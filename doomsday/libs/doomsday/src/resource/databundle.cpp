@@ -98,6 +98,16 @@ DE_PIMPL(DataBundle), public Lockable
         return App::rootFolder().locate<Folder>(DE_STR("/sys/bundles"));
     }
 
+    /**
+     * Bundles may be identified concurrently. Package links are created one at a
+     * time so that each bundle gets a unique link path and version.
+     */
+    static Lockable &linkingLock()
+    {
+        static Lockable lock;
+        return lock;
+    }
+
     bool readLumpDirectory()
     {
         if (format == Wad || format == Pwad || format == Iwad)
@@ -214,6 +224,7 @@ DE_PIMPL(DataBundle), public Lockable
         versionedPackageId = packageId;
 
         // Finally, make a link that represents the package.
+        DE_GUARD_FOR(linkingLock(), G);
         if (auto chosen = chooseUniqueLinkPathAndVersion(self().asFile(), packageId,
                                                          meta.gets(VAR_VERSION()),
                                                          meta.geti(VAR_BUNDLE_SCORE())))
@@ -775,16 +786,15 @@ DE_PIMPL(DataBundle), public Lockable
         identifiedTag.clear();
 
         // Look for terms that refer to specific games.
-        static List<std::pair<String, StringList>> terms;
-        if (terms.isEmpty())
-        {
-            terms << std::make_pair(String("doom2"),   StringList({ "\\b(doom2|doom 2|DoomII|Doom II|final\\s*doom|plutonia|tnt)\\b" }));
-            terms << std::make_pair(String("doom"),    StringList({ "^doom$|\\bdoom[^ s2][^2d]\\b|\\bultimate\\s*doom\\b|\\budoom\\b" }));
-            terms << std::make_pair(String("heretic"), StringList({ "\\b(jheretic|heretic)\\b", "\\b(d'sparil|serpent rider)\\b" }));
-            terms << std::make_pair(String("hexen"),   StringList({ "\\b(jhexen|hexen)\\b", "\\b(korax|mage|warrior|cleric)\\b" })); 
-        }
+        // Bundles are identified concurrently, so the list is made only once.
+        static const List<std::pair<String, StringList>> terms {
+            std::make_pair(String("doom2"),   StringList({ "\\b(doom2|doom 2|DoomII|Doom II|final\\s*doom|plutonia|tnt)\\b" })),
+            std::make_pair(String("doom"),    StringList({ "^doom$|\\bdoom[^ s2][^2d]\\b|\\bultimate\\s*doom\\b|\\budoom\\b" })),
+            std::make_pair(String("heretic"), StringList({ "\\b(jheretic|heretic)\\b", "\\b(d'sparil|serpent rider)\\b" })),
+            std::make_pair(String("hexen"),   StringList({ "\\b(jhexen|hexen)\\b", "\\b(korax|mage|warrior|cleric)\\b" })),
+        };
         Hash<String, int> scores;
-        for (auto &i : terms) //= terms.constBegin(); i != terms.constEnd(); ++i)
+        for (const auto &i : terms) //= terms.constBegin(); i != terms.constEnd(); ++i)
         {
             for (const String &term : i.second)
             {
@@ -22,191 +22,174 @@
 #include "doomsday/world/blockmap.h"
 
 #include <de/vector.h>
-#include <de/legacy/memoryzone.h>
 #include <de/legacy/vector1.h>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
-#include <list>
 
 using namespace de;
 
 namespace world {
 
-struct RingNode {
-    void *    elem;
-    RingNode *prev;
-    RingNode *next;
-};
+DE_PIMPL(Blockmap)
+{
+    AABoxd bounds;    ///< Map space units.
+    duint cellSize;   ///< Map space units.
+    Cell dimensions;  ///< Dimensions of the indexed space, in cells.
 
-struct CellData {
-    RingNode *ringNodes;
-    dint      elemCount; ///< Total number of linked elements.
-    
-    bool unlink(void *elem)
+    /// Node list of a cell in the dynamic layout.
+    struct CellList
     {
-        if (RingNode *node = findNode(elem))
-        {
-            clearElement(*node);
-            return true;
-        }
-        return false;
-    }
-    
-    void unlinkAll()
+        dint first = -1;
+        dint last  = -1;
+        dint count = 0; ///< Number of linked elements (non-empty nodes).
+    };
+
+    /// Dynamic layout: lists of each cell, in row-major order (see toCellIndex()).
+    std::vector<CellList> cells;
+    std::vector<Node>     nodes;
+
+    /// Compacted layout: elements of cell @em i are elements[offsets[i]...offsets[i + 1]).
+    bool                  compacted = false;
+    std::vector<dint>     offsets;
+    std::vector<void *>   elements;
+
+    /// Number of iterations in progress over the compacted elements.
+    mutable std::atomic_int iterations { 0 };
+
+    Impl(Public *i, const AABoxd &bounds, duint cellSize)
+        : Base(i)
+        , bounds    (bounds)
+        , cellSize  (cellSize)
+        , dimensions(Vec2ui(de::ceil((bounds.maxX - bounds.minX) / cellSize),
+                            de::ceil((bounds.maxY - bounds.minY) / cellSize)))
     {
-        for (RingNode *node = ringNodes; node; node = node->next)
-        {
-            clearElement(*node);
-        }
+        cells.resize(dsize(dimensions.x) * dimensions.y);
     }
-    
-    bool link(void *elem)
+
+    inline dsize cellCount() const
     {
-        addElement(newNode(), elem);
-        return true;
+        return dsize(dimensions.x) * dimensions.y;
     }
-    
-private:
-    RingNode &newNode()
+
+    bool linkElement(dint cellIndex, void *elem)
     {
-        RingNode *node = nullptr;
-        
-        if (!ringNodes)
+        if (compacted) expand();
+
+        CellList &cell = cells[cellIndex];
+
+        // Reuse the first empty node, if there is one. This keeps the remaining
+        // elements in their original order, which the PIT_ iterators depend on.
+        for (dint i = cell.first; i >= 0; i = nodes[i].next)
         {
-            // Create a new root node.
-            node       = reinterpret_cast<RingNode *>(Z_Malloc(sizeof(*node), PU_MAP, nullptr));
-            node->next = nullptr;
-            node->prev = nullptr;
-            node->elem = nullptr;
-            
-            ringNodes = node;
-            
-            return *node;
+            if (!nodes[i].elem)
+            {
+                nodes[i].elem = elem;
+                cell.count++;
+                return true;
+            }
         }
-        
-        // Is there an available node in the ring we can reuse?
-        for (node = ringNodes; node->next && node->elem; node = node->next)
+
+        // Add a new node to the end of the list.
+        const dint index = dint(nodes.size());
+        nodes.push_back(Node{elem, -1});
+        if (cell.last >= 0)
         {
+            nodes[cell.last].next = index;
         }
-        
-        if (!node->elem)
+        else
         {
-            // This will do nicely.
-            return *node;
+            cell.first = index;
         }
-        
-        // Add a new node to the ring.
-        node->next       = reinterpret_cast<RingNode *>(Z_Malloc(sizeof(*node), PU_MAP, nullptr));
-        node->next->next = nullptr;
-        node->next->prev = node;
-        node->next->elem = nullptr;
-        
-        return *node->next;
+        cell.last = index;
+        cell.count++;
+        return true;
     }
-    
-    RingNode *findNode(void *elem)
+
+    bool unlinkElement(dint cellIndex, void *elem)
     {
-        if (elem)
+        if (compacted) expand();
+
+        // Nodes are not released individually, because the list may be being
+        // iterated. They are reused by the same cell.
+        CellList &cell = cells[cellIndex];
+        for (dint i = cell.first; i >= 0; i = nodes[i].next)
         {
-            for (RingNode *found = ringNodes; found; found = found->next)
+            if (nodes[i].elem == elem)
             {
-                if (found->elem == elem) return found;
+                nodes[i].elem = nullptr;
+                cell.count--;
+                return true;
             }
         }
-        return nullptr;
-    }
-    
-    void clearElement(RingNode &node)
-    {
-        if (!node.elem) return;
-        
-        node.elem = nullptr;
-        elemCount--;
-    }
-    
-    void addElement(RingNode &node, void *elem)
-    {
-        DE_ASSERT(node.elem == nullptr);
-        node.elem = elem;
-        elemCount++;
+        return false;
     }
-};
 
-DE_PIMPL(Blockmap)
-{
-    /**
-     * Quadtree node.
-     */
-    struct Node
+    void compact()
     {
-        /// Logical child quadrant identifiers.
-        enum Quadrant
-        {
-            TopLeft,
-            TopRight,
-            BottomLeft,
-            BottomRight
-        };
-
-        Cell cell;   ///< Cell coordinates for this node.
-        duint size;  ///< Size of the cell at this node (width=height).
-        union {
-            Node *children[4];   /* One per quadrant (if any, not owned). */
-            CellData *leafData;  /* Data associated with the leaf cell.
-                                    Allocated from the zone; not freed by BlockMap. */
-        };
-
-        /**
-         * Construct a new node.
-         *
-         * @param cell  Cell coordinates for the node.
-         * @param size  Size of the cell.
-         */
-        Node(const Cell &cell, duint size)
-            : cell(cell)
-            , size(size)
+        if (compacted) return;
+        DE_ASSERT(iterations == 0);
+
+        offsets.resize(cellCount() + 1);
+        elements.clear();
+        for (dsize c = 0; c < cellCount(); ++c)
         {
-            zap(children);
+            offsets[c] = dint(elements.size());
+            for (dint i = cells[c].first; i >= 0; i = nodes[i].next)
+            {
+                if (nodes[i].elem) elements.push_back(nodes[i].elem);
+            }
         }
+        offsets.back() = dint(elements.size());
+        elements.shrink_to_fit();
 
-        /**
-         * Returns @c true iff the cell is a leaf (i.e., equal to a unit in the
-         * gridmap coordinate space).
-         */
-        inline bool isLeaf() const { return size == 1; }
+        clearLists();
+        nodes.shrink_to_fit();
+        compacted = true;
+    }
 
-        /**
-         * In which child quadrant is the given @a point?
-         */
-        Quadrant quadrant(const Cell &point) const
+    /// Returns from the compacted layout to the dynamic one.
+    void expand()
+    {
+        DE_ASSERT(compacted);
+        // The elements are freed below; nothing may be iterating them.
+        DE_ASSERT(iterations == 0);
+        compacted = false;
+
+        nodes.reserve(elements.size());
+        for (dsize c = 0; c < cellCount(); ++c)
         {
-            const duint subSize = size >> 1;
-            if(point.x < cell.x + subSize)
-            {
-                return (point.y < cell.y + subSize)? TopLeft  : BottomLeft;
-            }
-            else
+            CellList &cell = cells[c];
+            for (dint k = offsets[c]; k < offsets[c + 1]; ++k)
             {
-                return (point.y < cell.y + subSize)? TopRight : BottomRight;
+                const dint index = dint(nodes.size());
+                nodes.push_back(Node{elements[k], -1});
+                if (cell.last >= 0) nodes[cell.last].next = index;
+                else                cell.first = index;
+                cell.last = index;
+                cell.count++;
             }
         }
-    };
-    typedef std::list<Node> Nodes;
 
-    AABoxd bounds;    ///< Map space units.
-    duint cellSize;   ///< Map space units.
-    Cell dimensions;  ///< Dimensions of the indexed space, in cells.
+        offsets.clear();
+        offsets.shrink_to_fit();
+        elements.clear();
+        elements.shrink_to_fit();
+    }
 
-    Nodes nodes;      ///< Quadtree nodes. The first being the root.
+    void clearLists()
+    {
+        std::fill(cells.begin(), cells.end(), CellList());
+        nodes.clear();
+    }
 
-    Impl(Public *i, const AABoxd &bounds, duint cellSize)
-        : Base(i)
-        , bounds    (bounds)
-        , cellSize  (cellSize)
-        , dimensions(Vec2ui(de::ceil((bounds.maxX - bounds.minX) / cellSize),
-                            de::ceil((bounds.maxY - bounds.minY) / cellSize)))
+    void unlinkAll()
     {
-        // Quadtree must subdivide the space equally into 1x1 unit cells.
-        newNode(Cell(0, 0), ceilPow2(de::max(dimensions.x, dimensions.y)));
+        DE_ASSERT(iterations == 0);
+        clearLists();
+        compacted = false;
+        offsets.clear();
+        elements.clear();
     }
 
     inline dint toCellIndex(duint cellX, duint cellY)
@@ -298,88 +281,18 @@ DE_PIMPL(Blockmap)
         return didClipMin | didClipMax;
     }
 
-    Node *newNode(const Cell &at, duint size)
-    {
-        nodes.emplace_back(at, size);
-        return &nodes.back();
-    }
-
-    Node *findLeaf(Node *node, const Cell &at, bool canSubdivide)
-    {
-        if(node->isLeaf()) return node;
-
-        // Into which quadrant do we need to descend?
-        Node::Quadrant q = node->quadrant(at);
-
-        // Has this quadrant been initialized yet?
-        Node **childAdr = &node->children[q];
-        if(!*childAdr)
-        {
-            if(!canSubdivide) return nullptr;
-
-            // Subdivide the space.
-            const duint subSize = node->size >> 1;
-            switch(q)
-            {
-            case Node::TopLeft:
-                *childAdr = newNode(node->cell, subSize);
-                break;
-
-            case Node::TopRight:
-                *childAdr = newNode(Cell(node->cell.x + subSize, node->cell.y), subSize);
-                break;
-
-            case Node::BottomLeft:
-                *childAdr = newNode(Cell(node->cell.x, node->cell.y + subSize), subSize);
-                break;
-            case Node::BottomRight:
-                *childAdr = newNode(Cell(node->cell.x + subSize, node->cell.y + subSize), subSize);
-                break;
-            }
-        }
-
-        return findLeaf(*childAdr, at, canSubdivide);
-    }
-
-    inline Node *findLeaf(const Cell &at, bool canCreate = false)
-    {
-        return findLeaf(&nodes.front(), at, canCreate);
-    }
-
     /**
-     * Retrieve the user data associated with the identified cell.
-     *
-     * @param cell       Cell coordinates to retrieve user data for.
-     * @param canCreate  @c true= allocate new data if not already present
-     *                   for the referenced cell.
-     *
-     * @return  User data for the identified cell else @c 0if an invalid
-     *          reference or no there is no data present (and not allocating).
+     * Returns the linear index of the identified cell, or -1 if the cell is outside
+     * the blockmap.
      */
-    CellData *cellData(const Cell &cell, bool canCreate = false)
+    dint cellIndex(const Cell &cell) const
     {
         // Outside our boundary?
         if(cell.x >= dimensions.x || cell.y >= dimensions.y)
         {
-            return nullptr;
-        }
-
-        // Try to locate this leaf (may fail if not present and we are
-        // not allocating user data (there will be no corresponding cell)).
-        if(Node *node = findLeaf(cell, canCreate))
-        {
-            // Exisiting user data for this cell?
-            if(!node->leafData)
-            {
-                // Can we allocate new user data?
-                if(canCreate)
-                {
-                    node->leafData = (CellData *)Z_Calloc(sizeof(CellData), PU_MAPSTATIC, nullptr);
-                }
-            }
-            return node->leafData;
+            return -1;
         }
-        return nullptr;
+        return dint(cell.y * dimensions.x + cell.x);
     }
 };
 
@@ -436,9 +349,10 @@ bool Blockmap::link(const Cell &cell, void *elem)
 {
     if(!elem) return false; // Huh?
 
-    if(auto *cellData = d->cellData(cell, true /*can create*/))
+    const dint index = d->cellIndex(cell);
+    if(index >= 0)
     {
-        return cellData->link(elem);
+        return d->linkElement(index, elem);
     }
     return false; // Outside the blockmap?
 }
@@ -449,16 +363,16 @@ bool Blockmap::link(const AABoxd &region, void *elem)
 
     bool didLink = false;
 
-    CellBlock cellBlock = toCellBlock(region);
-    d->clipBlock(cellBlock);
+    const CellBlock cellBlock = clippedCellBlock(region);
 
     Cell cell;
     for(cell.y = cellBlock.min.y; cell.y < cellBlock.max.y; ++cell.y)
     for(cell.x = cellBlock.min.x; cell.x < cellBlock.max.x; ++cell.x)
     {
-        if(auto *cellData = d->cellData(cell, true))
+        const dint index = d->cellIndex(cell);
+        if(index >= 0)
         {
-            if(cellData->link(elem))
+            if(d->linkElement(index, elem))
             {
                 didLink = true;
             }
@@ -472,9 +386,10 @@ bool Blockmap::unlink(const Cell &cell, void *elem)
 {
     if(!elem) return false; // Huh?
 
-    if(auto *cellData = d->cellData(cell))
+    const dint index = d->cellIndex(cell);
+    if(index >= 0)
     {
-        return cellData->unlink(elem);
+        return d->unlinkElement(index, elem);
     }
     return false;
 }
@@ -485,16 +400,16 @@ bool Blockmap::unlink(const AABoxd &region, void *elem)
 
     bool didUnlink = false;
 
-    CellBlock cellBlock = toCellBlock(region);
-    d->clipBlock(cellBlock);
+    const CellBlock cellBlock = clippedCellBlock(region);
 
     Cell cell;
     for(cell.y = cellBlock.min.y; cell.y < cellBlock.max.y; ++cell.y)
     for(cell.x = cellBlock.min.x; cell.x < cellBlock.max.x; ++cell.x)
     {
-        if(auto *cellData = d->cellData(cell))
+        const dint index = d->cellIndex(cell);
+        if(index >= 0)
         {
-            if(cellData->unlink(elem))
+            if(d->unlinkElement(index, elem))
             {
                 didUnlink = true;
             }
@@ -506,61 +421,74 @@ bool Blockmap::unlink(const AABoxd &region, void *elem)
 
 void Blockmap::unlinkAll()
 {
-    for (const auto &node : d->nodes)
-    {
-        // Only leafs with user data.
-        if (!node.isLeaf()) continue;
+    d->unlinkAll();
+}
 
-        if (auto *cellData = node.leafData)
-        {
-            cellData->unlinkAll();
-        }
-    }
+void Blockmap::compact()
+{
+    d->compact();
+}
+
+void Blockmap::beginIteration() const
+{
+    d->iterations++;
+}
+
+void Blockmap::endIteration() const
+{
+    d->iterations--;
+}
+
+bool Blockmap::isCompact() const
+{
+    return d->compacted;
 }
 
 dint Blockmap::cellElementCount(const Cell &cell) const
 {
-    if(auto *cellData = d->cellData(cell))
+    const dint index = d->cellIndex(cell);
+    if(index < 0) return 0;
+
+    if(d->compacted)
     {
-        return cellData->elemCount;
+        return d->offsets[index + 1] - d->offsets[index];
     }
-    return 0;
+    return d->cells[index].count;
 }
 
-LoopResult Blockmap::forAllInCell(const Cell &cell, std::function<LoopResult (void *object)> func) const
+Blockmap::CellRange Blockmap::cellRange(const Cell &cell) const
 {
-    if(auto *cellData = d->cellData(cell))
+    CellRange range;
+    const dint index = d->cellIndex(cell);
+    if(index < 0) return range;
+
+    if(d->compacted)
     {
-        RingNode *node = cellData->ringNodes;
-        while(node)
+        const dint begin = d->offsets[index];
+        range.count = d->offsets[index + 1] - begin;
+        if(range.count > 0)
         {
-            RingNode *next = node->next;
-            if(node->elem)
-            {
-                if(auto result = func(node->elem)) return result;
-            }
-            node = next;
+            range.elements = d->elements.data() + begin;
         }
     }
-    return LoopContinue;
+    else
+    {
+        const auto &list = d->cells[index];
+        range.nodes = &d->nodes;
+        range.first = list.first;
+        range.last  = list.last;
+    }
+    return range;
 }
 
-LoopResult Blockmap::forAllInBox(const AABoxd &box, std::function<LoopResult (void *object)> func) const
+BlockmapCellBlock Blockmap::clippedCellBlock(const AABoxd &box) const
 {
     CellBlock cellBlock = toCellBlock(box);
     d->clipBlock(cellBlock);
-
-    Cell cell;
-    for(cell.y = cellBlock.min.y; cell.y < cellBlock.max.y; ++cell.y)
-    for(cell.x = cellBlock.min.x; cell.x < cellBlock.max.x; ++cell.x)
-    {
-        if(auto result = forAllInCell(cell, func)) return result;
-    }
-    return LoopContinue;
+    return cellBlock;
 }
 
-LoopResult Blockmap::forAllInPath(const Vec2d &from_, const Vec2d &to_,
-    std::function<LoopResult (void *object)> func) const
+bool Blockmap::beginPath(const Vec2d &from_, const Vec2d &to_, PathWalk &walk) const
 {
     // We may need to clip and/or adjust these points.
     Vec2d from = from_;
@@ -570,7 +498,7 @@ LoopResult Blockmap::forAllInPath(const Vec2d &from_, const Vec2d &to_,
     if(!(from.x >= d->bounds.minX && from.x <= d->bounds.maxX &&
          from.y >= d->bounds.minY && from.y <= d->bounds.maxY))
     {
-        return LoopContinue;
+        return false;
     }
 
     // Check the easy case of a trace line completely outside the blockmap.
@@ -579,7 +507,7 @@ LoopResult Blockmap::forAllInPath(const Vec2d &from_, const Vec2d &to_,
        (from.y < d->bounds.minY && to.y < d->bounds.minY) ||
        (from.y > d->bounds.maxY && to.y > d->bounds.maxY))
     {
-        return LoopContinue;
+        return false;
     }
 
     /*
@@ -685,29 +613,13 @@ LoopResult Blockmap::forAllInPath(const Vec2d &from_, const Vec2d &to_,
 
     intercept += frac * interceptStep;
 
-    // Walk the cells of the blockmap.
-    BlockmapCell cell = originCell;
-    for(int pass = 0; pass < 64; ++pass) // Prevent a round off error leading us into
-                                         // an infinite loop...
-    {
-        if(auto result = forAllInCell(cell, func))
-            return result;
-
-        if(cell == destCell) break;
-
-        if(cell.y == uint( intercept.y ))
-        {
-            cell.x      += cellStep.x;
-            intercept.y += interceptStep.y;
-        }
-        else if(cell.x == uint( intercept.x ))
-        {
-            cell.y      += cellStep.y;
-            intercept.x += interceptStep.x;
-        }
-    }
-
-    return LoopContinue;
+    walk.cell          = originCell;
+    walk.destCell      = destCell;
+    walk.cellStep      = cellStep;
+    walk.intercept     = intercept;
+    walk.interceptStep = interceptStep;
+    walk.pass          = 0;
+    return true;
 }
 
 }  // namespace world
@@ -2,6 +2,7 @@
  * @ingroup world
  *
  * @authors Copyright &copy; 2007-2013 Daniel Swanson <danij@dengine.net>
+ * @authors Copyright &copy; 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -20,87 +21,217 @@
 
 #include "doomsday/world/entitydatabase.h"
 
+#include <de/hash.h>
 #include <de/log.h>
-#include <map>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 using namespace de;
 
-/// @todo Use Records instead of these.
+static dsize entityValueSize(valuetype_t type)
+{
+    switch (type)
+    {
+    case DDVT_BYTE:   return sizeof(byte);
+    case DDVT_SHORT:  return sizeof(short);
+    case DDVT_INT:    return sizeof(int);
+    case DDVT_FIXED:  return sizeof(fixed_t);
+    case DDVT_ANGLE:  return sizeof(angle_t);
+    case DDVT_FLOAT:  return sizeof(float);
+    case DDVT_DOUBLE: return sizeof(double);
+    default:
+        throw Error("EntityDatabase", stringf("Unknown/not-supported value type %d", type));
+    }
+}
+
+static void writeEntityValue(void *dst, valuetype_t dstType, const PropertyValue &value)
+{
+    switch (dstType)
+    {
+    case DDVT_BYTE:   *(   (byte *) dst) = value.asByte();   break;
+    case DDVT_SHORT:  *(  (short *) dst) = value.asInt16();  break;
+    case DDVT_INT:    *(    (int *) dst) = value.asInt32();  break;
+    case DDVT_FIXED:  *((fixed_t *) dst) = value.asFixed();  break;
+    case DDVT_ANGLE:  *((angle_t *) dst) = value.asAngle();  break;
+    case DDVT_FLOAT:  *(  (float *) dst) = value.asFloat();  break;
+    case DDVT_DOUBLE: *( (double *) dst) = value.asDouble(); break;
+    default:
+        throw Error("EntityDatabase", stringf("Unknown/not-supported value type %d", dstType));
+    }
+}
+
+/**
+ * Converts a value from one type to another. The conversions are the ones
+ * PropertyValue does, so values read back are the same as before the values
+ * were stored in columns.
+ */
+static void convertEntityValue(void *dst, valuetype_t dstType, const void *src, valuetype_t srcType)
+{
+    if (dstType == srcType)
+    {
+        std::memcpy(dst, src, entityValueSize(srcType));
+        return;
+    }
+    switch (srcType)
+    {
+    case DDVT_BYTE:   writeEntityValue(dst, dstType, PropertyByteValue  (*(   (const byte *) src))); break;
+    case DDVT_SHORT:  writeEntityValue(dst, dstType, PropertyInt16Value (*(  (const short *) src))); break;
+    case DDVT_INT:    writeEntityValue(dst, dstType, PropertyInt32Value (*(    (const int *) src))); break;
+    case DDVT_FIXED:  writeEntityValue(dst, dstType, PropertyFixedValue (*((const fixed_t *) src))); break;
+    case DDVT_ANGLE:  writeEntityValue(dst, dstType, PropertyAngleValue (*((const angle_t *) src))); break;
+    case DDVT_FLOAT:  writeEntityValue(dst, dstType, PropertyFloatValue (*(  (const float *) src))); break;
+    case DDVT_DOUBLE: writeEntityValue(dst, dstType, PropertyDoubleValue(*( (const double *) src))); break;
+    default:
+        throw Error("EntityDatabase", stringf("Unknown/not-supported value type %d", srcType));
+    }
+}
+
+namespace {
+
+/// Set of element indices.
+struct ElementBits
+{
+    std::vector<duint64> bits;
+
+    inline bool test(int index) const
+    {
+        const dsize word = dsize(index) >> 6;
+        return word < bits.size() && ((bits[word] >> (index & 63)) & 1) != 0;
+    }
+
+    /// Returns @c true if the bit was not set before.
+    inline bool set(int index)
+    {
+        const dsize word = dsize(index) >> 6;
+        if (word >= bits.size()) bits.resize(word + 1, 0);
+        const duint64 mask = duint64(1) << (index & 63);
+        const bool wasSet = (bits[word] & mask) != 0;
+        bits[word] |= mask;
+        return !wasSet;
+    }
+};
 
-// An entity is a set of one or more properties.
-// Key is the unique identifier of said property in the
-// MapEntityPropertyDef it is derived from.
-typedef std::map<int, PropertyValue *> Entity;
+/// Values of one property of one entity type.
+struct PropertyColumn
+{
+    valuetype_t          type = DDVT_NONE;
+    dsize                valueSize = 0;
+    int                  size = 0;  ///< Number of elements (highest index + 1).
+    std::vector<duint8>  values;
+    ElementBits          present;
+
+    /// PropertyValues returned by EntityDatabase::property(), built on demand.
+    mutable std::unordered_map<int, std::unique_ptr<PropertyValue>> boxed;
+
+    inline void *at(int index) { return &values[dsize(index) * valueSize]; }
+    inline const void *at(int index) const { return &values[dsize(index) * valueSize]; }
+
+    void ensureSize(int newSize)
+    {
+        if (newSize <= size) return;
+        size = newSize;
+        values.resize(dsize(size) * valueSize, 0);
+        present.bits.resize((dsize(size) + 63) / 64, 0);
+    }
+};
 
-// Entities are stored in a set, each associated with a unique map element index.
-typedef std::map<int, Entity> Entities;
+/// All the properties of one entity type.
+struct EntityTable
+{
+    std::vector<std::unique_ptr<PropertyColumn>> columns; ///< Indexed like MapEntityDef::props.
+    ElementBits elements;
+    uint        count = 0;
+};
 
-// Entities are grouped in sets by their unique identifier.
-typedef std::map<int, Entities> EntitySet;
+} // namespace
 
 DE_PIMPL(EntityDatabase)
 {
-    EntitySet entitySets;
+    Hash<int, EntityTable> tables; ///< Key is the entity ID.
 
     Impl(Public *i) : Base(i)
     {}
 
-    ~Impl()
+    const EntityTable *table(int entityId) const
     {
-        DE_FOR_EACH(EntitySet, setIt, entitySets)
-        DE_FOR_EACH(Entities, entityIt, setIt->second)
-        DE_FOR_EACH(Entity, propIt, entityIt->second)
+        auto found = tables.find(entityId);
+        return found != tables.end()? &found->second : nullptr;
+    }
+
+    static dsize propertyIndex(const MapEntityPropertyDef &def)
+    {
+        return dsize(&def - def.entity->props);
+    }
+
+    const PropertyColumn *column(const MapEntityPropertyDef &def) const
+    {
+        if (const EntityTable *tab = table(def.entity->id))
         {
-            delete propIt->second;
+            const dsize index = propertyIndex(def);
+            if (index < tab->columns.size()) return tab->columns[index].get();
         }
+        return nullptr;
     }
 
-    /**
-     * Lookup the set in which entities with the unique identifier
-     * @a entityId are stored.
-     */
-    Entities *entities(int entityId)
+    const PropertyColumn &columnWithValue(const MapEntityPropertyDef &def, int elementIndex) const
     {
-        std::pair<EntitySet::iterator, bool> result;
-        result = entitySets.insert(std::pair<int, Entities>(entityId, Entities()));
-        return &result.first->second;
+        checkHasValue(def, elementIndex);
+        const PropertyColumn *col = column(def);
+        if (!col || !col->present.test(elementIndex))
+        {
+            throw Error("EntityDatabase::property",
+                        stringf("Element %i of type %s has no value for property %i",
+                                elementIndex,
+                                Str_Text(P_NameForMapEntityDef(def.entity)),
+                                def.id));
+        }
+        return *col;
     }
 
     /**
-     * Lookup an entity in @a set by its unique @a elementIndex.
+     * Makes sure there is room for the elements [firstIndex, firstIndex + count)
+     * in the column of the property.
      */
-    Entity *entityByElementIndex(Entities& set, int elementIndex, bool canCreate)
-    {
-        // Do we already have a record for this entity?
-        Entities::iterator found = set.find(elementIndex);
-        if (found != set.end()) return &found->second;
-
-        if (!canCreate) return 0;
-
-        // A new entity.
-        std::pair<Entities::iterator, bool> result;
-        result = set.insert(std::pair<int, Entity>(elementIndex, Entity()));
-        return &result.first->second;
-    }
-
-    const PropertyValue *tryFindPropertyValue(const MapEntityPropertyDef &def,
-                                              int elementIndex)
-    {
-         Entities *set = entities(def.entity->id);
-         const Entity *entity = entityByElementIndex(*set, elementIndex, false /*do not create*/);
-         if (!entity)
-         {
-             throw Error("EntityDatabase::property",
-                         stringf("There is no element %i of type %s",
-                                 elementIndex,
-                                 Str_Text(P_NameForMapEntityDef(def.entity))));
-         }
-         Entity::const_iterator found = entity->find(def.id);
-         if (found == entity->end())
-         {
-             return nullptr;
-         }
-         return found->second;
+    PropertyColumn &writableColumn(const MapEntityPropertyDef &def, int firstIndex, int count)
+    {
+        if (firstIndex < 0)
+        {
+            throw Error("EntityDatabase::setProperty",
+                        stringf("Invalid element index %i", firstIndex));
+        }
+        EntityTable &tab = tables[def.entity->id];
+        const dsize index = propertyIndex(def);
+        if (index >= tab.columns.size()) tab.columns.resize(de::max(dsize(def.entity->numProps), index + 1));
+
+        auto &col = tab.columns[index];
+        if (!col)
+        {
+            col.reset(new PropertyColumn);
+            col->type      = def.type;
+            col->valueSize = entityValueSize(def.type);
+        }
+        col->ensureSize(firstIndex + count);
+        return *col;
+    }
+
+    static void markPresent(EntityTable &tab, PropertyColumn &col, int elementIndex)
+    {
+        col.present.set(elementIndex);
+        if (tab.elements.set(elementIndex)) tab.count++;
+    }
+
+    void checkHasValue(const MapEntityPropertyDef &def, int elementIndex) const
+    {
+        const EntityTable *tab = table(def.entity->id);
+        if (!tab || !tab->elements.test(elementIndex))
+        {
+            throw Error("EntityDatabase::property",
+                        stringf("There is no element %i of type %s",
+                                elementIndex,
+                                Str_Text(P_NameForMapEntityDef(def.entity))));
+        }
     }
 };
 
@@ -110,57 +241,101 @@ EntityDatabase::EntityDatabase() : d(new Impl(this))
 uint EntityDatabase::entityCount(const MapEntityDef *entityDef) const
 {
     DE_ASSERT(entityDef);
-    Entities *set = d->entities(entityDef->id);
-    return set->size();
+    const EntityTable *tab = d->table(entityDef->id);
+    return tab? tab->count : 0;
 }
 
 bool EntityDatabase::hasEntity(const MapEntityDef *entityDef, int elementIndex) const
 {
     DE_ASSERT(entityDef);
-    Entities *set = d->entities(entityDef->id);
-    return d->entityByElementIndex(*set, elementIndex, false /*do not create*/) != 0;
+    const EntityTable *tab = d->table(entityDef->id);
+    return tab && tab->elements.test(elementIndex);
 }
 
 const PropertyValue &EntityDatabase::property(const MapEntityPropertyDef *def,
                                               int elementIndex) const
 {
     DE_ASSERT(def);
-    if (const auto *propValue = d->tryFindPropertyValue(*def, elementIndex))
+    const PropertyColumn &col = d->columnWithValue(*def, elementIndex);
+    auto &value = col.boxed[elementIndex];
+    if (!value)
     {
-        return *propValue;
+        value.reset(BuildPropertyValue(col.type, const_cast<void *>(col.at(elementIndex))));
     }
-    throw Error("EntityDatabase::property",
-                stringf("Element %i of type %s has no value for property %i",
-                        elementIndex,
-                        Str_Text(P_NameForMapEntityDef(def->entity)),
-                        def->id));
+    return *value;
+}
+
+void EntityDatabase::property(const MapEntityPropertyDef *def, int elementIndex,
+                              valuetype_t valueType, void *valueAdr) const
+{
+    DE_ASSERT(def);
+    DE_ASSERT(valueAdr);
+    const PropertyColumn &col = d->columnWithValue(*def, elementIndex);
+    convertEntityValue(valueAdr, valueType, col.at(elementIndex), col.type);
 }
 
 bool EntityDatabase::hasPropertyValue(const MapEntityPropertyDef *def, int elementIndex) const
 {
     DE_ASSERT(def);
-    return d->tryFindPropertyValue(*def, elementIndex) != nullptr;
+    d->checkHasValue(*def, elementIndex);
+    const PropertyColumn *col = d->column(*def);
+    return col && col->present.test(elementIndex);
+}
+
+EntityDatabase::Column EntityDatabase::column(const MapEntityPropertyDef *def) const
+{
+    DE_ASSERT(def);
+    Column view;
+    view.type = def->type;
+    if (const PropertyColumn *col = d->column(*def))
+    {
+        view.size    = col->size;
+        view.values  = col->values.data();
+        view.present = col->present.bits.data();
+    }
+    return view;
 }
 
 void EntityDatabase::setProperty(const MapEntityPropertyDef *def, int elementIndex,
     PropertyValue *value)
 {
     DE_ASSERT(def);
-    Entities *set = d->entities(def->entity->id);
-    Entity *entity = d->entityByElementIndex(*set, elementIndex, true);
-    if (!entity)
-        throw Error("EntityDatabase::setProperty", "Failed adding new entity element record");
-
-    // Do we already have a record for this?
-    Entity::iterator found = entity->find(def->id);
-    if (found != entity->end())
-    {
-        PropertyValue **adr = &found->second;
-        delete *adr;
-        *adr = value;
-        return;
-    }
+    DE_ASSERT(value);
+    std::unique_ptr<PropertyValue> owned(value);
+
+    PropertyColumn &col = d->writableColumn(*def, elementIndex, 1);
+    writeEntityValue(col.at(elementIndex), col.type, *owned);
+    col.boxed.erase(elementIndex);
+    Impl::markPresent(d->tables[def->entity->id], col, elementIndex);
+}
+
+void EntityDatabase::setProperties(const MapEntityPropertyDef *def, int firstIndex, int count,
+    valuetype_t valueType, const void *values)
+{
+    DE_ASSERT(def);
+    DE_ASSERT(values || count <= 0);
+
+    if (count <= 0) return;
+
+    const dsize srcSize = entityValueSize(valueType);
+    PropertyColumn &col = d->writableColumn(*def, firstIndex, count);
 
-    // Add a new record.
-    entity->insert(std::pair<int, PropertyValue *>(def->id, value));
+    if (valueType == col.type)
+    {
+        std::memcpy(col.at(firstIndex), values, srcSize * dsize(count));
+    }
+    else
+    {
+        auto *src = reinterpret_cast<const byte *>(values);
+        for (int i = 0; i < count; ++i, src += srcSize)
+        {
+            convertEntityValue(col.at(firstIndex + i), col.type, src, valueType);
+        }
+    }
+    EntityTable &tab = d->tables[def->entity->id];
+    for (int i = 0; i < count; ++i)
+    {
+        Impl::markPresent(tab, col, firstIndex + i);
+        if (!col.boxed.empty()) col.boxed.erase(firstIndex + i);
+    }
 }
@@ -291,27 +291,11 @@ static MapEntityPropertyDef *entityPropertyDef(int entityId, int propertyId)
     return property; // Found it.
 }
 
-static void setValue(void *dst, valuetype_t dstType, const PropertyValue &pvalue)
-{
-    switch (dstType)
-    {
-    case DDVT_FIXED:  *((fixed_t *) dst) = pvalue.asFixed();  break;
-    case DDVT_FLOAT:  *(  (float *) dst) = pvalue.asFloat();  break;
-    case DDVT_DOUBLE: *( (double *) dst) = pvalue.asDouble(); break;
-    case DDVT_BYTE:   *(   (byte *) dst) = pvalue.asByte();   break;
-    case DDVT_INT:    *(    (int *) dst) = pvalue.asInt32();  break;
-    case DDVT_SHORT:  *(  (short *) dst) = pvalue.asInt16();  break;
-    case DDVT_ANGLE:  *((angle_t *) dst) = pvalue.asAngle();  break;
-    default:
-        throw Error("setValue", stringf("Unknown value type %d", dstType));
-    }
-}
-
 dd_bool P_GMOPropertyIsSet(int entityId, int elementIndex, int propertyId)
 {
     if (World::get().hasMap())
     {
-        World::get().map().entityDatabase()
+        return World::get().map().entityDatabase()
                 .hasPropertyValue(entityPropertyDef(entityId, propertyId), elementIndex);
     }
     return false;
@@ -327,7 +311,7 @@ Type getEntityValue(int entityId, int elementIndex, int propertyId)
         {
             const EntityDatabase &db = World::get().map().entityDatabase();
             const MapEntityPropertyDef *propDef = entityPropertyDef(entityId, propertyId);
-            setValue(&returnVal, returnValueType, db.property(propDef, elementIndex));
+            db.property(propDef, elementIndex, returnValueType, &returnVal);
         }
         return returnVal;
     }
@@ -642,6 +642,18 @@ dint LineSide::setProperty(const DmuArgs &args)
     return false; // Continue iteration.
 }
 
+dsize LineSide::memoryUsage() const
+{
+    dsize bytes = MapElement::memoryUsage() + sizeof(LineSide) - sizeof(MapElement) + sizeof(Impl)
+                + d->segments.size() * sizeof(LineSideSegment *);
+    if (d->sections)
+    {
+        // The surfaces themselves are separate map elements.
+        bytes += sizeof(Impl::Sections) + 3 * sizeof(Impl::Section);
+    }
+    return bytes;
+}
+
 String LineSide::sectionIdAsText(dint sectionId) // static
 {
     switch (sectionId)
@@ -1070,6 +1082,12 @@ dint Line::setProperty(const DmuArgs &args)
     return false; // Continue iteration.
 }
 
+dsize Line::memoryUsage() const
+{
+    return MapElement::memoryUsage() + sizeof(Line) - sizeof(MapElement) + sizeof(Impl)
+         + audienceForFlagsChange.allocatedSize();
+}
+
 D_CMD(InspectLine)
 {
     DE_UNUSED(src);
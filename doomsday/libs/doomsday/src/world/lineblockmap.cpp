@@ -74,6 +74,9 @@ void LineBlockmap::link(Line &line)
 void LineBlockmap::link(const List<Line *> &lines)
 {
     for (Line *line : lines) link(*line);
+
+    // Lines are not relinked after the map has been loaded.
+    compact();
 }
 
 }  // namespace world
@@ -21,24 +21,61 @@
 #include "doomsday/world/linesighttest.h"
 
 #include "doomsday/mesh/face.h"
-//#include "world/clientserverworld.h"  /// For validCount, @todo Remove me.
 #include "doomsday/world/bspnode.h"
 #include "doomsday/world/bspleaf.h"
 #include "doomsday/world/convexsubspace.h"
 #include "doomsday/world/line.h"
 #include "doomsday/world/polyobj.h"
 #include "doomsday/world/sector.h"
-#include "doomsday/world/world.h"
+#include "doomsday/world/map.h"
 
 #include <de/legacy/aabox.h>
 #include <de/legacy/fixedpoint.h>
 #include <de/legacy/vector1.h>
+#include <algorithm>
 #include <cmath>
 
 using namespace de;
 
 namespace world {
 
+/**
+ * Lines already tested during the current trace of the calling thread. Kept
+ * separately for each thread (instead of using the validCount of the lines) so
+ * that traces can be run concurrently.
+ */
+struct VisitedLines
+{
+    List<duint32> stamps; ///< Indexed by line number.
+    duint32 current = 0;
+
+    void beginTrace()
+    {
+        if (++current == 0)
+        {
+            // Wrapped around; forget all previous visits.
+            std::fill(stamps.begin(), stamps.end(), 0);
+            current = 1;
+        }
+    }
+
+    /// Marks @a line visited. Returns @c false if it was already visited.
+    bool visit(const Line &line)
+    {
+        const dint index = line.indexInMap();
+        DE_ASSERT(index >= 0);
+        if (index >= stamps.sizei())
+        {
+            stamps.resize(de::max(index + 1, line.map().lineCount()), 0);
+        }
+        if (stamps[index] == current) return false;
+        stamps[index] = current;
+        return true;
+    }
+};
+
+static thread_local VisitedLines visitedLines;
+
 DE_PIMPL_NOREF(LineSightTest)
 {
     dint flags = 0;      // LS_* flags @ref lineSightFlags
@@ -90,11 +127,9 @@ DE_PIMPL_NOREF(LineSightTest)
 
         Line &line = side.line();
 
-        if (line.validCount() == World::validCount)
+        if (!visitedLines.visit(line))
             return true;  // Ignore
 
-        line.setValidCount(World::validCount);
-
         // Does the ray intercept the line on the X/Y plane?
         // Try a quick bounding-box rejection.
         if (   line.bounds().minX > ray.bounds.maxX
@@ -325,7 +360,7 @@ LineSightTest::LineSightTest(const Vec3d &from, const Vec3d &to, dfloat bottomSl
 
 bool LineSightTest::trace(const BspTree &bspRoot)
 {
-    World::validCount++;
+    visitedLines.beginTrace();
 
     d->topSlope    = d->to.z + d->topSlope    - d->from.z;
     d->bottomSlope = d->to.z + d->bottomSlope - d->from.z;
@@ -27,6 +27,7 @@
 #include "doomsday/world/lineowner.h"
 #include "doomsday/world/bspleaf.h"
 #include "doomsday/world/convexsubspace.h"
+#include "doomsday/world/reject.h"
 #include "doomsday/world/bsp/partitioner.h"
 #include "doomsday/world/factory.h"
 #include "doomsday/world/thinkers.h"
@@ -39,6 +40,7 @@
 #include "doomsday/console/var.h"
 #include "doomsday/doomsdayapp.h"
 #include "doomsday/network/protocol.h"
+#include "doomsday/filesys/file.h"
 
 #include <de/legacy/nodepile.h>
 #include <de/legacy/memory.h>
@@ -46,6 +48,9 @@
 #include <de/charsymbols.h>
 #include <de/rectangle.h>
 #include <de/logbuffer.h>
+#include <de/filesystem.h>
+#include <de/folder.h>
+#include <de/math.h>
 
 using namespace de;
 
@@ -168,6 +173,8 @@ DE_PIMPL(Map)
     nodepile_t                    lineNodes;
     nodeindex_t *                 lineLinks = nullptr; ///< Indices to roots.
 
+    std::unique_ptr<Block>        rejectMatrix; ///< Loaded or built on demand.
+
     Impl(Public *i) : Base(i)
     {
         sky.reset(Factory::newSky(nullptr));
@@ -222,6 +229,119 @@ DE_PIMPL(Map)
         }
     }
 
+    /// Size of the REJECT matrix of the map, in bytes.
+    dsize rejectMatrixSize() const
+    {
+        return (dsize(sectors.count()) * sectors.count() + 7) / 8;
+    }
+
+    /**
+     * Reads the REJECT lump of the map. A short lump is padded with zeros (i.e., not
+     * rejected), like vanilla would read past its end.
+     *
+     * @return  REJECT matrix, or an empty block if the map has no REJECT lump or
+     * the lump is empty. Node builders that do not build REJECT write one with
+     * only zeros, which is considered empty too.
+     */
+    Block shippedRejectMatrix() const
+    {
+        if (!manifest) return Block();
+
+        const auto &lumps = manifest->recognizer().lumps();
+        const auto found  = lumps.constFind(res::Id1MapRecognizer::RejectData);
+        if (found == lumps.end() || !found->second) return Block();
+
+        res::File1 &lump = *found->second;
+        const dsize size = rejectMatrixSize();
+        Block matrix(size);
+        matrix.fill(0);
+        lump.read(matrix.data(), 0, de::min(dsize(lump.size()), size));
+
+        bool isEmpty = true;
+        for (dbyte b : matrix)
+        {
+            if (b) { isEmpty = false; break; }
+        }
+        if (isEmpty) return Block();
+
+        if (lump.size() < size)
+        {
+            LOG_MAP_WARNING("REJECT of map \"%s\" is too short (%i bytes instead of %i); "
+                            "the missing sector pairs are not rejected")
+                << self().id() << lump.size() << size;
+        }
+        return matrix;
+    }
+
+    /**
+     * Path of the cached REJECT matrix built for the map. The name includes a
+     * checksum of the map data, so a modified map gets a new matrix.
+     */
+    String rejectCachePath() const
+    {
+        if (!manifest || !manifest->sourceFile()) return "";
+
+        Block mapData;
+        for (const auto &lump : manifest->recognizer().lumps())
+        {
+            if (lump.first == res::Id1MapRecognizer::RejectData   ||
+                lump.first == res::Id1MapRecognizer::BlockmapData || !lump.second)
+            {
+                continue;
+            }
+            mapData.append(lump.second->cache(), int(lump.second->size()));
+            lump.second->unlock();
+        }
+        return Stringf("/home/cache/maps/%s.%08x/%s.reject",
+                       String(manifest->sourceFile()->name().fileNameWithoutExtension()).c_str(),
+                       crc32(mapData),
+                       self().id().c_str())
+                .lower();
+    }
+
+    Block loadOrBuildRejectMatrix() const
+    {
+        Block matrix = shippedRejectMatrix();
+        if (!matrix.isEmpty())
+        {
+            LOG_MAP_VERBOSE("Using the REJECT lump of the map");
+            return matrix;
+        }
+
+        const String cachePath = rejectCachePath();
+        if (!cachePath.isEmpty())
+        {
+            if (const auto *cached = FS::tryLocate<File const>(cachePath))
+            {
+                *cached >> matrix;
+                if (matrix.size() == rejectMatrixSize())
+                {
+                    LOG_MAP_VERBOSE("Using the REJECT built earlier: %s") << cached->description();
+                    return matrix;
+                }
+            }
+        }
+
+        matrix = BuildRejectForMap(self());
+
+        if (!cachePath.isEmpty())
+        {
+            try
+            {
+                Folder &folder = FS::get().makeFolder(String(cachePath.fileNamePath()));
+                File &out = folder.replaceFile(String(cachePath.fileName()));
+                out << matrix;
+                out.release();
+                LOG_MAP_VERBOSE("REJECT written to %s") << out.description();
+            }
+            catch (const Error &er)
+            {
+                LOG_MAP_WARNING("Failed to write REJECT to \"%s\": %s") << cachePath << er.asText();
+            }
+        }
+        return matrix;
+    }
+
     /**
      * @pre Axis-aligned bounding boxes of all Sectors must be initialized.
      */
@@ -840,6 +960,7 @@ DE_PIMPL(Map)
         {
             subspaceBlockmap->link(subspace->poly().bounds(), subspace);
         }
+        subspaceBlockmap->compact();
     }
 
     /**
@@ -1267,6 +1388,15 @@ const BspTree &Map::bspTree() const
     throw MissingBspTreeError("Map::bspTree", "No BSP tree is available");
 }
 
+const Block &Map::rejectMatrix() const
+{
+    if (!d->rejectMatrix)
+    {
+        d->rejectMatrix.reset(new Block(d->loadOrBuildRejectMatrix()));
+    }
+    return *d->rejectMatrix;
+}
+
 BspLeaf &Map::bspLeafAt(const Vec2d &point) const
 {
     if (!d->bsp.tree)
@@ -2318,6 +2448,71 @@ String Map::elementSummaryAsStyledText() const
     return str.rightStrip();
 }
 
+String Map::memorySummaryAsStyledText() const
+{
+    struct Usage
+    {
+        dint  count = 0;
+        dsize bytes = 0;
+
+        void add(const MapElement &elem)
+        {
+            count += 1;
+            bytes += elem.memoryUsage();
+        }
+    };
+    Usage vertexes, lines, sides, sectors, planes, surfaces;
+
+    forAllVertices([&vertexes] (Vertex &vertex)
+    {
+        vertexes.add(vertex);
+        return LoopContinue;
+    });
+    forAllLines([&lines, &sides, &surfaces] (Line &line)
+    {
+        lines.add(line);
+        for (dint i = 0; i < 2; ++i)
+        {
+            LineSide &side = line.side(i);
+            sides.add(side);
+            side.forAllSurfaces([&surfaces] (Surface &surface)
+            {
+                surfaces.add(surface);
+                return LoopContinue;
+            });
+        }
+        return LoopContinue;
+    });
+    forAllSectors([&sectors, &planes, &surfaces] (Sector &sector)
+    {
+        sectors.add(sector);
+        sector.forAllPlanes([&planes, &surfaces] (Plane &plane)
+        {
+            planes.add(plane);
+            surfaces.add(plane.surface());
+            return LoopContinue;
+        });
+        return LoopContinue;
+    });
+
+    String str;
+    auto tabbed = [&str] (const Usage &usage, const char *label)
+    {
+        if (!usage.count) return;
+        str += Stringf(_E(Ta) "  %i " _E(Tb) "%s: %.1f KB (%i bytes each)\n",
+                       usage.count, label, usage.bytes / 1024.0,
+                       dint(usage.bytes / dsize(usage.count)));
+    };
+    tabbed(vertexes, "Vertexes");
+    tabbed(lines,    "Lines");
+    tabbed(sides,    "Line sides");
+    tabbed(sectors,  "Sectors");
+    tabbed(planes,   "Planes");
+    tabbed(surfaces, "Surfaces");
+
+    return str.rightStrip();
+}
+
 String Map::objectsDescription() const
 {
     auto &gx = DoomsdayApp::plugins().gameExports();
@@ -2560,6 +2755,9 @@ D_CMD(InspectMap)
     LOG_SCR_MSG(_E(D) "Elements:");
     LOG_SCR_MSG("%s") << map.elementSummaryAsStyledText();
 
+    LOG_SCR_MSG(_E(D) "Memory:");
+    LOG_SCR_MSG("%s") << map.memorySummaryAsStyledText();
+
     if (map.thinkers().isInited())
     {
         LOG_SCR_MSG(_E(D) "Objects:");
@@ -140,6 +140,11 @@ dint MapElement::setProperty(const DmuArgs &args)
                              stringf("'%s' is unknown/not writable", DMU_Str(args.prop)));
 }
 
+dsize MapElement::memoryUsage() const
+{
+    return sizeof(MapElement) + sizeof(Impl);
+}
+
 }  // namespace world
 
 const char *DMU_Str(uint prop)
@@ -51,7 +51,7 @@ mobj_t *P_MobjCreate(thinkfunc_t function, const Vec3d &origin, angle_t angle,
     if (!mob)
     {
         // No, we need to allocate another.
-        mob = MobjThinker(Thinker::AllocateMemoryZone).take();
+        mob = MobjThinker(Thinker::AllocatePooled).take();
     }
 
     V3d_Set(mob->origin, origin.x, origin.y, origin.z);
@@ -77,6 +77,7 @@ DE_PIMPL(Plane)
             return;
 
         self()._height = newHeight;
+        World::geometryStamp++;
 
         if (!World::ddMapSetup)
         {
@@ -191,6 +192,7 @@ void Plane::updateSoundEmitterOrigin()
 void Plane::setHeight(double newHeight)
 {
     _height = d->heightTarget = newHeight;
+    World::geometryStamp++;
     d->maybeBeginNewMovement(newHeight);
 }
 
@@ -267,4 +269,11 @@ dint Plane::setProperty(const DmuArgs &args)
     return false;  // Continue iteration.
 }
 
+dsize Plane::memoryUsage() const
+{
+    return MapElement::memoryUsage() + sizeof(Plane) - sizeof(MapElement) + sizeof(Impl)
+         + d->audienceForDeletion    .allocatedSize()
+         + d->audienceForHeightChange.allocatedSize();
+}
+
 } // namespace world
@@ -301,6 +301,8 @@ bool Polyobj::move(const Vec2d &delta)
     LOG_AS("Polyobj::move");
     //LOG_DEBUG("Applying delta %s to [%p]") << delta.asText() << this;
 
+    world::World::geometryStamp++;
+
     unlink();
     {
         auto prevCoordsIt = data().prevPts.begin();
@@ -378,6 +380,8 @@ bool Polyobj::rotate(angle_t delta)
     //LOG_DEBUG("Applying delta %u (%f) to [%p]")
     //    << delta << (delta / float( ANGLE_MAX ) * 360) << this;
 
+    world::World::geometryStamp++;
+
     unlink();
     {
         duint fineAngle = (angle + delta) >> ANGLETOFINESHIFT;
@@ -1,4 +1,4 @@
-/** @file reject.h World map sector LOS reject LUT building.
+/** @file reject.cpp World map sector LOS reject LUT building.
  *
  * @authors Copyright © 2007-2013 Daniel Swanson <danij@dengine.net>
  * @authors Copyright © 2000-2007 Andrew Apted <ajapted@gmail.com>
@@ -23,92 +23,327 @@
  * 02110-1301 USA</small>
  */
 
-#if 0 // Needs updating.
-#include <cmath>
+#include "doomsday/world/reject.h"
+#include "doomsday/world/map.h"
+#include "doomsday/world/convexsubspace.h"
+#include "doomsday/world/line.h"
+#include "doomsday/world/sector.h"
+#include "doomsday/mesh/face.h"
+#include "doomsday/mesh/hedge.h"
 
-#include "de_base.h"
-#include "world/map.h"
+#include <de/list.h>
+#include <de/log.h>
+#include <de/taskpool.h>
+#include <de/time.h>
+#include <de/vector.h>
+#include <algorithm>
 
 using namespace de;
 
-void BuildRejectForMap(const Map &map)
+namespace world {
+
+/// Maximum number of portal flow steps for one sector. If exceeded, every sector
+/// is considered visible from the sector.
+static const dint FLOW_STEP_LIMIT = 250000;
+
+/// Distance (in map units) within which points are considered to be on a line.
+static const ddouble CLIP_EPSILON = 1.0 / 128;
+
+namespace {
+
+struct Segment
+{
+    Vec2d a, b;
+};
+
+/// Opening between two subspaces that a line of sight may pass through.
+struct Portal
+{
+    Segment segment;
+    dint target;  ///< Index of the cell on the other side.
+};
+
+/// A convex subspace of the map.
+struct Cell
+{
+    dint sector = -1;
+    List<Portal> portals;
+};
+
+inline ddouble sideOfLine(const Vec2d &origin, const Vec2d &dir, const Vec2d &point)
+{
+    return dir.x * (point.y - origin.y) - dir.y * (point.x - origin.x);
+}
+
+/**
+ * Clips @a seg to the side of a line where sideOfLine() has the sign @a keepSign.
+ * @return @c false if nothing of the segment remains.
+ */
+bool clipSegment(Segment &seg, const Vec2d &origin, const Vec2d &dir, ddouble keepSign)
+{
+    const ddouble epsilon = CLIP_EPSILON * dir.length();
+    const ddouble sa = sideOfLine(origin, dir, seg.a) * keepSign;
+    const ddouble sb = sideOfLine(origin, dir, seg.b) * keepSign;
+
+    if (sa < -epsilon && sb < -epsilon) return false;
+    if (sa >= -epsilon && sb >= -epsilon) return true;
+
+    const Vec2d cut = seg.a + (seg.b - seg.a) * (sa / (sa - sb));
+    if (sa < -epsilon) seg.a = cut;
+    else               seg.b = cut;
+    return true;
+}
+
+/**
+ * Clips @a target to the region reachable by straight lines that pass through both
+ * @a source and @a pass. The region is bounded by the lines that go through an end
+ * point of each segment and separate the segments from each other. Degenerate
+ * separators are skipped, which only makes the result more permissive.
+ *
+ * @return @c false if nothing of @a target remains.
+ */
+bool clipToSightRegion(const Segment &source, const Segment &pass, Segment &target)
+{
+    const Vec2d src[2] = { source.a, source.b };
+    const Vec2d via[2] = { pass.a, pass.b };
+
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            const Vec2d dir = via[j] - src[i];
+            if (dir.lengthSquared() < CLIP_EPSILON * CLIP_EPSILON) continue;
+
+            const ddouble srcSide = sideOfLine(src[i], dir, src[i ^ 1]);
+            const ddouble viaSide = sideOfLine(src[i], dir, via[j ^ 1]);
+            if (!(srcSide < 0 && viaSide > 0) && !(srcSide > 0 && viaSide < 0))
+            {
+                continue; // Not a separator.
+            }
+            if (!clipSegment(target, src[i], dir, viaSide > 0 ? 1 : -1))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Can a line of sight cross the line side (if any) of @a hedge?
+bool isSightPassable(const mesh::HEdge &hedge)
+{
+    if (!hedge.hasMapElement()) return true; // BSP partition.
+
+    const LineSide &side = hedge.mapElementAs<LineSideSegment>().lineSide();
+    // Plane heights are ignored since they may change.
+    return !side.hasSections() || (side.hasSector() && side.back().hasSector());
+}
+
+/// Sight flood from the subspaces of one sector. Results are collected as
+/// visible sectors.
+struct PortalFlow
 {
-    int *secGroups = M_Malloc(sizeof(int) * map.sectorCount());
-    int group = 0;
+    /// A cell on the current path of the flood.
+    struct Step
+    {
+        dint cell;
+        Segment pass;       ///< Portal through which the cell was entered.
+        dsize nextPortal;   ///< Next portal of the cell to follow.
+    };
+
+    const List<Cell> &cells;
+    List<dbyte> onPath;          ///< Per cell.
+    List<dbyte> visibleSectors;  ///< Per sector.
+    List<Step> path;             ///< Explicit stack; paths can be thousands of cells long.
+    dint steps = 0;
+
+    PortalFlow(const List<Cell> &cells, dint sectorCount)
+        : cells(cells)
+        , onPath(cells.size(), dbyte(0))
+        , visibleSectors(dsize(sectorCount), dbyte(0))
+    {}
 
-    for(uint i = 0; i < map.sectorCount(); ++i)
+    void markVisible(dint cell)
     {
-        Sector &sector = map.sectors[i];
-        secGroups[i] = group++;
-        sector.rejNext = sector.rejPrev = &sector;
+        const dint sector = cells[cell].sector;
+        if (sector >= 0) visibleSectors[sector] = 1;
     }
 
-    for(uint i = 0; i < map.lineCount(); ++i)
+    bool exhausted() const
     {
-        Line *line = &map.lines[i];
+        return steps > FLOW_STEP_LIMIT;
+    }
 
-        if(!line->front().hasSector() || !line->back().hasSector())
-            continue;
+    void enter(dint cell, const Segment &pass)
+    {
+        markVisible(cell);
+        onPath[cell] = 1;
+        path.append(Step{cell, pass, 0});
+    }
 
-        Sector *sec1 = line->front().sectorPtr();
-        Sector *sec2 = line->back().sectorPtr();
+    /**
+     * Follows the lines of sight that pass through both @a source and @a pass
+     * into @a cell, and onward through the portals of the cells reached.
+     */
+    void flow(dint cell, const Segment &source, const Segment &pass)
+    {
+        DE_ASSERT(path.isEmpty());
+        enter(cell, pass);
+        while (!path.isEmpty())
+        {
+            Step &step = path.last();
+            const List<Portal> &portals = cells[step.cell].portals;
+            if (step.nextPortal == portals.size() || exhausted())
+            {
+                onPath[step.cell] = 0;
+                path.removeLast();
+                continue;
+            }
 
-        if(!sec1 || !sec2 || sec1 == sec2)
-            continue;
+            const Portal &portal = portals[step.nextPortal++];
+            if (onPath[portal.target]) continue;
+            if (++steps > FLOW_STEP_LIMIT) continue; // Unwinds the path.
 
-        // Already in the same group?
-        if(secGroups[sec1->index] == secGroups[sec2->index])
-            continue;
+            Segment target = portal.segment;
+            if (clipToSightRegion(source, step.pass, target))
+            {
+                enter(portal.target, target);
+            }
+        }
+    }
 
-        // Swap sectors so that the smallest group is added to the biggest
-        // group. This is based on the assumption that sector numbers in
-        // wads will generally increase over the set of lines, and so
-        // (by swapping) we'll tend to add small groups into larger
-        // groups, thereby minimising the updates to 'rej_group' fields
-        // that is required when merging.
-        Sector *p = 0;
-        if(secGroups[sec1->index] > secGroups[sec2->index])
+    void flowFrom(dint cell)
+    {
+        markVisible(cell);
+        onPath[cell] = 1;
+        for (const Portal &first : cells[cell].portals)
         {
-            p = sec1;
-            sec1 = sec2;
-            sec2 = p;
+            if (onPath[first.target]) continue;
+
+            // Everything in a neighbor is visible through the first portal.
+            const dint next = first.target;
+            markVisible(next);
+            onPath[next] = 1;
+            for (const Portal &second : cells[next].portals)
+            {
+                if (onPath[second.target]) continue;
+                if (++steps > FLOW_STEP_LIMIT) break;
+
+                flow(second.target, first.segment, second.segment);
+            }
+            onPath[next] = 0;
         }
+        onPath[cell] = 0;
+    }
 
-        // Update the group numbers in the second group
-        secGroups[sec2->index] = secGroups[sec1->index];
-        for(p = sec2->rejNext; p != sec2; p = p->rejNext)
+    void run(const List<dint> &sectorCells)
+    {
+        std::fill(visibleSectors.begin(), visibleSectors.end(), 0);
+        steps = 0;
+        for (dint cell : sectorCells)
+        {
+            flowFrom(cell);
+            if (exhausted()) break;
+        }
+        if (exhausted())
         {
-            secGroups[p->index] = secGroups[sec1->index];
+            // The result would be incomplete; nothing can be rejected.
+            std::fill(visibleSectors.begin(), visibleSectors.end(), 1);
         }
+    }
+};
 
-        // Merge 'em baby...
-        sec1->rejNext->rejPrev = sec2;
-        sec2->rejNext->rejPrev = sec1;
+} // namespace
 
-        p = sec1->rejNext;
-        sec1->rejNext = sec2->rejNext;
-        sec2->rejNext = p;
-    }
+Block BuildRejectForMap(const Map &map)
+{
+    const Time startedAt;
+    const dint sectorCount = map.sectorCount();
+
+    // Gather the cells and portals.
+    List<Cell> cells(dsize(map.subspaceCount()));
+    List<List<dint>> sectorCells(dsize(sectorCount));
+    map.forAllSubspaces([&cells, &sectorCells] (ConvexSubspace &subspace)
+    {
+        const dint index = subspace.indexInMap();
+        Cell &cell = cells[index];
+        if (subspace.hasSubsector())
+        {
+            cell.sector = subspace.sector().indexInMap();
+            sectorCells[cell.sector].append(index);
+        }
+
+        const mesh::HEdge *base  = subspace.poly().hedge();
+        const mesh::HEdge *hedge = base;
+        do
+        {
+            if (hedge->hasTwin() && hedge->twin().hasFace() &&
+                hedge->twin().face().hasMapElement() &&
+                (isSightPassable(*hedge) || isSightPassable(hedge->twin())))
+            {
+                const auto &neighbor = hedge->twin().face().mapElementAs<ConvexSubspace>();
+                cell.portals.append(Portal{{hedge->origin(), hedge->next().origin()},
+                                           neighbor.indexInMap()});
+            }
+        } while ((hedge = &hedge->next()) != base);
+        return LoopContinue;
+    });
 
-    size_t rejectSize = (map.sectorCount() * map.sectorCount() + 7) / 8;
-    byte *matrix = Z_Calloc(rejectSize, PU_MAPSTATIC, 0);
+    // Flood sight from each sector. Each sector has its own row of visibility bits.
+    const dint rowBytes = (sectorCount + 7) / 8;
+    List<dbyte> visibility(dsize(rowBytes) * sectorCount, dbyte(0));
+    List<dint> exhaustedCounts(dsize(TaskPool::batchCount(sectorCount)), 0);
 
-    for(int view = 0; view < map.sectorCount(); ++view)
-    for(int target = 0; target < view; ++target)
+    TaskPool::forBatches(sectorCount,
+                         [&cells, &sectorCells, &visibility, &exhaustedCounts, sectorCount, rowBytes]
+                         (int batch, int begin, int end)
     {
-        if(secGroups[view] == secGroups[target])
-            continue;
+        PortalFlow flow(cells, sectorCount);
+        for (int from = begin; from < end; ++from)
+        {
+            flow.run(sectorCells[from]);
+            if (flow.exhausted()) exhaustedCounts[batch]++;
 
-        // For symmetry, do two bits at a time.
-        int p1 = view * map.sectorCount() + target;
-        int p2 = target * map.sectorCount() + view;
+            dbyte *row = &visibility[from * rowBytes];
+            for (dint to = 0; to < sectorCount; ++to)
+            {
+                if (flow.visibleSectors[to]) row[to >> 3] |= 1 << (to & 7);
+            }
+        }
+    });
 
-        matrix[p1 >> 3] |= (1 << (p1 & 7));
-        matrix[p2 >> 3] |= (1 << (p2 & 7));
+    // A pair is rejected only if neither sector can see the other.
+    Block matrix((dsize(sectorCount) * sectorCount + 7) / 8);
+    matrix.fill(0);
+    dint rejected = 0;
+    for (dint view = 0; view < sectorCount; ++view)
+    {
+        for (dint target = 0; target < sectorCount; ++target)
+        {
+            const bool visible = (visibility[view   * rowBytes + (target >> 3)] & (1 << (target & 7))) ||
+                                 (visibility[target * rowBytes + (view   >> 3)] & (1 << (view   & 7)));
+            if (!visible)
+            {
+                const dsize p = dsize(view) * sectorCount + target;
+                matrix.data()[p >> 3] |= 1 << (p & 7);
+                rejected++;
+            }
+        }
     }
 
-    M_Free(secGroups);
+    dint exhausted = 0;
+    for (dint count : exhaustedCounts) exhausted += count;
 
+    LOG_MAP_VERBOSE("Built REJECT for %i sectors in %.2f seconds: %.1f%% of sector pairs rejected")
+        << sectorCount << startedAt.since()
+        << (sectorCount? 100.0 * rejected / (ddouble(sectorCount) * sectorCount) : 0.0);
+    if (exhausted)
+    {
+        LOG_MAP_WARNING("REJECT is incomplete: the sight flood of %i sectors exceeded %i steps, "
+                        "so every sector is considered visible from them")
+            << exhausted << FLOW_STEP_LIMIT;
+    }
     return matrix;
 }
-#endif
+
+} // namespace world
@@ -635,6 +635,13 @@ dint Sector::setProperty(const DmuArgs &args)
     return false;  // Continue iteration.
 }
 
+dsize Sector::memoryUsage() const
+{
+    return MapElement::memoryUsage() + sizeof(Sector) - sizeof(MapElement) + sizeof(Impl)
+         + d->audienceForLightLevelChange.allocatedSize()
+         + d->audienceForLightColorChange.allocatedSize();
+}
+
 D_CMD(InspectSector)
 {
     DE_UNUSED(src);
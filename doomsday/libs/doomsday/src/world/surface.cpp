@@ -509,6 +509,16 @@ dint Surface::setProperty(const DmuArgs &args)
     return false;  // Continue iteration.
 }
 
+dsize Surface::memoryUsage() const
+{
+    return MapElement::memoryUsage() + sizeof(Surface) - sizeof(MapElement) + sizeof(Impl)
+         + d->audienceForColorChange   .allocatedSize()
+         + d->audienceForMaterialChange.allocatedSize()
+         + d->audienceForNormalChange  .allocatedSize()
+         + d->audienceForOpacityChange .allocatedSize()
+         + d->audienceForOriginChange  .allocatedSize();
+}
+
 Surface::IDecorationState::~IDecorationState()
 {}
 
@@ -18,6 +18,7 @@
  */
 
 #include "doomsday/world/thinker.h"
+#include "doomsday/world/thinkerpool.h"
 
 #include <de/math.h>
 #include <de/legacy/memory.h>
@@ -41,6 +42,10 @@ DE_PIMPL_NOREF(Thinker)
             base = reinterpret_cast<thinker_s *>(M_Calloc(size));
             base->_flags = THINKF_STD_MALLOC;
         }
+        else if (alloc == AllocatePooled)
+        {
+            base = world::ThinkerPool::forSize(size).allocate();
+        }
         else // using memory zone
         {
             base = reinterpret_cast<thinker_s *>(Z_Calloc(size, PU_MAP, NULL));
@@ -51,11 +56,17 @@ DE_PIMPL_NOREF(Thinker)
 
     Impl(const Impl &other)
         : size(other.size)
-        , base(reinterpret_cast<thinker_s *>(other.base->_flags & THINKF_STD_MALLOC?
+        , base(other.base->_flags & THINKF_POOLED?
+                   world::ThinkerPool::forSize(size).allocate() :
+               reinterpret_cast<thinker_s *>(other.base->_flags & THINKF_STD_MALLOC?
                                                  M_MemDup(other.base, size) :
                                                  Z_MemDup(other.base, size)))
         , data(other.data? other.data->duplicate() : 0)
     {
+        if (other.base->_flags & THINKF_POOLED)
+        {
+            memcpy(base, other.base, size);
+        }
         base->d = data;
         if (data) data->setThinker(base);
     }
@@ -79,6 +90,10 @@ DE_PIMPL_NOREF(Thinker)
             {
                 M_Free(base);
             }
+            else if (base->_flags & THINKF_POOLED)
+            {
+                world::ThinkerPool::release(base);
+            }
             else
             {
                 Z_Free(base);
@@ -103,9 +118,9 @@ DE_PIMPL_NOREF(Thinker)
 
     static void clearBaseToZero(thinker_s *base, dsize size)
     {
-        const bool stdAlloc = CPP_BOOL(base->_flags & THINKF_STD_MALLOC);
+        const duint32 allocFlags = base->_flags & (THINKF_STD_MALLOC | THINKF_POOLED);
         memset(base, 0, size);
-        if (stdAlloc) base->_flags |= THINKF_STD_MALLOC;
+        base->_flags |= allocFlags;
     }
 };
 
@@ -144,8 +159,9 @@ Thinker::Thinker(const thinker_s &podThinker, dsize sizeInBytes, AllocMethod all
     memcpy(d->base, &podThinker, sizeInBytes);
 
     // Retain the original allocation flag, though.
-    d->base->_flags &= ~THINKF_STD_MALLOC;
+    d->base->_flags &= ~(THINKF_STD_MALLOC | THINKF_POOLED);
     if (alloc == AllocateStandard) d->base->_flags |= THINKF_STD_MALLOC;
+    if (alloc == AllocatePooled)   d->base->_flags |= THINKF_POOLED;
 
     if (podThinker.d)
     {
@@ -233,6 +249,10 @@ void Thinker::destroy(thinker_s *thinkerBase)
     {
         M_Free(thinkerBase);
     }
+    else if (thinkerBase->_flags & THINKF_POOLED)
+    {
+        world::ThinkerPool::release(thinkerBase);
+    }
     else
     {
         Z_Free(thinkerBase);
@@ -0,0 +1,157 @@
+/** @file thinkerpool.cpp  Slab allocator for thinkers.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "thinkerpool_private.h"
+
+#include <de/legacy/memory.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace de;
+
+namespace world {
+
+/// Set by ThinkerPool::clearAll(). Thinkers released after that are already gone.
+static bool poolsCleared = false;
+
+DE_PIMPL_NOREF(ThinkerPool)
+{
+    dsize thinkerSize;
+    dsize stride;     ///< Header and thinker, rounded up to 16 bytes.
+    dsize perSlab;
+    dsize count = 0;
+    std::vector<void *> slabs;
+    PooledThinkerHeader *freeList = nullptr;
+
+    Impl(dsize thinkerSize, dsize perSlab)
+        : thinkerSize(thinkerSize)
+        , stride(POOLED_HEADER_SIZE + ((thinkerSize + 15) & ~dsize(15)))
+        , perSlab(de::max(dsize(1), perSlab))
+    {}
+
+    ~Impl()
+    {
+        clear();
+    }
+
+    void addSlab(ThinkerPool &pool)
+    {
+        auto *slab = reinterpret_cast<dbyte *>(M_Malloc(stride * perSlab));
+        slabs.push_back(slab);
+
+        // Thinkers are handed out in ascending address order.
+        for (dsize i = perSlab; i-- > 0; )
+        {
+            auto *header = reinterpret_cast<PooledThinkerHeader *>(slab + i * stride);
+            header->pool     = &pool;
+            header->nextFree = freeList;
+            freeList = header;
+        }
+    }
+
+    void clear()
+    {
+        for (void *slab : slabs) M_Free(slab);
+        slabs.clear();
+        freeList = nullptr;
+        count    = 0;
+    }
+};
+
+ThinkerPool::ThinkerPool(dsize thinkerSize, dsize thinkersPerSlab)
+    : d(new Impl(thinkerSize, thinkersPerSlab))
+{}
+
+dsize ThinkerPool::thinkerSize() const
+{
+    return d->thinkerSize;
+}
+
+dsize ThinkerPool::count() const
+{
+    return d->count;
+}
+
+thinker_s *ThinkerPool::allocate()
+{
+    if (!d->freeList) d->addSlab(*this);
+
+    PooledThinkerHeader *header = d->freeList;
+    d->freeList = header->nextFree;
+    header->nextFree = nullptr;
+    header->list     = 0;
+    header->slot     = 0;
+    d->count++;
+    poolsCleared = false;
+
+    auto *th = reinterpret_cast<thinker_s *>(reinterpret_cast<dbyte *>(header) + POOLED_HEADER_SIZE);
+    memset(th, 0, d->thinkerSize);
+    th->_flags = THINKF_POOLED;
+    return th;
+}
+
+void ThinkerPool::clear()
+{
+    d->clear();
+}
+
+void ThinkerPool::release(thinker_s *th)
+{
+    if (!th) return;
+
+    // The memory of the thinker was freed together with its slab (e.g., while
+    // the map is being unloaded).
+    if (poolsCleared) return;
+
+    auto *header = pooledThinkerHeader(th);
+    DE_ASSERT(header);
+    auto &pool = *header->pool->d;
+    header->nextFree = pool.freeList;
+    pool.freeList = header;
+    DE_ASSERT(pool.count > 0);
+    pool.count--;
+}
+
+static std::vector<std::unique_ptr<ThinkerPool>> &thinkerPools()
+{
+    static std::vector<std::unique_ptr<ThinkerPool>> pools;
+    return pools;
+}
+
+ThinkerPool &ThinkerPool::forSize(dsize thinkerSize)
+{
+    // There are only a few different sizes.
+    for (auto &pool : thinkerPools())
+    {
+        if (pool->thinkerSize() == thinkerSize) return *pool;
+    }
+    thinkerPools().emplace_back(new ThinkerPool(thinkerSize));
+    return *thinkerPools().back();
+}
+
+void ThinkerPool::clearAll()
+{
+    for (auto &pool : thinkerPools())
+    {
+        pool->clear();
+    }
+    poolsCleared = true;
+}
+
+} // namespace world
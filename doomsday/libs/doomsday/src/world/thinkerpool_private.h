@@ -0,0 +1,53 @@
+/** @file thinkerpool_private.h  Bookkeeping of pooled thinkers (engine-internal).
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#pragma once
+
+#include "doomsday/world/thinker.h"
+#include "doomsday/world/thinkerpool.h"
+
+namespace world {
+
+/**
+ * Header in front of each pooled thinker. Besides the free list of the pool, it
+ * holds the position of the thinker in its thinker list so that Thinkers can
+ * unlink it without searching. This is kept out of thinker_s, whose layout is
+ * part of the public API.
+ */
+struct PooledThinkerHeader
+{
+    ThinkerPool *        pool;
+    PooledThinkerHeader *nextFree;
+    de::dint32           list; ///< Thinker list the thinker is linked to, plus one.
+    de::dint32           slot; ///< Position in the member array of the list.
+};
+
+/// The thinker that follows the header must be suitably aligned.
+static const de::dsize POOLED_HEADER_SIZE = (sizeof(PooledThinkerHeader) + 15) & ~de::dsize(15);
+
+/**
+ * Returns the header of a thinker allocated from a ThinkerPool, or @c nullptr if
+ * @a th was allocated in some other way.
+ */
+inline PooledThinkerHeader *pooledThinkerHeader(thinker_s *th)
+{
+    if (!(th->_flags & THINKF_POOLED)) return nullptr;
+    return reinterpret_cast<PooledThinkerHeader *>(reinterpret_cast<de::dbyte *>(th) - POOLED_HEADER_SIZE);
+}
+
+} // namespace world
@@ -25,9 +25,11 @@
 #include "doomsday/world/world.h"
 #include "doomsday/world/thinkerdata.h"
 #include "doomsday/doomsdayapp.h"
+#include "thinkerpool_private.h"
 
 #include <de/legacy/memoryzone.h>
 #include <de/list.h>
+#include <vector>
 
 using namespace de;
 
@@ -50,13 +52,29 @@ world::Map &Thinker_Map(const thinker_t & /*th*/)
 
 namespace world {
 
+/**
+ * Thinkers of one think function. In addition to the intrusive links of the
+ * thinkers themselves, the list keeps a dense array of member pointers in link
+ * order so that the per-tic iteration does not have to chase pointers across
+ * the heap. Unlinked members leave a hole in the array; holes are compacted
+ * away (preserving the order) when no iteration of the list is in progress.
+ *
+ * Pooled members know their list and their position in the array (see
+ * PooledThinkerHeader), so unlinking them does not need to search.
+ */
 struct ThinkerList
 {
     bool isPublic; ///< All thinkers in this list are visible publically.
+    dint index;    ///< Position in Thinkers' lists.
 
     Thinker sentinel;
+    List<thinker_t *> members;  ///< In link order; @c nullptr for unlinked ones.
+    dint holes     = 0;         ///< Number of @c nullptr entries in members.
+    dint iterating = 0;         ///< Depth of ongoing iterations.
 
-    ThinkerList(thinkfunc_t func, bool isPublic) : isPublic(isPublic)
+    ThinkerList(thinkfunc_t func, bool isPublic, dint index)
+        : isPublic(isPublic)
+        , index(index)
     {
         sentinel.function = func;
         sentinel.disable(); // Safety measure.
@@ -67,6 +85,8 @@ struct ThinkerList
     void reinit()
     {
         sentinel.prev = sentinel.next = sentinel;
+        members.clear();
+        holes = 0;
     }
 
     thinkfunc_t function() const
@@ -81,33 +101,107 @@ struct ThinkerList
         th.next = sentinel;
         th.prev = sentinel.prev;
         sentinel.prev = &th;
+
+        if (auto *pooled = pooledThinkerHeader(&th))
+        {
+            pooled->list = index + 1;
+            pooled->slot = members.sizei();
+        }
+        members.append(&th);
     }
 
-    dint count(dint *numInStasis) const
+    /**
+     * Returns the position of @a th in the members, or -1 if it is not a member.
+     */
+    dint find(thinker_t &th) const
     {
-        dint num = 0;
-        thinker_t *th = sentinel.next;
-        while (th != &sentinel.base() && th)
+        if (const auto *pooled = pooledThinkerHeader(&th))
         {
+            if (pooled->list == index + 1 && pooled->slot >= 0 &&
+                pooled->slot < members.sizei() && members[pooled->slot] == &th)
+            {
+                return pooled->slot;
+            }
+            return -1;
+        }
+        return members.indexOf(&th);
+    }
+
+    void unlink(thinker_t &th, dint pos)
+    {
+        DE_ASSERT(members[pos] == &th);
+
+        th.next->prev = th.prev;
+        th.prev->next = th.next;
+
+        members[pos] = nullptr;
+        holes++;
+        if (auto *pooled = pooledThinkerHeader(&th))
+        {
+            pooled->list = 0;
+            pooled->slot = 0;
+        }
+    }
+
+    void compact()
+    {
+        if (holes && !iterating)
+        {
+            members.removeAll(nullptr);
+            holes = 0;
+            for (dint i = 0; i < members.sizei(); ++i)
+            {
+                if (auto *pooled = pooledThinkerHeader(members[i]))
+                {
+                    pooled->slot = i;
+                }
+            }
+        }
+    }
+
+    LoopResult forAll(const std::function<LoopResult (thinker_t *)> &func)
+    {
+        compact();
+
+        LoopResult result = LoopContinue;
+        iterating++;
+        // Thinkers linked during the iteration are appended and will be visited, too.
+        for (dint i = 0; i < members.sizei(); ++i)
+        {
+            if (thinker_t *th = members[i])
+            {
 #ifdef DE_FAKE_MEMORY_ZONE
-            DE_ASSERT(th->next);
-            DE_ASSERT(th->prev);
+                DE_ASSERT(th->next);
+                DE_ASSERT(th->prev);
 #endif
-            num += 1;
-            if (numInStasis && Thinker_InStasis(th))
+                if ((result = func(th))) break;
+            }
+        }
+        iterating--;
+        return result;
+    }
+
+    dint count(dint *numInStasis) const
+    {
+        const dint num = members.sizei() - holes;
+        if (numInStasis)
+        {
+            for (const thinker_t *th : members)
             {
-                (*numInStasis) += 1;
+                if (th && Thinker_InStasis(th))
+                {
+                    (*numInStasis) += 1;
+                }
             }
-            th = th->next;
         }
         return num;
     }
 
     void releaseAll()
     {
-        for (thinker_t *th = sentinel.next; th != &sentinel.base() && th; th = th->next)
+        for (thinker_t *th : members)
         {
-            Thinker::release(*th);
+            if (th) Thinker::release(*th);
         }
     }
 };
@@ -119,8 +213,11 @@ DE_PIMPL(Thinkers)
 
     std::function<void (thinker_t &)> idAssignor;
     List<ThinkerList *>       lists;
-    Hash<thid_t, mobj_t *>    mobjIdLookup;    ///< public only
-    Hash<thid_t, thinker_t *> thinkerIdLookup; ///< all thinkers with ID
+    Hash<thinkfunc_t, ThinkerList *> listIndex[2]; ///< [private, public]
+    // Thinker IDs are dealt out in increasing order, so they are used directly as
+    // indices for looking up thinkers.
+    std::vector<mobj_t *>     mobjIdLookup;    ///< public only
+    std::vector<thinker_t *>  thinkerIdLookup; ///< all thinkers with ID
 
     bool inited = false;
 
@@ -140,6 +237,13 @@ DE_PIMPL(Thinkers)
         deleteAll(lists);
     }
 
+    void clearLists()
+    {
+        lists.clear();
+        listIndex[0].clear();
+        listIndex[1].clear();
+    }
+
     void releaseAllThinkers()
     {
         thinkerIdLookup.clear();
@@ -173,18 +277,37 @@ DE_PIMPL(Thinkers)
     ThinkerList *listForThinkFunc(thinkfunc_t func, bool makePublic = true,
                                   bool canCreate = false)
     {
-        for (dint i = 0; i < lists.count(); ++i)
+        auto &index = listIndex[makePublic? 1 : 0];
+        auto found = index.find(func);
+        if (found != index.end())
         {
-            ThinkerList *list = lists[i];
-            if (list->function() == func && list->isPublic == makePublic)
-                return list;
+            return found->second;
         }
 
         if (!canCreate) return nullptr;
 
         // A new thinker type.
-        lists.append(new ThinkerList(func, makePublic));
-        return lists.last();
+        auto *list = new ThinkerList(func, makePublic, lists.sizei());
+        lists.append(list);
+        index.insert(func, list);
+        return list;
+    }
+
+    template <typename T>
+    static void setById(std::vector<T *> &lookup, thid_t id, T *ptr)
+    {
+        if (id >= lookup.size())
+        {
+            if (!ptr) return;
+            lookup.resize(de::max(dsize(id) + 1, lookup.size() * 2));
+        }
+        lookup[id] = ptr;
+    }
+
+    template <typename T>
+    static T *findById(const std::vector<T *> &lookup, thid_t id)
+    {
+        return id < lookup.size()? lookup[id] : nullptr;
     }
 
     DE_PIMPL_AUDIENCE(Removal)
@@ -215,22 +338,13 @@ void Thinkers::setMobjId(thid_t id, bool inUse)
 
 struct mobj_s *Thinkers::mobjById(dint id)
 {
-    auto found = d->mobjIdLookup.find(thid_t(id));
-    if (found != d->mobjIdLookup.end())
-    {
-        return found->second;
-    }
-    return nullptr;
+    if (id < 0) return nullptr;
+    return Impl::findById(d->mobjIdLookup, thid_t(id));
 }
 
 thinker_t *Thinkers::find(thid_t id)
 {
-    auto found = d->thinkerIdLookup.find(id);
-    if (found != d->thinkerIdLookup.end())
-    {
-        return found->second;
-    }
-    return nullptr;
+    return Impl::findById(d->thinkerIdLookup, id);
 }
 
 void Thinkers::add(thinker_t &th, bool makePublic)
@@ -254,7 +368,7 @@ void Thinkers::add(thinker_t &th, bool makePublic)
 
         if (makePublic && th.id)
         {
-            d->mobjIdLookup.insert(th.id, reinterpret_cast<mobj_t *>(&th));
+            Impl::setById(d->mobjIdLookup, th.id, reinterpret_cast<mobj_t *>(&th));
         }
     }
     else
@@ -264,7 +378,7 @@ void Thinkers::add(thinker_t &th, bool makePublic)
 
     if (th.id)
     {
-        d->thinkerIdLookup.insert(th.id, &th);
+        Impl::setById(d->thinkerIdLookup, th.id, &th);
     }
 
     // Link the thinker to the thinker list.
@@ -280,8 +394,8 @@ void Thinkers::remove(thinker_t &th)
         // Flag the identifier as free.
         setMobjId(th.id, false);
 
-        d->mobjIdLookup.remove(th.id);
-        d->thinkerIdLookup.remove(th.id);
+        Impl::setById<mobj_t>(d->mobjIdLookup, th.id, nullptr);
+        Impl::setById<thinker_t>(d->thinkerIdLookup, th.id, nullptr);
 
         DE_NOTIFY(Removal, i) i->thinkerRemoved(th);
     }
@@ -291,11 +405,37 @@ void Thinkers::remove(thinker_t &th)
     Thinker::release(th);
 }
 
+void Thinkers::unlink(thinker_t &th)
+{
+    // Removed thinkers have had their function cleared, so the list of a pooled
+    // thinker is found via its header. Others are searched for.
+    if (const auto *pooled = pooledThinkerHeader(&th))
+    {
+        const dint listIndex = pooled->list - 1;
+        if (listIndex >= 0 && listIndex < d->lists.sizei())
+        {
+            ThinkerList *list = d->lists[listIndex];
+            const dint pos = list->find(th);
+            if (pos >= 0) list->unlink(th, pos);
+        }
+        return;
+    }
+    for (ThinkerList *list : d->lists)
+    {
+        const dint pos = list->find(th);
+        if (pos >= 0)
+        {
+            list->unlink(th, pos);
+            return;
+        }
+    }
+}
+
 void Thinkers::initLists(dbyte flags)
 {
     if (!d->inited)
     {
-        d->lists.clear();
+        d->clearLists();
     }
     else
     {
@@ -330,20 +470,8 @@ LoopResult Thinkers::forAll(dbyte flags, const std::function<LoopResult (thinker
         if ( list->isPublic && !(flags & 0x1)) continue;
         if (!list->isPublic && !(flags & 0x2)) continue;
 
-        thinker_t *th = list->sentinel.next;
-        while (th != &list->sentinel.base() && th)
-        {
-#ifdef DE_FAKE_MEMORY_ZONE
-            DE_ASSERT(th->next);
-            DE_ASSERT(th->prev);
-#endif
-            thinker_t *next = th->next;
-
-            if (auto result = func(th))
-                return result;
-
-            th = next;
-        }
+        if (auto result = list->forAll(func))
+            return result;
     }
 
     return LoopContinue;
@@ -364,40 +492,16 @@ LoopResult Thinkers::forAll(thinkfunc_t thinkFunc,
     {
         if (ThinkerList *list = d->listForThinkFunc(thinkFunc))
         {
-            thinker_t *th = list->sentinel.next;
-            while (th != &list->sentinel.base() && th)
-            {
-#ifdef DE_FAKE_MEMORY_ZONE
-                DE_ASSERT(th->next);
-                DE_ASSERT(th->prev);
-#endif
-                thinker_t *next = th->next;
-
-                if (auto result = func(th))
-                    return result;
-
-                th = next;
-            }
+            if (auto result = list->forAll(func))
+                return result;
         }
     }
     if (flags & 0x2 /*private*/)
     {
         if (ThinkerList *list = d->listForThinkFunc(thinkFunc, false /*private*/))
         {
-            thinker_t *th = list->sentinel.next;
-            while (th != &list->sentinel.base() && th)
-            {
-#ifdef DE_FAKE_MEMORY_ZONE
-                DE_ASSERT(th->next);
-                DE_ASSERT(th->prev);
-#endif
-                thinker_t *next = th->next;
-
-                if (auto result = func(th))
-                    return result;
-
-                th = next;
-            }
+            if (auto result = list->forAll(func))
+                return result;
         }
     }
 
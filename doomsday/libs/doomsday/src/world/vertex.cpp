@@ -106,4 +106,10 @@ LineOwner *Vertex::firstLineOwner() const
     return _lineOwners;
 }
 
+dsize Vertex::memoryUsage() const
+{
+    return MapElement::memoryUsage() + sizeof(Vertex) - sizeof(MapElement)
+         + audienceForOriginChange.allocatedSize();
+}
+
 } // namespace world
@@ -28,6 +28,7 @@
 #include "doomsday/world/sector.h"
 #include "doomsday/world/sky.h"
 #include "doomsday/world/thinkers.h"
+#include "doomsday/world/thinkerpool.h"
 #include "doomsday/world/surface.h"
 #include "doomsday/console/exec.h"
 #include "doomsday/defs/ded.h"
@@ -53,6 +54,7 @@ static World *theWorld = nullptr;
 
 int World::ddMapSetup = false;
 int World::validCount = 1;
+int World::geometryStamp = 0;
 
 DE_PIMPL(World)
 {
@@ -224,8 +226,10 @@ DE_PIMPL(World)
     {
         scheduler.clear();
         map.reset();
-        Z_FreeTags(PU_MAP, PU_PURGELEVEL - 1);
+        // Pooled thinkers go before the rest of the map's memory.
+        ThinkerPool::clearAll();
         unusedMobjList = nullptr;
+        Z_FreeTags(PU_MAP, PU_PURGELEVEL - 1);
 
         // Are we just unloading the current map?
         if (!mapManifest) return true;
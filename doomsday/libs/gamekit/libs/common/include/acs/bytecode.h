@@ -0,0 +1,484 @@
+/** @file bytecode.h  Action Code Script (ACS) pre-decoded bytecode.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#ifndef LIBCOMMON_ACS_BYTECODE_H
+#define LIBCOMMON_ACS_BYTECODE_H
+
+#include <de/block.h>
+#include <de/error.h>
+#include <de/keymap.h>
+#include <de/list.h>
+
+/**
+ * ACS commands in opcode order: name, number of operands, and whether the command
+ * is executed directly by Bytecode::execute() (Vm) or passed on to the
+ * interpreter (Host).
+ */
+#define ACS_OPCODES(X) \
+    X(NOP,                  0, Vm)   \
+    X(Terminate,            0, Vm)   \
+    X(Suspend,              0, Host) \
+    X(PushNumber,           1, Vm)   \
+    X(LSpec1,               1, Host) \
+    X(LSpec2,               1, Host) \
+    X(LSpec3,               1, Host) \
+    X(LSpec4,               1, Host) \
+    X(LSpec5,               1, Host) \
+    X(LSpec1Direct,         2, Host) \
+    X(LSpec2Direct,         3, Host) \
+    X(LSpec3Direct,         4, Host) \
+    X(LSpec4Direct,         5, Host) \
+    X(LSpec5Direct,         6, Host) \
+    X(Add,                  0, Vm)   \
+    X(Subtract,             0, Vm)   \
+    X(Multiply,             0, Vm)   \
+    X(Divide,               0, Vm)   \
+    X(Modulus,              0, Vm)   \
+    X(EQ,                   0, Vm)   \
+    X(NE,                   0, Vm)   \
+    X(LT,                   0, Vm)   \
+    X(GT,                   0, Vm)   \
+    X(LE,                   0, Vm)   \
+    X(GE,                   0, Vm)   \
+    X(AssignScriptVar,      1, Vm)   \
+    X(AssignMapVar,         1, Vm)   \
+    X(AssignWorldVar,       1, Vm)   \
+    X(PushScriptVar,        1, Vm)   \
+    X(PushMapVar,           1, Vm)   \
+    X(PushWorldVar,         1, Vm)   \
+    X(AddScriptVar,         1, Vm)   \
+    X(AddMapVar,            1, Vm)   \
+    X(AddWorldVar,          1, Vm)   \
+    X(SubScriptVar,         1, Vm)   \
+    X(SubMapVar,            1, Vm)   \
+    X(SubWorldVar,          1, Vm)   \
+    X(MulScriptVar,         1, Vm)   \
+    X(MulMapVar,            1, Vm)   \
+    X(MulWorldVar,          1, Vm)   \
+    X(DivScriptVar,         1, Vm)   \
+    X(DivMapVar,            1, Vm)   \
+    X(DivWorldVar,          1, Vm)   \
+    X(ModScriptVar,         1, Vm)   \
+    X(ModMapVar,            1, Vm)   \
+    X(ModWorldVar,          1, Vm)   \
+    X(IncScriptVar,         1, Vm)   \
+    X(IncMapVar,            1, Vm)   \
+    X(IncWorldVar,          1, Vm)   \
+    X(DecScriptVar,         1, Vm)   \
+    X(DecMapVar,            1, Vm)   \
+    X(DecWorldVar,          1, Vm)   \
+    X(Goto,                 1, Vm)   \
+    X(IfGoto,               1, Vm)   \
+    X(Drop,                 0, Vm)   \
+    X(Delay,                0, Vm)   \
+    X(DelayDirect,          1, Vm)   \
+    X(Random,               0, Host) \
+    X(RandomDirect,         2, Host) \
+    X(ThingCount,           0, Host) \
+    X(ThingCountDirect,     2, Host) \
+    X(TagWait,              0, Host) \
+    X(TagWaitDirect,        1, Host) \
+    X(PolyWait,             0, Host) \
+    X(PolyWaitDirect,       1, Host) \
+    X(ChangeFloor,          0, Host) \
+    X(ChangeFloorDirect,    2, Host) \
+    X(ChangeCeiling,        0, Host) \
+    X(ChangeCeilingDirect,  2, Host) \
+    X(Restart,              0, Host) \
+    X(AndLogical,           0, Vm)   \
+    X(OrLogical,            0, Vm)   \
+    X(AndBitwise,           0, Vm)   \
+    X(OrBitwise,            0, Vm)   \
+    X(EorBitwise,           0, Vm)   \
+    X(NegateLogical,        0, Vm)   \
+    X(LShift,               0, Vm)   \
+    X(RShift,               0, Vm)   \
+    X(UnaryMinus,           0, Vm)   \
+    X(IfNotGoto,            1, Vm)   \
+    X(LineSide,             0, Host) \
+    X(ScriptWait,           0, Host) \
+    X(ScriptWaitDirect,     1, Host) \
+    X(ClearLineSpecial,     0, Host) \
+    X(CaseGoto,             2, Vm)   \
+    X(BeginPrint,           0, Host) \
+    X(EndPrint,             0, Host) \
+    X(PrintString,          0, Host) \
+    X(PrintNumber,          0, Host) \
+    X(PrintCharacter,       0, Host) \
+    X(PlayerCount,          0, Host) \
+    X(GameType,             0, Host) \
+    X(GameSkill,            0, Host) \
+    X(Timer,                0, Host) \
+    X(SectorSound,          0, Host) \
+    X(AmbientSound,         0, Host) \
+    X(SoundSequence,        0, Host) \
+    X(SetLineTexture,       0, Host) \
+    X(SetLineBlocking,      0, Host) \
+    X(SetLineSpecial,       0, Host) \
+    X(ThingSound,           0, Host) \
+    X(EndPrintBold,         0, Host)
+
+// GCC and Clang support taking the address of a label, so each command can jump
+// directly to the next one. Elsewhere a switch is used.
+#if defined(__GNUC__)
+#  define ACS_THREADED_DISPATCH
+#endif
+
+namespace acs {
+
+/// Status to return from ACScript command functions.
+enum CommandResult
+{
+    Continue,
+    Stop,
+    Terminate
+};
+
+/**
+ * ACS bytecode translated into a stream of fixed-size instructions.
+ *
+ * The code reachable from the script entry points is decoded once when a module
+ * is loaded. Operands are read in advance, and jump targets are resolved to
+ * instruction indices. Each linear run of code is stored contiguously; where a
+ * run flows into code that has already been decoded, an explicit Goto is
+ * inserted.
+ *
+ * Every instruction remembers the offset of the original instruction in the
+ * bytecode. Saved games refer to code positions using these offsets.
+ *
+ * @ingroup playsim
+ */
+class Bytecode
+{
+    DE_NO_COPY  (Bytecode)
+    DE_NO_ASSIGN(Bytecode)
+
+public:
+    /// There is no instruction at the specified bytecode offset. @ingroup errors
+    DE_ERROR(MissingInstructionError);
+
+    /// An instruction with an unknown opcode was executed. @ingroup errors
+    DE_ERROR(UnknownCommandError);
+
+    enum class Opcode : de::dint32
+    {
+#define ACS_OPCODE_ENUM(Name, Operands, Handler) Name,
+        ACS_OPCODES(ACS_OPCODE_ENUM)
+#undef ACS_OPCODE_ENUM
+        Invalid ///< Unknown opcode, or the operands are missing.
+    };
+
+    static constexpr int MAX_OPERANDS = 6;
+
+    struct Instruction
+    {
+        Opcode opcode;
+        de::dint32 pcodeOffset;              ///< Offset of the original instruction.
+        de::dint32 operands[MAX_OPERANDS];   ///< Jump targets are instruction indices.
+    };
+
+public:
+    Bytecode() = default;
+
+    /**
+     * Decodes all code reachable from the given entry points. Unknown opcodes are
+     * not errors until they are executed.
+     *
+     * @param pcode         ACS bytecode.
+     * @param entryOffsets  Offsets of the script entry points.
+     */
+    void decode(const de::Block &pcode, const de::List<de::dint32> &entryOffsets);
+
+    int instructionCount() const;
+
+    /**
+     * Returns the instruction decoded from @a pcodeOffset in the bytecode.
+     */
+    const Instruction *at(de::dint32 pcodeOffset) const;
+
+    static int operandCount(Opcode opcode);
+
+    /**
+     * Executes instructions starting from @a machine.ip until a command returns
+     * something else than Continue. Stack, arithmetic, variable, jump, and delay
+     * commands are executed here. The rest are passed on to
+     * @a machine.command(), which may also change @a machine.ip.
+     *
+     * @param machine    Interpreter state: @c ip, @c locals, @c args, @c delayCount,
+     *                   and the method @c command(const Instruction &).
+     * @param mapVars    Map variables.
+     * @param worldVars  World variables.
+     *
+     * @return Result of the command that stopped execution.
+     */
+    template <typename Machine>
+    CommandResult execute(Machine &machine, de::dint32 *mapVars, de::dint32 *worldVars) const;
+
+private:
+    void unknownCommand(const Instruction &insn) const;
+
+    de::List<Instruction> _code;
+    de::KeyMap<de::dint32, de::dint32> _indexByOffset;
+};
+
+#ifdef ACS_THREADED_DISPATCH
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wpedantic" // labels as values
+#endif
+
+template <typename Machine>
+CommandResult Bytecode::execute(Machine &m, de::dint32 *mapVars, de::dint32 *worldVars) const
+{
+    const Instruction *const code = _code.data();
+    const Instruction *ip = m.ip;
+    const Instruction *insn;
+    auto &locals = m.locals;
+
+#ifdef ACS_THREADED_DISPATCH
+#   define ACS_TARGET_Vm(Name)    &&op_##Name
+#   define ACS_TARGET_Host(Name)  &&op_command
+#   define ACS_OPCODE_TARGET(Name, Operands, Handler) ACS_TARGET_##Handler(Name),
+    static const void *const targets[] = {
+        ACS_OPCODES(ACS_OPCODE_TARGET)
+        &&op_Invalid
+    };
+#   undef ACS_OPCODE_TARGET
+#   undef ACS_TARGET_Host
+#   undef ACS_TARGET_Vm
+#   define ACS_CASE(Name)     op_##Name
+#   define ACS_CASE_COMMAND   op_command
+#   define ACS_NEXT()         insn = ip++; goto *targets[int(insn->opcode)]
+    ACS_NEXT();
+#else
+#   define ACS_CASE(Name)     case Opcode::Name
+#   define ACS_CASE_COMMAND   default
+#   define ACS_NEXT()         continue
+    for (;;)
+    {
+        insn = ip++;
+        switch (insn->opcode)
+        {
+#endif
+
+    ACS_CASE(NOP):
+        ACS_NEXT();
+
+    ACS_CASE(Terminate):
+        m.ip = ip;
+        return Terminate;
+
+    ACS_CASE(PushNumber):
+        locals.push(insn->operands[0]);
+        ACS_NEXT();
+
+    ACS_CASE(Add):
+        locals.push(locals.pop() + locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(Subtract): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() - operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(Multiply):
+        locals.push(locals.pop() * locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(Divide): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() / operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(Modulus): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() % operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(EQ):
+        locals.push(locals.pop() == locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(NE):
+        locals.push(locals.pop() != locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(LT): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() < operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(GT): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() > operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(LE): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() <= operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(GE): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() >= operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(AssignScriptVar): m.args   [insn->operands[0]] = locals.pop(); ACS_NEXT();
+    ACS_CASE(AssignMapVar):    mapVars  [insn->operands[0]] = locals.pop(); ACS_NEXT();
+    ACS_CASE(AssignWorldVar):  worldVars[insn->operands[0]] = locals.pop(); ACS_NEXT();
+
+    ACS_CASE(PushScriptVar):   locals.push(m.args   [insn->operands[0]]); ACS_NEXT();
+    ACS_CASE(PushMapVar):      locals.push(mapVars  [insn->operands[0]]); ACS_NEXT();
+    ACS_CASE(PushWorldVar):    locals.push(worldVars[insn->operands[0]]); ACS_NEXT();
+
+    ACS_CASE(AddScriptVar):    m.args   [insn->operands[0]] += locals.pop(); ACS_NEXT();
+    ACS_CASE(AddMapVar):       mapVars  [insn->operands[0]] += locals.pop(); ACS_NEXT();
+    ACS_CASE(AddWorldVar):     worldVars[insn->operands[0]] += locals.pop(); ACS_NEXT();
+
+    ACS_CASE(SubScriptVar):    m.args   [insn->operands[0]] -= locals.pop(); ACS_NEXT();
+    ACS_CASE(SubMapVar):       mapVars  [insn->operands[0]] -= locals.pop(); ACS_NEXT();
+    ACS_CASE(SubWorldVar):     worldVars[insn->operands[0]] -= locals.pop(); ACS_NEXT();
+
+    ACS_CASE(MulScriptVar):    m.args   [insn->operands[0]] *= locals.pop(); ACS_NEXT();
+    ACS_CASE(MulMapVar):       mapVars  [insn->operands[0]] *= locals.pop(); ACS_NEXT();
+    ACS_CASE(MulWorldVar):     worldVars[insn->operands[0]] *= locals.pop(); ACS_NEXT();
+
+    ACS_CASE(DivScriptVar):    m.args   [insn->operands[0]] /= locals.pop(); ACS_NEXT();
+    ACS_CASE(DivMapVar):       mapVars  [insn->operands[0]] /= locals.pop(); ACS_NEXT();
+    ACS_CASE(DivWorldVar):     worldVars[insn->operands[0]] /= locals.pop(); ACS_NEXT();
+
+    ACS_CASE(ModScriptVar):    m.args   [insn->operands[0]] %= locals.pop(); ACS_NEXT();
+    ACS_CASE(ModMapVar):       mapVars  [insn->operands[0]] %= locals.pop(); ACS_NEXT();
+    ACS_CASE(ModWorldVar):     worldVars[insn->operands[0]] %= locals.pop(); ACS_NEXT();
+
+    ACS_CASE(IncScriptVar):    m.args   [insn->operands[0]]++; ACS_NEXT();
+    ACS_CASE(IncMapVar):       mapVars  [insn->operands[0]]++; ACS_NEXT();
+    ACS_CASE(IncWorldVar):     worldVars[insn->operands[0]]++; ACS_NEXT();
+
+    ACS_CASE(DecScriptVar):    m.args   [insn->operands[0]]--; ACS_NEXT();
+    ACS_CASE(DecMapVar):       mapVars  [insn->operands[0]]--; ACS_NEXT();
+    ACS_CASE(DecWorldVar):     worldVars[insn->operands[0]]--; ACS_NEXT();
+
+    ACS_CASE(Goto):
+        ip = code + insn->operands[0];
+        ACS_NEXT();
+
+    ACS_CASE(IfGoto):
+        if (locals.pop())
+        {
+            ip = code + insn->operands[0];
+        }
+        ACS_NEXT();
+
+    ACS_CASE(IfNotGoto):
+        if (!locals.pop())
+        {
+            ip = code + insn->operands[0];
+        }
+        ACS_NEXT();
+
+    ACS_CASE(CaseGoto):
+        if (locals.top() == insn->operands[0])
+        {
+            ip = code + insn->operands[1];
+            locals.drop();
+        }
+        ACS_NEXT();
+
+    ACS_CASE(Drop):
+        locals.drop();
+        ACS_NEXT();
+
+    ACS_CASE(Delay):
+        m.delayCount = locals.pop();
+        m.ip = ip;
+        return Stop;
+
+    ACS_CASE(DelayDirect):
+        m.delayCount = insn->operands[0];
+        m.ip = ip;
+        return Stop;
+
+    // Note: the logical operators only pop the second operand if needed.
+    ACS_CASE(AndLogical):
+        locals.push(locals.pop() && locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(OrLogical):
+        locals.push(locals.pop() || locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(AndBitwise):
+        locals.push(locals.pop() & locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(OrBitwise):
+        locals.push(locals.pop() | locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(EorBitwise):
+        locals.push(locals.pop() ^ locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(NegateLogical):
+        locals.push(!locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(LShift): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() << operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(RShift): {
+        const int operand2 = locals.pop();
+        locals.push(locals.pop() >> operand2);
+        ACS_NEXT(); }
+
+    ACS_CASE(UnaryMinus):
+        locals.push(-locals.pop());
+        ACS_NEXT();
+
+    ACS_CASE(Invalid):
+        m.ip = ip;
+        unknownCommand(*insn);
+        return Terminate;
+
+    ACS_CASE_COMMAND: {
+        m.ip = ip;
+        const CommandResult result = m.command(*insn);
+        if (result != Continue) return result;
+        ip = m.ip;
+        ACS_NEXT(); }
+
+#ifndef ACS_THREADED_DISPATCH
+        }
+    }
+#endif
+
+#undef ACS_NEXT
+#undef ACS_CASE_COMMAND
+#undef ACS_CASE
+}
+
+#ifdef ACS_THREADED_DISPATCH
+#  pragma GCC diagnostic pop
+#endif
+
+} // namespace acs
+
+#endif // LIBCOMMON_ACS_BYTECODE_H
@@ -54,13 +54,37 @@ struct Interpreter
         int values[ACS_INTERPRETER_SCRIPT_STACK_DEPTH];
         int height;
 
-        void push(int value);
-        int pop();
-        int top() const;
-        void drop();
+        // Inline so that Bytecode::execute() needs no calls for stack operations.
+        inline void push(int value) {
+            if (height >= ACS_INTERPRETER_SCRIPT_STACK_DEPTH) {
+                overflow("push");
+                return;
+            }
+            values[height++] = value;
+        }
+        inline int pop() {
+            if (height <= 0) {
+                underflow("pop");
+                return 0;
+            }
+            return values[--height];
+        }
+        inline int top() const {
+            if (height == 0) {
+                underflow("top");
+                return 0;
+            }
+            return values[height - 1];
+        }
+        inline void drop() {
+            if (height == 0) underflow("drop");
+            height--;
+        }
+        static void overflow(const char *operation);
+        static void underflow(const char *operation);
     } locals;
     int args[ACS_INTERPRETER_MAX_SCRIPT_ARGS];
-    const int *pcodePtr;
+    const Bytecode::Instruction *ip; ///< Next instruction to execute.
 
     System &scriptSys() const;
 
@@ -71,6 +95,14 @@ struct Interpreter
 
     void think();
 
+    /**
+     * Executes one of the commands that Bytecode::execute() passes on to the
+     * interpreter, i.e., the ones that interact with the map.
+     *
+     * @param insn  Instruction to execute. @ref ip has already been moved past it.
+     */
+    CommandResult command(const Bytecode::Instruction &insn);
+
     /**
      * Deserialize the thinker using the given data reader @msr.
      */
@@ -27,6 +27,7 @@
 #include <de/block.h>
 #include <de/error.h>
 #include <de/string.h>
+#include "acs/bytecode.h"
 
 namespace acs {
 
@@ -53,7 +54,7 @@ public:
      */
     struct EntryPoint
     {
-        const int *pcodePtr       = nullptr;
+        const Bytecode::Instruction *code = nullptr;
         bool startWhenMapBegins   = false;
         de::dint32 scriptNumber   = 0;
         de::dint32 scriptArgCount = 0;
@@ -107,6 +108,11 @@ public:
      */
     const de::Block &pcode() const;
 
+    /**
+     * Provides readonly access to the bytecode decoded for execution.
+     */
+    const Bytecode &bytecode() const;
+
 private:
     Module();
 
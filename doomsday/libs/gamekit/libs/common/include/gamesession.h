@@ -188,6 +188,11 @@ public:  // Saved session management -------------------------------------------
     /**
      * Save the current game state to a new @em user saved session.
      *
+     * The game state is captured immediately, but the saved session is compressed and
+     * written to disk in the background. DD_NOTIFY_GAME_SAVED is sent once the
+     * saved session is complete. A save requested while the previous one is still
+     * being written waits for it to complete first.
+     *
      * @param saveName         Name of the new saved session.
      * @param userDescription  Textual description of the current game state provided either
      *                         by the user or possibly generated automatically.
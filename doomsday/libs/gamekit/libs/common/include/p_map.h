@@ -56,6 +56,20 @@ extern "C" {
  */
 dd_bool P_CheckSight(const mobj_t *beholder, const mobj_t *target);
 
+/**
+ * Prepares the sector-to-sector line-of-sight REJECT matrix of the current map for
+ * use by P_CheckSight(). Called during map setup.
+ */
+void P_InitRejectMatrix();
+
+/**
+ * Evaluates ahead of time the line-of-sight checks that monsters are likely to make
+ * during the current tic. The traces are done concurrently; P_CheckSight() will use
+ * a precomputed result only if nothing affecting it has changed since. Called before
+ * the thinkers are run.
+ */
+void P_PrecomputeSight();
+
 /**
  * Determines the world space angle between the points @a from and @a to.
  *
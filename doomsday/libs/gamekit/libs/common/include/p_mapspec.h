@@ -26,7 +26,8 @@
 #include "doomsday.h"
 #include "p_iterlist.h"
 
-/// For crossed line specials.
+/// Special lines contacted in the most recent position check (e.g., for opening
+/// doors after a failed move). Only read after P_TryMoveXY/P_CheckPosition return.
 DE_EXTERN_C iterlist_t *spechit;
 
 #ifdef __cplusplus
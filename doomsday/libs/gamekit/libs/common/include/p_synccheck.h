@@ -0,0 +1,50 @@
+/** @file p_synccheck.h  Playsim determinism checking.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#ifndef LIBCOMMON_P_SYNCCHECK_H
+#define LIBCOMMON_P_SYNCCHECK_H
+
+#include "dd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Calculates a checksum of the state of the playsim: the mobjs and the heights of
+ * the sector planes.
+ */
+uint32_t P_PlaysimChecksum(void);
+
+/**
+ * Called at the end of each tic of the playsim. With the "-synclog <file>" option,
+ * the checksum of every tic is written to the file. With "-synccheck <file>", the
+ * checksums are compared against a file written earlier with -synclog, and the
+ * first tic that differs is a fatal error.
+ *
+ * Playing back the same demo with both options, before and after a change to the
+ * playsim, shows whether the change affects demo sync.
+ */
+void P_SyncCheckTic(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // LIBCOMMON_P_SYNCCHECK_H
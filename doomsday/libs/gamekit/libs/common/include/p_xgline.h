@@ -224,7 +224,8 @@ enum // Line reference type.
     LREF_LINE_TAGGED,
     LREF_ACT_TAGGED,
     LREF_INDEX,
-    LREF_ALL
+    LREF_ALL,
+    LREF_TYPED
 };
 
 enum // Line -> Plane reference type.
@@ -252,6 +253,8 @@ enum // Line -> Plane reference type.
     LPREF_THING_EXIST_CEILINGS,
     LPREF_THING_NOEXIST_FLOORS,
     LPREF_THING_NOEXIST_CEILINGS,
+    LPREF_TYPED_FLOORS,
+    LPREF_TYPED_CEILINGS,
 
     // Line -> Sector references (same as ->Plane, really).
     LSREF_NONE = LPREF_NONE,
@@ -263,7 +266,8 @@ enum // Line -> Plane reference type.
     LSREF_ALL,
     LSREF_BACK = LPREF_BACK_FLOOR,
     LSREF_THING_EXIST = LPREF_THING_EXIST_FLOORS,
-    LSREF_THING_NOEXIST = LPREF_THING_NOEXIST_FLOORS
+    LSREF_THING_NOEXIST = LPREF_THING_NOEXIST_FLOORS,
+    LSREF_TYPED = LPREF_TYPED_FLOORS
 };
 
 enum // Sector -> Plane reference type.
@@ -435,6 +439,14 @@ void SV_WriteXGLine(Line *li, MapStateWriter *msw);
 void SV_ReadXGLine(Line *li, MapStateReader *msr);
 
 } // extern "C"
+
+class XGIndex;
+
+/**
+ * Index of the map's lines: all lines by tag, and XG lines by act tag and line
+ * type. Kept up to date as XG changes the lines.
+ */
+const XGIndex &XL_Index();
 #endif
 
 #endif
@@ -206,6 +206,14 @@ void XS_ChangePlaneMaterial(Sector &sector, bool ceiling, world_Material &newMat
 
 void XS_ChangePlaneColor(Sector &sector, bool ceiling, const de::Vec3f &newColor, bool isDelta = false);
 
+class XGIndex;
+
+/**
+ * Index of the map's sectors: all sectors by tag, and XG sectors by act tag and
+ * sector type. Kept up to date as XG changes the sectors.
+ */
+const XGIndex &XS_Index();
+
 #endif
 
 #endif // LIBCOMMON_XG_SECTORTYPE_H
@@ -0,0 +1,107 @@
+/** @file xgindex.h  Index of map elements by XG reference keys.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#ifndef LIBCOMMON_XGINDEX_H
+#define LIBCOMMON_XGINDEX_H
+
+#include <de/list.h>
+#include <functional>
+
+/**
+ * Finds map elements (sectors or lines) by the values XG uses to refer to them.
+ *
+ * Elements are identified by their index in the map. Each element may have a
+ * value for each key; the elements that have a given value are kept in
+ * ascending order, so the first one is the one a linear scan of the map would
+ * find first. Values are updated one element at a time when XG changes them.
+ *
+ * The lists returned by elements() are invalidated by changes to the same key
+ * and value. Copy the list if the elements may change while it is iterated.
+ *
+ * @ingroup libcommon
+ */
+class XGIndex
+{
+public:
+    enum Key {
+        Tag,    ///< Map tag.
+        ActTag, ///< Act tag of the XG type (XG elements only).
+        Type,   ///< XG type (XG elements only).
+
+        KeyCount
+    };
+
+public:
+    XGIndex();
+
+    /**
+     * Removes everything from the index and sets the number of elements. The
+     * elements have no values.
+     */
+    void clear(int elementCount = 0);
+
+    int elementCount() const;
+
+    void set(int element, Key key, int value);
+
+    void unset(int element, Key key);
+
+    bool has(int element, Key key) const;
+
+    /**
+     * Updates all the values of @a element. Every element has a tag. Only XG
+     * elements (@a isXG) have an act tag and a type.
+     */
+    void setElement(int element, int tag, bool isXG, int actTag = 0, int type = 0);
+
+    /**
+     * Determines if @a element currently has @a value for @a key.
+     */
+    bool matches(int element, Key key, int value) const;
+
+    /**
+     * Returns the elements that have @a value for @a key, in ascending order.
+     */
+    const de::List<int> &elements(Key key, int value) const;
+
+    /**
+     * Returns the lowest element that has @a value for @a key, or -1.
+     */
+    int first(Key key, int value) const;
+
+    /**
+     * Returns the lowest element above @a after that has @a value for @a key,
+     * or -1. Iterating with first() and next() visits the same elements as a
+     * linear scan would, even if values change during the iteration.
+     */
+    int next(Key key, int value, int after) const;
+
+    /**
+     * Calls @a func for each element that has @a value for @a key, in ascending
+     * order. The next element is looked up only after @a func returns, so the
+     * callback may change values. A zero tag refers to nothing.
+     */
+    de::LoopResult forAllElements(Key key, int value,
+                                  const std::function<de::LoopResult (int element)> &func) const;
+
+private:
+    DE_PRIVATE(d)
+};
+
+#endif // LIBCOMMON_XGINDEX_H
@@ -0,0 +1,170 @@
+/** @file bytecode.cpp  Action Code Script (ACS) pre-decoded bytecode.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#include "acs/bytecode.h"
+
+#include <de/byteorder.h>
+#include <de/string.h>
+#include <cstring>
+
+using namespace de;
+
+namespace acs {
+
+static const int operandCounts[] = {
+#define ACS_OPCODE_OPERANDS(Name, Operands, Handler) Operands,
+    ACS_OPCODES(ACS_OPCODE_OPERANDS)
+#undef ACS_OPCODE_OPERANDS
+};
+
+static const int OPCODE_COUNT = int(sizeof(operandCounts) / sizeof(operandCounts[0]));
+
+/// Index of the jump target operand of @a opcode, or -1 if it is not a jump.
+static int jumpOperand(Bytecode::Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Bytecode::Opcode::Goto:
+    case Bytecode::Opcode::IfGoto:
+    case Bytecode::Opcode::IfNotGoto:
+        return 0;
+
+    case Bytecode::Opcode::CaseGoto:
+        return 1;
+
+    default:
+        return -1;
+    }
+}
+
+/// Determines if execution never continues to the instruction following @a opcode.
+static bool endsRun(Bytecode::Opcode opcode)
+{
+    return opcode == Bytecode::Opcode::Terminate ||
+           opcode == Bytecode::Opcode::Goto      ||
+           opcode == Bytecode::Opcode::Restart   ||
+           opcode == Bytecode::Opcode::Invalid;
+}
+
+int Bytecode::operandCount(Opcode opcode) // static
+{
+    return opcode == Opcode::Invalid? 0 : operandCounts[int(opcode)];
+}
+
+void Bytecode::decode(const Block &pcode, const List<dint32> &entryOffsets)
+{
+    _code.clear();
+    _indexByOffset.clear();
+
+    const dint32 size = dint32(pcode.size());
+    auto readInt32 = [&pcode] (dint32 offset) {
+        dint32 value;
+        std::memcpy(&value, pcode.constData() + offset, sizeof(value));
+        return fromLittleEndian(value);
+    };
+
+    struct JumpFixup
+    {
+        int instruction;
+        int operand;
+        dint32 targetOffset;
+    };
+    List<JumpFixup> fixups;
+    List<dint32> pending = entryOffsets;
+
+    for (dsize next = 0; next < pending.size(); ++next)
+    {
+        // Decode a linear run of code.
+        for (dint32 offset = pending[next]; ; )
+        {
+            auto found = _indexByOffset.find(offset);
+            if (found != _indexByOffset.end())
+            {
+                if (offset != pending[next])
+                {
+                    // Continue in code decoded earlier.
+                    Instruction jump{Opcode::Goto, offset, {found->second}};
+                    _code << jump;
+                }
+                break;
+            }
+
+            Instruction insn{Opcode::Invalid, offset, {}};
+            const int index = _code.sizei();
+            if (offset >= 0 && offset <= size - 4)
+            {
+                const dint32 opcode = readInt32(offset);
+                insn.operands[0] = opcode;
+                if (opcode >= 0 && opcode < OPCODE_COUNT &&
+                    offset + 4 * (1 + operandCounts[opcode]) <= size)
+                {
+                    insn.opcode = Opcode(opcode);
+                    for (int i = 0; i < operandCounts[opcode]; ++i)
+                    {
+                        insn.operands[i] = readInt32(offset + 4 * (1 + i));
+                    }
+                    const int jump = jumpOperand(insn.opcode);
+                    if (jump >= 0)
+                    {
+                        fixups << JumpFixup{index, jump, insn.operands[jump]};
+                        pending << insn.operands[jump];
+                    }
+                }
+            }
+            _indexByOffset.insert(offset, index);
+            _code << insn;
+
+            if (endsRun(insn.opcode)) break;
+            offset += 4 * (1 + operandCounts[int(insn.opcode)]);
+        }
+    }
+
+    // All jump targets have been decoded now.
+    for (const auto &fix : fixups)
+    {
+        _code[fix.instruction].operands[fix.operand] = _indexByOffset[fix.targetOffset];
+    }
+}
+
+int Bytecode::instructionCount() const
+{
+    return _code.sizei();
+}
+
+const Bytecode::Instruction *Bytecode::at(dint32 pcodeOffset) const
+{
+    auto found = _indexByOffset.find(pcodeOffset);
+    if (found != _indexByOffset.end())
+    {
+        return &_code[found->second];
+    }
+    /// @throw MissingInstructionError  No code was decoded at @a pcodeOffset.
+    throw MissingInstructionError("acs::Bytecode::at",
+                                  "No instruction at offset " + String::asText(pcodeOffset));
+}
+
+void Bytecode::unknownCommand(const Instruction &insn) const
+{
+    /// @throw UnknownCommandError  Invalid command name specified.
+    throw UnknownCommandError("acs::Bytecode::execute",
+                              "Unknown command #" + String::asText(insn.operands[0]) +
+                              " at offset " + String::asText(insn.pcodeOffset));
+}
+
+} // namespace acs
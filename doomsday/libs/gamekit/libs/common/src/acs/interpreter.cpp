@@ -3,6 +3,7 @@
  * @authors Copyright © 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
  * @authors Copyright © 2005-2015 Daniel Swanson <danij@dengine.net>
  * @authors Copyright © 1999 Activision
+ * @authors Copyright © 2026 The Doomsday Engine Project
  *
  * @par License
  * GPL: http://www.gnu.org/licenses/gpl.html
@@ -38,60 +39,39 @@ int acs::Interpreter::currentScriptNumber = -1;
 
 namespace internal
 {
-    /// Status to return from ACScript command functions.
-    enum CommandResult
-    {
-        Continue,
-        Stop,
-        Terminate
-    };
-
-    typedef CommandResult (*CommandFunc) (acs::Interpreter &);
+    using acs::CommandResult;
+    using acs::Continue;
+    using acs::Stop;
+    using acs::Terminate;
 
-/// Helper macro for declaring ACScript command functions.
+/// Helper macros for declaring ACScript command functions.
 #define ACS_COMMAND(Name) CommandResult cmd##Name(acs::Interpreter &interp)
+#define ACS_COMMAND_WITH_OPERANDS(Name) \
+    CommandResult cmd##Name(acs::Interpreter &interp, const acs::Bytecode::Instruction &insn)
 
     static String printBuffer;
 
 #ifdef __JHEXEN__
     static byte specArgs[5];
 
-    ACS_COMMAND(NOP)
-    {
-        DE_UNUSED(interp);
-        return Continue;
-    }
-
-    ACS_COMMAND(Terminate)
-    {
-        DE_UNUSED(interp);
-        return Terminate;
-    }
-
     ACS_COMMAND(Suspend)
     {
         interp.script().setState(acs::Script::Suspended);
         return Stop;
     }
 
-    ACS_COMMAND(PushNumber)
-    {
-        interp.locals.push(DD_LONG(*interp.pcodePtr++));
-        return Continue;
-    }
-
-    ACS_COMMAND(LSpec1)
+    ACS_COMMAND_WITH_OPERANDS(LSpec1)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
         specArgs[0] = interp.locals.pop();
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side, interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(LSpec2)
+    ACS_COMMAND_WITH_OPERANDS(LSpec2)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
         specArgs[1] = interp.locals.pop();
         specArgs[0] = interp.locals.pop();
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side, interp.activator);
@@ -99,9 +79,9 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(LSpec3)
+    ACS_COMMAND_WITH_OPERANDS(LSpec3)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
         specArgs[2] = interp.locals.pop();
         specArgs[1] = interp.locals.pop();
         specArgs[0] = interp.locals.pop();
@@ -110,9 +90,9 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(LSpec4)
+    ACS_COMMAND_WITH_OPERANDS(LSpec4)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
         specArgs[3] = interp.locals.pop();
         specArgs[2] = interp.locals.pop();
         specArgs[1] = interp.locals.pop();
@@ -122,9 +102,9 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(LSpec5)
+    ACS_COMMAND_WITH_OPERANDS(LSpec5)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
         specArgs[4] = interp.locals.pop();
         specArgs[3] = interp.locals.pop();
         specArgs[2] = interp.locals.pop();
@@ -136,338 +116,66 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(LSpec1Direct)
+    ACS_COMMAND_WITH_OPERANDS(LSpec1Direct)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
-        specArgs[0] = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
+        specArgs[0] = insn.operands[1];
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side,
                              interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(LSpec2Direct)
+    ACS_COMMAND_WITH_OPERANDS(LSpec2Direct)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
-        specArgs[0] = DD_LONG(*interp.pcodePtr++);
-        specArgs[1] = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
+        specArgs[0] = insn.operands[1];
+        specArgs[1] = insn.operands[2];
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side,
                              interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(LSpec3Direct)
+    ACS_COMMAND_WITH_OPERANDS(LSpec3Direct)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
-        specArgs[0] = DD_LONG(*interp.pcodePtr++);
-        specArgs[1] = DD_LONG(*interp.pcodePtr++);
-        specArgs[2] = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
+        specArgs[0] = insn.operands[1];
+        specArgs[1] = insn.operands[2];
+        specArgs[2] = insn.operands[3];
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side,
                              interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(LSpec4Direct)
+    ACS_COMMAND_WITH_OPERANDS(LSpec4Direct)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
-        specArgs[0] = DD_LONG(*interp.pcodePtr++);
-        specArgs[1] = DD_LONG(*interp.pcodePtr++);
-        specArgs[2] = DD_LONG(*interp.pcodePtr++);
-        specArgs[3] = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
+        specArgs[0] = insn.operands[1];
+        specArgs[1] = insn.operands[2];
+        specArgs[2] = insn.operands[3];
+        specArgs[3] = insn.operands[4];
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side,
                              interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(LSpec5Direct)
+    ACS_COMMAND_WITH_OPERANDS(LSpec5Direct)
     {
-        int special = DD_LONG(*interp.pcodePtr++);
-        specArgs[0] = DD_LONG(*interp.pcodePtr++);
-        specArgs[1] = DD_LONG(*interp.pcodePtr++);
-        specArgs[2] = DD_LONG(*interp.pcodePtr++);
-        specArgs[3] = DD_LONG(*interp.pcodePtr++);
-        specArgs[4] = DD_LONG(*interp.pcodePtr++);
+        int special = insn.operands[0];
+        specArgs[0] = insn.operands[1];
+        specArgs[1] = insn.operands[2];
+        specArgs[2] = insn.operands[3];
+        specArgs[3] = insn.operands[4];
+        specArgs[4] = insn.operands[5];
         P_ExecuteLineSpecial(special, specArgs, interp.line, interp.side,
                              interp.activator);
 
         return Continue;
     }
 
-    ACS_COMMAND(Add)
-    {
-        interp.locals.push(interp.locals.pop() + interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(Subtract)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() - operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(Multiply)
-    {
-        interp.locals.push(interp.locals.pop() * interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(Divide)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() / operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(Modulus)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() % operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(EQ)
-    {
-        interp.locals.push(interp.locals.pop() == interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(NE)
-    {
-        interp.locals.push(interp.locals.pop() != interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(LT)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() < operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(GT)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() > operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(LE)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() <= operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(GE)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() >= operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(AssignScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] = interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(AssignMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] = interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(AssignWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] = interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(PushScriptVar)
-    {
-        interp.locals.push(interp.args[DD_LONG(*interp.pcodePtr++)]);
-        return Continue;
-    }
-
-    ACS_COMMAND(PushMapVar)
-    {
-        interp.locals.push(interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)]);
-        return Continue;
-    }
-
-    ACS_COMMAND(PushWorldVar)
-    {
-        interp.locals.push(interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)]);
-        return Continue;
-    }
-
-    ACS_COMMAND(AddScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] += interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(AddMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] += interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(AddWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] += interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(SubScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] -= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(SubMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] -= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(SubWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] -= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(MulScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] *= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(MulMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] *= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(MulWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] *= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(DivScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] /= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(DivMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] /= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(DivWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] /= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(ModScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)] %= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(ModMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)] %= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(ModWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)] %= interp.locals.pop();
-        return Continue;
-    }
-
-    ACS_COMMAND(IncScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)]++;
-        return Continue;
-    }
-
-    ACS_COMMAND(IncMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)]++;
-        return Continue;
-    }
-
-    ACS_COMMAND(IncWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)]++;
-        return Continue;
-    }
-
-    ACS_COMMAND(DecScriptVar)
-    {
-        interp.args[DD_LONG(*interp.pcodePtr++)]--;
-        return Continue;
-    }
-
-    ACS_COMMAND(DecMapVar)
-    {
-        interp.scriptSys().mapVars[DD_LONG(*interp.pcodePtr++)]--;
-        return Continue;
-    }
-
-    ACS_COMMAND(DecWorldVar)
-    {
-        interp.scriptSys().worldVars[DD_LONG(*interp.pcodePtr++)]--;
-        return Continue;
-    }
-
-    ACS_COMMAND(Goto)
-    {
-        interp.pcodePtr = (const int *) (interp.scriptSys().module().pcode().constData() + DD_LONG(*interp.pcodePtr));
-        return Continue;
-    }
-
-    ACS_COMMAND(IfGoto)
-    {
-        if(interp.locals.pop())
-        {
-            interp.pcodePtr = (const int *) (interp.scriptSys().module().pcode().constData() + DD_LONG(*interp.pcodePtr));
-        }
-        else
-        {
-            interp.pcodePtr++;
-        }
-        return Continue;
-    }
-
-    ACS_COMMAND(Drop)
-    {
-        interp.locals.drop();
-        return Continue;
-    }
-
-    ACS_COMMAND(Delay)
-    {
-        interp.delayCount = interp.locals.pop();
-        return Stop;
-    }
-
-    ACS_COMMAND(DelayDirect)
-    {
-        interp.delayCount = DD_LONG(*interp.pcodePtr++);
-        return Stop;
-    }
-
     ACS_COMMAND(Random)
     {
         int high = interp.locals.pop();
@@ -476,10 +184,10 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(RandomDirect)
+    ACS_COMMAND_WITH_OPERANDS(RandomDirect)
     {
-        int low  = DD_LONG(*interp.pcodePtr++);
-        int high = DD_LONG(*interp.pcodePtr++);
+        int low  = insn.operands[0];
+        int high = insn.operands[1];
         interp.locals.push(low + (P_Random() % (high - low + 1)));
         return Continue;
     }
@@ -496,10 +204,10 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(ThingCountDirect)
+    ACS_COMMAND_WITH_OPERANDS(ThingCountDirect)
     {
-        int type = DD_LONG(*interp.pcodePtr++);
-        int tid  = DD_LONG(*interp.pcodePtr++);
+        int type = insn.operands[0];
+        int tid  = insn.operands[1];
         // Anything to count?
         if(type + tid)
         {
@@ -514,9 +222,9 @@ namespace internal
         return Stop;
     }
 
-    ACS_COMMAND(TagWaitDirect)
+    ACS_COMMAND_WITH_OPERANDS(TagWaitDirect)
     {
-        interp.script().waitForSector(DD_LONG(*interp.pcodePtr++));
+        interp.script().waitForSector(insn.operands[0]);
         return Stop;
     }
 
@@ -526,9 +234,9 @@ namespace internal
         return Stop;
     }
 
-    ACS_COMMAND(PolyWaitDirect)
+    ACS_COMMAND_WITH_OPERANDS(PolyWaitDirect)
     {
-        interp.script().waitForPolyobj(DD_LONG(*interp.pcodePtr++));
+        interp.script().waitForPolyobj(insn.operands[0]);
         return Stop;
     }
 
@@ -557,11 +265,11 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(ChangeFloorDirect)
+    ACS_COMMAND_WITH_OPERANDS(ChangeFloorDirect)
     {
-        int tag = DD_LONG(*interp.pcodePtr++);
+        int tag = insn.operands[0];
 
-        AutoStr *path = Str_PercentEncode(AutoStr_FromTextStd(interp.scriptSys().module().constant(DD_LONG(*interp.pcodePtr++))));
+        AutoStr *path = Str_PercentEncode(AutoStr_FromTextStd(interp.scriptSys().module().constant(insn.operands[1])));
         uri_s *uri = Uri_NewWithPath3("Flats", Str_Text(path));
 
         world_Material *mat = (world_Material *) P_ToPtr(DMU_MATERIAL, Materials_ResolveUri(uri));
@@ -607,11 +315,11 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(ChangeCeilingDirect)
+    ACS_COMMAND_WITH_OPERANDS(ChangeCeilingDirect)
     {
-        int tag = DD_LONG(*interp.pcodePtr++);
+        int tag = insn.operands[0];
 
-        AutoStr *path = Str_PercentEncode(AutoStr_FromTextStd(interp.scriptSys().module().constant(DD_LONG(*interp.pcodePtr++))));
+        AutoStr *path = Str_PercentEncode(AutoStr_FromTextStd(interp.scriptSys().module().constant(insn.operands[1])));
         uri_s *uri = Uri_NewWithPath3("Flats", Str_Text(path));
 
         world_Material *mat = (world_Material *) P_ToPtr(DMU_MATERIAL, Materials_ResolveUri(uri));
@@ -634,76 +342,7 @@ namespace internal
 
     ACS_COMMAND(Restart)
     {
-        interp.pcodePtr = interp.script().entryPoint().pcodePtr;
-        return Continue;
-    }
-
-    ACS_COMMAND(AndLogical)
-    {
-        interp.locals.push(interp.locals.pop() && interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(OrLogical)
-    {
-        interp.locals.push(interp.locals.pop() || interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(AndBitwise)
-    {
-        interp.locals.push(interp.locals.pop() & interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(OrBitwise)
-    {
-        interp.locals.push(interp.locals.pop() | interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(EorBitwise)
-    {
-        interp.locals.push(interp.locals.pop() ^ interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(NegateLogical)
-    {
-        interp.locals.push(!interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(LShift)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() << operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(RShift)
-    {
-        int operand2 = interp.locals.pop();
-        interp.locals.push(interp.locals.pop() >> operand2);
-        return Continue;
-    }
-
-    ACS_COMMAND(UnaryMinus)
-    {
-        interp.locals.push(-interp.locals.pop());
-        return Continue;
-    }
-
-    ACS_COMMAND(IfNotGoto)
-    {
-        if(interp.locals.pop())
-        {
-            interp.pcodePtr++;
-        }
-        else
-        {
-            interp.pcodePtr = (const int *) (interp.scriptSys().module().pcode().constData() + DD_LONG(*interp.pcodePtr));
-        }
+        interp.ip = interp.script().entryPoint().code;
         return Continue;
     }
 
@@ -719,9 +358,9 @@ namespace internal
         return Stop;
     }
 
-    ACS_COMMAND(ScriptWaitDirect)
+    ACS_COMMAND_WITH_OPERANDS(ScriptWaitDirect)
     {
-        interp.script().waitForScript(DD_LONG(*interp.pcodePtr++));
+        interp.script().waitForScript(insn.operands[0]);
         return Stop;
     }
 
@@ -734,20 +373,6 @@ namespace internal
         return Continue;
     }
 
-    ACS_COMMAND(CaseGoto)
-    {
-        if(interp.locals.top() == DD_LONG(*interp.pcodePtr++))
-        {
-            interp.pcodePtr = (const int *) (interp.scriptSys().module().pcode().constData() + DD_LONG(*interp.pcodePtr));
-            interp.locals.drop();
-        }
-        else
-        {
-            interp.pcodePtr++;
-        }
-        return Continue;
-    }
-
     ACS_COMMAND(BeginPrint)
     {
         DE_UNUSED(interp);
@@ -1026,42 +651,6 @@ namespace internal
         return Continue;
     }
 
-    static const CommandFunc &findCommand(int name)
-    {
-        static CommandFunc const cmds[] =
-        {
-            cmdNOP, cmdTerminate, cmdSuspend, cmdPushNumber, cmdLSpec1, cmdLSpec2,
-            cmdLSpec3, cmdLSpec4, cmdLSpec5, cmdLSpec1Direct, cmdLSpec2Direct,
-            cmdLSpec3Direct, cmdLSpec4Direct, cmdLSpec5Direct, cmdAdd,
-            cmdSubtract, cmdMultiply, cmdDivide, cmdModulus, cmdEQ, cmdNE,
-            cmdLT, cmdGT, cmdLE, cmdGE, cmdAssignScriptVar, cmdAssignMapVar,
-            cmdAssignWorldVar, cmdPushScriptVar, cmdPushMapVar,
-            cmdPushWorldVar, cmdAddScriptVar, cmdAddMapVar, cmdAddWorldVar,
-            cmdSubScriptVar, cmdSubMapVar, cmdSubWorldVar, cmdMulScriptVar,
-            cmdMulMapVar, cmdMulWorldVar, cmdDivScriptVar, cmdDivMapVar,
-            cmdDivWorldVar, cmdModScriptVar, cmdModMapVar, cmdModWorldVar,
-            cmdIncScriptVar, cmdIncMapVar, cmdIncWorldVar, cmdDecScriptVar,
-            cmdDecMapVar, cmdDecWorldVar, cmdGoto, cmdIfGoto, cmdDrop,
-            cmdDelay, cmdDelayDirect, cmdRandom, cmdRandomDirect,
-            cmdThingCount, cmdThingCountDirect, cmdTagWait, cmdTagWaitDirect,
-            cmdPolyWait, cmdPolyWaitDirect, cmdChangeFloor,
-            cmdChangeFloorDirect, cmdChangeCeiling, cmdChangeCeilingDirect,
-            cmdRestart, cmdAndLogical, cmdOrLogical, cmdAndBitwise,
-            cmdOrBitwise, cmdEorBitwise, cmdNegateLogical, cmdLShift,
-            cmdRShift, cmdUnaryMinus, cmdIfNotGoto, cmdLineSide, cmdScriptWait,
-            cmdScriptWaitDirect, cmdClearLineSpecial, cmdCaseGoto,
-            cmdBeginPrint, cmdEndPrint, cmdPrintString, cmdPrintNumber,
-            cmdPrintCharacter, cmdPlayerCount, cmdGameType, cmdGameSkill,
-            cmdTimer, cmdSectorSound, cmdAmbientSound, cmdSoundSequence,
-            cmdSetLineTexture, cmdSetLineBlocking, cmdSetLineSpecial,
-            cmdThingSound, cmdEndPrintBold
-        };
-        static const int numCmds = sizeof(cmds) / sizeof(cmds[0]);
-        if(name >= 0 && name < numCmds) return cmds[name];
-        /// @throw Error  Invalid command name specified.
-        throw Error("acs::Interpreter::findCommand", "Unknown command #" + String::asText(name));
-    }
-
 #endif  // __JHEXEN__
 
 } // namespace internal
@@ -1075,11 +664,11 @@ thinker_t *Interpreter::newThinker(Script &script, const Script::Args &scriptArg
 {
     const Module::EntryPoint &ep = script.entryPoint();
 
-    Interpreter *th = (Interpreter *) Z_Calloc(sizeof(*th), PU_MAP, nullptr);
+    Interpreter *th = ThinkerT<Interpreter>(Thinker::AllocatePooled).take();
     th->thinker.function = (thinkfunc_t) acs_Interpreter_Think;
 
     th->_script    = &script;
-    th->pcodePtr   = ep.pcodePtr;
+    th->ip         = ep.code;
     th->delayCount = delayCount;
     th->activator  = activator;
     th->line       = line;
@@ -1099,7 +688,7 @@ thinker_t *Interpreter::newThinker(Script &script, const Script::Args &scriptArg
 void Interpreter::think()
 {
 #ifdef __JHEXEN__
-    int action = (script().state() == Script::Terminating? Terminate : Continue);
+    CommandResult action = (script().state() == Script::Terminating? Terminate : Continue);
 
     if(script().isRunning())
     {
@@ -1111,8 +700,8 @@ void Interpreter::think()
 
         currentScriptNumber = script().entryPoint().scriptNumber;
 
-        while((action = findCommand(DD_LONG(*pcodePtr++))(*this)) == Continue)
-        {}
+        System &sys = scriptSys();
+        action = sys.module().bytecode().execute(*this, sys.mapVars.data(), sys.worldVars.data());
 
         currentScriptNumber = -1;
     }
@@ -1135,6 +724,69 @@ void Interpreter::think()
 #endif
 }
 
+CommandResult Interpreter::command(const Bytecode::Instruction &insn)
+{
+#ifdef __JHEXEN__
+    using Opcode = Bytecode::Opcode;
+
+    switch (insn.opcode)
+    {
+    case Opcode::Suspend:             return cmdSuspend(*this);
+    case Opcode::LSpec1:              return cmdLSpec1(*this, insn);
+    case Opcode::LSpec2:              return cmdLSpec2(*this, insn);
+    case Opcode::LSpec3:              return cmdLSpec3(*this, insn);
+    case Opcode::LSpec4:              return cmdLSpec4(*this, insn);
+    case Opcode::LSpec5:              return cmdLSpec5(*this, insn);
+    case Opcode::LSpec1Direct:        return cmdLSpec1Direct(*this, insn);
+    case Opcode::LSpec2Direct:        return cmdLSpec2Direct(*this, insn);
+    case Opcode::LSpec3Direct:        return cmdLSpec3Direct(*this, insn);
+    case Opcode::LSpec4Direct:        return cmdLSpec4Direct(*this, insn);
+    case Opcode::LSpec5Direct:        return cmdLSpec5Direct(*this, insn);
+    case Opcode::Random:              return cmdRandom(*this);
+    case Opcode::RandomDirect:        return cmdRandomDirect(*this, insn);
+    case Opcode::ThingCount:          return cmdThingCount(*this);
+    case Opcode::ThingCountDirect:    return cmdThingCountDirect(*this, insn);
+    case Opcode::TagWait:             return cmdTagWait(*this);
+    case Opcode::TagWaitDirect:       return cmdTagWaitDirect(*this, insn);
+    case Opcode::PolyWait:            return cmdPolyWait(*this);
+    case Opcode::PolyWaitDirect:      return cmdPolyWaitDirect(*this, insn);
+    case Opcode::ChangeFloor:         return cmdChangeFloor(*this);
+    case Opcode::ChangeFloorDirect:   return cmdChangeFloorDirect(*this, insn);
+    case Opcode::ChangeCeiling:       return cmdChangeCeiling(*this);
+    case Opcode::ChangeCeilingDirect: return cmdChangeCeilingDirect(*this, insn);
+    case Opcode::Restart:             return cmdRestart(*this);
+    case Opcode::LineSide:            return cmdLineSide(*this);
+    case Opcode::ScriptWait:          return cmdScriptWait(*this);
+    case Opcode::ScriptWaitDirect:    return cmdScriptWaitDirect(*this, insn);
+    case Opcode::ClearLineSpecial:    return cmdClearLineSpecial(*this);
+    case Opcode::BeginPrint:          return cmdBeginPrint(*this);
+    case Opcode::EndPrint:            return cmdEndPrint(*this);
+    case Opcode::PrintString:         return cmdPrintString(*this);
+    case Opcode::PrintNumber:         return cmdPrintNumber(*this);
+    case Opcode::PrintCharacter:      return cmdPrintCharacter(*this);
+    case Opcode::PlayerCount:         return cmdPlayerCount(*this);
+    case Opcode::GameType:            return cmdGameType(*this);
+    case Opcode::GameSkill:           return cmdGameSkill(*this);
+    case Opcode::Timer:               return cmdTimer(*this);
+    case Opcode::SectorSound:         return cmdSectorSound(*this);
+    case Opcode::AmbientSound:        return cmdAmbientSound(*this);
+    case Opcode::SoundSequence:       return cmdSoundSequence(*this);
+    case Opcode::SetLineTexture:      return cmdSetLineTexture(*this);
+    case Opcode::SetLineBlocking:     return cmdSetLineBlocking(*this);
+    case Opcode::SetLineSpecial:      return cmdSetLineSpecial(*this);
+    case Opcode::ThingSound:          return cmdThingSound(*this);
+    case Opcode::EndPrintBold:        return cmdEndPrintBold(*this);
+
+    default:
+        break;
+    }
+#endif
+    /// @throw Bytecode::UnknownCommandError  The command is executed by Bytecode.
+    throw Bytecode::UnknownCommandError("acs::Interpreter::command",
+                                        "Command #" + String::asText(int(insn.opcode)) +
+                                        " is not an interpreter command");
+}
+
 System &Interpreter::scriptSys() const
 {
     return gfw_Session()->acsSystem();
@@ -1146,41 +798,14 @@ Script &Interpreter::script() const
     return *_script;
 }
 
-void Interpreter::Stack::push(int value)
-{
-    if (height >= ACS_INTERPRETER_SCRIPT_STACK_DEPTH)
-    { 
-        LOG_SCR_ERROR("acs::Interpreter::Stack::push: Overflow");
-        return;
-    }
-    values[height++] = value;
-}
-
-int Interpreter::Stack::pop()
-{
-    if (height <= 0)
-    {
-        LOG_SCR_ERROR("acs::Interpreter::Stack::pop: Underflow");
-        return 0;
-    }
-    return values[--height];
-}
-
-int Interpreter::Stack::top() const
+void Interpreter::Stack::overflow(const char *operation) // static
 {
-    if (height == 0)
-    {
-        LOG_SCR_ERROR("acs::Interpreter::Stack::top: Underflow");
-        return 0;
-    }
-    return values[height - 1];
+    LOG_SCR_ERROR("acs::Interpreter::Stack::%s: Overflow") << operation;
 }
 
-void Interpreter::Stack::drop()
+void Interpreter::Stack::underflow(const char *operation) // static
 {
-    if(height == 0)
-        LOG_SCR_ERROR("acs::Interpreter::Stack::drop: Underflow");
-    height--;
+    LOG_SCR_ERROR("acs::Interpreter::Stack::%s: Underflow") << operation;
 }
 
 void Interpreter::write(MapStateWriter *msw) const
@@ -1203,7 +828,7 @@ void Interpreter::write(MapStateWriter *msw) const
     {
         Writer_WriteInt32(writer, args[i]);
     }
-    Writer_WriteInt32(writer, ((const dbyte *)pcodePtr) - (const dbyte *)scriptSys().module().pcode().constData());
+    Writer_WriteInt32(writer, ip->pcodeOffset);
 }
 
 int Interpreter::read(MapStateReader *msr)
@@ -1258,7 +883,7 @@ int Interpreter::read(MapStateReader *msr)
             args[i] = Reader_ReadInt32(reader);
         }
 
-        pcodePtr = (const int *) (scriptSys().module().pcode().constData() + Reader_ReadInt32(reader));
+        ip = scriptSys().module().bytecode().at(Reader_ReadInt32(reader));
     }
     else
     {
@@ -1298,7 +923,7 @@ int Interpreter::read(MapStateReader *msr)
             args[i] = Reader_ReadInt32(reader);
         }
 
-        pcodePtr = (const int *) (scriptSys().module().pcode().constData() + Reader_ReadInt32(reader));
+        ip = scriptSys().module().bytecode().at(Reader_ReadInt32(reader));
     }
 
     thinker.function = (thinkfunc_t) acs_Interpreter_Think;
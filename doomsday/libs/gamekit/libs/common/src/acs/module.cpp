@@ -35,6 +35,7 @@ namespace acs {
 DE_PIMPL_NOREF(Module)
 {
     Block                  pcode;
+    Bytecode               bytecode;
     List<EntryPoint>       entryPoints;
     KeyMap<int, EntryPoint *> epByScriptNumberLut;
     List<String>           constants;
@@ -86,6 +87,7 @@ Module *Module::newFromBytecode(const Block &bytecode)  // static
     dint32 numEntryPoints;
     from >> numEntryPoints;
     module->d->entryPoints.reserve(numEntryPoints);
+    List<dint32> entryOffsets;
     for(dint32 i = 0; i < numEntryPoints; ++i)
     {
 #define OPEN_SCRIPTS_BASE 1000
@@ -105,7 +107,7 @@ Module *Module::newFromBytecode(const Block &bytecode)  // static
         {
             throw FormatError("acs::Module", "Invalid script entrypoint offset");
         }
-        ep.pcodePtr = reinterpret_cast<const int *>(module->d->pcode.constData() + offset);
+        entryOffsets << offset;
 
         from >> ep.scriptArgCount;
         if(ep.scriptArgCount > ACS_INTERPRETER_MAX_SCRIPT_ARGS)
@@ -119,6 +121,15 @@ Module *Module::newFromBytecode(const Block &bytecode)  // static
 
 #undef OPEN_SCRIPTS_BASE
     }
+    // Translate the code once so the interpreter doesn't need to decode anything.
+    module->d->bytecode.decode(module->d->pcode, entryOffsets);
+    for (dsize i = 0; i < entryOffsets.size(); ++i)
+    {
+        module->d->entryPoints[i].code = module->d->bytecode.at(entryOffsets[i]);
+    }
+    LOG_SCR_XVERBOSE("Decoded %i instructions for %i scripts", module->d->bytecode.instructionCount()
+                     << module->d->entryPoints.count());
+
     // Prepare a script-number => EntryPoint LUT.
     module->d->buildEntryPointLut();
 
@@ -200,4 +211,9 @@ const Block &Module::pcode() const
     return d->pcode;
 }
 
+const Bytecode &Module::bytecode() const
+{
+    return d->bytecode;
+}
+
 } // namespace acs
@@ -21,13 +21,17 @@
 #include "gamesession.h"
 
 #include <de/app.h>
+#include <de/archivefeed.h>
 #include <de/commandline.h>
+#include <de/loop.h>
+#include <de/taskpool.h>
 #include <de/arrayvalue.h>
 #include <de/numbervalue.h>
 #include <de/recordvalue.h>
 #include <de/packageloader.h>
 #include <de/time.h>
 #include <de/textvalue.h>
+#include <de/writer.h>
 #include <de/ziparchive.h>
 #include <doomsday/doomsdayapp.h>
 #include <doomsday/gamestatefolder.h>
@@ -118,9 +122,75 @@ DE_PIMPL(GameSession)
 
     acs::System acscriptSys;  ///< The One acs::System instance.
 
+    /// Saved session whose package is compressed in the background.
+    struct PendingSave
+    {
+        GameStateFolder *saved = nullptr;
+        String savePath;
+        Block serialized;       ///< Compressed package (written by the worker).
+        bool compressed = false;
+        bool finished   = false;
+    };
+    std::shared_ptr<PendingSave> pendingSave;
+    TaskPool saveTasks;  ///< Compresses saved sessions in the background.
+
     Impl(Public *i) : Base(i)
     {}
 
+    ~Impl()
+    {
+        waitForPendingSave();
+    }
+
+    /**
+     * Blocks until a saved session being compressed in the background is complete,
+     * and writes it. Must be called before the internal or user saved sessions are
+     * accessed.
+     */
+    void waitForPendingSave()
+    {
+        saveTasks.waitForDone();
+        if (pendingSave)
+        {
+            finishSave(*pendingSave);
+            pendingSave.reset();
+        }
+    }
+
+    /**
+     * Writes a package compressed in the background to the internal saved session and
+     * copies it to the user's save slot. The file system is only modified here, in the
+     * main thread.
+     */
+    static void finishSave(PendingSave &save)
+    {
+        if (save.finished) return;
+        save.finished = true;
+
+        if (!save.compressed) return;
+        try
+        {
+            save.saved->primaryFeed()->as<ArchiveFeed>().rewriteFile(save.serialized);
+            save.serialized.clear();
+
+            // Copy the internal saved session to the destination slot.
+            AbstractSession::copySaved(save.savePath, internalSavePath());
+
+            LOG_RES_VERBOSE("Game saved to \"%s\"") << save.savePath;
+            P_SetMessage(&players[CONSOLEPLAYER], TXT_GAMESAVED);
+
+            // Notify the engine that the game was saved.
+            /// @todo After the engine has the primary responsibility of saving the game,
+            /// this notification is unnecessary.
+            Plug_Notify(DD_NOTIFY_GAME_SAVED, nullptr);
+        }
+        catch (const Error &er)
+        {
+            LOG_RES_WARNING("Error writing game session to '%s':\n")
+                    << save.savePath << er.asText();
+        }
+    }
+
     inline String userSavePath(const String &fileName)
     {
         DE_ASSERT(DoomsdayApp::currentGameProfile());
@@ -129,6 +199,8 @@ DE_PIMPL(GameSession)
 
     void cleanupInternalSave()
     {
+        waitForPendingSave();
+
         // Ensure the internal save folder exists.
         App::fileSystem().makeFolder(internalSavePath().fileNamePath());
 
@@ -261,11 +333,17 @@ DE_PIMPL(GameSession)
     /**
      * Update/create a new GameStateFolder at the specified @a path from the current
      * game state.
+     *
+     * @param flush  Write the updated package to disk right away. Otherwise the
+     *               changes remain in memory until the folder is released.
      */
-    GameStateFolder &updateGameStateFolder(const String &path, const GameStateMetadata &metadata)
+    GameStateFolder &updateGameStateFolder(const String &path, const GameStateMetadata &metadata,
+                                           bool flush = true)
     {
         DE_ASSERT(self().hasBegun());
 
+        waitForPendingSave();
+
         LOG_AS("GameSession");
         LOG_RES_VERBOSE("Serializing to \"%s\"...") << path;
 
@@ -306,7 +384,10 @@ DE_PIMPL(GameSession)
         //DoomsdayApp::app().gameSessionWasSaved(self(), *saved);
         //self().setThinkerMapping(nullptr);
 
-        saved->release();  // No need to populate; FS2 Files already in sync with source data.
+        if (flush)
+        {
+            saved->release();  // No need to populate; FS2 Files already in sync with source data.
+        }
         saved->cacheMetadata(metadata);  // Avoid immediately reopening the .save package.
 
         return *saved;
@@ -506,6 +587,8 @@ DE_PIMPL(GameSession)
 
     void loadSaved(const String &savePath)
     {
+        waitForPendingSave();
+
         ::briefDisabled = true;
 
         G_StopDemo();
@@ -1053,6 +1136,7 @@ void GameSession::end()
         G_ResetViewEffects();
     }
 
+    d->waitForPendingSave();
     AbstractSession::removeSaved(internalSavePath());
 
     setInProgress(false);
@@ -1201,6 +1285,7 @@ void GameSession::leaveMap(const res::Uri &nextMapUri, uint nextMapEntryPoint)
     GameStateFolder *saved = nullptr;
     if (!d->rules.values.deathmatch) // Never save in deathmatch.
     {
+        d->waitForPendingSave();
         saved = &App::rootFolder().locate<GameStateFolder>(internalSavePath());
         auto &mapsFolder = saved->locate<Folder>("maps");
 
@@ -1354,21 +1439,41 @@ void GameSession::save(const String &saveName, const String &userDescription)
         GameStateMetadata metadata = d->metadata();
         metadata.set("userDescription", chooseSaveDescription(savePath, userDescription));
 
-        // Update the existing internal .save package.
-        d->updateGameStateFolder(internalSavePath(), metadata);
+        // Update the existing internal .save package. This only snapshots the game
+        // state in memory (also waiting for a previous save to be written first);
+        // the package is compressed in the background.
+        GameStateFolder &saved = d->updateGameStateFolder(internalSavePath(), metadata,
+                                                          false /* don't flush */);
 
         // In networked games the server tells the clients to save also.
         NetSv_SaveGame(metadata.getui("sessionId"));
 
-        // Copy the internal saved session to the destination slot.
-        AbstractSession::copySaved(savePath, internalSavePath());
+        // Move the changed entries into the archive, and detach the archive from
+        // the package file since the file will be overwritten.
+        saved.Folder::release();
+        saved.archive().cache();
 
-        P_SetMessage(&players[CONSOLEPLAYER], TXT_GAMESAVED);
+        auto pending = std::make_shared<Impl::PendingSave>();
+        pending->saved    = &saved;
+        pending->savePath = savePath;
+        d->pendingSave = pending;
 
-        // Notify the engine that the game was saved.
-        /// @todo After the engine has the primary responsibility of saving the game,
-        /// this notification is unnecessary.
-        Plug_Notify(DD_NOTIFY_GAME_SAVED, nullptr);
+        d->saveTasks.start([pending] ()
+        {
+            try
+            {
+                // Compress the package in memory.
+                Writer(pending->serialized) << pending->saved->archive();
+                pending->compressed = true;
+            }
+            catch (const Error &er)
+            {
+                LOG_RES_WARNING("Error compressing game session for '%s':\n")
+                        << pending->savePath << er.asText();
+            }
+            // The session may already have written it, if it had to wait for this.
+            Loop::mainCall([pending] () { Impl::finishSave(*pending); });
+        });
     }
     catch (const Error &er)
     {
@@ -1388,17 +1493,20 @@ void GameSession::load(const String &saveName)
 
 void GameSession::copySaved(const String &destName, const String &sourceName)
 {
+    d->waitForPendingSave();
     AbstractSession::copySaved(d->userSavePath(destName), d->userSavePath(sourceName));
     LOG_MSG("Copied savegame \"%s\" to \"%s\"") << sourceName << destName;
 }
 
 void GameSession::removeSaved(const String &saveName)
 {
+    d->waitForPendingSave();
     AbstractSession::removeSaved(d->userSavePath(saveName));
 }
 
 String GameSession::savedUserDescription(const String &saveName)
 {
+    d->waitForPendingSave();
     const String savePath = d->userSavePath(saveName);
     if (const auto *saved = App::rootFolder().tryLocate<GameStateFolder>(savePath))
     {
@@ -362,7 +362,7 @@ DE_PIMPL(MapStateReader)
         }
         else
         {
-            Z_Free(th);
+            Thinker::destroy(th);
         }
 
         return false; // Continue iteration.
@@ -616,7 +616,7 @@ DE_PIMPL(MapStateReader)
             }
             else
             {
-                th = Thinker(Thinker::AllocateMemoryZone, thInfo->size).take();
+                th = Thinker(Thinker::AllocatePooled, thInfo->size).take();
             }
 
             bool putThinkerInStasis = (formatHasStasisInfo? CPP_BOOL(Reader_ReadByte(reader)) : false);
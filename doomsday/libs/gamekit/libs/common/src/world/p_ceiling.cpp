@@ -365,7 +365,7 @@ static int EV_DoCeiling2(int tag, float basespeed, ceilingtype_e type)
 
         // new door thinker
         rtn = 1;
-        ceiling_t *ceiling = (ceiling_t *)Z_Calloc(sizeof(*ceiling), PU_MAP, 0);
+        ceiling_t *ceiling = ThinkerT<ceiling_t>(Thinker::AllocatePooled).take();
 
         ceiling->thinker.function = T_MoveCeiling;
         Thinker_Add(&ceiling->thinker);
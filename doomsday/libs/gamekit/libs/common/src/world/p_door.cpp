@@ -378,7 +378,7 @@ static int EV_DoDoor2(int tag, float speed, int topwait, doortype_e type)
 
         // new door thinker
         rtn = 1;
-        door_t *door = (door_t *)Z_Calloc(sizeof(*door), PU_MAP, 0);
+        door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
         door->thinker.function = T_Door;
         Thinker_Add(&door->thinker);
         xsec->specialData = door;
@@ -782,7 +782,7 @@ dd_bool EV_VerticalDoor(Line *line, mobj_t *mo)
     }
 
     // New door thinker.
-    door_t *door = (door_t *) Z_Calloc(sizeof(*door), PU_MAP, 0);
+    door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
     door->thinker.function = T_Door;
     Thinker_Add(&door->thinker);
 
@@ -903,7 +903,7 @@ dd_bool EV_VerticalDoor(Line *line, mobj_t *mo)
 #if __JDOOM__ || __JHERETIC__ || __JDOOM64__
 void P_SpawnDoorCloseIn30(Sector *sec)
 {
-    door_t *door = (door_t *)Z_Calloc(sizeof(*door), PU_MAP, 0);
+    door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
     door->thinker.function = T_Door;
     Thinker_Add(&door->thinker);
 
@@ -920,7 +920,7 @@ void P_SpawnDoorCloseIn30(Sector *sec)
 
 void P_SpawnDoorRaiseIn5Mins(Sector *sec)
 {
-    door_t *door = (door_t *)Z_Calloc(sizeof(*door), PU_MAP, 0);
+    door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
     door->thinker.function = T_Door;
     Thinker_Add(&door->thinker);
 
@@ -702,7 +702,7 @@ int EV_DoFloor(Line *line, floortype_e floortype)
         rtn = 1;
 
         // New floor thinker.
-        floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+        floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
         floor->thinker.function = T_MoveFloor;
         Thinker_Add(&floor->thinker);
         xsec->specialData = floor;
@@ -1156,7 +1156,7 @@ int EV_BuildStairs(Line *line, stair_e type)
 
         // New floor thinker.
         rtn = 1;
-        floor_t *floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+        floor_t *floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
         floor->thinker.function = T_MoveFloor;
         Thinker_Add(&floor->thinker);
 
@@ -1207,7 +1207,7 @@ int EV_BuildStairs(Line *line, stair_e type)
         while(P_Iteratep(params.baseSec, DMU_LINE, findAdjacentSectorForSpread, &params))
         {
             // We found another sector to spread to.
-            floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+            floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
             floor->thinker.function = T_MoveFloor;
             Thinker_Add(&floor->thinker);
 
@@ -1269,7 +1269,7 @@ static void processStairSector(Sector *sec, int type, coord_t height,
 
     height += stairData.stepDelta;
 
-    floor_t *floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+    floor_t *floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
     floor->thinker.function = T_MoveFloor;
     Thinker_Add(&floor->thinker);
     P_ToXSector(sec)->specialData = floor;
@@ -1446,7 +1446,7 @@ int EV_DoDonut(Line *line)
             coord_t destHeight = P_GetDoublep(outer, DMU_FLOOR_HEIGHT);
 
             // Spawn rising slime.
-            floor_t *floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+            floor_t *floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
             floor->thinker.function = T_MoveFloor;
             Thinker_Add(&floor->thinker);
 
@@ -1462,7 +1462,7 @@ int EV_DoDonut(Line *line)
             floor->floorDestHeight = destHeight;
 
             // Spawn lowering donut-hole.
-            floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, 0);
+            floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
             floor->thinker.function = T_MoveFloor;
             Thinker_Add(&floor->thinker);
 
@@ -40,25 +40,18 @@
 #include "p_mapsetup.h"
 
 #include <doomsday/world/lineopening.h>
+#include <de/hash.h>
+#include <de/list.h>
+#include <de/taskpool.h>
+#include <de/time.h>
 
 /*
- * Try move variables:
+ * Results of the most recent position check or move, for the game to inspect:
  */
-static AABoxd tmBox;
-static mobj_t *tmThing;
 dd_bool tmFloatOk; ///< @c true= move would be ok if within "tmFloorZ - tmCeilingZ".
 coord_t tmFloorZ;
 coord_t tmCeilingZ;
-#if __JHEXEN__
-static world_Material *tmFloorMaterial;
-#endif
 dd_bool tmFellDown; // $dropoff_fix
-static coord_t tm[3];
-static coord_t tmDropoffZ;
-#if __JDOOM__ || __JDOOM64__ || __JHERETIC__
-static Line *tmHitLine;
-static int tmUnstuck; ///< $unstuck: used to check unsticking
-#endif
 Line *tmBlockingLine; // $unstuck: blocking line
 #if __JHEXEN__
 mobj_t *tmBlockingMobj;
@@ -70,20 +63,109 @@ Line *tmCeilingLine;
 Line *tmFloorLine;
 
 /*
- * Line aim/attack variables:
+ * Results of the most recent aim/attack:
  */
 mobj_t *lineTarget; // Who got hit (or NULL).
-static coord_t attackRange;
+static coord_t attackRange; ///< Range of the most recent aim.
 #if __JHEXEN__
 mobj_t *PuffSpawned;
 #endif
-static coord_t shootZ; ///< Height if not aiming up or down.
-static mobj_t *shooterThing;
-static float aimSlope;
-static float topSlope, bottomSlope; ///< Slopes to top and bottom of target.
+
+/**
+ * State of a single position check or move attempt. Each check has its own, so
+ * that a check started while another one is in progress (e.g., by a line special
+ * or a damage reaction) does not disturb the outer one.
+ */
+struct trymove_params_t
+{
+    mobj_t *thing;       ///< Mobj being moved.
+    coord_t pos[3];      ///< Position being checked.
+    AABoxd box;          ///< Bounds of @ref thing at @ref pos.
+    dd_bool floatOk;     ///< @c true= move would be ok if within "floorZ - ceilingZ".
+    coord_t floorZ;
+    coord_t ceilingZ;
+    coord_t dropoffZ;    ///< Lowest point contacted.
+    dd_bool fellDown;    ///< $dropoff_fix
+    Line *ceilingLine;
+    Line *floorLine;
+#if __JHEXEN__
+    world_Material *floorMaterial;
+    mobj_t *blockingMobj;
+#else
+    Line *blockingLine;  ///< $unstuck: blocking line
+    Line *hitLine;       ///< Special line hit (for XG).
+    int unstuck;         ///< $unstuck: used to check unsticking
+#endif
+    de::List<Line *> specHits; ///< Contacted lines with a special, for crossing.
+};
+
+/**
+ * Incremented whenever a position check or a teleport begins. All checks used to
+ * share one list of contacted special lines, which a nested check (e.g., a
+ * teleport triggered by crossing a line) cleared. Callers processing their lines
+ * compare this before and after activating a line, and stop if it has changed,
+ * like they did when the nested check emptied the shared list.
+ */
+static int positionCheckCount;
+
+/**
+ * Makes the outcome of a position check available to the game via the tm* globals
+ * and @ref spechit.
+ */
+static void publishPosition(const trymove_params_t &tm)
+{
+    tmFloorZ       = tm.floorZ;
+    tmCeilingZ     = tm.ceilingZ;
+    tmCeilingLine  = tm.ceilingLine;
+    tmFloorLine    = tm.floorLine;
+#if __JHEXEN__
+    tmBlockingMobj = tm.blockingMobj;
+#else
+    tmBlockingLine = tm.blockingLine;
+#endif
+
+    IterList_Clear(spechit);
+    for(Line *line : tm.specHits)
+    {
+        IterList_PushBack(spechit, line);
+    }
+}
 
 /// Sector >= Sector line-of-sight rejection.
-static byte *rejectMatrix;
+static const byte *rejectMatrix;
+static int sightCheckCount;  ///< Since the matrix was initialized.
+static int sightRejectCount;
+static de::TimeSpan sightTraceTime; ///< Spent in the traces not rejected.
+
+/**
+ * Line-of-sight trace evaluated ahead of the thinkers of the current tic (see
+ * P_PrecomputeSight()). The result is only used if the inputs of the trace and
+ * the map geometry are unchanged, so the outcome is the same as tracing serially.
+ */
+struct sightquery_t
+{
+    const mobj_t *beholder;
+    const mobj_t *target;
+    vec3d_t from;
+    vec3d_t to;
+    coord_t targetHeight;
+    int geometryStamp;
+    bool visible;
+};
+static de::Hash<const mobj_t *, sightquery_t> sightQueries; ///< By beholder.
+
+/// Minimum number of queries in a tic for the pre-pass to be worthwhile.
+static const int SIGHT_PREPASS_MIN_QUERIES = 32;
+
+/**
+ * Sight pre-pass mode, from the command line: -nosightprepass turns it off, and
+ * with -sightprepasscheck (always in debug builds) the pre-pass is done but the
+ * serial traces decide. Every precomputed result is then compared with the
+ * serial one, so a tic whose state would differ with the pre-pass on and off is
+ * a fatal error.
+ */
+enum { SIGHT_PREPASS_OFF, SIGHT_PREPASS_ON, SIGHT_PREPASS_CHECK };
+static int sightPrepassMode = -1;
 
 coord_t P_GetGravity()
 {
@@ -118,6 +200,48 @@ static dd_bool checkReject(Sector *sec1, Sector *sec2)
     return true;
 }
 
+/**
+ * Determines the point from where @a beholder is looking, i.e., its "eyes".
+ */
+static void sightOrigin(const mobj_t *beholder, vec3d_t from)
+{
+    V3d_Copy(from, beholder->origin);
+    if(!P_MobjIsCamera(beholder))
+    {
+        from[VZ] += beholder->height + -(beholder->height / 4);
+    }
+}
+
+static inline bool sameSightPoint(const_pvec3d_t a, const_pvec3d_t b)
+{
+    return a[VX] == b[VX] && a[VY] == b[VY] && a[VZ] == b[VZ];
+}
+
+/**
+ * Looks up the result of a trace done during the pre-pass of the current tic.
+ *
+ * @return  The precomputed query, or @c nullptr if there is none for these inputs.
+ */
+static const sightquery_t *precomputedSight(const mobj_t *beholder, const mobj_t *target,
+                                            const_pvec3d_t from)
+{
+    if(sightQueries.empty()) return nullptr;
+
+    auto found = sightQueries.find(beholder);
+    if(found == sightQueries.end()) return nullptr;
+
+    const sightquery_t &query = found->second;
+    if(query.target == target &&
+       query.targetHeight == target->height &&
+       sameSightPoint(query.from, from) &&
+       sameSightPoint(query.to, target->origin) &&
+       query.geometryStamp == DD_GetInteger(DD_MAP_GEOMETRY_STAMP))
+    {
+        return &query;
+    }
+    return nullptr;
+}
+
 dd_bool P_CheckSight(const mobj_t *beholder, const mobj_t *target)
 {
     if(!beholder || !target) return false;
@@ -130,19 +254,120 @@ dd_bool P_CheckSight(const mobj_t *beholder, const mobj_t *target)
     if(P_MobjIsCamera(target)) return false;
 
     // Does a reject table exist and if so, should this line-of-sight fail?
+    sightCheckCount++;
     if(!checkReject(Mobj_Sector(beholder), Mobj_Sector(target)))
     {
+        sightRejectCount++;
         return false;
     }
 
     // The line-of-sight is from the "eyes" of the beholder.
-    vec3d_t from = { beholder->origin[VX], beholder->origin[VY], beholder->origin[VZ] };
-    if(!P_MobjIsCamera(beholder))
+    vec3d_t from;
+    sightOrigin(beholder, from);
+
+    // Maybe the trace has already been done during the pre-pass?
+    const sightquery_t *query = precomputedSight(beholder, target, from);
+    if(query && sightPrepassMode != SIGHT_PREPASS_CHECK)
     {
-        from[VZ] += beholder->height + -(beholder->height / 4);
+        return query->visible;
+    }
+
+    const de::Time tracedAt;
+    const dd_bool visible = P_CheckLineSight(from, target->origin, 0, target->height, 0);
+    sightTraceTime += tracedAt.since();
+
+    if(query && CPP_BOOL(visible) != query->visible)
+    {
+        App_FatalError("P_CheckSight: The sight pre-pass changes the playsim at map time %i "
+                       "(mobj %i looking at mobj %i: precomputed %s, traced %s)",
+                       mapTime, beholder->thinker.id, target->thinker.id,
+                       query->visible? "visible" : "hidden", visible? "visible" : "hidden");
+    }
+    return visible;
+}
+
+void P_InitRejectMatrix()
+{
+    if(sightCheckCount)
+    {
+        LOGDEV_MAP_MSG("%i sight checks during the previous map, %.1f%% rejected by REJECT, "
+                       "%.1f ms spent tracing the rest")
+            << sightCheckCount << 100.0 * sightRejectCount / sightCheckCount
+            << double(sightTraceTime) * 1000.0;
+    }
+    sightCheckCount = sightRejectCount = 0;
+    sightTraceTime = 0.0;
+
+    // Clients do not check sight. With -noreject, every check is traced; compare
+    // the time spent tracing with and without it.
+    rejectMatrix = (IS_CLIENT || CommandLine_Check("-noreject"))? nullptr
+                 : (const byte *) DD_GetVariable(DD_MAP_REJECT_MATRIX);
+}
+
+void P_PrecomputeSight()
+{
+    sightQueries.clear();
+
+    if(sightPrepassMode < 0)
+    {
+        sightPrepassMode = CommandLine_Check("-nosightprepass")?    SIGHT_PREPASS_OFF
+                         : CommandLine_Check("-sightprepasscheck")? SIGHT_PREPASS_CHECK
+#ifdef DE_DEBUG
+                         : SIGHT_PREPASS_CHECK;
+#else
+                         : SIGHT_PREPASS_ON;
+#endif
     }
+    if(sightPrepassMode == SIGHT_PREPASS_OFF) return;
 
-    return P_CheckLineSight(from, target->origin, 0, target->height, 0);
+    // Clients do not run the monster AI.
+    if(IS_CLIENT) return;
+
+    // Monsters check whether they can see their targets while thinking.
+    de::List<sightquery_t> queries;
+    P_IterateThinkers(P_MobjThinker, [&queries] (thinker_t *th)
+    {
+        const mobj_t *mo = reinterpret_cast<mobj_t *>(th);
+        const mobj_t *target = mo->target;
+
+        if(mo->health <= 0 || (mo->flags & MF_MISSILE) || !target)
+            return false; // Continue iteration.
+
+        if(!Mobj_Sector(mo) || !Mobj_Sector(target) || P_MobjIsCamera(target))
+            return false; // Continue iteration.
+
+        if(!checkReject(Mobj_Sector(mo), Mobj_Sector(target)))
+            return false; // Continue iteration.
+
+        sightquery_t query;
+        query.beholder     = mo;
+        query.target       = target;
+        sightOrigin(mo, query.from);
+        V3d_Copy(query.to, target->origin);
+        query.targetHeight = target->height;
+        query.visible      = false;
+        queries.append(query);
+        return false; // Continue iteration.
+    });
+
+    if(queries.sizei() < SIGHT_PREPASS_MIN_QUERIES) return;
+
+    // The traces only read the map, so they can be done concurrently.
+    de::TaskPool::forBatches(queries.sizei(), [&queries] (int, int begin, int end)
+    {
+        for(int i = begin; i < end; ++i)
+        {
+            sightquery_t &query = queries[i];
+            query.visible = P_CheckLineSight(query.from, query.to, 0, query.targetHeight, 0);
+        }
+    }, 16);
+
+    const int geometryStamp = DD_GetInteger(DD_MAP_GEOMETRY_STAMP);
+    for(sightquery_t &query : queries)
+    {
+        query.geometryStamp = geometryStamp;
+        sightQueries.insert(query.beholder, query);
+    }
 }
 
 angle_t P_AimAtPoint2(coord_t const from[], coord_t const to[], dd_bool shadowed)
@@ -212,7 +437,7 @@ dd_bool P_TeleportMove(mobj_t *mobj, coord_t x, coord_t y, dd_bool alwaysStomp)
 {
     if(!mobj) return false;
 
-    IterList_Clear(spechit); /// @todo necessary? -ds
+    positionCheckCount++;
 
     // Attempt to stomp any mobjs in the way.
     pit_stompthing_params_t parm;
@@ -362,24 +587,26 @@ static int untouched(Line *line, mobj_t *mobj)
 }
 #endif
 
-static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
+static int PIT_CheckThing(mobj_t *thing, void *context)
 {
+    trymove_params_t &tm = *static_cast<trymove_params_t *>(context);
+
     // Don't clip against oneself.
-    if(thing == tmThing)
+    if(thing == tm.thing)
     {
         return false;
     }
 
 #if __JHEXEN__
     // Don't clip on something we are stood on.
-    if(thing == tmThing->onMobj)
+    if(thing == tm.thing->onMobj)
     {
         return false;
     }
 #endif
 
     if(!(thing->flags & (MF_SOLID | MF_SPECIAL | MF_SHOOTABLE)) ||
-       P_MobjIsCamera(thing) || P_MobjIsCamera(tmThing))
+       P_MobjIsCamera(thing) || P_MobjIsCamera(tm.thing))
     {
         return false;
     }
@@ -387,11 +614,11 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 #if !__JHEXEN__
     // Player only.
     dd_bool overlap = false;
-    if(tmThing->player && !FEQUAL(tm[VZ], DDMAXFLOAT) &&
-       (cfg.moveCheckZ || (tmThing->flags2 & MF2_PASSMOBJ)))
+    if(tm.thing->player && !FEQUAL(tm.pos[VZ], DDMAXFLOAT) &&
+       (cfg.moveCheckZ || (tm.thing->flags2 & MF2_PASSMOBJ)))
     {
-        if((thing->origin[VZ] > tm[VZ] + tmThing->height) ||
-           (thing->origin[VZ] + thing->height < tm[VZ]))
+        if((thing->origin[VZ] > tm.pos[VZ] + tm.thing->height) ||
+           (thing->origin[VZ] + thing->height < tm.pos[VZ]))
         {
             return false; // Under or over it.
         }
@@ -400,9 +627,9 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
     }
 #endif
 
-    coord_t blockdist = thing->radius + tmThing->radius;
-    if(fabs(thing->origin[VX] - tm[VX]) >= blockdist ||
-       fabs(thing->origin[VY] - tm[VY]) >= blockdist)
+    coord_t blockdist = thing->radius + tm.thing->radius;
+    if(fabs(thing->origin[VX] - tm.pos[VX]) >= blockdist ||
+       fabs(thing->origin[VY] - tm.pos[VY]) >= blockdist)
     {
         return false; // Didn't hit thing.
     }
@@ -410,13 +637,13 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
     if(IS_CLIENT)
     {
         // On clientside, missiles don't collide with mobjs.
-        if(tmThing->ddFlags & DDMF_MISSILE)
+        if(tm.thing->ddFlags & DDMF_MISSILE)
         {
             return false;
         }
 
         // Players can't hit their own clmobjs.
-        if(tmThing->player && ClPlayer_ClMobj(tmThing->player - players) == thing)
+        if(tm.thing->player && ClPlayer_ClMobj(tm.thing->player - players) == thing)
         {
             return false;
         }
@@ -430,24 +657,24 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 */
 
 #if __JHEXEN__
-    tmBlockingMobj = thing;
+    tm.blockingMobj = thing;
 #endif
 
 #if __JHEXEN__
-    if(tmThing->flags2 & MF2_PASSMOBJ)
+    if(tm.thing->flags2 & MF2_PASSMOBJ)
 #else
-    if(!tmThing->player && (tmThing->flags2 & MF2_PASSMOBJ))
+    if(!tm.thing->player && (tm.thing->flags2 & MF2_PASSMOBJ))
 #endif
     {
         // Check if a mobj passed over/under another object.
 #if __JHERETIC__
-        if((tmThing->type == MT_IMP || tmThing->type == MT_WIZARD) &&
+        if((tm.thing->type == MT_IMP || tm.thing->type == MT_WIZARD) &&
            (thing->type == MT_IMP || thing->type == MT_WIZARD))
         {
             return true; // Don't let imps/wizards fly over other imps/wizards.
         }
 #elif __JHEXEN__
-        if(tmThing->type == MT_BISHOP && thing->type == MT_BISHOP)
+        if(tm.thing->type == MT_BISHOP && thing->type == MT_BISHOP)
         {
             return true; // Don't let bishops fly over other bishops.
         }
@@ -455,8 +682,8 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 
         if(!(thing->flags & MF_SPECIAL))
         {
-            if(tmThing->origin[VZ] > thing->origin[VZ] + thing->height ||
-               tmThing->origin[VZ] + tmThing->height < thing->origin[VZ])
+            if(tm.thing->origin[VZ] > thing->origin[VZ] + thing->height ||
+               tm.thing->origin[VZ] + tm.thing->height < thing->origin[VZ])
             {
                 return false; // Over/under thing.
             }
@@ -464,12 +691,12 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
     }
 
     // Check for skulls slamming into things.
-    if((tmThing->flags & MF_SKULLFLY) && (thing->flags & MF_SOLID))
+    if((tm.thing->flags & MF_SKULLFLY) && (thing->flags & MF_SOLID))
     {
 #if __JHEXEN__
-        tmBlockingMobj = 0;
+        tm.blockingMobj = 0;
 
-        if(tmThing->type == MT_MINOTAUR)
+        if(tm.thing->type == MT_MINOTAUR)
         {
             // Slamming minotaurs shouldn't move non-creatures.
             if(!(thing->flags & MF_COUNTKILL))
@@ -477,9 +704,9 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                 return true;
             }
         }
-        else if(tmThing->type == MT_HOLY_FX)
+        else if(tm.thing->type == MT_HOLY_FX)
         {
-            if((thing->flags & MF_SHOOTABLE) && thing != tmThing->target)
+            if((thing->flags & MF_SHOOTABLE) && thing != tm.thing->target)
             {
                 if(IS_NETGAME && !gfw_Rule(deathmatch) && thing->player)
                 {
@@ -489,14 +716,14 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                 if((thing->flags2 & MF2_REFLECTIVE) &&
                    (thing->player || (thing->flags2 & MF2_BOSS)))
                 {
-                    tmThing->tracer = tmThing->target;
-                    tmThing->target = thing;
+                    tm.thing->tracer = tm.thing->target;
+                    tm.thing->target = thing;
                     return false;
                 }
 
                 if(thing->flags & MF_COUNTKILL || thing->player)
                 {
-                    tmThing->tracer = thing;
+                    tm.thing->tracer = thing;
                 }
 
                 if(P_Random() < 96)
@@ -506,14 +733,14 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                     {
                         damage = 3;
                         // Ghost burns out faster when attacking players/bosses.
-                        tmThing->health -= 6;
+                        tm.thing->health -= 6;
                     }
 
-                    P_DamageMobj(thing, tmThing, tmThing->target, damage, false);
+                    P_DamageMobj(thing, tm.thing, tm.thing->target, damage, false);
                     if(P_Random() < 128)
                     {
-                        P_SpawnMobj(MT_HOLY_PUFF, tmThing->origin, P_Random() << 24, 0);
-                        S_StartSound(SFX_SPIRIT_ATTACK, tmThing);
+                        P_SpawnMobj(MT_HOLY_PUFF, tm.thing->origin, P_Random() << 24, 0);
+                        S_StartSound(SFX_SPIRIT_ATTACK, tm.thing);
 
                         if((thing->flags & MF_COUNTKILL) && P_Random() < 128 &&
                            !S_IsPlaying(SFX_PUPPYBEAT, thing))
@@ -530,7 +757,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 
                 if(thing->health <= 0)
                 {
-                    tmThing->tracer = 0;
+                    tm.thing->tracer = 0;
                 }
             }
 
@@ -538,7 +765,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
         }
 #endif
 
-        int damage = tmThing->damage;
+        int damage = tm.thing->damage;
 #if __JDOOM__
         /// @attention Kludge:
         /// Older save versions did not serialize the damage property,
@@ -546,20 +773,20 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
         /// @fixme Do this during map state deserialization.
         if(damage == DDMAXINT)
         {
-            damage = tmThing->info->damage;
+            damage = tm.thing->info->damage;
         }
 #endif
 
         damage *= (P_Random() % 8) + 1;
-        P_DamageMobj(thing, tmThing, tmThing, damage, false);
+        P_DamageMobj(thing, tm.thing, tm.thing, damage, false);
 
-        tmThing->flags &= ~MF_SKULLFLY;
-        tmThing->mom[MX] = tmThing->mom[MY] = tmThing->mom[MZ] = 0;
+        tm.thing->flags &= ~MF_SKULLFLY;
+        tm.thing->mom[MX] = tm.thing->mom[MY] = tm.thing->mom[MZ] = 0;
 
 #if __JHERETIC__ || __JHEXEN__
-        P_MobjChangeState(tmThing, P_GetState(mobjtype_t(tmThing->type), SN_SEE));
+        P_MobjChangeState(tm.thing, P_GetState(mobjtype_t(tm.thing->type), SN_SEE));
 #else
-        P_MobjChangeState(tmThing, P_GetState(mobjtype_t(tmThing->type), SN_SPAWN));
+        P_MobjChangeState(tm.thing, P_GetState(mobjtype_t(tm.thing->type), SN_SPAWN));
 #endif
 
         return true; // Stop moving.
@@ -567,21 +794,21 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 
 #if __JHEXEN__
     // Check for blasted thing running into another
-    if((tmThing->flags2 & MF2_BLASTED) && (thing->flags & MF_SHOOTABLE))
+    if((tm.thing->flags2 & MF2_BLASTED) && (thing->flags & MF_SHOOTABLE))
     {
         if(!(thing->flags2 & MF2_BOSS) && (thing->flags & MF_COUNTKILL))
         {
-            thing->mom[MX] += tmThing->mom[MX];
-            thing->mom[MY] += tmThing->mom[MY];
+            thing->mom[MX] += tm.thing->mom[MX];
+            thing->mom[MY] += tm.thing->mom[MY];
 
-            NetSv_PlayerMobjImpulse(thing, tmThing->mom[MX], tmThing->mom[VY], 0);
+            NetSv_PlayerMobjImpulse(thing, tm.thing->mom[MX], tm.thing->mom[VY], 0);
 
             if((thing->mom[MX] + thing->mom[MY]) > 3)
             {
-                P_DamageMobj(thing, tmThing, tmThing,
-                             (tmThing->info->mass / 100) + 1, false);
+                P_DamageMobj(thing, tm.thing, tm.thing,
+                             (tm.thing->info->mass / 100) + 1, false);
 
-                P_DamageMobj(tmThing, thing, thing,
+                P_DamageMobj(tm.thing, thing, thing,
                              ((thing->info->mass / 100) + 1) >> 2, false);
             }
 
@@ -591,7 +818,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 #endif
 
     // Missiles can hit other things.
-    if(tmThing->flags & MF_MISSILE)
+    if(tm.thing->flags & MF_MISSILE)
     {
 #if __JHEXEN__
         // Check for a non-shootable mobj.
@@ -601,35 +828,35 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
         }
 #else
         // Check for passing through a ghost.
-        if((thing->flags & MF_SHADOW) && (tmThing->flags2 & MF2_THRUGHOST))
+        if((thing->flags & MF_SHADOW) && (tm.thing->flags2 & MF2_THRUGHOST))
         {
             return false;
         }
 #endif
 
         // See if it went over / under.
-        if(tmThing->origin[VZ] > thing->origin[VZ] + thing->height ||
-           tmThing->origin[VZ] + tmThing->height < thing->origin[VZ])
+        if(tm.thing->origin[VZ] > thing->origin[VZ] + thing->height ||
+           tm.thing->origin[VZ] + tm.thing->height < thing->origin[VZ])
         {
             return false;
         }
 
 #if __JHEXEN__
-        if(tmThing->flags2 & MF2_FLOORBOUNCE)
+        if(tm.thing->flags2 & MF2_FLOORBOUNCE)
         {
-            return !(tmThing->target == thing || !(thing->flags & MF_SOLID));
+            return !(tm.thing->target == thing || !(thing->flags & MF_SOLID));
         }
 
-        if(tmThing->type == MT_LIGHTNING_FLOOR || tmThing->type == MT_LIGHTNING_CEILING)
+        if(tm.thing->type == MT_LIGHTNING_FLOOR || tm.thing->type == MT_LIGHTNING_CEILING)
         {
-            if((thing->flags & MF_SHOOTABLE) && thing != tmThing->target)
+            if((thing->flags & MF_SHOOTABLE) && thing != tm.thing->target)
             {
                 if(thing->info->mass != DDMAXINT)
                 {
-                    thing->mom[MX] += tmThing->mom[MX] / 16;
-                    thing->mom[MY] += tmThing->mom[MY] / 16;
+                    thing->mom[MX] += tm.thing->mom[MX] / 16;
+                    thing->mom[MY] += tm.thing->mom[MY] / 16;
 
-                    NetSv_PlayerMobjImpulse(thing, tmThing->mom[MX] / 16, tmThing->mom[MY] / 16, 0);
+                    NetSv_PlayerMobjImpulse(thing, tm.thing->mom[MX] / 16, tm.thing->mom[MY] / 16, 0);
                 }
 
                 if((!thing->player && !(thing->flags2 & MF2_BOSS)) ||
@@ -638,16 +865,16 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                     // Lightning does more damage to centaurs.
                     if(thing->type == MT_CENTAUR || thing->type == MT_CENTAURLEADER)
                     {
-                        P_DamageMobj(thing, tmThing, tmThing->target, 9, false);
+                        P_DamageMobj(thing, tm.thing, tm.thing->target, 9, false);
                     }
                     else
                     {
-                        P_DamageMobj(thing, tmThing, tmThing->target, 3, false);
+                        P_DamageMobj(thing, tm.thing, tm.thing->target, 3, false);
                     }
 
-                    if(!S_IsPlaying(SFX_MAGE_LIGHTNING_ZAP, tmThing))
+                    if(!S_IsPlaying(SFX_MAGE_LIGHTNING_ZAP, tm.thing))
                     {
-                        S_StartSound(SFX_MAGE_LIGHTNING_ZAP, tmThing);
+                        S_StartSound(SFX_MAGE_LIGHTNING_ZAP, tm.thing);
                     }
 
                     if((thing->flags & MF_COUNTKILL) && P_Random() < 64 &&
@@ -662,34 +889,34 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                     }
                 }
 
-                tmThing->health--;
-                if(tmThing->health <= 0 || thing->health <= 0)
+                tm.thing->health--;
+                if(tm.thing->health <= 0 || thing->health <= 0)
                 {
                     return true;
                 }
 
-                if(tmThing->type == MT_LIGHTNING_FLOOR)
+                if(tm.thing->type == MT_LIGHTNING_FLOOR)
                 {
-                    if(tmThing->lastEnemy && !tmThing->lastEnemy->tracer)
+                    if(tm.thing->lastEnemy && !tm.thing->lastEnemy->tracer)
                     {
-                        tmThing->lastEnemy->tracer = thing;
+                        tm.thing->lastEnemy->tracer = thing;
                     }
                 }
-                else if(!tmThing->tracer)
+                else if(!tm.thing->tracer)
                 {
-                    tmThing->tracer = thing;
+                    tm.thing->tracer = thing;
                 }
             }
 
             return false; // Lightning zaps through all sprites.
         }
 
-        if(tmThing->type == MT_LIGHTNING_ZAP)
+        if(tm.thing->type == MT_LIGHTNING_ZAP)
         {
-            if((thing->flags & MF_SHOOTABLE) && thing != tmThing->target &&
-               tmThing->lastEnemy)
+            if((thing->flags & MF_SHOOTABLE) && thing != tm.thing->target &&
+               tm.thing->lastEnemy)
             {
-                mobj_t *lmo = tmThing->lastEnemy;
+                mobj_t *lmo = tm.thing->lastEnemy;
 
                 if(lmo->type == MT_LIGHTNING_FLOOR)
                 {
@@ -709,7 +936,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                 }
             }
         }
-        else if(tmThing->type == MT_MSTAFF_FX2 && thing != tmThing->target)
+        else if(tm.thing->type == MT_MSTAFF_FX2 && thing != tm.thing->target)
         {
             if(!thing->player && !(thing->flags2 & MF2_BOSS))
             {
@@ -721,7 +948,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
                     break;
 
                 default:
-                    P_DamageMobj(thing, tmThing, tmThing->target, 10, false);
+                    P_DamageMobj(thing, tm.thing, tm.thing->target, 10, false);
                     return false;
                 }
             }
@@ -730,15 +957,15 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 
         // Don't hit same species as originator.
 #if __JDOOM__ || __JDOOM64__
-        if(tmThing->target &&
-           (tmThing->target->type == thing->type ||
-           (tmThing->target->type == MT_KNIGHT && thing->type == MT_BRUISER) ||
-           (tmThing->target->type == MT_BRUISER && thing->type == MT_KNIGHT)))
+        if(tm.thing->target &&
+           (tm.thing->target->type == thing->type ||
+           (tm.thing->target->type == MT_KNIGHT && thing->type == MT_BRUISER) ||
+           (tm.thing->target->type == MT_BRUISER && thing->type == MT_KNIGHT)))
 #else
-        if(tmThing->target && tmThing->target->type == thing->type)
+        if(tm.thing->target && tm.thing->target->type == thing->type)
 #endif
         {
-            if(thing == tmThing->target)
+            if(thing == tm.thing->target)
             {
                 return false;
             }
@@ -763,7 +990,7 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
             return !!(thing->flags & MF_SOLID); // Didn't do any damage.
         }
 
-        if(tmThing->flags2 & MF2_RIP)
+        if(tm.thing->flags2 & MF2_RIP)
         {
 #if __JHEXEN__
             if(!(thing->flags & MF_NOBLOOD) &&
@@ -773,14 +1000,14 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
             if(!(thing->flags & MF_NOBLOOD))
 #endif
             {   // Ok to spawn some blood.
-                P_RipperBlood(tmThing);
+                P_RipperBlood(tm.thing);
             }
 
 #if __JHERETIC__
-            S_StartSound(SFX_RIPSLOP, tmThing);
+            S_StartSound(SFX_RIPSLOP, tm.thing);
 #endif
 
-            int damage = tmThing->damage;
+            int damage = tm.thing->damage;
 #if __JDOOM__
             /// @attention Kludge:
             /// Older save versions did not serialize the damage property,
@@ -788,41 +1015,41 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
             /// @fixme Do this during map state deserialization.
             if(damage == DDMAXINT)
             {
-                damage = tmThing->info->damage;
+                damage = tm.thing->info->damage;
             }
 #endif
 
             damage *= (P_Random() & 3) + 2;
-            P_DamageMobj(thing, tmThing, tmThing->target, damage, false);
+            P_DamageMobj(thing, tm.thing, tm.thing->target, damage, false);
 
-            if((thing->flags2 & MF2_PUSHABLE) && !(tmThing->flags2 & MF2_CANNOTPUSH))
+            if((thing->flags2 & MF2_PUSHABLE) && !(tm.thing->flags2 & MF2_CANNOTPUSH))
             {
                 // Push thing
-                thing->mom[MX] += tmThing->mom[MX] / 4;
-                thing->mom[MY] += tmThing->mom[MY] / 4;
-                NetSv_PlayerMobjImpulse(thing, tmThing->mom[MX]/4, tmThing->mom[MY]/4, 0);
+                thing->mom[MX] += tm.thing->mom[MX] / 4;
+                thing->mom[MY] += tm.thing->mom[MY] / 4;
+                NetSv_PlayerMobjImpulse(thing, tm.thing->mom[MX]/4, tm.thing->mom[MY]/4, 0);
             }
 
-            IterList_Clear(spechit);
+            tm.specHits.clear();
             return false;
         }
 
         // Do damage
-        int damage = tmThing->damage;
+        int damage = tm.thing->damage;
 #if __JDOOM__
         /// @attention Kludge:
         /// Older save versions did not serialize the damage property,
         /// so here we take the damage from the current Thing definition.
         /// @fixme Do this during map state deserialization.
-        if(tmThing->damage == DDMAXINT)
+        if(tm.thing->damage == DDMAXINT)
         {
-            damage = tmThing->info->damage;
+            damage = tm.thing->info->damage;
         }
 #endif
 
         damage *= (P_Random() % 8) + 1;
 #if __JDOOM__ || __JDOOM64__
-        P_DamageMobj(thing, tmThing, tmThing->target, damage, false);
+        P_DamageMobj(thing, tm.thing, tm.thing->target, damage, false);
 #else
         if(damage)
         {
@@ -832,17 +1059,17 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
             if(!(thing->flags & MF_NOBLOOD) &&
                !(thing->flags2 & MF2_REFLECTIVE) &&
                !(thing->flags2 & MF2_INVULNERABLE) &&
-               !(tmThing->type == MT_TELOTHER_FX1) &&
-               !(tmThing->type == MT_TELOTHER_FX2) &&
-               !(tmThing->type == MT_TELOTHER_FX3) &&
-               !(tmThing->type == MT_TELOTHER_FX4) &&
-               !(tmThing->type == MT_TELOTHER_FX5) && (P_Random() < 192))
+               !(tm.thing->type == MT_TELOTHER_FX1) &&
+               !(tm.thing->type == MT_TELOTHER_FX2) &&
+               !(tm.thing->type == MT_TELOTHER_FX3) &&
+               !(tm.thing->type == MT_TELOTHER_FX4) &&
+               !(tm.thing->type == MT_TELOTHER_FX5) && (P_Random() < 192))
 # endif
             {
-                P_SpawnBloodSplatter(tmThing->origin[VX], tmThing->origin[VY], tmThing->origin[VZ], thing);
+                P_SpawnBloodSplatter(tm.thing->origin[VX], tm.thing->origin[VY], tm.thing->origin[VZ], thing);
             }
 
-            P_DamageMobj(thing, tmThing, tmThing->target, damage, false);
+            P_DamageMobj(thing, tm.thing, tm.thing->target, damage, false);
         }
 #endif
 
@@ -850,17 +1077,17 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
         return true;
     }
 
-    if((thing->flags2 & MF2_PUSHABLE) && !(tmThing->flags2 & MF2_CANNOTPUSH))
+    if((thing->flags2 & MF2_PUSHABLE) && !(tm.thing->flags2 & MF2_CANNOTPUSH))
     {
         // Push thing.
-        coord_t pushImpulse[2] = {tmThing->mom[MX] / 4, tmThing->mom[MY] / 4};
+        coord_t pushImpulse[2] = {tm.thing->mom[MX] / 4, tm.thing->mom[MY] / 4};
 
         for (int axis = 0; axis < 2; ++axis)
         {
             // Do not exceed the momentum of the thing doing the pushing.
             if (cfg.common.pushableMomentumLimitedToPusher)
             {
-                coord_t maxIncrement = tmThing->mom[axis] - thing->mom[axis];
+                coord_t maxIncrement = tm.thing->mom[axis] - thing->mom[axis];
                 if (thing->mom[axis] > 0 && pushImpulse[axis] > 0)
                 {
                     pushImpulse[axis] = de::max(0.0, de::min(pushImpulse[axis], maxIncrement));
@@ -882,59 +1109,59 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 
     // @fixme Kludge: Always treat blood as a solid.
     dd_bool solid;
-    if(tmThing->type == MT_BLOOD)
+    if(tm.thing->type == MT_BLOOD)
     {
         solid = true;
     }
     else
     {
         solid = (thing->flags & MF_SOLID) && !(thing->flags & MF_NOCLIP) &&
-                (tmThing->flags & MF_SOLID);
+                (tm.thing->flags & MF_SOLID);
     }
     // Kludge end.
 
 #if __JHEXEN__
-    if(tmThing->player && tmThing->onMobj && solid)
+    if(tm.thing->player && tm.thing->onMobj && solid)
     {
         /// @todo Unify Hexen's onMobj logic with the other games.
 
         // We may be standing on more than one thing.
-        if(tmThing->origin[VZ] > thing->origin[VZ] + thing->height - 24)
+        if(tm.thing->origin[VZ] > thing->origin[VZ] + thing->height - 24)
         {
             // Stepping up on this is possible.
-            tmFloorZ = MAX_OF(tmFloorZ, thing->origin[VZ] + thing->height);
+            tm.floorZ = MAX_OF(tm.floorZ, thing->origin[VZ] + thing->height);
             solid = false;
         }
     }
 #endif
 
     // Check for special pickup.
-    if((thing->flags & MF_SPECIAL) && (tmThing->flags & MF_PICKUP))
+    if((thing->flags & MF_SPECIAL) && (tm.thing->flags & MF_PICKUP))
     {
-        P_TouchSpecialMobj(thing, tmThing); // Can remove thing.
+        P_TouchSpecialMobj(thing, tm.thing); // Can remove thing.
     }
 #if !__JHEXEN__
     else if(overlap && solid)
     {
         // How are we positioned, allow step up?
-        if(!(thing->flags & MF_CORPSE) && tm[VZ] > thing->origin[VZ] + thing->height - 24)
+        if(!(thing->flags & MF_CORPSE) && tm.pos[VZ] > thing->origin[VZ] + thing->height - 24)
         {
-            tmThing->onMobj = thing;
-            if(thing->origin[VZ] + thing->height > tmFloorZ)
+            tm.thing->onMobj = thing;
+            if(thing->origin[VZ] + thing->height > tm.floorZ)
             {
-                tmFloorZ = thing->origin[VZ] + thing->height;
+                tm.floorZ = thing->origin[VZ] + thing->height;
             }
             return false;
         }
     }
-    else if(!tmThing->player && solid)
+    else if(!tm.thing->player && solid)
     {
         // A non-player object is contacting a solid object.
-        if(cfg.allowMonsterFloatOverBlocking && (tmThing->flags & MF_FLOAT) && !thing->player)
+        if(cfg.allowMonsterFloatOverBlocking && (tm.thing->flags & MF_FLOAT) && !thing->player)
         {
             coord_t top = thing->origin[VZ] + thing->height;
-            tmThing->onMobj = thing;
-            tmFloorZ = MAX_OF(tmFloorZ, top);
+            tm.thing->onMobj = thing;
+            tm.floorZ = MAX_OF(tm.floorZ, top);
             return false;
         }
     }
@@ -946,11 +1173,13 @@ static int PIT_CheckThing(mobj_t *thing, void * /*context*/)
 /**
  * Adjusts tmFloorZ and tmCeilingZ as lines are contacted.
  */
-static int PIT_CheckLine(Line *ld, void * /*context*/)
+static int PIT_CheckLine(Line *ld, void *context)
 {
+    trymove_params_t &tm = *static_cast<trymove_params_t *>(context);
+
     const AABoxd *aaBox = (AABoxd *)P_GetPtrp(ld, DMU_BOUNDING_BOX);
-    if(tmBox.minX >= aaBox->maxX || tmBox.minY >= aaBox->maxY ||
-       tmBox.maxX <= aaBox->minX || tmBox.maxY <= aaBox->minY)
+    if(tm.box.minX >= aaBox->maxX || tm.box.minY >= aaBox->maxY ||
+       tm.box.maxX <= aaBox->minX || tm.box.maxY <= aaBox->minY)
     {
         return false;
     }
@@ -960,9 +1189,9 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
      * collision testing -- the rest of the playsim uses coord_t, and we don't
      * want conflicting results (e.g., getting stuck in tight spaces).
      */
-    if(Mobj_IsPlayer(tmThing) && !Mobj_IsVoodooDoll(tmThing))
+    if(Mobj_IsPlayer(tm.thing) && !Mobj_IsVoodooDoll(tm.thing))
     {
-        if(Line_BoxOnSide(ld, &tmBox)) // double precision floats
+        if(Line_BoxOnSide(ld, &tm.box)) // double precision floats
         {
             return false;
         }
@@ -970,7 +1199,7 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
     else
     {
         // Fixed-precision math gives better compatibility with vanilla DOOM.
-        if(Line_BoxOnSide_FixedPrecision(ld, &tmBox))
+        if(Line_BoxOnSide_FixedPrecision(ld, &tm.box))
         {
             return false;
         }
@@ -980,24 +1209,24 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
     xline_t *xline = P_ToXLine(ld);
 
 #if !__JHEXEN__
-    tmThing->wallHit = true;
+    tm.thing->wallHit = true;
 
     // A Hit event will be sent to special lines.
     if(xline->special)
     {
-        tmHitLine = ld;
+        tm.hitLine = ld;
     }
 #endif
 
     if(!P_GetPtrp(ld, DMU_BACK_SECTOR)) // One sided line.
     {
 #if __JHEXEN__
-        if(tmThing->flags2 & MF2_BLASTED)
+        if(tm.thing->flags2 & MF2_BLASTED)
         {
-            P_DamageMobj(tmThing, NULL, NULL, tmThing->info->mass >> 5, false);
+            P_DamageMobj(tm.thing, NULL, NULL, tm.thing->info->mass >> 5, false);
         }
 
-        checkForPushSpecial(ld, 0, tmThing);
+        checkForPushSpecial(ld, 0, tm.thing);
         return true;
 #else
         coord_t d1[2];
@@ -1016,10 +1245,10 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
          *       are only 8 units apart could be crossed in either order.
          */
 
-        tmBlockingLine = ld;
-        return !(tmUnstuck && !untouched(ld, tmThing) &&
-            ((tm[VX] - tmThing->origin[VX]) * d1[1]) >
-            ((tm[VY] - tmThing->origin[VY]) * d1[0]));
+        tm.blockingLine = ld;
+        return !(tm.unstuck && !untouched(ld, tm.thing) &&
+            ((tm.pos[VX] - tm.thing->origin[VX]) * d1[1]) >
+            ((tm.pos[VY] - tm.thing->origin[VY]) * d1[0]));
 #endif
     }
 
@@ -1029,49 +1258,49 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
     if(!P_GetPtrp(ld, DMU_BACK_SECTOR)) // one sided line
     {
         // Missiles can trigger impact specials
-        if((tmThing->flags & MF_MISSILE) && xline->special)
+        if((tm.thing->flags & MF_MISSILE) && xline->special)
         {
-            IterList_PushBack(spechit, ld);
+            tm.specHits.append(ld);
         }
         return true;
     }
 #endif
 
-    if(!(tmThing->flags & MF_MISSILE))
+    if(!(tm.thing->flags & MF_MISSILE))
     {
         // Explicitly blocking everything?
         if(P_GetIntp(ld, DMU_FLAGS) & DDLF_BLOCKING)
         {
 #if __JHEXEN__
-            if(tmThing->flags2 & MF2_BLASTED)
+            if(tm.thing->flags2 & MF2_BLASTED)
             {
-                P_DamageMobj(tmThing, NULL, NULL, tmThing->info->mass >> 5, false);
+                P_DamageMobj(tm.thing, NULL, NULL, tm.thing->info->mass >> 5, false);
             }
 
-            checkForPushSpecial(ld, 0, tmThing);
+            checkForPushSpecial(ld, 0, tm.thing);
             return true;
 #else
             // $unstuck: allow escape.
-            return !(tmUnstuck && !untouched(ld, tmThing));
+            return !(tm.unstuck && !untouched(ld, tm.thing));
 #endif
         }
 
         // Block monsters only?
 #if __JHEXEN__
-        if(!tmThing->player && tmThing->type != MT_CAMERA &&
+        if(!tm.thing->player && tm.thing->type != MT_CAMERA &&
            (xline->flags & ML_BLOCKMONSTERS))
 #elif __JHERETIC__
-        if(!tmThing->player && tmThing->type != MT_POD &&
+        if(!tm.thing->player && tm.thing->type != MT_POD &&
            (xline->flags & ML_BLOCKMONSTERS))
 #else
-        if(!tmThing->player &&
+        if(!tm.thing->player &&
            (xline->flags & ML_BLOCKMONSTERS))
 #endif
         {
 #if __JHEXEN__
-            if(tmThing->flags2 & MF2_BLASTED)
+            if(tm.thing->flags2 & MF2_BLASTED)
             {
-                P_DamageMobj(tmThing, NULL, NULL, tmThing->info->mass >> 5, false);
+                P_DamageMobj(tm.thing, NULL, NULL, tm.thing->info->mass >> 5, false);
             }
 #endif
             return true;
@@ -1079,51 +1308,55 @@ static int PIT_CheckLine(Line *ld, void * /*context*/)
     }
 
 #if __JDOOM64__
-    if((tmThing->flags & MF_MISSILE) && (xline->flags & ML_BLOCKALL))
+    if((tm.thing->flags & MF_MISSILE) && (xline->flags & ML_BLOCKALL))
     {
         // $unstuck: allow escape.
-        return !(tmUnstuck && !untouched(ld, tmThing));
+        return !(tm.unstuck && !untouched(ld, tm.thing));
     }
 #endif
 
     LineOpening opening; Line_Opening(ld, &opening);
 
     // Adjust floor / ceiling heights.
-    if(opening.top < tmCeilingZ)
+    if(opening.top < tm.ceilingZ)
     {
-        tmCeilingZ    = opening.top;
-        tmCeilingLine = ld;
+        tm.ceilingZ    = opening.top;
+        tm.ceilingLine = ld;
 #if !__JHEXEN__
-        tmBlockingLine     = ld;
+        tm.blockingLine = ld;
 #endif
     }
-    if(opening.bottom > tmFloorZ)
+    if(opening.bottom > tm.floorZ)
     {
-        tmFloorZ    = opening.bottom;
-        tmFloorLine = ld;
+        tm.floorZ    = opening.bottom;
+        tm.floorLine = ld;
 #if !__JHEXEN__
-        tmBlockingLine   = ld;
+        tm.blockingLine = ld;
 #endif
     }
-    if(opening.lowFloor < tmDropoffZ)
+    if(opening.lowFloor < tm.dropoffZ)
     {
-        tmDropoffZ  = opening.lowFloor;
+        tm.dropoffZ = opening.lowFloor;
     }
 
     // If contacted a special line, add it to the list.
     if(P_ToXLine(ld)->special)
     {
-        IterList_PushBack(spechit, ld);
+        tm.specHits.append(ld);
     }
 
 #if !__JHEXEN__
-    tmThing->wallHit = false;
+    tm.thing->wallHit = false;
 #endif
 
     return false; // Continue iteration.
 }
 
-dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
+/**
+ * Checks whether @a thing could be at the given position, taking note of the
+ * floor and ceiling heights and the lines contacted there in @a tm.
+ */
+static dd_bool checkPosition(trymove_params_t &tm, mobj_t *thing, coord_t x, coord_t y, coord_t z)
 {
 #if defined(__JHERETIC__)
     if (thing->type != MT_POD) // vanilla onMobj behavior for pods
@@ -1135,34 +1368,35 @@ dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
 #endif
     thing->wallHit = false;
 
-    tmThing         = thing;
-    V3d_Set(tm, x, y, z);
-    tmBox           = AABoxd(tm[VX] - tmThing->radius, tm[VY] - tmThing->radius,
-                             tm[VX] + tmThing->radius, tm[VY] + tmThing->radius);
+    tm.thing = thing;
+    V3d_Set(tm.pos, x, y, z);
+    tm.box   = AABoxd(tm.pos[VX] - tm.thing->radius, tm.pos[VY] - tm.thing->radius,
+                      tm.pos[VX] + tm.thing->radius, tm.pos[VY] + tm.thing->radius);
 #if !__JHEXEN__
-    tmHitLine       = 0;
+    tm.hitLine = 0;
 #endif
 
     // The base floor/ceiling is from the BSP leaf that contains the point.
     // Any contacted lines the step closer together will adjust them.
-    Sector *newSector = Sector_AtPoint_FixedPrecision(tm);
+    Sector *newSector = Sector_AtPoint_FixedPrecision(tm.pos);
 
-    tmCeilingLine   = tmFloorLine = 0;
-    tmFloorZ        = tmDropoffZ = P_GetDoublep(newSector, DMU_FLOOR_HEIGHT);
-    tmCeilingZ      = P_GetDoublep(newSector, DMU_CEILING_HEIGHT);
+    tm.ceilingLine   = tm.floorLine = 0;
+    tm.floorZ        = tm.dropoffZ = P_GetDoublep(newSector, DMU_FLOOR_HEIGHT);
+    tm.ceilingZ      = P_GetDoublep(newSector, DMU_CEILING_HEIGHT);
 #if __JHEXEN__
-    tmFloorMaterial = (world_Material *)P_GetPtrp(newSector, DMU_FLOOR_MATERIAL);
+    tm.floorMaterial = (world_Material *)P_GetPtrp(newSector, DMU_FLOOR_MATERIAL);
 #else
-    tmBlockingLine  = 0;
-    tmUnstuck       = Mobj_IsPlayer(thing) && !Mobj_IsVoodooDoll(thing);
+    tm.blockingLine  = 0;
+    tm.unstuck       = Mobj_IsPlayer(thing) && !Mobj_IsVoodooDoll(thing);
 #endif
 
-    IterList_Clear(spechit);
+    tm.specHits.clear();
+    positionCheckCount++;
 
-    if(tmThing->flags & MF_NOCLIP)
+    if(tm.thing->flags & MF_NOCLIP)
     {
 #if __JHEXEN__
-        if(!(tmThing->flags & MF_SKULLFLY))
+        if(!(tm.thing->flags & MF_SKULLFLY))
         {
             return true;
         }
@@ -1175,7 +1409,7 @@ dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
 
     // Check things first, possibly picking things up;
 #if __JHEXEN__
-    tmBlockingMobj = 0;
+    tm.blockingMobj = 0;
 #endif
 
     // The camera goes through all objects.
@@ -1186,10 +1420,10 @@ dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
          * into mapblocks based on their origin point and can overlap adjacent
          * blocks by up to MAXRADIUS units.
          */
-        AABoxd tmBoxExpanded(tmBox.minX - MAXRADIUS, tmBox.minY - MAXRADIUS,
-                             tmBox.maxX + MAXRADIUS, tmBox.maxY + MAXRADIUS);
+        AABoxd tmBoxExpanded(tm.box.minX - MAXRADIUS, tm.box.minY - MAXRADIUS,
+                             tm.box.maxX + MAXRADIUS, tm.box.maxY + MAXRADIUS);
 
-        if(Mobj_BoxIterator(&tmBoxExpanded, PIT_CheckThing, 0))
+        if(Mobj_BoxIterator(&tmBoxExpanded, PIT_CheckThing, &tm))
         {
             return false;
         }
@@ -1205,7 +1439,7 @@ dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
     }
 
 #if __JHEXEN__
-    if(tmThing->flags & MF_NOCLIP)
+    if(tm.thing->flags & MF_NOCLIP)
     {
         return true;
     }
@@ -1213,10 +1447,18 @@ dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
 
     // Check lines.
 #if __JHEXEN__
-    tmBlockingMobj = 0;
+    tm.blockingMobj = 0;
 #endif
 
-    return !Line_BoxIterator(&tmBox, LIF_ALL, PIT_CheckLine, 0);
+    return !Line_BoxIterator(&tm.box, LIF_ALL, PIT_CheckLine, &tm);
+}
+
+dd_bool P_CheckPositionXYZ(mobj_t *thing, coord_t x, coord_t y, coord_t z)
+{
+    trymove_params_t tm{};
+    const dd_bool result = checkPosition(tm, thing, x, y, z);
+    publishPosition(tm);
+    return result;
 }
 
 dd_bool P_CheckPosition(mobj_t *thing, coord_t const pos[3])
@@ -1236,22 +1478,18 @@ dd_bool Mobj_IsRemotePlayer(mobj_t *mo)
 }
 
 #if __JDOOM64__ || __JHERETIC__
-static void checkMissileImpact(mobj_t &mobj)
+static void checkMissileImpact(mobj_t &mobj, const trymove_params_t &tm)
 {
     if(IS_CLIENT) return;
 
     if(!(mobj.flags & MF_MISSILE)) return;
     if(!mobj.target || !mobj.target->player) return;
 
-    if(IterList_Empty(spechit)) return;
-
-    IterList_SetIteratorDirection(spechit, ITERLIST_BACKWARD);
-    IterList_RewindIterator(spechit);
-
-    Line *line;
-    while((line = (Line *)IterList_MoveIterator(spechit)) != 0)
+    const int checkCount = positionCheckCount;
+    for(auto i = tm.specHits.rbegin(); i != tm.specHits.rend(); ++i)
     {
-        P_ActivateLine(line, mobj.target, 0, SPAC_IMPACT);
+        P_ActivateLine(*i, mobj.target, 0, SPAC_IMPACT);
+        if(positionCheckCount != checkCount) break;
     }
 }
 #endif
@@ -1261,41 +1499,41 @@ static void checkMissileImpact(mobj_t &mobj)
  * MF_TELEPORT is set. $dropoff_fix
  */
 #if __JHEXEN__
-static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y)
+static dd_bool P_TryMove2(trymove_params_t &tm, mobj_t *thing, coord_t x, coord_t y)
 #else
-static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
+static dd_bool P_TryMove2(trymove_params_t &tm, mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 #endif
 {
     const dd_bool isRemotePlayer = Mobj_IsRemotePlayer(thing);
 
-    // $dropoff_fix: tmFellDown.
-    tmFloatOk  = false;
+    // $dropoff_fix: tm.fellDown.
+    tm.floatOk  = false;
 #if !__JHEXEN__
-    tmFellDown = false;
+    tm.fellDown = false;
 #endif
 
 #if __JHEXEN__
-    if(!P_CheckPositionXY(thing, x, y))
+    if(!checkPosition(tm, thing, x, y, DDMAXFLOAT))
 #else
-    if(!P_CheckPositionXYZ(thing, x, y, thing->origin[VZ]))
+    if(!checkPosition(tm, thing, x, y, thing->origin[VZ]))
 #endif
     {
 #if __JHEXEN__
-        if(!tmBlockingMobj || tmBlockingMobj->player || !thing->player)
+        if(!tm.blockingMobj || tm.blockingMobj->player || !thing->player)
         {
             goto pushline;
         }
-        else if(tmBlockingMobj->origin[VZ] + tmBlockingMobj->height - thing->origin[VZ] > 24 ||
-                (P_GetDoublep(Mobj_Sector(tmBlockingMobj), DMU_CEILING_HEIGHT) -
-                 (tmBlockingMobj->origin[VZ] + tmBlockingMobj->height) < thing->height) ||
-                (tmCeilingZ - (tmBlockingMobj->origin[VZ] + tmBlockingMobj->height) <
+        else if(tm.blockingMobj->origin[VZ] + tm.blockingMobj->height - thing->origin[VZ] > 24 ||
+                (P_GetDoublep(Mobj_Sector(tm.blockingMobj), DMU_CEILING_HEIGHT) -
+                 (tm.blockingMobj->origin[VZ] + tm.blockingMobj->height) < thing->height) ||
+                (tm.ceilingZ - (tm.blockingMobj->origin[VZ] + tm.blockingMobj->height) <
                  thing->height))
         {
             goto pushline;
         }
 #else
 #  if __JHERETIC__
-        checkMissileImpact(*thing);
+        checkMissileImpact(*thing, tm);
 #  endif
         // Would we hit another thing or a solid wall?
         if(!thing->onMobj || thing->wallHit)
@@ -1306,15 +1544,15 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
     if(!(thing->flags & MF_NOCLIP))
     {
 #if __JHEXEN__
-        if(tmCeilingZ - tmFloorZ < thing->height)
+        if(tm.ceilingZ - tm.floorZ < thing->height)
         {   // Doesn't fit.
             goto pushline;
         }
 
-        tmFloatOk = true;
+        tm.floatOk = true;
 
         if(!(thing->flags & MF_TELEPORT) &&
-           tmCeilingZ - thing->origin[VZ] < thing->height &&
+           tm.ceilingZ - thing->origin[VZ] < thing->height &&
            thing->type != MT_LIGHTNING_CEILING && !(thing->flags2 & MF2_FLY))
         {
             // Mobj must lower itself to fit.
@@ -1322,19 +1560,19 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
         }
 #else
         // Possibly allow escape if otherwise stuck.
-        dd_bool ret = (tmUnstuck &&
-            !(tmCeilingLine && untouched(tmCeilingLine, tmThing)) &&
-            !(tmFloorLine   && untouched(tmFloorLine, tmThing)));
+        dd_bool ret = (tm.unstuck &&
+            !(tm.ceilingLine && untouched(tm.ceilingLine, tm.thing)) &&
+            !(tm.floorLine   && untouched(tm.floorLine, tm.thing)));
 
-        if(tmCeilingZ - tmFloorZ < thing->height)
+        if(tm.ceilingZ - tm.floorZ < thing->height)
         {
             return ret; // Doesn't fit.
         }
 
         // Mobj must lower to fit.
-        tmFloatOk = true;
+        tm.floatOk = true;
         if(!(thing->flags & MF_TELEPORT) && !(thing->flags2 & MF2_FLY) &&
-           tmCeilingZ - thing->origin[VZ] < thing->height)
+           tm.ceilingZ - thing->origin[VZ] < thing->height)
         {
             return ret;
         }
@@ -1347,24 +1585,24 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 # endif
             )
         {
-            if(!isRemotePlayer && tmFloorZ - thing->origin[VZ] > 24)
+            if(!isRemotePlayer && tm.floorZ - thing->origin[VZ] > 24)
             {
 # if __JHERETIC__
-                checkMissileImpact(*thing);
+                checkMissileImpact(*thing, tm);
 # endif
                 return ret;
             }
         }
 # if __JHERETIC__
-        if((thing->flags & MF_MISSILE) && tmFloorZ > thing->origin[VZ])
+        if((thing->flags & MF_MISSILE) && tm.floorZ > thing->origin[VZ])
         {
-            checkMissileImpact(*thing);
+            checkMissileImpact(*thing, tm);
         }
 # endif
 #endif
         if(thing->flags2 & MF2_FLY)
         {
-            if(thing->origin[VZ] + thing->height > tmCeilingZ)
+            if(thing->origin[VZ] + thing->height > tm.ceilingZ)
             {
                 thing->mom[MZ] = -8;
 #if __JHEXEN__
@@ -1373,8 +1611,8 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
                 return false;
 #endif
             }
-            else if(thing->origin[VZ] < tmFloorZ &&
-                    tmFloorZ - tmDropoffZ > 24)
+            else if(thing->origin[VZ] < tm.floorZ &&
+                    tm.floorZ - tm.dropoffZ > 24)
             {
                 thing->mom[MZ] = 8;
 #if __JHEXEN__
@@ -1390,7 +1628,7 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
            // The Minotaur floor fire (MT_MNTRFX2) can step up any amount
            && thing->type != MT_MNTRFX2 && thing->type != MT_LIGHTNING_FLOOR
            && !isRemotePlayer
-           && tmFloorZ - thing->origin[VZ] > 24)
+           && tm.floorZ - thing->origin[VZ] > 24)
         {
             goto pushline;
         }
@@ -1398,7 +1636,7 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 
 #if __JHEXEN__
         if(!(thing->flags & (MF_DROPOFF | MF_FLOAT)) &&
-           (tmFloorZ - tmDropoffZ > 24) &&
+           (tm.floorZ - tm.dropoffZ > 24) &&
            !(thing->flags2 & MF2_BLASTED))
         {
             // Can't move over a dropoff unless it's been blasted.
@@ -1418,28 +1656,28 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
                 // Dropoff height limit.
                 if (cfg.avoidDropoffs)
                 {
-                    if (tmFloorZ - tmDropoffZ > 24)
+                    if (tm.floorZ - tm.dropoffZ > 24)
                     {
                         return false; // Don't stand over dropoff.
                     }
                 }
                 else
                 {
-                    coord_t floorZ = tmFloorZ;
+                    coord_t floorZ = tm.floorZ;
                     if (thing->onMobj)
                     {
                         // Thing is stood on something so use our z position as the floor.
-                        floorZ = (thing->origin[VZ] > tmFloorZ ? thing->origin[VZ] : tmFloorZ);
+                        floorZ = (thing->origin[VZ] > tm.floorZ ? thing->origin[VZ] : tm.floorZ);
                     }
 
                     if (!dropoff)
                     {
-                        if (thing->floorZ - floorZ > 24 || thing->dropOffZ - tmDropoffZ > 24)
+                        if (thing->floorZ - floorZ > 24 || thing->dropOffZ - tm.dropoffZ > 24)
                             return false;
                     }
                     else
                     {
-                        tmFellDown = !(thing->flags & MF_NOGRAVITY) && thing->origin[VZ] - floorZ > 24;
+                        tm.fellDown = !(thing->flags & MF_NOGRAVITY) && thing->origin[VZ] - floorZ > 24;
                     }
                 }
             }
@@ -1447,7 +1685,7 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
             else if (!thing->onMobj && (thing->flags & MF_DROPOFF) && !(thing->flags & MF_NOGRAVITY))
             {
                 // Allow gentle dropoff from great heights.
-                tmFellDown = (thing->origin[VZ] - tmFloorZ > 24);
+                tm.fellDown = (thing->origin[VZ] - tm.floorZ > 24);
             }
 #endif
         }
@@ -1457,10 +1695,10 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
         /// @todo D64 Mother demon fire attack.
         if(!(thing->flags & MF_TELEPORT) /*&& thing->type != MT_SPAWNFIRE*/
             && !isRemotePlayer
-            && tmFloorZ - thing->origin[VZ] > 24)
+            && tm.floorZ - thing->origin[VZ] > 24)
         {
             // Too big a step up
-            checkMissileImpact(*thing);
+            checkMissileImpact(*thing, tm);
             return false;
         }
 #endif
@@ -1468,8 +1706,8 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 #if __JHEXEN__
         // Must stay within a sector of a certain floor type?
         if((thing->flags2 & MF2_CANTLEAVEFLOORPIC) &&
-           (tmFloorMaterial != P_GetPtrp(Mobj_Sector(thing), DMU_FLOOR_MATERIAL) ||
-            !FEQUAL(tmFloorZ, thing->origin[VZ])))
+           (tm.floorMaterial != P_GetPtrp(Mobj_Sector(thing), DMU_FLOOR_MATERIAL) ||
+            !FEQUAL(tm.floorZ, thing->origin[VZ])))
         {
             return false;
         }
@@ -1478,7 +1716,7 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 #if !__JHEXEN__
         // $dropoff: prevent falling objects from going up too many steps.
         if(!thing->player && (thing->intFlags & MIF_FALLING) &&
-           tmFloorZ - thing->origin[VZ] > (thing->mom[MX] * thing->mom[MX]) +
+           tm.floorZ - thing->origin[VZ] > (thing->mom[MX] * thing->mom[MX]) +
                                           (thing->mom[MY] * thing->mom[MY]))
         {
             return false;
@@ -1493,10 +1731,10 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
 
     thing->origin[VX] = x;
     thing->origin[VY] = y;
-    thing->floorZ     = tmFloorZ;
-    thing->ceilingZ   = tmCeilingZ;
+    thing->floorZ     = tm.floorZ;
+    thing->ceilingZ   = tm.ceilingZ;
 #if __JDOOM__ || __JDOOM64__ || __JHERETIC__
-    thing->dropOffZ   = tmDropoffZ; // $dropoff_fix: keep track of dropoffs.
+    thing->dropOffZ   = tm.dropoffZ; // $dropoff_fix: keep track of dropoffs.
 #endif
 
     P_MobjLink(thing);
@@ -1518,9 +1756,11 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
     // If any special lines were hit, do the effect.
     if(!(thing->flags & (MF_TELEPORT | MF_NOCLIP)))
     {
-        Line *line;
-        while((line = (Line *)IterList_Pop(spechit)) != 0)
+        const int checkCount = positionCheckCount;
+        while(!tm.specHits.isEmpty() && positionCheckCount == checkCount)
         {
+            Line *line = tm.specHits.takeLast();
+
             // See if the line was crossed.
             if(P_ToXLine(line)->special)
             {
@@ -1565,20 +1805,18 @@ static dd_bool P_TryMove2(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff)
   pushline:
     if(!(thing->flags & (MF_TELEPORT | MF_NOCLIP)))
     {
-        if(tmThing->flags2 & MF2_BLASTED)
+        if(tm.thing->flags2 & MF2_BLASTED)
         {
-            P_DamageMobj(tmThing, NULL, NULL, tmThing->info->mass >> 5, false);
+            P_DamageMobj(tm.thing, NULL, NULL, tm.thing->info->mass >> 5, false);
         }
 
-        IterList_SetIteratorDirection(spechit, ITERLIST_BACKWARD);
-        IterList_RewindIterator(spechit);
-
-        Line *line;
-        while((line = (Line *)IterList_MoveIterator(spechit)) != 0)
+        const int checkCount = positionCheckCount;
+        for(auto i = tm.specHits.rbegin(); i != tm.specHits.rend(); ++i)
         {
             // See if the line was crossed.
-            int side = Line_PointOnSide(line, thing->origin) < 0;
-            checkForPushSpecial(line, side, thing);
+            int side = Line_PointOnSide(*i, thing->origin) < 0;
+            checkForPushSpecial(*i, side, thing);
+            if(positionCheckCount != checkCount) break;
         }
     }
     return false;
@@ -1591,17 +1829,24 @@ dd_bool P_TryMoveXY(mobj_t *thing, coord_t x, coord_t y)
 dd_bool P_TryMoveXY(mobj_t *thing, coord_t x, coord_t y, dd_bool dropoff, dd_bool slide)
 #endif
 {
+    trymove_params_t tm{};
 #if __JHEXEN__
-    return P_TryMove2(thing, x, y);
+    const dd_bool res = P_TryMove2(tm, thing, x, y);
+    publishPosition(tm);
+    tmFloatOk = tm.floatOk;
+    return res;
 #else
     // $dropoff_fix
-    dd_bool res = P_TryMove2(thing, x, y, dropoff);
+    const dd_bool res = P_TryMove2(tm, thing, x, y, dropoff);
+    publishPosition(tm);
+    tmFloatOk  = tm.floatOk;
+    tmFellDown = tm.fellDown;
 
-    if(!res && tmHitLine)
+    if(!res && tm.hitLine)
     {
         // Move not possible, see if the thing hit a line and send a Hit
         // event to it.
-        XL_HitLine(tmHitLine, Line_PointOnSide(tmHitLine, thing->origin) < 0,
+        XL_HitLine(tm.hitLine, Line_PointOnSide(tm.hitLine, thing->origin) < 0,
                    thing);
     }
 
@@ -1732,6 +1977,8 @@ struct ptr_shoottraverse_params_t
     mobj_t *shooterMobj; ///< Mobj doing the shooting.
     int damage;          ///< Damage to inflict.
     coord_t range;       ///< Maximum effective range from the trace origin.
+    coord_t shootZ;      ///< Height of the trace origin.
+    float aimSlope;      ///< Slope of the trace.
     mobjtype_t puffType; ///< Type of puff to spawn.
     bool puffNoSpark;    ///< @c true= Advance the puff to the first non-spark state.
 };
@@ -1742,12 +1989,12 @@ struct ptr_shoottraverse_params_t
  */
 static int PTR_ShootTraverse(const Intercept *icpt, void *context)
 {
+    ptr_shoottraverse_params_t &parm = *static_cast<ptr_shoottraverse_params_t *>(context);
+
     const vec3d_t tracePos = {
-        Interceptor_Origin(icpt->trace)[VX], Interceptor_Origin(icpt->trace)[VY], shootZ
+        Interceptor_Origin(icpt->trace)[VX], Interceptor_Origin(icpt->trace)[VY], parm.shootZ
     };
 
-    ptr_shoottraverse_params_t &parm = *static_cast<ptr_shoottraverse_params_t *>(context);
-
     if(icpt->type == ICPT_LINE)
     {
         bool lineWasHit = false;
@@ -1795,7 +2042,7 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
         {
             slope = (Interceptor_Opening(icpt->trace)->bottom - tracePos[VZ]) / dist;
 
-            if(slope > aimSlope) goto hitline;
+            if(slope > parm.aimSlope) goto hitline;
         }
 
         if(!FEQUAL(P_GetDoublep(frontSec, DMU_CEILING_HEIGHT),
@@ -1803,7 +2050,7 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
         {
             slope = (Interceptor_Opening(icpt->trace)->top - tracePos[VZ]) / dist;
 
-            if(slope < aimSlope) goto hitline;
+            if(slope < parm.aimSlope) goto hitline;
         }
         // Shot continues...
         return false;
@@ -1815,7 +2062,7 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
         coord_t frac = icpt->distance - (4 / parm.range);
         vec3d_t pos = { tracePos[VX] + Interceptor_Direction(icpt->trace)[VX] * frac,
                         tracePos[VY] + Interceptor_Direction(icpt->trace)[VY] * frac,
-                        tracePos[VZ] + aimSlope * (frac * parm.range) };
+                        tracePos[VZ] + parm.aimSlope * (frac * parm.range) };
 
         if(backSec)
         {
@@ -1959,13 +2206,13 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
     dz -= tracePos[VZ];
 
     coord_t thingTopSlope = dz / dist;
-    if(thingTopSlope < aimSlope)
+    if(thingTopSlope < parm.aimSlope)
     {
         return false; // Shot over the thing.
     }
 
     coord_t thingBottomSlope = (th->origin[VZ] - tracePos[VZ]) / dist;
-    if(thingBottomSlope > aimSlope)
+    if(thingBottomSlope > parm.aimSlope)
     {
         return false; // Shot under the thing.
     }
@@ -1976,7 +2223,7 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
     coord_t frac = icpt->distance - (10 / parm.range);
     vec3d_t pos  = { tracePos[VX] + Interceptor_Direction(icpt->trace)[VX] * frac,
                      tracePos[VY] + Interceptor_Direction(icpt->trace)[VY] * frac,
-                     tracePos[VZ] + aimSlope * (frac * parm.range) };
+                     tracePos[VZ] + parm.aimSlope * (frac * parm.range) };
 
     // Spawn bullet puffs or blood spots, depending on target type.
 #if __JHERETIC__ || __JHEXEN__
@@ -2040,13 +2287,26 @@ static int PTR_ShootTraverse(const Intercept *icpt, void *context)
     return true;
 }
 
+struct ptr_aimtraverse_params_t
+{
+    mobj_t *shooterMobj; ///< Mobj doing the aiming.
+    coord_t range;       ///< Maximum effective range from the trace origin.
+    coord_t shootZ;      ///< Height if not aiming up or down.
+    float topSlope;      ///< Slope to the top of the possible target range.
+    float bottomSlope;   ///< Slope to the bottom of the possible target range.
+    float aimSlope;      ///< Slope to the center of @ref target.
+    mobj_t *target;      ///< Mobj aimed at (or @c nullptr).
+};
+
 /**
- * Sets linetarget and aimSlope when a target is aimed at.
+ * Sets the target and aimSlope when a target is aimed at.
  */
-static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
+static int PTR_AimTraverse(const Intercept *icpt, void *context)
 {
+    ptr_aimtraverse_params_t &parm = *static_cast<ptr_aimtraverse_params_t *>(context);
+
     const vec3d_t tracePos = {
-        Interceptor_Origin(icpt->trace)[VX], Interceptor_Origin(icpt->trace)[VY], shootZ
+        Interceptor_Origin(icpt->trace)[VX], Interceptor_Origin(icpt->trace)[VY], parm.shootZ
     };
 
     if(icpt->type == ICPT_LINE)
@@ -2068,7 +2328,7 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
             return true; // Stop.
         }
 
-        coord_t dist   = attackRange * icpt->distance;
+        coord_t dist   = parm.range * icpt->distance;
         coord_t fFloor = P_GetDoublep(frontSec, DMU_FLOOR_HEIGHT);
         coord_t fCeil  = P_GetDoublep(frontSec, DMU_CEILING_HEIGHT);
         coord_t bFloor = P_GetDoublep(backSec, DMU_FLOOR_HEIGHT);
@@ -2077,25 +2337,25 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
         coord_t slope;
         if(!FEQUAL(fFloor, bFloor))
         {
-            slope = (Interceptor_Opening(icpt->trace)->bottom - shootZ) / dist;
-            if(slope > bottomSlope)
-                bottomSlope = slope;
+            slope = (Interceptor_Opening(icpt->trace)->bottom - parm.shootZ) / dist;
+            if(slope > parm.bottomSlope)
+                parm.bottomSlope = slope;
         }
 
         if(!FEQUAL(fCeil, bCeil))
         {
-            slope = (Interceptor_Opening(icpt->trace)->top - shootZ) / dist;
-            if(slope < topSlope)
-                topSlope = slope;
+            slope = (Interceptor_Opening(icpt->trace)->top - parm.shootZ) / dist;
+            if(slope < parm.topSlope)
+                parm.topSlope = slope;
         }
 
-        return topSlope <= bottomSlope;
+        return parm.topSlope <= parm.bottomSlope;
     }
 
     // Intercepted a mobj.
     mobj_t *th = icpt->mobj;
 
-    if(th == shooterThing) return false; // Can't aim at oneself.
+    if(th == parm.shooterMobj) return false; // Can't aim at oneself.
 
     if(!(th->flags & MF_SHOOTABLE)) return false; // Corpse or something (not shootable)?
 
@@ -2104,7 +2364,7 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
 #endif
 
 #if __JDOOM__ || __JHEXEN__ || __JDOOM64__
-    if(Mobj_IsPlayer(shooterThing) && Mobj_IsPlayer(th) &&
+    if(Mobj_IsPlayer(parm.shooterMobj) && Mobj_IsPlayer(th) &&
        IS_NETGAME && !gfw_Rule(deathmatch))
     {
         // In co-op, players don't aim at fellow players (although manually aiming is
@@ -2114,7 +2374,7 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
 #endif
 
     // Check angles to see if the thing can be aimed at.
-    coord_t dist = attackRange * icpt->distance;
+    coord_t dist = parm.range * icpt->distance;
     coord_t posZ = th->origin[VZ];
 
     if(!(th->player && (th->player->plr->flags & DDPF_CAMERA)))
@@ -2122,8 +2382,8 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
         posZ += th->height;
     }
 
-    coord_t thingTopSlope = (posZ - shootZ) / dist;
-    if(thingTopSlope < bottomSlope)
+    coord_t thingTopSlope = (posZ - parm.shootZ) / dist;
+    if(thingTopSlope < parm.bottomSlope)
     {
         return false; // Shot over the thing.
     }
@@ -2131,14 +2391,14 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
     // Too far below?
     // $addtocfg $limitautoaimZ:
 #if __JHEXEN__
-    if(posZ < shootZ - attackRange / 1.2f)
+    if(posZ < parm.shootZ - parm.range / 1.2f)
     {
         return false;
     }
 #endif
 
-    coord_t thingBottomSlope = (th->origin[VZ] - shootZ) / dist;
-    if(thingBottomSlope > topSlope)
+    coord_t thingBottomSlope = (th->origin[VZ] - parm.shootZ) / dist;
+    if(thingBottomSlope > parm.topSlope)
     {
         return false; // Shot under the thing.
     }
@@ -2146,36 +2406,34 @@ static int PTR_AimTraverse(const Intercept *icpt, void * /*context*/)
     // Too far above?
     // $addtocfg $limitautoaimZ:
 #if __JHEXEN__
-    if(th->origin[VZ] > shootZ + attackRange / 1.2f)
+    if(th->origin[VZ] > parm.shootZ + parm.range / 1.2f)
     {
         return false;
     }
 #endif
 
     // This thing can be hit!
-    if(thingTopSlope > topSlope)
+    if(thingTopSlope > parm.topSlope)
     {
-        thingTopSlope = topSlope;
+        thingTopSlope = parm.topSlope;
     }
-    if(thingBottomSlope < bottomSlope)
+    if(thingBottomSlope < parm.bottomSlope)
     {
-        thingBottomSlope = bottomSlope;
+        thingBottomSlope = parm.bottomSlope;
     }
 
-    aimSlope = (thingTopSlope + thingBottomSlope) / 2;
-    lineTarget = th;
+    parm.aimSlope = (thingTopSlope + thingBottomSlope) / 2;
+    parm.target = th;
 
     return true; // Don't go any farther.
 }
 
-float P_AimLineAttack(mobj_t *t1, angle_t angle, coord_t distance)
+/**
+ * Determines the height of the trace origin for an aim or attack by @a t1.
+ */
+static coord_t attackOriginZ(const mobj_t *t1)
 {
-    uint an = angle >> ANGLETOFINESHIFT;
-    vec2d_t target = { t1->origin[VX] + distance * FIX2FLT(finecosine[an]),
-                       t1->origin[VY] + distance * FIX2FLT(finesine[an]) };
-
-    // Determine the z trace origin.
-    shootZ = t1->origin[VZ];
+    coord_t shootZ = t1->origin[VZ];
 #if __JHEXEN__
     if(t1->player &&
       (t1->player->class_ == PCLASS_FIGHTER ||
@@ -2194,23 +2452,35 @@ float P_AimLineAttack(mobj_t *t1, angle_t angle, coord_t distance)
     {
         shootZ += (t1->height / 2) + 8;
     }
+    return shootZ;
+}
 
-    /// @todo What about t1->floorClip ? -ds
+float P_AimLineAttack(mobj_t *t1, angle_t angle, coord_t distance)
+{
+    uint an = angle >> ANGLETOFINESHIFT;
+    vec2d_t target = { t1->origin[VX] + distance * FIX2FLT(finecosine[an]),
+                       t1->origin[VY] + distance * FIX2FLT(finesine[an]) };
 
-    topSlope     = 100.0/160;
-    bottomSlope  = -100.0/160;
-    attackRange  = distance;
-    lineTarget   = 0;
-    shooterThing = t1;
+    ptr_aimtraverse_params_t parm;
+    parm.shooterMobj = t1;
+    parm.range       = distance;
+    parm.shootZ      = attackOriginZ(t1);
+    /// @todo What about t1->floorClip ? -ds
+    parm.topSlope    = 100.0/160;
+    parm.bottomSlope = -100.0/160;
+    parm.aimSlope    = 0;
+    parm.target      = 0;
 
-    P_PathTraverse(t1->origin, target, PTR_AimTraverse, 0);
+    P_PathTraverse(t1->origin, target, PTR_AimTraverse, &parm);
 
+    lineTarget  = parm.target;
+    attackRange = distance;
     if(lineTarget)
     {
         // While autoaiming, we accept this slope.
         if(!t1->player || !cfg.common.noAutoAim)
         {
-            return aimSlope;
+            return parm.aimSlope;
         }
     }
 
@@ -2230,33 +2500,11 @@ void P_LineAttack(mobj_t *t1, angle_t angle, coord_t distance, coord_t slope,
     vec2d_t target = { t1->origin[VX] + distance * FIX2FLT(finecosine[an]),
                        t1->origin[VY] + distance * FIX2FLT(finesine[an]) };
 
-    aimSlope = slope;
-
-    // Determine the z trace origin.
-    shootZ = t1->origin[VZ];
-#if __JHEXEN__
-    if(t1->player &&
-      (t1->player->class_ == PCLASS_FIGHTER ||
-       t1->player->class_ == PCLASS_CLERIC ||
-       t1->player->class_ == PCLASS_MAGE))
-#else
-    if(t1->player && t1->type == MT_PLAYER)
-#endif
-    {
-        if(!(t1->player->plr->flags & DDPF_CAMERA))
-        {
-            shootZ += cfg.common.plrViewHeight - 5;
-        }
-    }
-    else
-    {
-        shootZ += (t1->height / 2) + 8;
-    }
-    shootZ -= t1->floorClip;
-
     ptr_shoottraverse_params_t parm;
     parm.shooterMobj = t1;
     parm.range       = distance;
+    parm.shootZ      = attackOriginZ(t1) - t1->floorClip;
+    parm.aimSlope    = slope;
     parm.damage      = damage;
     parm.puffType    = puffType;
 #if __JDOOM__ || __JDOOM64__
@@ -2281,7 +2529,7 @@ void P_LineAttack(mobj_t *t1, angle_t angle, coord_t distance, coord_t slope,
             break;
 
         case MT_FLAMEPUFF: {
-            vec3d_t pos = { target[VX], target[VY], shootZ + (slope * distance) };
+            vec3d_t pos = { target[VX], target[VY], parm.shootZ + (slope * distance) };
             spawnPuff(puffType, pos);
             break; }
 
@@ -2724,11 +2972,12 @@ static int PIT_ChangeSector(mobj_t *thing, void *context)
     {
         const bool onfloor = de::fequal(thing->origin[VZ], thing->floorZ);
 
-        P_CheckPosition(thing, thing->origin);
-        thing->floorZ   = tmFloorZ;
-        thing->ceilingZ = tmCeilingZ;
+        trymove_params_t tm{};
+        checkPosition(tm, thing, thing->origin[VX], thing->origin[VY], thing->origin[VZ]);
+        thing->floorZ   = tm.floorZ;
+        thing->ceilingZ = tm.ceilingZ;
 #if !__JHEXEN__
-        thing->dropOffZ = tmDropoffZ; // $dropoff_fix: remember dropoffs.
+        thing->dropOffZ = tm.dropoffZ; // $dropoff_fix: remember dropoffs.
 #endif
 
         if (onfloor)
@@ -939,6 +939,7 @@ void P_FinalizeMapChange(const uri_s *mapUri_)
     initMapSpots();
     spawnMapObjects();
     PO_InitForMap();
+    P_InitRejectMatrix();
 
     HU_UpdatePsprites();
 
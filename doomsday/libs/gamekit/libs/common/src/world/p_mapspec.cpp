@@ -31,7 +31,7 @@
 
 using namespace de;
 
-iterlist_t *spechit;  ///< For crossed line specials.
+iterlist_t *spechit;  ///< Special lines of the most recent position check.
 
 struct spreadsoundtoneighbors_params_t
 {
@@ -326,7 +326,7 @@ static int doPlat(Line *line, int tag, plattype_e type, int amount)
         // Find lowest & highest floors around sector
         rtn = 1;
 
-        plat_t *plat = (plat_t *) Z_Calloc(sizeof(*plat), PU_MAP, 0);
+        plat_t *plat = ThinkerT<plat_t>(Thinker::AllocatePooled).take();
         plat->thinker.function = T_PlatRaise;
         Thinker_Add(&plat->thinker);
 
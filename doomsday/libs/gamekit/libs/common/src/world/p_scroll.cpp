@@ -132,7 +132,7 @@ static scroll_t *spawnMaterialOriginScroller(void *dmuObject, int elementBits, f
         return 0;
     }
 
-    scroll_t *scroll = (scroll_t *)Z_Calloc(sizeof(*scroll), PU_MAP, 0);
+    scroll_t *scroll = ThinkerT<scroll_t>(Thinker::AllocatePooled).take();
     scroll->thinker.function = (thinkfunc_t) T_Scroll;
     Thinker_Add(&scroll->thinker);
 
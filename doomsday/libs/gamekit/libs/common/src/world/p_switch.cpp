@@ -373,7 +373,7 @@ int materialchanger_s::read(MapStateReader *msr)
 
 static void spawnMaterialChanger(Side *side, SideSection section, world_Material *mat, int tics)
 {
-    materialchanger_t *mchanger = (materialchanger_t *)Z_Calloc(sizeof(*mchanger), PU_MAP, 0);
+    materialchanger_t *mchanger = ThinkerT<materialchanger_t>(Thinker::AllocatePooled).take();
     mchanger->thinker.function = T_MaterialChanger;
     Thinker_Add(&mchanger->thinker);
 
@@ -0,0 +1,144 @@
+/** @file p_synccheck.cpp  Playsim determinism checking.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#include "common.h"
+#include "p_synccheck.h"
+
+#include <cstdio>
+#include "dmu_lib.h"
+#include "p_map.h"
+#include "p_tick.h"
+
+namespace {
+
+/// FNV-1a over the bytes of the playsim state.
+struct SyncHash
+{
+    uint32_t value = 2166136261u;
+
+    void add(const void *data, size_t size)
+    {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(data);
+        for(size_t i = 0; i < size; ++i)
+        {
+            value = (value ^ bytes[i]) * 16777619u;
+        }
+    }
+
+    template <typename T>
+    void add(const T &v) { add(&v, sizeof(v)); }
+};
+
+struct SyncLog
+{
+    bool inited = false;
+    FILE *log = nullptr;    ///< -synclog
+    FILE *check = nullptr;  ///< -synccheck
+    unsigned int tic = 0;   ///< Playsim tics since startup.
+
+    ~SyncLog()
+    {
+        if(log)   fclose(log);
+        if(check) fclose(check);
+    }
+
+    void init()
+    {
+        inited = true;
+        if(int arg = CommandLine_CheckWith("-synclog", 1))
+        {
+            if(!(log = fopen(CommandLine_PathAt(arg + 1), "wt")))
+            {
+                LOG_MAP_WARNING("Failed to open \"%s\" for writing") << CommandLine_At(arg + 1);
+            }
+        }
+        if(int arg = CommandLine_CheckWith("-synccheck", 1))
+        {
+            if(!(check = fopen(CommandLine_PathAt(arg + 1), "rt")))
+            {
+                LOG_MAP_WARNING("Failed to open \"%s\"") << CommandLine_At(arg + 1);
+            }
+        }
+    }
+};
+
+SyncLog syncLog;
+
+} // namespace
+
+uint32_t P_PlaysimChecksum()
+{
+    SyncHash hash;
+    hash.add(mapTime);
+
+    P_IterateThinkers(P_MobjThinker, [&hash] (thinker_t *th)
+    {
+        const mobj_t *mo = reinterpret_cast<mobj_t *>(th);
+        hash.add(mo->thinker.id);
+        hash.add(mo->type);
+        hash.add(mo->origin);
+        hash.add(mo->mom);
+        hash.add(mo->angle);
+        hash.add(mo->health);
+        hash.add(mo->flags);
+        hash.add(mo->flags2);
+        hash.add(mo->tics);
+        hash.add(int(mo->state? mo->state - STATES : -1));
+        return false; // Continue iteration.
+    });
+
+    for(int i = 0; i < numsectors; ++i)
+    {
+        hash.add(P_GetDouble(DMU_SECTOR, i, DMU_FLOOR_HEIGHT));
+        hash.add(P_GetDouble(DMU_SECTOR, i, DMU_CEILING_HEIGHT));
+    }
+    return hash.value;
+}
+
+void P_SyncCheckTic()
+{
+    if(!syncLog.inited) syncLog.init();
+    if(!syncLog.log && !syncLog.check) return;
+
+    const unsigned int tic = syncLog.tic++;
+    const uint32_t checksum = P_PlaysimChecksum();
+
+    if(syncLog.log)
+    {
+        fprintf(syncLog.log, "%u %08x\n", tic, checksum);
+    }
+
+    if(syncLog.check)
+    {
+        unsigned int refTic = 0, refChecksum = 0;
+        if(fscanf(syncLog.check, "%u %x", &refTic, &refChecksum) != 2)
+        {
+            LOG_MAP_NOTE("Sync check: reference log ends at tic %u; no differences") << tic;
+            fclose(syncLog.check);
+            syncLog.check = nullptr;
+            return;
+        }
+        if(refTic != tic || refChecksum != checksum)
+        {
+            App_FatalError("Sync check: playsim state differs from the reference at tic %u "
+                           "(map time %i): %08x, expected %08x",
+                           tic, mapTime, checksum, refChecksum);
+        }
+    }
+}
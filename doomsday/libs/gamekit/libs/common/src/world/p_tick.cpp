@@ -28,6 +28,7 @@
 #include "hu_menu.h"
 #include "hu_msg.h"
 #include "p_actor.h"
+#include "p_synccheck.h"
 #include "p_user.h"
 #include "player.h"
 #include "r_common.h"
@@ -73,6 +74,7 @@ void P_DoTick()
        !Get(DD_PLAYBACK) && mapTime > 1)
         return;
 
+    P_PrecomputeSight();
     Thinker_Run();
 
 #if __JDOOM__ || __JDOOM64__ || __JHERETIC__
@@ -104,4 +106,6 @@ void P_DoTick()
 
     // For par times, among other things.
     mapTime++;
+
+    P_SyncCheckTic();
 }
@@ -43,6 +43,7 @@
 #include "p_tick.h"
 #include "p_sound.h"
 #include "p_switch.h"
+#include "xgindex.h"
 
 using namespace de;
 
@@ -64,7 +65,8 @@ using namespace de;
         : reftype == LREF_LINE_TAGGED? "LINE TAGGED LINES" \
         : reftype == LREF_ACT_TAGGED? "ACT TAGGED LINES" \
         : reftype == LREF_INDEX? "INDEXED LINE" \
-        : reftype == LREF_ALL? "ALL LINES" : "???")
+        : reftype == LREF_ALL? "ALL LINES" \
+        : reftype == LREF_TYPED? "TYPED LINES" : "???")
 
 #define LPREFTYPESTR(reftype) (reftype == LPREF_NONE? "NONE" \
         : reftype == LPREF_MY_FLOOR? "MY FLOOR" \
@@ -85,7 +87,9 @@ using namespace de;
         : reftype == LPREF_THING_EXIST_FLOORS? "SECTORS WITH THING - FLOOR" \
         : reftype == LPREF_THING_EXIST_CEILINGS? "SECTORS WITH THING - CEILING" \
         : reftype == LPREF_THING_NOEXIST_FLOORS? "SECTORS WITHOUT THING - FLOOR" \
-        : reftype == LPREF_THING_NOEXIST_CEILINGS? "SECTORS WITHOUT THING - CEILING" : "???")
+        : reftype == LPREF_THING_NOEXIST_CEILINGS? "SECTORS WITHOUT THING - CEILING" \
+        : reftype == LPREF_TYPED_FLOORS? "TYPED FLOORS" \
+        : reftype == LPREF_TYPED_CEILINGS? "TYPED CEILINGS" : "???")
 
 #define LSREFTYPESTR(reftype) (reftype == LSREF_NONE? "NONE" \
         : reftype == LSREF_MY? "MY SECTOR" \
@@ -96,7 +100,8 @@ using namespace de;
         : reftype == LSREF_ALL? "ALL SECTORS" \
         : reftype == LSREF_BACK? "BACK SECTOR" \
         : reftype == LSREF_THING_EXIST? "SECTORS WITH THING" \
-        : reftype == LSREF_THING_NOEXIST? "SECTORS WITHOUT THING" : "???")
+        : reftype == LSREF_THING_NOEXIST? "SECTORS WITHOUT THING" \
+        : reftype == LSREF_TYPED? "TYPED SECTORS" : "???")
 
 #define TO_DMU_TOP_COLOR(x) ((x) == 0? DMU_TOP_COLOR_RED \
         : (x) == 1? DMU_TOP_COLOR_GREEN \
@@ -136,6 +141,7 @@ int xgDev = 0; // Print dev messages.
 static linetype_t typebuffer;
 static char msgbuf[80];
 ThinkerT<mobj_s> dummyThing;
+static XGIndex xlIndex; ///< Lines by tag, and XG lines by act tag and type.
 
 struct mobj_s *XG_DummyThing()
 {
@@ -904,6 +910,25 @@ int findXLThinker(thinker_t *th, void *context)
     return false; // Continue iteration.
 }
 
+const XGIndex &XL_Index()
+{
+    return xlIndex;
+}
+
+/**
+ * Updates the index entries of @a line to match its current tag and XG state.
+ * Dummy lines are not part of the map and are not indexed.
+ */
+static void xlUpdateIndex(Line *line)
+{
+    const int index = P_ToIndex(line);
+    if(index < 0 || index >= xlIndex.elementCount()) return;
+
+    const xline_t *xline = P_ToXLine(line);
+    xlIndex.setElement(index, xline->tag, xline->xg != nullptr,
+                       xline->xg? xline->xg->info.actTag : 0, xline->special);
+}
+
 void XL_SetLineType(Line *line, int id)
 {
     LOG_AS("XL_SetLineType");
@@ -943,7 +968,7 @@ void XL_SetLineType(Line *line, int id)
 
             xl->thinker.function = XL_Thinker;*/
 
-            ThinkerT<xlthinker_t> xl(Thinker::AllocateMemoryZone);
+            ThinkerT<xlthinker_t> xl(Thinker::AllocatePooled);
             xl.function = XL_Thinker;
             xl->line = line;
 
@@ -954,12 +979,21 @@ void XL_SetLineType(Line *line, int id)
     {
         LOG_MAP_MSG_XGDEVONLY2("Line %i, type %i NOT DEFINED", P_ToIndex(line) << id);
     }
+
+    xlUpdateIndex(line);
 }
 
 void XL_Init()
 {
     dummyThing.Thinker::zap();
 
+    // Sector types refer to lines by tag, so index the tags in any case.
+    xlIndex.clear(de::max(numlines, 0));
+    for(int i = 0; i < numlines; ++i)
+    {
+        xlIndex.set(i, XGIndex::Tag, P_GetXLine(i)->tag);
+    }
+
     // Clients rely on the server, they don't do XG themselves.
     if(IS_CLIENT) return;
 
@@ -1037,7 +1071,8 @@ int XL_TraversePlanes(Line *line, int refType, int ref, void *data, void *contex
                     activator);
     }
 
-    // Can we use the tagged sector lists?
+    // Tagged and typed references are looked up from the sector index.
+    XGIndex::Key key = XGIndex::Tag;
     findSecTagged = false;
     if(refType == LPREF_TAGGED_FLOORS || refType == LPREF_TAGGED_CEILINGS)
     {
@@ -1050,49 +1085,43 @@ int XL_TraversePlanes(Line *line, int refType, int ref, void *data, void *contex
         findSecTagged = true;
         tag = P_ToXLine(line)->tag;
     }
+    else if(refType == LPREF_ACT_TAGGED_FLOORS ||
+            refType == LPREF_ACT_TAGGED_CEILINGS)
+    {
+        findSecTagged = true;
+        key = XGIndex::ActTag;
+        tag = ref;
+    }
+    else if(refType == LPREF_TYPED_FLOORS ||
+            refType == LPREF_TYPED_CEILINGS)
+    {
+        findSecTagged = true;
+        key = XGIndex::Type;
+        tag = ref;
+    }
 
     // References to multiple planes
     if(findSecTagged)
     {
-        // Use tagged sector lists for these (speed).
-        if(iterlist_t *list = P_GetSectorIterListForTag(tag, false))
-        {
-            // Find the first sector with the tag.
-            IterList_SetIteratorDirection(list, ITERLIST_FORWARD);
-            IterList_RewindIterator(list);
-
-            Sector *sec;
-            while((sec = (Sector *)IterList_MoveIterator(list)) != NULL)
-            {
-                //xsector_t *xsec = P_ToXSector(sec);
+        const dd_bool ceiling = (refType == LPREF_TAGGED_CEILINGS ||
+                                 refType == LPREF_LINE_TAGGED_CEILINGS ||
+                                 refType == LPREF_ACT_TAGGED_CEILINGS ||
+                                 refType == LPREF_TYPED_CEILINGS);
 
-                if(refType == LPREF_TAGGED_FLOORS || refType == LPREF_TAGGED_CEILINGS)
-                {
-                    if(!func(sec, refType == LPREF_TAGGED_CEILINGS, data,
-                             context, activator))
-                    {
-                        return false;
-                    }
-                }
-
-                if(refType == LPREF_LINE_TAGGED_FLOORS ||
-                   refType == LPREF_LINE_TAGGED_CEILINGS)
-                {
-                    if(!func(sec, refType == LPREF_LINE_TAGGED_CEILINGS,
-                             data, context, activator))
-                    {
-                        return false;
-                    }
-                }
-            }
-        }
+        // The callbacks may change tags and types.
+        const de::LoopResult aborted = XS_Index().forAllElements(key, tag, [&] (int i)
+        {
+            if(!func((Sector *)P_ToPtr(DMU_SECTOR, i), ceiling, data, context, activator))
+                return de::LoopAbort;
+            return de::LoopContinue;
+        });
+        return aborted? false : true;
     }
     else
     {
         for(int i = 0; i < numsectors; ++i)
         {
-            Sector *sec     = (Sector *)P_ToPtr(DMU_SECTOR, i);
-            xsector_t *xsec = P_ToXSector(sec);
+            Sector *sec = (Sector *)P_ToPtr(DMU_SECTOR, i);
 
             if(refType == LPREF_ALL_FLOORS || refType == LPREF_ALL_CEILINGS)
             {
@@ -1103,17 +1132,6 @@ int XL_TraversePlanes(Line *line, int refType, int ref, void *data, void *contex
                 }
             }
 
-            if((refType == LPREF_ACT_TAGGED_FLOORS ||
-                refType == LPREF_ACT_TAGGED_CEILINGS) && xsec->xg &&
-                xsec->xg->info.actTag == ref)
-            {
-                if(!func(sec, refType == LPREF_ACT_TAGGED_CEILINGS, data,
-                   context, activator))
-                {
-                   return false;
-                }
-            }
-
             // Reference all sectors with (at least) one mobj of specified
             // type inside.
             if(refType == LPREF_THING_EXIST_FLOORS ||
@@ -1207,7 +1225,8 @@ int XL_TraverseLines(Line* line, int rtype, int ref, void* data,
     if(reftype == LREF_INDEX)
         return func((Line *)P_ToPtr(DMU_LINE, ref), true, data, context, activator);
 
-    // Can we use the tagged line lists?
+    // Tagged and typed references are looked up from the line index.
+    XGIndex::Key key = XGIndex::Tag;
     findLineTagged = false;
     if(reftype == LREF_TAGGED)
     {
@@ -1219,54 +1238,44 @@ int XL_TraverseLines(Line* line, int rtype, int ref, void* data,
         findLineTagged = true;
         tag = P_ToXLine(line)->tag;
     }
+    else if(reftype == LREF_ACT_TAGGED)
+    {
+        findLineTagged = true;
+        key = XGIndex::ActTag;
+        tag = ref;
+    }
+    else if(reftype == LREF_TYPED)
+    {
+        findLineTagged = true;
+        key = XGIndex::Type;
+        tag = ref;
+    }
 
     // References to multiple lines
     if(findLineTagged)
     {
-        // Use tagged line lists for these (speed).
-        if(iterlist_t *list = P_GetLineIterListForTag(tag, false))
+        // The callbacks may change tags and types.
+        const de::LoopResult aborted = xlIndex.forAllElements(key, tag, [&] (int index)
         {
-            IterList_SetIteratorDirection(list, ITERLIST_FORWARD);
-            IterList_RewindIterator(list);
-            while((iter = (Line *)IterList_MoveIterator(list)) != NULL)
-            {
-                if(reftype == LREF_TAGGED)
-                {
-                    if(!func(iter, true, data, context, activator))
-                        return false;
-                }
-                else if(reftype == LREF_LINE_TAGGED)
-                {
-                    // Ref is true if line itself should be excluded.
-                    if(!ref || iter != line)
-                    {
-                        if(!func(iter, true, data, context, activator))
-                            return false;
-                    }
-                }
-            }
-        }
+            iter = (Line *)P_ToPtr(DMU_LINE, index);
+
+            // Ref is true if line itself should be excluded.
+            if(reftype == LREF_LINE_TAGGED && ref && iter == line)
+                return de::LoopContinue;
+
+            if(!func(iter, true, data, context, activator))
+                return de::LoopAbort;
+            return de::LoopContinue;
+        });
+        return aborted? false : true;
     }
-    else
+    else if(reftype == LREF_ALL)
     {
         for(i = 0; i < numlines; ++i)
         {
             iter = (Line *)P_ToPtr(DMU_LINE, i);
-            if(reftype == LREF_ALL)
-            {
-                if(!func(iter, true, data, context, activator))
-                    return false;
-            }
-            else if(reftype == LREF_ACT_TAGGED)
-            {
-                xline_t *xl = P_ToXLine(iter);
-
-                if(xl->xg && xl->xg->info.actTag == ref)
-                {
-                    if(!func(iter, true, data, context, activator))
-                        return false;
-                }
-            }
+            if(!func(iter, true, data, context, activator))
+                return false;
         }
     }
     return true;
@@ -3081,6 +3090,7 @@ void XL_Update(void)
         {
             xline->xg = NULL;
             xline->special = 0;
+            xlUpdateIndex((Line *)P_ToPtr(DMU_LINE, i));
         }
     }
 }
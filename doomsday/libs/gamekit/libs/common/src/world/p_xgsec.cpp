@@ -45,6 +45,7 @@
 #include "p_sound.h"
 #include "p_terraintype.h"
 #include "p_tick.h"
+#include "xgindex.h"
 
 #define MAX_VALS        128
 
@@ -104,6 +105,26 @@
 
 void XS_DoChain(Sector *sec, int ch, int activating, void *actThing);
 
+static XGIndex xsIndex; ///< Sectors by tag, and XG sectors by act tag and type.
+
+const XGIndex &XS_Index()
+{
+    return xsIndex;
+}
+
+/**
+ * Updates the index entries of @a sec to match its current tag and XG state.
+ */
+static void xsUpdateIndex(Sector *sec)
+{
+    const int index = P_ToIndex(sec);
+    if(index < 0 || index >= xsIndex.elementCount()) return;
+
+    const xsector_t *xsec = P_ToXSector(sec);
+    xsIndex.setElement(index, xsec->tag, xsec->xg != nullptr,
+                       xsec->xg? xsec->xg->info.actTag : 0, xsec->special);
+}
+
 /**
  * Lookup a sectortype_t with the given @a id and if found - copy it into @a outBuffer.
  *
@@ -380,7 +401,7 @@ void XS_SetSectorType(Sector *sec, int special)
         if(!Thinker_Iterate((thinkfunc_t) XS_Thinker, findXSThinker, sec))
         {
             // Not created one yet.
-            ThinkerT<xsthinker_t> xs(Thinker::AllocateMemoryZone);
+            ThinkerT<xsthinker_t> xs(Thinker::AllocatePooled);
             xs.function = XS_Thinker;
             xs->sector  = sec;
             Thinker_Add(xs.Thinker::take());
@@ -401,6 +422,8 @@ void XS_SetSectorType(Sector *sec, int special)
         // or anything.
         xsec->special = special;
     }
+
+    xsUpdateIndex(sec);
 }
 
 void XS_Init()
@@ -408,8 +431,15 @@ void XS_Init()
     /*  // Clients rely on the server, they don't do XG themselves.
     if(IS_CLIENT) return; */
 
+    xsIndex.clear(de::max(numsectors, 0));
     if(numsectors <= 0) return;
 
+    // Sector types may look up other sectors by tag while being set.
+    for(int i = 0; i < numsectors; ++i)
+    {
+        xsIndex.set(i, XGIndex::Tag, P_GetXSector(i)->tag);
+    }
+
     for(int i = 0; i < numsectors; ++i)
     {
         Sector *sec     = (Sector *) P_ToPtr(DMU_SECTOR, i);
@@ -650,7 +680,7 @@ xgplanemover_t *XS_GetPlaneMover(Sector *sec, dd_bool ceiling)
     Thinker_Iterate((thinkfunc_t) XS_PlaneMover, stopPlaneMover, &params);
 
     // Allocate a new thinker.
-    ThinkerT<xgplanemover_t> mover(Thinker::AllocateMemoryZone);
+    ThinkerT<xgplanemover_t> mover(Thinker::AllocatePooled);
     mover.function = (thinkfunc_t) XS_PlaneMover;
 
     xgplanemover_t *th = mover.take();
@@ -850,58 +880,29 @@ int XS_TextureHeight(Line* line, int part)
 }
 
 /**
- * Returns a pointer to the first sector with the tag.
- *
- * NOTE: We cannot use the tagged sector lists here as this can be called
- * during an iteration at a higher level. Doing so would change the position
- * of the rover which would affect the other iteration.
- *
- * NOTE2: Re-above, obviously that is bad design and should be addressed.
+ * Returns the first (lowest index) sector found in the index with @a value for
+ * @a key, logging a note if there are more of them when XG dev mode is on.
  */
-Sector *XS_FindTagged(int tag)
+static Sector *xsFindFirst(XGIndex::Key key, int value, const char *what)
 {
-    LOG_AS("XS_FindTagged");
-
-    int k;
-    int foundcount = 0;
-    int retsectorid = 0;
-    Sector *sec, *retsector;
+    const int found = xsIndex.first(key, value);
+    if(found < 0) return NULL;
 
-    retsector = NULL;
-
-    for(k = 0; k < numsectors; ++k)
+    if(xgDev && xsIndex.elements(key, value).size() > 1)
     {
-        sec = (Sector *) P_ToPtr(DMU_SECTOR, k);
-        if(P_ToXSector(sec)->tag == tag)
-        {
-            if(xgDev)
-            {
-                if(foundcount == 0)
-                {
-                    retsector = sec;
-                    retsectorid = k;
-                }
-            }
-            else
-                return sec;
-
-            foundcount++;
-        }
-    }
-
-    if(xgDev)
-    {
-        if(foundcount > 1)
-        {
-            LOG_MAP_MSG_XGDEVONLY2("More than one sector exists with this tag (%i)!", tag);
-            LOG_MAP_MSG_XGDEVONLY2("The sector with the lowest ID (%i) will be used", retsectorid);
-        }
-
-        if(retsector)
-            return retsector;
+        LOG_MAP_MSG_XGDEVONLY2("More than one sector exists with this %s (%i)!", what << value);
+        LOG_MAP_MSG_XGDEVONLY2("The sector with the lowest ID (%i) will be used", found);
     }
+    return (Sector *) P_ToPtr(DMU_SECTOR, found);
+}
 
-    return NULL;
+/**
+ * Returns a pointer to the first sector with the tag.
+ */
+Sector *XS_FindTagged(int tag)
+{
+    LOG_AS("XS_FindTagged");
+    return xsFindFirst(XGIndex::Tag, tag, "tag");
 }
 
 /**
@@ -910,54 +911,7 @@ Sector *XS_FindTagged(int tag)
 Sector *XS_FindActTagged(int tag)
 {
     LOG_AS("XS_FindActTagged");
-
-    int k;
-    int foundcount = 0;
-    int retsectorid = 0;
-    Sector *sec, *retsector;
-    xsector_t *xsec;
-
-    retsector = NULL;
-
-    for(k = 0; k < numsectors; ++k)
-    {
-        sec = (Sector *) P_ToPtr(DMU_SECTOR, k);
-        xsec = P_ToXSector(sec);
-        if(xsec->xg)
-        {
-            if(xsec->xg->info.actTag == tag)
-            {
-                if(xgDev)
-                {
-                    if(foundcount == 0)
-                    {
-                        retsector = sec;
-                        retsectorid = k;
-                    }
-                }
-                else
-                {
-                    return sec;
-                }
-
-                foundcount++;
-            }
-        }
-    }
-
-    if(xgDev)
-    {
-        if(foundcount > 1)
-        {
-            LOG_MAP_MSG_XGDEVONLY2("More than one sector exists with this ACT tag (%i)!", tag);
-            LOG_MAP_MSG_XGDEVONLY2("The sector with the lowest ID (%i) will be used", retsectorid);
-        }
-
-        if(retsector)
-            return retsector;
-    }
-
-    return NULL;
+    return xsFindFirst(XGIndex::ActTag, tag, "ACT tag");
 }
 
 #define FSETHF_MIN          0x1 // Get min. If not set, get max.
@@ -2187,6 +2141,9 @@ int C_DECL XSTrav_MimicSector(Sector *sector, dd_bool /*ceiling*/,
     if(P_ToXSector(from)->xg)
         memcpy(P_ToXSector(sector)->xg, P_ToXSector(from)->xg, sizeof(xgsector_t));
 
+    // The tag and act tag were copied, too.
+    xsUpdateIndex(sector);
+
     return true;
 }
 
@@ -3052,6 +3009,7 @@ void XS_Update(void)
         {
             xsec->xg = 0;
             xsec->special = 0;
+            xsUpdateIndex((Sector *) P_ToPtr(DMU_SECTOR, i));
         }
     }
 }
@@ -3109,20 +3067,13 @@ D_CMD(MovePlane)
     else if(!stricmp(argv[1], "tag") && argc >= 3)
     {
         int tag = (short) strtol(argv[2], 0, 0);
-        Sector* sec = NULL;
-        iterlist_t* list;
 
         p = 3;
-        list = P_GetSectorIterListForTag(tag, false);
-        if(list)
+        if(tag)
         {   // Find the first sector with the tag.
-            IterList_SetIteratorDirection(list, ITERLIST_FORWARD);
-            IterList_RewindIterator(list);
-            while((sec = (Sector *) IterList_MoveIterator(list)) != NULL)
-            {
-                sector = sec;
-                break;
-            }
+            const int found = xsIndex.first(XGIndex::Tag, tag);
+            if(found >= 0)
+                sector = (Sector *) P_ToPtr(DMU_SECTOR, found);
         }
     }
     else
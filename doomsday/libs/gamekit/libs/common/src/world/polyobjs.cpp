@@ -150,7 +150,7 @@ dd_bool EV_RotatePoly(Line *line, byte *args, int direction, dd_bool overRide)
         Con_Error("EV_RotatePoly:  Invalid polyobj tag: %d\n", tag);
     }
 
-    polyevent_t *pe = (polyevent_t *)Z_Calloc(sizeof(*pe), PU_MAP, 0);
+    polyevent_t *pe = ThinkerT<polyevent_t>(Thinker::AllocatePooled).take();
     pe->thinker.function = T_RotatePoly;
     Thinker_Add(&pe->thinker);
 
@@ -191,7 +191,7 @@ dd_bool EV_RotatePoly(Line *line, byte *args, int direction, dd_bool overRide)
             break;
         }
 
-        pe = (polyevent_t *)Z_Calloc(sizeof(*pe), PU_MAP, 0);
+        pe = ThinkerT<polyevent_t>(Thinker::AllocatePooled).take();
         pe->thinker.function = T_RotatePoly;
         Thinker_Add(&pe->thinker);
 
@@ -393,7 +393,7 @@ dd_bool EV_MovePoly(Line *line, byte *args, dd_bool timesEight, dd_bool override
     if(po->specialData && !override)
         return false;
 
-    polyevent_t *pe = (polyevent_t *)Z_Calloc(sizeof(*pe), PU_MAP, 0);
+    polyevent_t *pe = ThinkerT<polyevent_t>(Thinker::AllocatePooled).take();
     pe->thinker.function = T_MovePoly;
     Thinker_Add(&pe->thinker);
 
@@ -427,7 +427,7 @@ dd_bool EV_MovePoly(Line *line, byte *args, dd_bool timesEight, dd_bool override
         if(po && po->specialData && !override)
             break;
 
-        pe = (polyevent_t *)Z_Calloc(sizeof(*pe), PU_MAP, 0);
+        pe = ThinkerT<polyevent_t>(Thinker::AllocatePooled).take();
         pe->thinker.function = T_MovePoly;
         Thinker_Add(&pe->thinker);
 
@@ -669,7 +669,7 @@ dd_bool EV_OpenPolyDoor(Line *line, byte *args, podoortype_t type)
         Con_Error("EV_OpenPolyDoor:  Invalid polyobj num: %d\n", tag);
     }
 
-    polydoor_t *pd = (polydoor_t *)Z_Calloc(sizeof(*pd), PU_MAP, 0);
+    polydoor_t *pd = ThinkerT<polydoor_t>(Thinker::AllocatePooled).take();
     pd->thinker.function = T_PolyDoor;
     Thinker_Add(&pd->thinker);
 
@@ -712,7 +712,7 @@ dd_bool EV_OpenPolyDoor(Line *line, byte *args, podoortype_t type)
             break;
         }
 
-        pd = (polydoor_t *)Z_Calloc(sizeof(*pd), PU_MAP, 0);
+        pd = ThinkerT<polydoor_t>(Thinker::AllocatePooled).take();
         pd->thinker.function = T_PolyDoor;
         Thinker_Add(&pd->thinker);
 
@@ -0,0 +1,171 @@
+/** @file xgindex.cpp  Index of map elements by XG reference keys.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, write to the Free
+ * Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA
+ * 02110-1301 USA</small>
+ */
+
+#include "xgindex.h"
+
+#include <de/hash.h>
+#include <algorithm>
+
+using namespace de;
+
+DE_PIMPL_NOREF(XGIndex)
+{
+    struct Values
+    {
+        int value[KeyCount];
+        bool present[KeyCount];
+    };
+
+    List<Values> values; ///< Current values of each element.
+    Hash<int, List<int>> buckets[KeyCount];
+    const List<int> none;
+
+    void insert(Key key, int value, int element)
+    {
+        List<int> &list = buckets[key][value];
+        // Elements are usually added in ascending order.
+        if (list.isEmpty() || list.last() < element)
+        {
+            list << element;
+        }
+        else
+        {
+            list.insert(std::lower_bound(list.begin(), list.end(), element), element);
+        }
+    }
+
+    void remove(Key key, int value, int element)
+    {
+        auto found = buckets[key].find(value);
+        DE_ASSERT(found != buckets[key].end());
+        List<int> &list = found->second;
+        auto pos = std::lower_bound(list.begin(), list.end(), element);
+        DE_ASSERT(pos != list.end() && *pos == element);
+        list.removeAt(dsize(pos - list.begin()));
+        if (list.isEmpty())
+        {
+            buckets[key].erase(found);
+        }
+    }
+};
+
+XGIndex::XGIndex() : d(new Impl)
+{}
+
+void XGIndex::clear(int elementCount)
+{
+    for (auto &bucket : d->buckets)
+    {
+        bucket.clear();
+    }
+    d->values = List<Impl::Values>(dsize(elementCount), Impl::Values{{}, {}});
+}
+
+int XGIndex::elementCount() const
+{
+    return d->values.sizei();
+}
+
+void XGIndex::set(int element, Key key, int value)
+{
+    DE_ASSERT(element >= 0 && element < elementCount());
+    auto &vals = d->values[element];
+    if (vals.present[key])
+    {
+        if (vals.value[key] == value) return;
+        d->remove(key, vals.value[key], element);
+    }
+    vals.value[key]   = value;
+    vals.present[key] = true;
+    d->insert(key, value, element);
+}
+
+void XGIndex::unset(int element, Key key)
+{
+    DE_ASSERT(element >= 0 && element < elementCount());
+    auto &vals = d->values[element];
+    if (vals.present[key])
+    {
+        d->remove(key, vals.value[key], element);
+        vals.present[key] = false;
+    }
+}
+
+void XGIndex::setElement(int element, int tag, bool isXG, int actTag, int type)
+{
+    set(element, Tag, tag);
+    if (isXG)
+    {
+        set(element, ActTag, actTag);
+        set(element, Type, type);
+    }
+    else
+    {
+        unset(element, ActTag);
+        unset(element, Type);
+    }
+}
+
+bool XGIndex::has(int element, Key key) const
+{
+    DE_ASSERT(element >= 0 && element < elementCount());
+    return d->values[element].present[key];
+}
+
+bool XGIndex::matches(int element, Key key, int value) const
+{
+    DE_ASSERT(element >= 0 && element < elementCount());
+    const auto &vals = d->values[element];
+    return vals.present[key] && vals.value[key] == value;
+}
+
+const List<int> &XGIndex::elements(Key key, int value) const
+{
+    auto found = d->buckets[key].find(value);
+    if (found != d->buckets[key].end())
+    {
+        return found->second;
+    }
+    return d->none;
+}
+
+int XGIndex::first(Key key, int value) const
+{
+    const List<int> &list = elements(key, value);
+    return list.isEmpty()? -1 : list.first();
+}
+
+int XGIndex::next(Key key, int value, int after) const
+{
+    const List<int> &list = elements(key, value);
+    auto found = std::upper_bound(list.begin(), list.end(), after);
+    return found == list.end()? -1 : *found;
+}
+
+LoopResult XGIndex::forAllElements(Key key, int value,
+                                   const std::function<LoopResult (int)> &func) const
+{
+    if (key == Tag && !value) return LoopContinue;
+
+    for (int i = first(key, value); i >= 0; i = next(key, value, i))
+    {
+        if (auto result = func(i)) return result;
+    }
+    return LoopContinue;
+}
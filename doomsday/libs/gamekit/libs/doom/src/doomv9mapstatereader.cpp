@@ -349,7 +349,7 @@ static int removeThinker(thinker_t *th, void * /*context*/)
     }
     else
     {
-        Z_Free(th);
+        Thinker::destroy(th);
     }
 
     return false; // Continue iteration.
@@ -732,7 +732,7 @@ DE_PIMPL(DoomV9MapStateReader)
             {
             case tc_ceiling: {
                 PADSAVEP();
-                ceiling_t *ceiling = (ceiling_t *)Z_Calloc(sizeof(*ceiling), PU_MAP, NULL);
+                ceiling_t *ceiling = ThinkerT<ceiling_t>(Thinker::AllocatePooled).take();
 
                 readCeiling(ceiling, reader);
 
@@ -741,7 +741,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_door: {
                 PADSAVEP();
-                door_t *door = (door_t *)Z_Calloc(sizeof(*door), PU_MAP, NULL);
+                door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
 
                 readDoor(door, reader);
 
@@ -750,7 +750,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_floor: {
                 PADSAVEP();
-                floor_t *floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, NULL);
+                floor_t *floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
 
                 readFloor(floor, reader);
 
@@ -759,7 +759,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_plat: {
                 PADSAVEP();
-                plat_t *plat = (plat_t *)Z_Calloc(sizeof(*plat), PU_MAP, NULL);
+                plat_t *plat = ThinkerT<plat_t>(Thinker::AllocatePooled).take();
 
                 readPlat(plat, reader);
 
@@ -768,7 +768,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_flash: {
                 PADSAVEP();
-                lightflash_t *flash = (lightflash_t *)Z_Calloc(sizeof(*flash), PU_MAP, NULL);
+                lightflash_t *flash = ThinkerT<lightflash_t>(Thinker::AllocatePooled).take();
 
                 readFlash(flash, reader);
 
@@ -777,7 +777,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_strobe: {
                 PADSAVEP();
-                strobe_t *strobe = (strobe_t *)Z_Calloc(sizeof(*strobe), PU_MAP, NULL);
+                strobe_t *strobe = ThinkerT<strobe_t>(Thinker::AllocatePooled).take();
 
                 readStrobe(strobe, reader);
 
@@ -786,7 +786,7 @@ DE_PIMPL(DoomV9MapStateReader)
 
             case tc_glow: {
                 PADSAVEP();
-                glow_t *glow = (glow_t *)Z_Calloc(sizeof(*glow), PU_MAP, NULL);
+                glow_t *glow = ThinkerT<glow_t>(Thinker::AllocatePooled).take();
 
                 readGlow(glow, reader);
 
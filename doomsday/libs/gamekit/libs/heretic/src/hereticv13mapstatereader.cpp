@@ -375,7 +375,7 @@ static int removeThinker(thinker_t *th, void * /*context*/)
     }
     else
     {
-        Z_Free(th);
+        Thinker::destroy(th);
     }
 
     return false; // Continue iteration.
@@ -747,7 +747,7 @@ DE_PIMPL(HereticV13MapStateReader)
             switch(tclass)
             {
             case tc_ceiling: {
-                ceiling_t *ceiling = (ceiling_t *)Z_Calloc(sizeof(*ceiling), PU_MAP, NULL);
+                ceiling_t *ceiling = ThinkerT<ceiling_t>(Thinker::AllocatePooled).take();
 
                 readCeiling(ceiling, reader);
 
@@ -755,7 +755,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_door: {
-                door_t *door = (door_t *)Z_Calloc(sizeof(*door), PU_MAP, NULL);
+                door_t *door = ThinkerT<door_t>(Thinker::AllocatePooled).take();
 
                 readDoor(door, reader);
 
@@ -763,7 +763,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_floor: {
-                floor_t *floor = (floor_t *)Z_Calloc(sizeof(*floor), PU_MAP, NULL);
+                floor_t *floor = ThinkerT<floor_t>(Thinker::AllocatePooled).take();
 
                 readFloor(floor, reader);
 
@@ -771,7 +771,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_plat: {
-                plat_t *plat = (plat_t *)Z_Calloc(sizeof(*plat), PU_MAP, NULL);
+                plat_t *plat = ThinkerT<plat_t>(Thinker::AllocatePooled).take();
 
                 readPlat(plat, reader);
 
@@ -779,7 +779,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_flash: {
-                lightflash_t *flash = (lightflash_t *)Z_Calloc(sizeof(*flash), PU_MAP, NULL);
+                lightflash_t *flash = ThinkerT<lightflash_t>(Thinker::AllocatePooled).take();
 
                 readFlash(flash, reader);
 
@@ -787,7 +787,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_strobe: {
-                strobe_t *strobe = (strobe_t *)Z_Calloc(sizeof(*strobe), PU_MAP, NULL);
+                strobe_t *strobe = ThinkerT<strobe_t>(Thinker::AllocatePooled).take();
 
                 readStrobe(strobe, reader);
 
@@ -795,7 +795,7 @@ DE_PIMPL(HereticV13MapStateReader)
                 break; }
 
             case tc_glow: {
-                glow_t *glow = (glow_t *)Z_Calloc(sizeof(*glow), PU_MAP, NULL);
+                glow_t *glow = ThinkerT<glow_t>(Thinker::AllocatePooled).take();
 
                 readGlow(glow, reader);
 
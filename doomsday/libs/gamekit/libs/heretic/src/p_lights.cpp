@@ -125,7 +125,7 @@ void P_SpawnLightFlash(Sector *sector)
     // Nothing special about it during gameplay.
     P_ToXSector(sector)->special = 0;
 
-    lightflash_t *flash = (lightflash_t *)Z_Calloc(sizeof(*flash), PU_MAP, 0);
+    lightflash_t *flash = ThinkerT<lightflash_t>(Thinker::AllocatePooled).take();
     flash->thinker.function = (thinkfunc_t) T_LightFlash;
     Thinker_Add(&flash->thinker);
 
@@ -235,7 +235,7 @@ void P_SpawnStrobeFlash(Sector *sector, int fastOrSlow, int inSync)
     float lightLevel = P_GetFloatp(sector, DMU_LIGHT_LEVEL);
     float otherLevel = DDMAXFLOAT;
 
-    strobe_t *flash = (strobe_t *)Z_Calloc(sizeof(*flash), PU_MAP, 0);
+    strobe_t *flash = ThinkerT<strobe_t>(Thinker::AllocatePooled).take();
     flash->thinker.function = (thinkfunc_t) T_StrobeFlash;
     Thinker_Add(&flash->thinker);
 
@@ -427,7 +427,7 @@ void P_SpawnGlowingLight(Sector *sector)
     float lightLevel = P_GetFloatp(sector, DMU_LIGHT_LEVEL);
     float otherLevel = DDMAXFLOAT;
 
-    glow_t *g = (glow_t *)Z_Calloc(sizeof(*g), PU_MAP, 0);
+    glow_t *g = ThinkerT<glow_t>(Thinker::AllocatePooled).take();
     g->thinker.function = (thinkfunc_t) T_Glow;
     Thinker_Add(&g->thinker);
 
@@ -203,7 +203,7 @@ dd_bool EV_SpawnLight(Line * /*line*/, byte *arg, lighttype_t type)
 
         dd_bool think = false;
 
-        light_t *light = (light_t *)Z_Calloc(sizeof(*light), PU_MAP, 0);
+        light_t *light = ThinkerT<light_t>(Thinker::AllocatePooled).take();
 
         light->type   = type;
         light->sector = sec;
@@ -286,7 +286,7 @@ dd_bool EV_SpawnLight(Line * /*line*/, byte *arg, lighttype_t type)
         }
         else
         {
-            Z_Free(light);
+            Thinker::destroy(&light->thinker);
         }
     }
 
@@ -354,7 +354,7 @@ int phase_s::read(MapStateReader *msr)
 
 void P_SpawnPhasedLight(Sector *sector, float base, int index)
 {
-    phase_t *phase = (phase_t *)Z_Calloc(sizeof(*phase), PU_MAP, 0);
+    phase_t *phase = ThinkerT<phase_t>(Thinker::AllocatePooled).take();
     phase->thinker.function = (thinkfunc_t) T_Phase;
     Thinker_Add(&phase->thinker);
 
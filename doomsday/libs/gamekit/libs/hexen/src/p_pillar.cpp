@@ -144,7 +144,7 @@ int EV_BuildPillar(Line * /*line*/, byte *args, dd_bool crush)
             newHeight = P_GetDoublep(sec, DMU_FLOOR_HEIGHT) + (coord_t) args[2];
         }
 
-        pillar_t *pillar = (pillar_t *)Z_Calloc(sizeof(*pillar), PU_MAP, 0);
+        pillar_t *pillar = ThinkerT<pillar_t>(Thinker::AllocatePooled).take();
         pillar->thinker.function = (thinkfunc_t) T_BuildPillar;
         Thinker_Add(&pillar->thinker);
 
@@ -205,7 +205,7 @@ int EV_OpenPillar(Line * /*line*/, byte *args)
 
         rtn = 1;
 
-        pillar_t *pillar = (pillar_t *)Z_Calloc(sizeof(*pillar), PU_MAP, 0);
+        pillar_t *pillar = ThinkerT<pillar_t>(Thinker::AllocatePooled).take();
         pillar->thinker.function = (thinkfunc_t) T_BuildPillar;
         Thinker_Add(&pillar->thinker);
 
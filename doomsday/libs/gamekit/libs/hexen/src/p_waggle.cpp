@@ -165,7 +165,7 @@ dd_bool EV_StartFloorWaggle(int tag, int height, int speed, int offset, int time
 
         retCode = true;
 
-        waggle_t *waggle = (waggle_t *)Z_Calloc(sizeof(*waggle), PU_MAP, 0);
+        waggle_t *waggle = ThinkerT<waggle_t>(Thinker::AllocatePooled).take();
         waggle->thinker.function = (thinkfunc_t) T_FloorWaggle;
         Thinker_Add(&waggle->thinker);
 
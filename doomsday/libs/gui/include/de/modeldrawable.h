@@ -23,6 +23,7 @@
 #include <de/asset.h>
 #include <de/atlastexture.h>
 #include <de/bitarray.h>
+#include <de/block.h>
 #include <de/deletable.h>
 #include <de/file.h>
 #include <de/glprogram.h>
@@ -378,6 +379,44 @@ public:
 
     typedef List<TextureMap> Mapping;
 
+    /**
+     * Called in the main thread when loadAsync() finishes. @a loaded is @c false
+     * if the model could not be loaded.
+     */
+    typedef std::function<void (ModelDrawable &, bool loaded)> LoadedFunc;
+
+    /**
+     * Limits how much GL data is uploaded per frame when models are prepared for
+     * drawing. One unit of the budget covers the textures of one mesh in one
+     * material, or the vertex buffer of one material. A budget can be shared by
+     * any number of models.
+     */
+    class LIBGUI_PUBLIC UploadBudget
+    {
+    public:
+        UploadBudget(int unitsPerFrame = 1);
+
+        void setUnitsPerFrame(int units);
+
+        int unitsPerFrame() const;
+
+        /**
+         * Makes the full budget available again. Call this once per frame.
+         */
+        void beginFrame();
+
+        /**
+         * Uses up one unit of the budget.
+         *
+         * @return @c true, if a unit was available in the current frame.
+         */
+        bool take();
+
+    private:
+        int _unitsPerFrame;
+        int _available;
+    };
+
     // Audiences:
     DE_AUDIENCE(AboutToGLInit, void modelAboutToGLInit(ModelDrawable &))
 
@@ -412,6 +451,26 @@ public:
      */
     void load(const File &file);
 
+    /**
+     * Loads a model from a file in a background thread. The model file is imported
+     * and its vertex data is prepared in the background; the result is taken into
+     * use in the main thread, after which @a loaded is called. Existing data is
+     * released immediately. Must be called from the main thread.
+     *
+     * Calling clear(), load(), or loadAsync() again cancels an unfinished load;
+     * @a loaded is not called for a cancelled load.
+     *
+     * @param file    Model file to load. Must remain available until loading
+     *                has finished.
+     * @param loaded  Called when the model has been loaded or loading failed.
+     */
+    void loadAsync(const File &file, const LoadedFunc &loaded = LoadedFunc());
+
+    /**
+     * Determines if a model is being loaded with loadAsync().
+     */
+    bool isLoading() const;
+
     /**
      * Finds the id of an animation that has the name @a name. Note that
      * animation names are optional.
@@ -525,6 +584,17 @@ public:
      */
     void glInit();
 
+    /**
+     * Sets the budget that limits how much of the model's GL data is uploaded each
+     * time glInit() is called. If the budget runs out, glInit() returns before the
+     * model is ready and continues from the same point when called again (drawing
+     * does this automatically). By default there is no budget and glInit() always
+     * prepares the entire model at once.
+     *
+     * @param budget  Upload budget (not owned), or @c nullptr for no limit.
+     */
+    void setUploadBudget(UploadBudget *budget);
+
     /**
      * Releases all the GL resources of the model.
      */
@@ -578,6 +648,13 @@ public:
      */
     Vec3f midPoint() const;
 
+    /**
+     * Returns the vertices and indices prepared from the loaded model, as they are
+     * before texture coordinates are mapped onto the atlas. This is the same
+     * regardless of how the model was loaded.
+     */
+    Block geometryData() const;
+
 private:
     DE_PRIVATE(d)
 };
@@ -29,6 +29,7 @@
 #include <de/glstate.h>
 #include <de/gluniform.h>
 #include <de/matrix.h>
+#include <de/taskpool.h>
 #include <de/texturebank.h>
 #include <de/hash.h>
 
@@ -248,41 +249,15 @@ static ddouble ticksToSeconds(ddouble ticks, const aiAnimation &anim)
 /// Bone used for vertices that have no bones.
 static String const DUMMY_BONE_NAME{"__deng_dummy-bone__"};
 
-DE_PIMPL(ModelDrawable)
+/**
+ * Model data imported with Assimp, and the vertex data prepared from it. None of this
+ * depends on GL, so it can be produced in a background thread and then handed over to
+ * a ModelDrawable.
+ */
+struct SceneData
 {
-    typedef GLBufferT<ModelVertex> VBuf;
     typedef Hash<String, int> AnimLookup;
 
-    static TextureMap textureMapType(aiTextureType type)
-    {
-        switch (type)
-        {
-        case aiTextureType_DIFFUSE:  return Diffuse;
-        case aiTextureType_NORMALS:  return Normals;
-        case aiTextureType_HEIGHT:   return Height;
-        case aiTextureType_SPECULAR: return Specular;
-        case aiTextureType_EMISSIVE: return Emissive;
-        default:
-            DE_ASSERT_FAIL("Unsupported texture type");
-            return Diffuse;
-        }
-    }
-
-    static aiTextureType impTextureType(TextureMap map)
-    {
-        switch (map)
-        {
-        case Diffuse:  return aiTextureType_DIFFUSE;
-        case Normals:  return aiTextureType_NORMALS;
-        case Height:   return aiTextureType_HEIGHT;
-        case Specular: return aiTextureType_SPECULAR;
-        case Emissive: return aiTextureType_EMISSIVE;
-        default:
-            break;
-        }
-        return aiTextureType_UNKNOWN;
-    }
-
     struct VertexBone
     {
         duint16 ids[MAX_BONES_PER_VERTEX];
@@ -300,9 +275,8 @@ DE_PIMPL(ModelDrawable)
         Mat4f offset;
     };
 
-    Asset            modelAsset;
     String           sourcePath;
-    ImpIOSystem *    importerIoSystem; // not owned
+    ImpIOSystem *    importerIoSystem{nullptr}; // not owned
     std::unique_ptr<Assimp::Importer> importer;
     const aiScene *  scene{nullptr};
 
@@ -316,6 +290,390 @@ DE_PIMPL(ModelDrawable)
     List<BoneData>               bones; // indexed by bone index
     AnimLookup                   animNameToIndex;
     List<Rangez>                 meshIndexRanges;
+    List<ModelVertex>            vertices; ///< All meshes; default texture bounds.
+    List<duint16>                indices;
+
+    /**
+     * Imports a model file and prepares its vertex data. Can be called in any thread.
+     *
+     * @param file  Model file.
+     */
+    void importScene(const File &file)
+    {
+        LOG_GL_MSG("Loading model from %s") << file.description();
+
+        // Use FS2 for file access.
+        importer.reset(new Assimp::Importer);
+        importer->SetIOHandler(importerIoSystem = new ImpIOSystem);
+
+#if defined (DE_HAVE_CUSTOMIZED_ASSIMP)
+        {
+            /*
+             * MD5: Multiple animation sequences are supported via multiple .md5anim files.
+             * Autodetect if these exist and make a list of their names.
+             */
+            String anims;
+            if (file.extension() == ".md5mesh")
+            {
+                const String baseName = file.name().fileNameWithoutExtension() + "_";
+                file.parent()->forContents([&anims, &baseName] (String fileName, File &)
+                {
+                    if (fileName.beginsWith(baseName) &&
+                        fileName.fileNameExtension() == ".md5anim")
+                    {
+                        if (!anims.isEmpty()) anims += ";";
+                        anims += fileName.substr(baseName.sizeb()).fileNameWithoutExtension();
+                    }
+                    return LoopContinue;
+                });
+            }
+            importer->SetPropertyString(AI_CONFIG_IMPORT_MD5_ANIM_SEQUENCE_NAMES,
+                                        anims.toStdString());
+        }
+#endif
+
+        scene = nullptr;
+        sourcePath = file.path();
+        importerIoSystem->referencePath = sourcePath.fileNamePath();
+
+        // Read the model file and apply suitable postprocessing to clean up the data.
+        if (!importer->ReadFile(sourcePath.c_str(),
+                                aiProcess_CalcTangentSpace |
+                                aiProcess_GenSmoothNormals |
+                                aiProcess_JoinIdenticalVertices |
+                                aiProcess_Triangulate |
+                                aiProcess_GenUVCoords |
+                                aiProcess_FlipUVs |
+                                aiProcess_SortByPType))
+        {
+            throw ModelDrawable::LoadError("ModelDrawable::import",
+                                           stringf("Failed to load model from %s: %s",
+                                                   file.description().c_str(),
+                                                   importer->GetErrorString()));
+        }
+
+        scene = importer->GetScene();
+
+        initBones();
+
+        globalInverse = convertMatrix(scene->mRootNode->mTransformation).inverse();
+        maxPoint      = Vec3f(1.0e-9f, 1.0e-9f, 1.0e-9f);
+        minPoint      = Vec3f(1.0e9f,  1.0e9f,  1.0e9f);
+
+        // Determine the total bounding box.
+        for (duint i = 0; i < scene->mNumMeshes; ++i)
+        {
+            const aiMesh &mesh = *scene->mMeshes[i];
+            for (duint i = 0; i < mesh.mNumVertices; ++i)
+            {
+                addToBounds(Vec3f(&mesh.mVertices[i].x));
+            }
+        }
+
+        // Print some information.
+        LOG_GL_VERBOSE("Bone count: %i\n"
+                       "Animation count: %i")
+                << boneCount()
+                << scene->mNumAnimations;
+
+        // Animations.
+        animNameToIndex.clear();
+        for (duint i = 0; i < scene->mNumAnimations; ++i)
+        {
+            LOG_GL_VERBOSE("Animation #%i name:%s tps:%f")
+                    << i << scene->mAnimations[i]->mName.C_Str()
+                    << scene->mAnimations[i]->mTicksPerSecond;
+
+            const String name = scene->mAnimations[i]->mName.C_Str();
+            if (!name.isEmpty())
+            {
+                animNameToIndex.insert(name, i);
+            }
+        }
+
+        // Create a lookup for node names.
+        nodeNameToPtr.clear();
+        nodeNameToPtr.insert("", scene->mRootNode);
+        buildNodeLookup(*scene->mRootNode);
+
+        prepareGeometry();
+    }
+
+    void buildNodeLookup(const aiNode &node)
+    {
+        const String name = node.mName.C_Str();
+#ifdef DE_DEBUG
+        debug("Node: %s", name.c_str());
+#endif
+        if (!name.isEmpty())
+        {
+            nodeNameToPtr.insert(name, &node);
+        }
+
+        for (duint i = 0; i < node.mNumChildren; ++i)
+        {
+            buildNodeLookup(*node.mChildren[i]);
+        }
+    }
+
+    void clear()
+    {
+        sourcePath.clear();
+        vertexBones.clear();
+        boneNameToIndex.clear();
+        nodeNameToPtr.clear();
+        bones.clear();
+        animNameToIndex.clear();
+        meshIndexRanges.clear();
+        vertices.clear();
+        indices.clear();
+        importer.reset();
+        scene = nullptr;
+    }
+
+    void addToBounds(const Vec3f &point)
+    {
+        minPoint = minPoint.min(point);
+        maxPoint = maxPoint.max(point);
+    }
+
+//- Bone & Mesh Setup -------------------------------------------------------------------
+
+    void clearBones()
+    {
+        vertexBones.clear();
+        bones.clear();
+        boneNameToIndex.clear();
+    }
+
+    int boneCount() const
+    {
+        return bones.sizei();
+    }
+
+    int addBone(const String &name)
+    {
+        int idx = boneCount();
+        bones << BoneData();
+        boneNameToIndex[name] = duint16(idx);
+        return idx;
+    }
+
+    int findBone(const String &name) const
+    {
+        if (boneNameToIndex.contains(name))
+        {
+            return boneNameToIndex[name];
+        }
+        return -1;
+    }
+
+    int addOrFindBone(const String &name)
+    {
+        int i = findBone(name);
+        if (i >= 0)
+        {
+            return i;
+        }
+        return addBone(name);
+    }
+
+    void addVertexWeight(duint vertexIndex, duint16 boneIndex, dfloat weight)
+    {
+        VertexBone &vb = vertexBones[vertexIndex];
+        for (int i = 0; i < MAX_BONES_PER_VERTEX; ++i)
+        {
+            if (vb.weights[i] == 0.f)
+            {
+                // Here's a free one.
+                vb.ids[i] = boneIndex;
+                vb.weights[i] = weight;
+                return;
+            }
+        }
+        LOG_GL_WARNING("\"%s\": too many weights for vertex %i (only 4 supported), bone index: %i")
+            << sourcePath << vertexIndex << boneIndex;
+        DE_ASSERT_FAIL("Too many bone weights for a vertex");
+    }
+
+    /**
+     * Initializes the per-vertex bone weight information, and indexes the bones
+     * of the mesh in a sequential order.
+     *
+     * @param mesh        Source mesh.
+     * @param vertexBase  Index of the first vertex of the mesh.
+     */
+    void initMeshBones(const aiMesh &mesh, duint vertexBase)
+    {
+        vertexBones.resize(vertexBase + mesh.mNumVertices);
+
+        if (mesh.HasBones())
+        {
+            // Mark the per-vertex bone weights.
+            for (duint i = 0; i < mesh.mNumBones; ++i)
+            {
+                const aiBone &bone = *mesh.mBones[i];
+
+                const duint boneIndex = addOrFindBone(bone.mName.C_Str());
+                bones[boneIndex].offset = convertMatrix(bone.mOffsetMatrix);
+
+                for (duint w = 0; w < bone.mNumWeights; ++w)
+                {
+                    addVertexWeight(vertexBase + bone.mWeights[w].mVertexId,
+                                    duint16(boneIndex),
+                                    bone.mWeights[w].mWeight);
+                }
+            }
+        }
+        else
+        {
+            // No bones; make one dummy bone so we can render it the same way.
+            const duint boneIndex = addOrFindBone(DUMMY_BONE_NAME);
+            bones[boneIndex].offset = Mat4f();
+
+            // All vertices fully affected by this bone.
+            for (duint i = 0; i < mesh.mNumVertices; ++i)
+            {
+                addVertexWeight(vertexBase + i, duint16(boneIndex), 1.f);
+            }
+        }
+    }
+
+    /**
+     * Initializes all bones in the scene.
+     */
+    void initBones()
+    {
+        clearBones();
+
+        int base = 0;
+        for (duint i = 0; i < scene->mNumMeshes; ++i)
+        {
+            const aiMesh &mesh = *scene->mMeshes[i];
+
+            LOGDEV_GL_VERBOSE("Initializing %i bones for mesh #%i %s")
+                    << mesh.mNumBones << i << mesh.mName.C_Str();
+
+            initMeshBones(mesh, base);
+            base += mesh.mNumVertices;
+        }
+    }
+
+    /**
+     * Combines the vertices and indices of all the scene's meshes. The texture bounds
+     * depend on the atlas, so they are only filled in when a material's buffer is made.
+     */
+    void prepareGeometry()
+    {
+        aiVector3D const zero(0, 0, 0);
+        aiColor4D const white(1, 1, 1, 1);
+
+        vertices.clear();
+        indices.clear();
+
+        int base = 0;
+        meshIndexRanges.clear();
+        meshIndexRanges.resize(scene->mNumMeshes);
+
+        for (duint m = 0; m < scene->mNumMeshes; ++m)
+        {
+            const aiMesh &mesh = *scene->mMeshes[m];
+
+            for (duint i = 0; i < mesh.mNumVertices; ++i)
+            {
+                const aiVector3D *pos      = &mesh.mVertices[i];
+                const aiColor4D *color    = (mesh.HasVertexColors(0)? &mesh.mColors[0][i] : &white);
+                const aiVector3D *normal   = (mesh.HasNormals()? &mesh.mNormals[i] : &zero);
+                const aiVector3D *texCoord = (mesh.HasTextureCoords(0)? &mesh.mTextureCoords[0][i] : &zero);
+                const aiVector3D *tangent  = (mesh.HasTangentsAndBitangents()? &mesh.mTangents[i] : &zero);
+                const aiVector3D *bitang   = (mesh.HasTangentsAndBitangents()? &mesh.mBitangents[i] : &zero);
+
+                ModelVertex v;
+
+                v.pos       = Vec3f(pos->x, pos->y, pos->z);
+                v.color     = Vec4f(color->r, color->g, color->b, color->a);
+
+                v.normal    = Vec3f(normal ->x, normal ->y, normal ->z);
+                v.tangent   = Vec3f(tangent->x, tangent->y, tangent->z);
+                v.bitangent = Vec3f(bitang ->x, bitang ->y, bitang ->z);
+
+                v.texCoord     = Vec2f(texCoord->x, texCoord->y);
+                v.texBounds[0] = Vec4f(0, 0, 1, 1);
+                v.texBounds[1] = Vec4f(0, 0, 1, 1);
+                v.texBounds[2] = Vec4f(0, 0, 1, 1);
+                v.texBounds[3] = Vec4f(0, 0, 1, 1);
+
+                for (int b = 0; b < MAX_BONES_PER_VERTEX; ++b)
+                {
+                    v.boneIds[b]     = vertexBones[base + i].ids[b];
+                    v.boneWeights[b] = vertexBones[base + i].weights[b];
+                }
+
+                vertices << v;
+            }
+
+            dsize firstFace = indices.size();
+
+            // Get face indices.
+            for (duint i = 0; i < mesh.mNumFaces; ++i)
+            {
+                const aiFace &face = mesh.mFaces[i];
+                DE_ASSERT(face.mNumIndices == 3); // expecting triangles
+                indices << duint16(face.mIndices[0] + base)
+                        << duint16(face.mIndices[1] + base)
+                        << duint16(face.mIndices[2] + base);
+            }
+
+            meshIndexRanges[m] = Rangez::fromSize(firstFace, mesh.mNumFaces * 3);
+
+            base += mesh.mNumVertices;
+        }
+    }
+};
+
+/// Result of a background import.
+struct ImportResult : public Deletable
+{
+    std::shared_ptr<SceneData> scene; ///< @c nullptr if the import failed.
+
+    ImportResult(std::shared_ptr<SceneData> scene) : scene(std::move(scene)) {}
+};
+
+DE_PIMPL(ModelDrawable), public SceneData
+{
+    typedef GLBufferT<ModelVertex> VBuf;
+
+    static TextureMap textureMapType(aiTextureType type)
+    {
+        switch (type)
+        {
+        case aiTextureType_DIFFUSE:  return Diffuse;
+        case aiTextureType_NORMALS:  return Normals;
+        case aiTextureType_HEIGHT:   return Height;
+        case aiTextureType_SPECULAR: return Specular;
+        case aiTextureType_EMISSIVE: return Emissive;
+        default:
+            DE_ASSERT_FAIL("Unsupported texture type");
+            return Diffuse;
+        }
+    }
+
+    static aiTextureType impTextureType(TextureMap map)
+    {
+        switch (map)
+        {
+        case Diffuse:  return aiTextureType_DIFFUSE;
+        case Normals:  return aiTextureType_NORMALS;
+        case Height:   return aiTextureType_HEIGHT;
+        case Specular: return aiTextureType_SPECULAR;
+        case Emissive: return aiTextureType_EMISSIVE;
+        default:
+            break;
+        }
+        return aiTextureType_UNKNOWN;
+    }
+
+    Asset modelAsset;
 
     /**
      * Management of texture maps.
@@ -412,14 +770,6 @@ DE_PIMPL(ModelDrawable)
             return materials.size() - 1;
         }
 
-        void glInit(const String &modelSourcePath)
-        {
-            sourcePath = modelSourcePath;
-
-            // Materials.
-            initTextures();
-        }
-
         void glDeinit()
         {
             releaseTexturesFromAtlas();
@@ -462,42 +812,36 @@ DE_PIMPL(ModelDrawable)
         }
 
         /**
-         * Load all the textures of the model, for all materials. The textures
-         * are allocated into the atlas provided to the model.
+         * Loads the textures of one mesh in one material. The textures are allocated
+         * into the atlas provided to the model; the atlas needs to be committed
+         * afterwards.
          *
          * Only a single copy of each texture image is kept in the atlas even
          * if the same image is beig used in many meshes.
+         *
+         * @param mesh  Mesh and material whose textures to load.
          */
-        void initTextures()
+        void initMeshTextures(const MeshId &mesh)
         {
-            for (duint matIdx = 0; matIdx < duint(materials.size()); ++matIdx)
-            {
-                for (duint i = 0; i < scene->mNumMeshes; ++i)
-                {
-                    MeshId const mesh(i, matIdx);
-                    auto &textures = materials[matIdx]->meshTextures[i];
+            auto &textures = materials[mesh.material]->meshTextures[mesh.index];
 
-                    // Load all known types of textures, falling back to defaults.
-                    loadTextureImage(mesh, aiTextureType_DIFFUSE);
-                    fallBackToDefaultTexture(textures, Diffuse);
+            // Load all known types of textures, falling back to defaults.
+            loadTextureImage(mesh, aiTextureType_DIFFUSE);
+            fallBackToDefaultTexture(textures, Diffuse);
 
-                    loadTextureImage(mesh, aiTextureType_NORMALS);
-                    if (!textures.texIds[Normals])
-                    {
-                        // Try a height field instead. This will be converted to a normal map.
-                        loadTextureImage(mesh, aiTextureType_HEIGHT);
-                    }
-                    fallBackToDefaultTexture(textures, Normals);
+            loadTextureImage(mesh, aiTextureType_NORMALS);
+            if (!textures.texIds[Normals])
+            {
+                // Try a height field instead. This will be converted to a normal map.
+                loadTextureImage(mesh, aiTextureType_HEIGHT);
+            }
+            fallBackToDefaultTexture(textures, Normals);
 
-                    loadTextureImage(mesh, aiTextureType_SPECULAR);
-                    fallBackToDefaultTexture(textures, Specular);
+            loadTextureImage(mesh, aiTextureType_SPECULAR);
+            fallBackToDefaultTexture(textures, Specular);
 
-                    loadTextureImage(mesh, aiTextureType_EMISSIVE);
-                    fallBackToDefaultTexture(textures, Emissive);
-                }
-            }
-            // All textures loaded.
-            textureBank.atlas()->commit();
+            loadTextureImage(mesh, aiTextureType_EMISSIVE);
+            fallBackToDefaultTexture(textures, Emissive);
         }
 
         /**
@@ -639,6 +983,19 @@ DE_PIMPL(ModelDrawable)
 
     mutable GLUniform uBoneMatrices { "uBoneMatrices", GLUniform::Mat4Array, MAX_BONES };
 
+    TaskPool                   tasks;
+    std::shared_ptr<duint>     pendingLoad; ///< Identifies the unfinished background load.
+    UploadBudget *             uploadBudget{nullptr};
+
+    /// glInit() may be done in several parts if the upload budget runs out.
+    struct GLInitProgress
+    {
+        bool  begun       = false;
+        duint textureSets = 0; ///< Meshes whose textures have been loaded (per material).
+        duint buffers     = 0; ///< Materials whose buffer has been made.
+    };
+    GLInitProgress glInitProgress;
+
     Impl(Public *i) : Base(i)
     {
         // Get most kinds of log output.
@@ -650,104 +1007,71 @@ DE_PIMPL(ModelDrawable)
         glDeinit();
     }
 
-    void import(const File &file)
+    /// Release all loaded model data.
+    void clear()
     {
-        LOG_GL_MSG("Loading model from %s") << file.description();
-
-        // Use FS2 for file access.
-        importer.reset(new Assimp::Importer);
-        importer->SetIOHandler(importerIoSystem = new ImpIOSystem);
-
-#if defined (DE_HAVE_CUSTOMIZED_ASSIMP)
-        {
-            /*
-             * MD5: Multiple animation sequences are supported via multiple .md5anim files.
-             * Autodetect if these exist and make a list of their names.
-             */
-            String anims;
-            if (file.extension() == ".md5mesh")
-            {
-                const String baseName = file.name().fileNameWithoutExtension() + "_";
-                file.parent()->forContents([&anims, &baseName] (String fileName, File &)
-                {
-                    if (fileName.beginsWith(baseName) &&
-                        fileName.fileNameExtension() == ".md5anim")
-                    {
-                        if (!anims.isEmpty()) anims += ";";
-                        anims += fileName.substr(baseName.sizeb()).fileNameWithoutExtension();
-                    }
-                    return LoopContinue;
-                });
-            }
-            importer->SetPropertyString(AI_CONFIG_IMPORT_MD5_ANIM_SEQUENCE_NAMES,
-                                        anims.toStdString());
-        }
-#endif
-
-        scene = glData.scene = nullptr;
-        sourcePath = file.path();
-        importerIoSystem->referencePath = sourcePath.fileNamePath();
+        glDeinit();
 
-        // Read the model file and apply suitable postprocessing to clean up the data.
-        if (!importer->ReadFile(sourcePath.c_str(),
-                                aiProcess_CalcTangentSpace |
-                                aiProcess_GenSmoothNormals |
-                                aiProcess_JoinIdenticalVertices |
-                                aiProcess_Triangulate |
-                                aiProcess_GenUVCoords |
-                                aiProcess_FlipUVs |
-                                aiProcess_SortByPType))
-        {
-            throw LoadError("ModelDrawable::import",
-                            stringf("Failed to load model from %s: %s",
-                                    file.description().c_str(),
-                                    importer->GetErrorString()));
-        }
+        pendingLoad.reset(); // Cancel an unfinished background load.
+        defaultPasses.clear();
+        SceneData::clear();
+        glData.scene = nullptr;
+    }
 
-        scene = glData.scene = importer->GetScene();
+    void import(const File &file)
+    {
+        importScene(file);
+        sceneImported();
+    }
 
-        initBones();
+    void importAsync(const File &file, const LoadedFunc &loaded)
+    {
+        DE_ASSERT_IN_MAIN_THREAD();
 
-        globalInverse = convertMatrix(scene->mRootNode->mTransformation).inverse();
-        maxPoint      = Vec3f(1.0e-9f, 1.0e-9f, 1.0e-9f);
-        minPoint      = Vec3f(1.0e9f,  1.0e9f,  1.0e9f);
+        pendingLoad.reset(new duint(0));
+        const std::weak_ptr<duint> load = pendingLoad;
+        const File *source = &file;
 
-        // Determine the total bounding box.
-        for (duint i = 0; i < scene->mNumMeshes; ++i)
+        tasks.async([source] () -> Variant
         {
-            const aiMesh &mesh = *scene->mMeshes[i];
-            for (duint i = 0; i < mesh.mNumVertices; ++i)
+            LOG_AS("ModelDrawable");
+            std::shared_ptr<SceneData> data(new SceneData);
+            try
             {
-                addToBounds(Vec3f(&mesh.mVertices[i].x));
+                data->importScene(*source);
             }
-        }
-
-        // Print some information.
-        LOG_GL_VERBOSE("Bone count: %i\n"
-                       "Animation count: %i")
-                << boneCount()
-                << scene->mNumAnimations;
-
-        // Animations.
-        animNameToIndex.clear();
-        for (duint i = 0; i < scene->mNumAnimations; ++i)
+            catch (const Error &er)
+            {
+                LOG_GL_ERROR("%s") << er.asText();
+                data.reset();
+            }
+            return Variant(new ImportResult(data));
+        },
+        [this, load, loaded] (const Variant &result)
         {
-            LOG_GL_VERBOSE("Animation #%i name:%s tps:%f")
-                    << i << scene->mAnimations[i]->mName.C_Str()
-                    << scene->mAnimations[i]->mTicksPerSecond;
+            // The load may have been cancelled, or the model deleted.
+            if (load.expired()) return;
 
-            const String name = scene->mAnimations[i]->mName.C_Str();
-            if (!name.isEmpty())
+            pendingLoad.reset();
+            const auto &imported = result.value<ImportResult>().scene;
+            if (imported)
             {
-                animNameToIndex.insert(name, i);
+                static_cast<SceneData &>(*this) = std::move(*imported);
+                sceneImported();
             }
-        }
-
-        // Create a lookup for node names.
-        nodeNameToPtr.clear();
-        nodeNameToPtr.insert("", scene->mRootNode);
-        buildNodeLookup(*scene->mRootNode);
+            if (loaded)
+            {
+                loaded(self(), imported != nullptr);
+            }
+        });
+    }
 
+    /**
+     * Sets up the materials and rendering passes of a newly imported scene.
+     */
+    void sceneImported()
+    {
+        glData.scene = scene;
         glData.initMaterials();
 
         // Default rendering passes to use if none specified.
@@ -757,38 +1081,9 @@ DE_PIMPL(ModelDrawable)
         defaultPasses << pass;
     }
 
-    void buildNodeLookup(const aiNode &node)
-    {
-        const String name = node.mName.C_Str();
-#ifdef DE_DEBUG
-        debug("Node: %s", name.c_str());
-#endif
-        if (!name.isEmpty())
-        {
-            nodeNameToPtr.insert(name, &node);
-        }
-
-        for (duint i = 0; i < node.mNumChildren; ++i)
-        {
-            buildNodeLookup(*node.mChildren[i]);
-        }
-    }
-
-    /// Release all loaded model data.
-    void clear()
+    bool takeUpload()
     {
-        glDeinit();
-
-        sourcePath.clear();
-        defaultPasses.clear();
-        vertexBones.clear();
-        boneNameToIndex.clear();
-        nodeNameToPtr.clear();
-        bones.clear();
-        animNameToIndex.clear();
-        meshIndexRanges.clear();
-        importer.reset();
-        scene = glData.scene = nullptr;
+        return !uploadBudget || uploadBudget->take();
     }
 
     void glInit()
@@ -804,18 +1099,43 @@ DE_PIMPL(ModelDrawable)
             return;
         }
 
-        // Last minute notification in case some additional setup is needed.
-        DE_NOTIFY_PUBLIC(AboutToGLInit, i)
+        if (!glInitProgress.begun)
+        {
+            // Last minute notification in case some additional setup is needed.
+            DE_NOTIFY_PUBLIC(AboutToGLInit, i)
+            {
+                i->modelAboutToGLInit(self());
+            }
+            glData.sourcePath = sourcePath;
+            glInitProgress.begun = true;
+        }
+
+        // Textures of each mesh in each material.
+        const duint meshCount = scene->mNumMeshes;
+        const duint textureSetCount = duint(glData.materials.size()) * meshCount;
+        if (glInitProgress.textureSets < textureSetCount)
         {
-            i->modelAboutToGLInit(self());
+            while (glInitProgress.textureSets < textureSetCount && takeUpload())
+            {
+                const duint index = glInitProgress.textureSets++;
+                glData.initMeshTextures(MeshId(index % meshCount, index / meshCount));
+            }
+            glData.textureBank.atlas()->commit();
+
+            if (glInitProgress.textureSets < textureSetCount) return; // Continue later.
         }
 
-        glData.glInit(sourcePath);
+        // Each material has its own GL buffer with all of the scene's meshes.
+        while (glInitProgress.buffers < glData.materials.size())
+        {
+            if (!takeUpload()) return; // Continue later.
 
-        // Initialize all meshes in the scene into a single GL buffer.
-        makeBuffer();
+            if (glInitProgress.buffers == 0) glData.needMakeBuffer = false;
+            makeBuffer(*glData.materials[glInitProgress.buffers++]);
+        }
 
         // Ready to go!
+        glInitProgress = GLInitProgress();
         modelAsset.setState(Ready);
     }
 
@@ -824,15 +1144,10 @@ DE_PIMPL(ModelDrawable)
         glData.glDeinit();
         clearBones();
 
+        glInitProgress = GLInitProgress();
         modelAsset.setState(NotReady);
     }
 
-    void addToBounds(const Vec3f &point)
-    {
-        minPoint = minPoint.min(point);
-        maxPoint = maxPoint.max(point);
-    }
-
     int findMaterial(const String &name) const
     {
         if (!scene) return -1;
@@ -848,128 +1163,6 @@ DE_PIMPL(ModelDrawable)
         return -1;
     }
 
-//- Bone & Mesh Setup -------------------------------------------------------------------
-
-    void clearBones()
-    {
-        vertexBones.clear();
-        bones.clear();
-        boneNameToIndex.clear();
-    }
-
-    int boneCount() const
-    {
-        return bones.sizei();
-    }
-
-    int addBone(const String &name)
-    {
-        int idx = boneCount();
-        bones << BoneData();
-        boneNameToIndex[name] = duint16(idx);
-        return idx;
-    }
-
-    int findBone(const String &name) const
-    {
-        if (boneNameToIndex.contains(name))
-        {
-            return boneNameToIndex[name];
-        }
-        return -1;
-    }
-
-    int addOrFindBone(const String &name)
-    {
-        int i = findBone(name);
-        if (i >= 0)
-        {
-            return i;
-        }
-        return addBone(name);
-    }
-
-    void addVertexWeight(duint vertexIndex, duint16 boneIndex, dfloat weight)
-    {
-        VertexBone &vb = vertexBones[vertexIndex];
-        for (int i = 0; i < MAX_BONES_PER_VERTEX; ++i)
-        {
-            if (vb.weights[i] == 0.f)
-            {
-                // Here's a free one.
-                vb.ids[i] = boneIndex;
-                vb.weights[i] = weight;
-                return;
-            }
-        }
-        LOG_GL_WARNING("\"%s\": too many weights for vertex %i (only 4 supported), bone index: %i")
-            << sourcePath << vertexIndex << boneIndex;
-        DE_ASSERT_FAIL("Too many bone weights for a vertex");
-    }
-
-    /**
-     * Initializes the per-vertex bone weight information, and indexes the bones
-     * of the mesh in a sequential order.
-     *
-     * @param mesh        Source mesh.
-     * @param vertexBase  Index of the first vertex of the mesh.
-     */
-    void initMeshBones(const aiMesh &mesh, duint vertexBase)
-    {
-        vertexBones.resize(vertexBase + mesh.mNumVertices);
-
-        if (mesh.HasBones())
-        {
-            // Mark the per-vertex bone weights.
-            for (duint i = 0; i < mesh.mNumBones; ++i)
-            {
-                const aiBone &bone = *mesh.mBones[i];
-
-                const duint boneIndex = addOrFindBone(bone.mName.C_Str());
-                bones[boneIndex].offset = convertMatrix(bone.mOffsetMatrix);
-
-                for (duint w = 0; w < bone.mNumWeights; ++w)
-                {
-                    addVertexWeight(vertexBase + bone.mWeights[w].mVertexId,
-                                    duint16(boneIndex),
-                                    bone.mWeights[w].mWeight);
-                }
-            }
-        }
-        else
-        {
-            // No bones; make one dummy bone so we can render it the same way.
-            const duint boneIndex = addOrFindBone(DUMMY_BONE_NAME);
-            bones[boneIndex].offset = Mat4f();
-
-            // All vertices fully affected by this bone.
-            for (duint i = 0; i < mesh.mNumVertices; ++i)
-            {
-                addVertexWeight(vertexBase + i, duint16(boneIndex), 1.f);
-            }
-        }
-    }
-
-    /**
-     * Initializes all bones in the scene.
-     */
-    void initBones()
-    {
-        clearBones();
-
-        int base = 0;
-        for (duint i = 0; i < scene->mNumMeshes; ++i)
-        {
-            const aiMesh &mesh = *scene->mMeshes[i];
-
-            LOGDEV_GL_VERBOSE("Initializing %i bones for mesh #%i %s")
-                    << mesh.mNumBones << i << mesh.mName.C_Str();
-
-            initMeshBones(mesh, base);
-            base += mesh.mNumVertices;
-        }
-    }
-
     void makeBuffer()
     {
         glData.needMakeBuffer = false;
@@ -986,98 +1179,51 @@ DE_PIMPL(ModelDrawable)
      */
     void makeBuffer(GLData::Material &material)
     {
-        VBuf::Vertices verts;
-        VBuf::Indices indx;
-
-        aiVector3D const zero(0, 0, 0);
-        aiColor4D const white(1, 1, 1, 1);
-
-        int base = 0;
-        meshIndexRanges.clear();
-        meshIndexRanges.resize(scene->mNumMeshes);
+        VBuf::Vertices verts = vertices;
 
-        // All of the scene's meshes are combined into one GL buffer.
+        dsize base = 0;
         for (duint m = 0; m < scene->mNumMeshes; ++m)
         {
-            const aiMesh &mesh = *scene->mMeshes[m];
+            const auto &meshTextures = material.meshTextures[m];
 
-            // Load vertices into the buffer.
-            for (duint i = 0; i < mesh.mNumVertices; ++i)
+            Vec4f texBounds[MAX_TEXTURES];
+            for (int t = 0; t < MAX_TEXTURES; ++t)
             {
-                const aiVector3D *pos      = &mesh.mVertices[i];
-                const aiColor4D *color    = (mesh.HasVertexColors(0)? &mesh.mColors[0][i] : &white);
-                const aiVector3D *normal   = (mesh.HasNormals()? &mesh.mNormals[i] : &zero);
-                const aiVector3D *texCoord = (mesh.HasTextureCoords(0)? &mesh.mTextureCoords[0][i] : &zero);
-                const aiVector3D *tangent  = (mesh.HasTangentsAndBitangents()? &mesh.mTangents[i] : &zero);
-                const aiVector3D *bitang   = (mesh.HasTangentsAndBitangents()? &mesh.mBitangents[i] : &zero);
-
-                VBuf::Type v;
-
-                v.pos       = Vec3f(pos->x, pos->y, pos->z);
-                v.color     = Vec4f(color->r, color->g, color->b, color->a);
-
-                v.normal    = Vec3f(normal ->x, normal ->y, normal ->z);
-                v.tangent   = Vec3f(tangent->x, tangent->y, tangent->z);
-                v.bitangent = Vec3f(bitang ->x, bitang ->y, bitang ->z);
+                texBounds[t] = Vec4f(0, 0, 1, 1);
 
-                v.texCoord     = Vec2f(texCoord->x, texCoord->y);
-                v.texBounds[0] = Vec4f(0, 0, 1, 1);
-                v.texBounds[1] = Vec4f(0, 0, 1, 1);
-                v.texBounds[2] = Vec4f(0, 0, 1, 1);
-                v.texBounds[3] = Vec4f(0, 0, 1, 1);
-
-                const auto &meshTextures = material.meshTextures[m];
+                // Apply the specified order for the textures.
+                TextureMap map = glData.textureOrder[t];
+                if (map < 0 || map >= MAX_TEXTURES) continue;
 
-                for (int t = 0; t < MAX_TEXTURES; ++t)
+                if (meshTextures.texIds[map])
                 {
-                    // Apply the specified order for the textures.
-                    TextureMap map = glData.textureOrder[t];
-                    if (map < 0 || map >= MAX_TEXTURES) continue;
-
-                    if (meshTextures.texIds[map])
-                    {
-                        v.texBounds[t] = glData.textureBank.atlas(map)->imageRectf(meshTextures.texIds[map]).xywh();
-                    }
-                    else if (glData.defaultTexIds[map])
-                    {
-                        v.texBounds[t] = glData.textureBank.atlas(map)->imageRectf(glData.defaultTexIds[map]).xywh();
-                    }
-                    else
-                    {
-                        // Not included in material.
-                        v.texBounds[t] = Vec4f();
-                    }
+                    texBounds[t] = glData.textureBank.atlas(map)->imageRectf(meshTextures.texIds[map]).xywh();
                 }
-
-                for (int b = 0; b < MAX_BONES_PER_VERTEX; ++b)
+                else if (glData.defaultTexIds[map])
                 {
-                    v.boneIds[b]     = vertexBones[base + i].ids[b];
-                    v.boneWeights[b] = vertexBones[base + i].weights[b];
+                    texBounds[t] = glData.textureBank.atlas(map)->imageRectf(glData.defaultTexIds[map]).xywh();
+                }
+                else
+                {
+                    // Not included in material.
+                    texBounds[t] = Vec4f();
                 }
-
-                verts << v;
             }
 
-            dsize firstFace = indx.size();
-
-            // Get face indices.
-            for (duint i = 0; i < mesh.mNumFaces; ++i)
+            const dsize end = base + scene->mMeshes[m]->mNumVertices;
+            for (dsize i = base; i < end; ++i)
             {
-                const aiFace &face = mesh.mFaces[i];
-                DE_ASSERT(face.mNumIndices == 3); // expecting triangles
-                indx << VBuf::Index(face.mIndices[0] + base)
-                     << VBuf::Index(face.mIndices[1] + base)
-                     << VBuf::Index(face.mIndices[2] + base);
+                for (int t = 0; t < MAX_TEXTURES; ++t)
+                {
+                    verts[i].texBounds[t] = texBounds[t];
+                }
             }
-
-            meshIndexRanges[m] = Rangez::fromSize(firstFace, mesh.mNumFaces * 3);
-
-            base += mesh.mNumVertices;
+            base = end;
         }
 
         std::unique_ptr<VBuf> buf(new VBuf);
         buf->setVertices(verts, gfx::Static);
-        buf->setIndices(gfx::Triangles, indx, gfx::Static);
+        buf->setIndices(gfx::Triangles, indices, gfx::Static);
         material.buffer = std::move(buf);
     }
 
@@ -1504,6 +1650,21 @@ void ModelDrawable::load(const File &file)
     d->import(file);
 }
 
+void ModelDrawable::loadAsync(const File &file, const LoadedFunc &loaded)
+{
+    LOG_AS("ModelDrawable");
+
+    // Get rid of all existing data.
+    clear();
+
+    d->importAsync(file, loaded);
+}
+
+bool ModelDrawable::isLoading() const
+{
+    return bool(d->pendingLoad);
+}
+
 void ModelDrawable::clear()
 {
     glDeinit();
@@ -1645,6 +1806,11 @@ void ModelDrawable::glInit()
     d->glInit();
 }
 
+void ModelDrawable::setUploadBudget(UploadBudget *budget)
+{
+    d->uploadBudget = budget;
+}
+
 void ModelDrawable::glDeinit()
 {
     d->glDeinit();
@@ -1730,6 +1896,40 @@ Vec3f ModelDrawable::midPoint() const
     return (d->maxPoint + d->minPoint) / 2.f;
 }
 
+Block ModelDrawable::geometryData() const
+{
+    Block data(d->vertices.data(), d->vertices.size() * sizeof(ModelVertex));
+    data.append(d->indices.data(), int(d->indices.size() * sizeof(duint16)));
+    return data;
+}
+
+ModelDrawable::UploadBudget::UploadBudget(int unitsPerFrame)
+    : _unitsPerFrame(unitsPerFrame)
+    , _available(unitsPerFrame)
+{}
+
+void ModelDrawable::UploadBudget::setUnitsPerFrame(int units)
+{
+    _unitsPerFrame = units;
+}
+
+int ModelDrawable::UploadBudget::unitsPerFrame() const
+{
+    return _unitsPerFrame;
+}
+
+void ModelDrawable::UploadBudget::beginFrame()
+{
+    _available = _unitsPerFrame;
+}
+
+bool ModelDrawable::UploadBudget::take()
+{
+    if (_available <= 0) return false;
+    --_available;
+    return true;
+}
+
 int ModelDrawable::Passes::findName(const String &name) const
 {
     for (dsize i = 0; i < size(); ++i)
@@ -0,0 +1,171 @@
+/*
+ * The Doomsday Engine Project
+ *
+ * Copyright © 2026 The Doomsday Engine Project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "resource/hqx.h"
+#include "gl/texfilter.h"
+
+#include <de/string.h>
+#include <iostream>
+#include <vector>
+
+using namespace de;
+using namespace std;
+
+typedef std::vector<uint8_t> Pixels;
+
+namespace {
+
+struct Config
+{
+    texfilter::InstructionSet isa;
+    bool threads;
+
+    String name() const
+    {
+        return Stringf("%s%s", texfilter::instructionSetName(isa), threads? " + threads" : "");
+    }
+
+    void apply() const
+    {
+        texfilter::setInstructionSet(isa);
+        texfilter::setMultithreaded(threads);
+    }
+};
+
+/**
+ * Hashes of the upscaled test sprites, produced by the original single-threaded
+ * hq2x implementation.
+ */
+struct Expected
+{
+    int width, height;
+    int flags; ///< 1: wrap horizontally, 2: wrap vertically.
+    duint64 hash;
+};
+
+const Expected expectedResults[] = {
+    {  1,   1, 0, 0xf9a5faafe9cea745ull},
+    {  1,   1, 3, 0xf9a5faafe9cea745ull},
+    {  1,   5, 0, 0xfb0d068777febaf5ull},
+    {  1,   5, 3, 0xfb0d068777febaf5ull},
+    {  7,   1, 0, 0x92980ef1c1c9298dull},
+    {  7,   1, 3, 0xdac3f0cb3ea2e471ull},
+    { 16,  16, 0, 0x558a26646e1d5b49ull},
+    { 16,  16, 3, 0xee14e0b7f3a0dc3full},
+    { 33,  17, 0, 0xe78d7356e08d7297ull},
+    { 33,  17, 3, 0xb14c66fd6fe61b46ull},
+    { 64, 128, 0, 0xd38e92e6b4f40a92ull},
+    { 64, 128, 3, 0x09a9ca88670dba40ull},
+    {320, 200, 0, 0x8219bc5495a7b446ull},
+    {320, 200, 3, 0x9fbe1e3ae4aa3d61ull},
+};
+
+/**
+ * Sprite-like test image: an opaque ellipse with a few translucent pixels on a
+ * transparent background, filled with a noisy pattern of palette colors.
+ */
+Pixels generateSprite(int width, int height, duint32 seed)
+{
+    static const uint8_t palette[8][3] = {
+        {  0,   0,   0}, {255, 255, 255}, {100, 100, 100}, {110, 104, 100},
+        {200,  40,  40}, {190,  60,  40}, { 30, 160,  60}, { 40,  60, 220},
+    };
+    Pixels image(dsize(width) * height * 4);
+    duint32 rnd = seed;
+    const dint64 w2 = dint64(width) * width, h2 = dint64(height) * height;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            rnd = rnd * 1664525u + 1013904223u;
+            const dint64 dx = 2 * x - width + 1, dy = 2 * y - height + 1;
+            const bool inside = dx * dx * h2 + dy * dy * w2 <= w2 * h2;
+            const int index = ((x / 3) ^ (y / 4) ^ int(rnd >> 30)) & 7;
+            uint8_t *pix = &image[(dsize(y) * width + x) * 4];
+            pix[0] = palette[index][0];
+            pix[1] = palette[index][1];
+            pix[2] = palette[index][2];
+            pix[3] = !inside? 0 : (rnd >> 24) < 8? 128 : 255;
+        }
+    }
+    return image;
+}
+
+/// FNV-1a, 64 bits.
+duint64 hashOf(const Pixels &data)
+{
+    duint64 hash = 14695981039346656037ull;
+    for (uint8_t b : data) hash = (hash ^ b) * 1099511628211ull;
+    return hash;
+}
+
+Pixels upscale(const Pixels &image, int width, int height, int flags)
+{
+    Pixels out(dsize(width) * height * 16);
+    hqx::upscale(image.data(), width, height, (flags & 1) != 0, (flags & 2) != 0, out.data());
+    return out;
+}
+
+} // namespace
+
+int main(int, char **)
+{
+    init_Foundation();
+    int failures = 0;
+    try
+    {
+        const texfilter::InstructionSet best = texfilter::availableInstructionSet();
+        std::vector<Config> configs{{texfilter::Scalar, false}, {texfilter::Scalar, true}};
+        if (best != texfilter::Scalar)
+        {
+            configs.push_back({best, false});
+            configs.push_back({best, true});
+        }
+
+        for (const auto &config : configs)
+        {
+            config.apply();
+            for (const auto &expected : expectedResults)
+            {
+                const Pixels image = generateSprite(expected.width, expected.height,
+                                                    duint32(expected.width * 1000 + expected.height));
+                const duint64 hash = hashOf(upscale(image, expected.width, expected.height,
+                                                    expected.flags));
+                if (hash != expected.hash)
+                {
+                    cout << Stringf("Output differs at %ix%i (flags %i) with %s: %016llx, expected %016llx",
+                                    expected.width, expected.height,
+                                    expected.flags, config.name().c_str(),
+                                    (unsigned long long) hash,
+                                    (unsigned long long) expected.hash) << endl;
+                    ++failures;
+                }
+            }
+        }
+        cout << (failures? Stringf("%i failures", failures) : String("All outputs as expected"))
+             << endl;
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        failures = 1;
+    }
+    deinit_Foundation();
+    return failures? 1 : 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * The Doomsday Engine Project
+ *
+ * Copyright © 2026 The Doomsday Engine Project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <de/filesystem.h>
+#include <de/folder.h>
+#include <de/log.h>
+#include <de/modeldrawable.h>
+#include <de/textapp.h>
+
+using namespace de;
+
+/// Two meshes: a quad and a triangle. No GL is needed for importing them.
+static const char *MODEL_SOURCE =
+    "o Quad\n"
+    "v 0 0 0\n"
+    "v 1 0 0\n"
+    "v 1 1 0\n"
+    "v 0 1 0\n"
+    "vt 0 0\n"
+    "vt 1 0\n"
+    "vt 1 1\n"
+    "vt 0 1\n"
+    "f 1/1 2/2 3/3\n"
+    "f 1/1 3/3 4/4\n"
+    "o Triangle\n"
+    "v 0 0 1\n"
+    "v 2 0 1\n"
+    "v 2 3 1\n"
+    "f 5 6 7\n";
+
+static bool compare(const ModelDrawable &sync, const ModelDrawable &async)
+{
+    bool same = true;
+    auto check = [&same] (bool ok, const char *what)
+    {
+        if (!ok)
+        {
+            LOG_WARNING("Synchronous and asynchronous loads differ: %s") << what;
+            same = false;
+        }
+    };
+
+    check(sync.meshCount() == async.meshCount(), "mesh count");
+    for (int i = 0; i < sync.meshCount(); ++i)
+    {
+        check(sync.meshName(i) == async.meshName(i), "mesh names");
+    }
+    check(sync.animationCount() == async.animationCount(), "animation count");
+    check(sync.dimensions() == async.dimensions(), "dimensions");
+    check(sync.midPoint() == async.midPoint(), "midpoint");
+    check(sync.geometryData() == async.geometryData(), "vertex data");
+    return same;
+}
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        app.initSubsystems(App::DisablePersistentData);
+
+        File &modelFile = app.homeFolder().replaceFile("test_modeldrawable.obj");
+        modelFile << String(MODEL_SOURCE).toUtf8();
+        modelFile.release();
+
+        ModelDrawable syncModel;
+        syncModel.load(modelFile);
+        LOG_MSG("Loaded synchronously: %i meshes, %i bytes of vertex data")
+                << syncModel.meshCount() << syncModel.geometryData().size();
+
+        ModelDrawable asyncModel;
+        result = app.exec([&] ()
+        {
+            asyncModel.loadAsync(modelFile, [&app, &syncModel] (ModelDrawable &model, bool loaded)
+            {
+                if (!loaded)
+                {
+                    LOG_WARNING("Asynchronous load failed");
+                    app.quit(1);
+                    return;
+                }
+                LOG_MSG("Loaded asynchronously: %i meshes") << model.meshCount();
+                app.quit(compare(syncModel, model)? 0 : 2);
+            });
+            DE_ASSERT(asyncModel.isLoading());
+        });
+        LOG_MSG("Result: %i") << result;
+    }
+    catch (const Error &err)
+    {
+        err.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}
@@ -0,0 +1,364 @@
+/*
+ * The Doomsday Engine Project
+ *
+ * Copyright © 2026 The Doomsday Engine Project
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "audio/softmixer.h"
+
+#include <de/string.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace de;
+
+namespace {
+
+const int    OUTPUT_RATE  = 44100;
+const int    CHUNK_FRAMES = 735;   ///< Offline rendering advances one frame (1/60 s) at a time.
+const double PI           = 3.14159265358979323846;
+
+/// Largest allowed difference from the reference, in 16-bit sample units.
+const int TOLERANCE = 2;
+
+struct Listener
+{
+    double position[3] = { 0, 0, 0 };
+    double yaw = 0;
+};
+
+/**
+ * Straightforward double precision mix of one voice, written independently of
+ * the mixer: the sample position is a real number, and the gains are ramped
+ * linearly from their previous values over each block.
+ */
+struct ReferenceVoice
+{
+    std::vector<double> samples;
+    int    rate       = 0;
+    bool   repeat     = false;
+    bool   positional = false;
+    bool   relative   = false;
+    double volume     = 1;
+    double pan        = 0;
+    double pitch      = 1;
+    double minDistance = 256;
+    double maxDistance = 2025;
+    double position[3] = { 0, 0, 0 };
+
+    bool   playing  = true;
+    bool   started  = false;
+    double cursor   = 0;
+    double gain[2]  = { 0, 0 };
+
+    void targetGains(const Listener &listener, double gains[2]) const
+    {
+        double vol = (volume < 0 ? std::pow(10.0, volume / 2000.0) : volume);
+        double p   = pan;
+        if (positional)
+        {
+            double delta[3], distSq = 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                delta[i] = position[i] - (relative ? 0 : listener.position[i]);
+                distSq  += delta[i] * delta[i];
+            }
+            const double dist = std::sqrt(distSq);
+            if (dist >= maxDistance)
+            {
+                vol = 0;
+            }
+            else if (dist > minDistance)
+            {
+                const double norm = (dist - minDistance) / (maxDistance - minDistance);
+                vol *= .125 / (.125 + norm) * (1 - norm);
+            }
+            p = 0;
+            if (dist > 1)
+            {
+                const double yaw = listener.yaw * PI / 180;
+                p = (delta[0] * std::sin(yaw) - delta[1] * std::cos(yaw)) / dist;
+            }
+        }
+        p = de::min(1.0, de::max(-1.0, p));
+        gains[0] = vol * de::min(1.0, 1 - p);
+        gains[1] = vol * de::min(1.0, 1 + p);
+    }
+
+    /// Adds @a frames frames of the voice to the stereo accumulators.
+    void mixBlock(const Listener &listener, double *left, double *right, int frames)
+    {
+        if (!playing) return;
+
+        double target[2];
+        targetGains(listener, target);
+        if (!started)
+        {
+            gain[0] = gain[1] = 0;
+            started = true;
+        }
+
+        const double count = double(samples.size());
+        const double step  = pitch * rate / OUTPUT_RATE;
+        for (int i = 0; i < frames; ++i)
+        {
+            if (cursor >= count)
+            {
+                if (!repeat)
+                {
+                    playing = false;
+                    break;
+                }
+                cursor = std::fmod(cursor, count);
+            }
+            const size_t idx  = size_t(cursor);
+            const double next = (idx + 1 < samples.size() ? samples[idx + 1]
+                                                          : (repeat ? samples[0] : 0.0));
+            const double value = samples[idx] + (next - samples[idx]) * (cursor - idx);
+            left[i]  += value * (gain[0] + (target[0] - gain[0]) * i / frames);
+            right[i] += value * (gain[1] + (target[1] - gain[1]) * i / frames);
+            cursor += step;
+        }
+        gain[0] = target[0];
+        gain[1] = target[1];
+    }
+};
+
+/**
+ * Builds the same voice for the mixer and for the reference.
+ */
+struct TestVoice
+{
+    SoftMixVoice   mixed;
+    ReferenceVoice reference;
+
+    TestVoice(bool positional, bool repeat, const std::vector<dint16> &samples, int rate)
+        : mixed(positional, repeat)
+    {
+        mixed.setSample(samples.data(), 2, int(samples.size()), rate);
+        mixed.playing = true;
+        for (dint16 s : samples) reference.samples.push_back(s / 32768.0);
+        reference.rate       = rate;
+        reference.repeat     = repeat;
+        reference.positional = positional;
+    }
+
+    TestVoice(bool positional, bool repeat, const std::vector<duint8> &samples, int rate)
+        : mixed(positional, repeat)
+    {
+        mixed.setSample(samples.data(), 1, int(samples.size()), rate);
+        mixed.playing = true;
+        for (duint8 s : samples) reference.samples.push_back((int(s) - 0x80) / 128.0);
+        reference.rate       = rate;
+        reference.repeat     = repeat;
+        reference.positional = positional;
+    }
+
+    void setVolume(float v) { mixed.volume = v; reference.volume = v; }
+    void setPan(float v)    { mixed.pan = v;    reference.pan = v; }
+    void setPitch(float v)  { mixed.pitch = v;  reference.pitch = v; }
+    void setRelative(bool v) { mixed.relative = v; reference.relative = v; }
+
+    void setPosition(float x, float y, float z)
+    {
+        const float pos[3] = { x, y, z };
+        for (int i = 0; i < 3; ++i)
+        {
+            mixed.position[i] = pos[i];
+            reference.position[i] = pos[i];
+        }
+    }
+};
+
+struct Scene
+{
+    SoftMixer mixer { OUTPUT_RATE };
+    Listener  listener;
+    std::vector<TestVoice *> voices;
+
+    ~Scene() { for (auto *v : voices) delete v; }
+
+    void add(TestVoice *voice)
+    {
+        voices.push_back(voice);
+        mixer.voices << &voice->mixed;
+    }
+
+    void setListener(float x, float y, float z, float yaw)
+    {
+        const float pos[3] = { x, y, z };
+        for (int i = 0; i < 3; ++i)
+        {
+            mixer.listener.position[i] = pos[i];
+            listener.position[i] = pos[i];
+        }
+        mixer.listener.yaw = yaw;
+        listener.yaw = yaw;
+    }
+
+    /**
+     * Renders one chunk with the mixer and with the reference, using the same
+     * block boundaries as the mixer.
+     *
+     * @return Largest difference between the two, in sample units.
+     */
+    int render(int frames, std::vector<dint16> &mixed, std::vector<dint16> &reference)
+    {
+        const size_t start = mixed.size();
+        mixed.resize(start + 2 * frames);
+        mixer.mix(&mixed[start], frames);
+
+        int maxDiff = 0;
+        for (int done = 0; done < frames; )
+        {
+            const int count = de::min(frames - done, SOFTMIX_BLOCK_FRAMES);
+            std::vector<double> left(count), right(count);
+            for (auto *voice : voices)
+            {
+                voice->reference.mixBlock(listener, left.data(), right.data(), count);
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                {
+                    const double v = de::min(32767.0, de::max(-32768.0, (ch? right : left)[i] * 32768));
+                    const dint16 out = dint16(v);
+                    reference.push_back(out);
+                    const int diff = std::abs(int(out) - int(mixed[start + 2 * (done + i) + ch]));
+                    maxDiff = de::max(maxDiff, diff);
+                }
+            }
+            done += count;
+        }
+        return maxDiff;
+    }
+};
+
+std::vector<dint16> sineTone(int rate, double frequency, double seconds, double amplitude)
+{
+    std::vector<dint16> samples(static_cast<std::size_t>(rate * seconds));
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        samples[i] = dint16(amplitude * 32767 * std::sin(2 * PI * frequency * i / rate));
+    }
+    return samples;
+}
+
+std::vector<duint8> squareWave(int period, int count)
+{
+    std::vector<duint8> samples(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i)
+    {
+        samples[size_t(i)] = ((i % period) < period / 2 ? 0xe0 : 0x20);
+    }
+    return samples;
+}
+
+std::vector<dint16> noise(int count, duint32 seed)
+{
+    std::vector<dint16> samples(static_cast<std::size_t>(count));
+    for (auto &s : samples)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        s = dint16(int(seed >> 16) - 0x8000) / 2;
+    }
+    return samples;
+}
+
+} // namespace
+
+int main(int, char **)
+{
+    init_Foundation();
+    int failures = 0;
+    try
+    {
+        Scene scene;
+        scene.setListener(100, 100, 0, 30);
+
+        // A tone that ends after half a second.
+        auto *tone = new TestVoice(false, false, sineTone(22050, 440, .5, .6), 22050);
+        tone->setVolume(.8f);
+        tone->setPan(-.5f);
+        scene.add(tone);
+
+        // A repeating 8-bit square wave, attenuated in hundredths of a decibel.
+        auto *square = new TestVoice(false, true, squareWave(40, 400), 11025);
+        square->setVolume(-600);
+        square->setPitch(1.25f);
+        scene.add(square);
+
+        // Positional noise to the side of the listener.
+        auto *source = new TestVoice(true, true, noise(5000, 1234), 11025);
+        source->setVolume(.9f);
+        source->setPitch(.8f);
+        source->setPosition(700, 300, 0);
+        scene.add(source);
+
+        std::vector<dint16> mixed, reference;
+        const int chunks = 90; // 1.5 seconds.
+        int maxDiff = 0;
+        for (int chunk = 0; chunk < chunks; ++chunk)
+        {
+            if (chunk == 30)
+            {
+                // Parameter changes between frames are ramped over the next block.
+                square->setVolume(.3f);
+                square->setPitch(.6f);
+                source->setRelative(true);
+                scene.setListener(-200, 50, 0, 120);
+            }
+            maxDiff = de::max(maxDiff, scene.render(CHUNK_FRAMES, mixed, reference));
+        }
+
+        if (maxDiff > TOLERANCE)
+        {
+            std::cout << Stringf("Mix differs from the reference by up to %i (tolerance %i)",
+                            maxDiff, TOLERANCE) << std::endl;
+            ++failures;
+        }
+        if (tone->mixed.playing || !tone->mixed.finished)
+        {
+            std::cout << "The tone did not end" << std::endl;
+            ++failures;
+        }
+
+        // Both channels must have something in them for the comparison to mean anything.
+        double energy[2] = { 0, 0 };
+        for (size_t i = 0; i < mixed.size(); ++i)
+        {
+            energy[i % 2] += double(mixed[i]) * mixed[i];
+        }
+        if (energy[0] < 1e9 || energy[1] < 1e9)
+        {
+            std::cout << "Mix is nearly silent" << std::endl;
+            ++failures;
+        }
+
+        std::cout << Stringf("%i frames compared, largest difference %i", int(mixed.size() / 2), maxDiff)
+             << std::endl;
+        std::cout << (failures? Stringf("%i failures", failures) : String("Mix matches the reference"))
+             << std::endl;
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        failures = 1;
+    }
+    deinit_Foundation();
+    return failures? 1 : 0;
+}
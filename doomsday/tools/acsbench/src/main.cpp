@@ -0,0 +1,656 @@
+/** @file main.cpp  Benchmark for the ACS bytecode interpreter.
+ *
+ * Generates a module of scripts that mostly do arithmetic on script, map, and
+ * world variables, and runs it for a number of tics both with a reference
+ * interpreter that decodes the original bytecode as it goes (like the
+ * interpreter used to) and with acs::Bytecode. The state of every script is
+ * compared after each tic, including the bytecode offset that would be written
+ * to a saved game. The exit status is non-zero if the results differ.
+ *
+ * Only acs::Bytecode (decoding and Bytecode::execute()) is the game's own code.
+ * The script stack, the Machine that stands in for acs::Interpreter, and the
+ * whole reference interpreter are copies written for this tool, because
+ * acs::Interpreter cannot be built without the engine. The timings therefore
+ * show the difference between the two dispatch schemes, not the speed of the
+ * game's actual interpreter.
+ *
+ * Usage: acsbench [--scripts N] [--loops N] [--tics N] [--rounds N]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "acs/bytecode.h"
+
+#include <de/byteorder.h>
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+using namespace de;
+using acs::Bytecode;
+using acs::CommandResult;
+using Opcode = Bytecode::Opcode;
+
+namespace {
+
+static const int MAX_SCRIPT_ARGS = 10;
+static const int STACK_DEPTH     = 32;
+
+/// Copy of acs::Interpreter::Stack, except that errors are only counted.
+struct Stack
+{
+    int values[STACK_DEPTH];
+    int height;
+    int errors;
+
+    inline void push(int value) {
+        if (height >= STACK_DEPTH) {
+            errors++;
+            return;
+        }
+        values[height++] = value;
+    }
+    inline int pop() {
+        if (height <= 0) {
+            errors++;
+            return 0;
+        }
+        return values[--height];
+    }
+    inline int top() const {
+        if (height == 0) {
+            const_cast<Stack *>(this)->errors++;
+            return 0;
+        }
+        return values[height - 1];
+    }
+    inline void drop() {
+        if (height == 0) errors++;
+        height--;
+    }
+};
+
+struct Variables
+{
+    std::array<dint32, 32> mapVars;
+    std::array<dint32, 64> worldVars;
+};
+
+/**
+ * State of one running script. Stands in for acs::Interpreter: the members used by
+ * Bytecode::execute() are named like the ones there, and command() handles only
+ * the commands that the generated scripts use.
+ */
+struct Machine
+{
+    // Reference interpreter.
+    const dint32 *pcodePtr;
+    const dint32 *entryPcodePtr;
+
+    // Bytecode.
+    const Bytecode::Instruction *ip;
+    const Bytecode::Instruction *entryCode;
+
+    Stack locals;
+    int args[MAX_SCRIPT_ARGS];
+    int delayCount;
+    int side;
+    bool terminated;
+
+    CommandResult command(const Bytecode::Instruction &insn)
+    {
+        switch (insn.opcode)
+        {
+        case Opcode::Restart:
+            ip = entryCode;
+            return acs::Continue;
+
+        case Opcode::LineSide:
+            locals.push(side);
+            return acs::Continue;
+
+        default:
+            throw Error("Machine::command", "Unexpected command #" + String::asText(int(insn.opcode)));
+        }
+    }
+};
+
+/// Writes bytecode one command at a time.
+struct Assembler
+{
+    List<dint32> words;
+
+    /// Returns the index of the last word written.
+    int emit(Opcode op, std::initializer_list<dint32> operands = {})
+    {
+        DE_ASSERT(int(operands.size()) == Bytecode::operandCount(op));
+        words << dint32(op);
+        for (dint32 v : operands) words << v;
+        return words.sizei() - 1;
+    }
+
+    /// Bytecode offset of the next command.
+    dint32 here() const { return dint32(4 * words.size()); }
+};
+
+/**
+ * Generated module. Each script loops over its variables for a number of
+ * iterations each tic, and then delays. Half of the scripts restart themselves
+ * after a while and the rest terminate. Some scripts start in the middle of
+ * another one, so that linear runs of code meet in the decoded bytecode.
+ */
+struct GeneratedModule
+{
+    Block pcode;
+    List<dint32> entryOffsets;
+    List<int> entrySides;
+
+    GeneratedModule(int scriptCount, int loopCount)
+    {
+        Assembler a;
+
+        for (int i = 0; i < scriptCount; ++i)
+        {
+            const dint32 mapVar   = i % 32;
+            const dint32 worldVar = (i * 7) % 64;
+
+            const dint32 entry = a.here();
+            a.emit(Opcode::PushNumber, {i});
+            a.emit(Opcode::AssignScriptVar, {1});
+
+            const dint32 loop = a.here();
+            a.emit(Opcode::PushScriptVar, {0});
+            a.emit(Opcode::PushNumber, {3});
+            a.emit(Opcode::Multiply);
+            a.emit(Opcode::PushScriptVar, {1});
+            a.emit(Opcode::Add);
+            a.emit(Opcode::PushNumber, {1000003});
+            a.emit(Opcode::Modulus);
+            a.emit(Opcode::AssignScriptVar, {2});
+            a.emit(Opcode::PushScriptVar, {2});
+            a.emit(Opcode::AddMapVar, {mapVar});
+            a.emit(Opcode::IncWorldVar, {worldVar});
+            a.emit(Opcode::PushScriptVar, {2});
+            a.emit(Opcode::PushNumber, {2});
+            a.emit(Opcode::Modulus);
+            const int evenJump = a.emit(Opcode::CaseGoto, {0, 0});
+            a.emit(Opcode::Drop);
+            a.emit(Opcode::PushMapVar, {mapVar});
+            a.emit(Opcode::PushNumber, {1});
+            a.emit(Opcode::RShift);
+            a.emit(Opcode::AssignMapVar, {mapVar});
+            const int joinJump = a.emit(Opcode::Goto, {0});
+
+            a.words[evenJump] = a.here();
+            a.emit(Opcode::PushWorldVar, {worldVar});
+            a.emit(Opcode::PushNumber, {0x7ff});
+            a.emit(Opcode::AndBitwise);
+            a.emit(Opcode::PushNumber, {5});
+            a.emit(Opcode::LShift);
+            a.emit(Opcode::PushNumber, {0xffff});
+            a.emit(Opcode::AndBitwise);
+            a.emit(Opcode::AssignWorldVar, {worldVar});
+
+            // The even case falls through to here.
+            const dint32 join = a.here();
+            a.words[joinJump] = join;
+            a.emit(Opcode::PushMapVar, {mapVar});
+            a.emit(Opcode::PushNumber, {0xfffff});
+            a.emit(Opcode::AndBitwise);
+            a.emit(Opcode::AssignMapVar, {mapVar});
+            a.emit(Opcode::LineSide);
+            a.emit(Opcode::PushScriptVar, {2});
+            a.emit(Opcode::EQ);
+            a.emit(Opcode::NegateLogical);
+            a.emit(Opcode::SubWorldVar, {worldVar});
+            a.emit(Opcode::IncScriptVar, {0});
+            a.emit(Opcode::PushScriptVar, {0});
+            a.emit(Opcode::PushNumber, {loopCount});
+            a.emit(Opcode::LT);
+            a.emit(Opcode::IfGoto, {loop});
+
+            a.emit(Opcode::PushNumber, {0});
+            a.emit(Opcode::AssignScriptVar, {0});
+            if (i % 2)
+            {
+                a.emit(Opcode::PushNumber, {1 + i % 3});
+                a.emit(Opcode::Delay);
+            }
+            else
+            {
+                a.emit(Opcode::DelayDirect, {1});
+            }
+            a.emit(Opcode::IncScriptVar, {1});
+            a.emit(Opcode::PushScriptVar, {1});
+            a.emit(Opcode::PushNumber, {i + 50 + i % 20});
+            a.emit(Opcode::GE);
+            a.emit(Opcode::IfNotGoto, {loop});
+            a.emit(Opcode::PushNumber, {i});
+            a.emit(Opcode::UnaryMinus);
+            a.emit(Opcode::AssignScriptVar, {1});
+            a.emit(i % 2? Opcode::Terminate : Opcode::Restart);
+
+            // Decoding the extra entry point first means that the main one will
+            // reach the code decoded for it.
+            if (i % 4 == 0)
+            {
+                entryOffsets << join;
+                entrySides << -i;
+            }
+            entryOffsets << entry;
+            entrySides << i;
+        }
+
+        pcode = Block(a.words.size() * 4);
+        for (dsize i = 0; i < a.words.size(); ++i)
+        {
+            const dint32 value = fromLittleEndian(a.words[i]);
+            std::memcpy(pcode.data() + 4 * i, &value, 4);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------------------
+// Reference interpreter. Operands are read from the bytecode as commands are
+// executed, and each command is called via a table of function pointers.
+
+#define REF_COMMAND(Name) CommandResult ref##Name(Machine &m, Variables &vars, const dint32 *base)
+#define REF_OPERAND() fromLittleEndian(*m.pcodePtr++)
+
+typedef CommandResult (*RefCommand)(Machine &, Variables &, const dint32 *);
+
+REF_COMMAND(NOP)        { DE_UNUSED(m, vars, base); return acs::Continue; }
+REF_COMMAND(Terminate)  { DE_UNUSED(m, vars, base); return acs::Terminate; }
+REF_COMMAND(PushNumber) { DE_UNUSED(vars, base); m.locals.push(REF_OPERAND()); return acs::Continue; }
+
+#define REF_BINARY(Name, Operator) \
+    REF_COMMAND(Name) { \
+        DE_UNUSED(vars, base); \
+        const int operand2 = m.locals.pop(); \
+        m.locals.push(m.locals.pop() Operator operand2); \
+        return acs::Continue; \
+    }
+
+REF_BINARY(Add,        +)
+REF_BINARY(Subtract,   -)
+REF_BINARY(Multiply,   *)
+REF_BINARY(Divide,     /)
+REF_BINARY(Modulus,    %)
+REF_BINARY(EQ,         ==)
+REF_BINARY(NE,         !=)
+REF_BINARY(LT,         <)
+REF_BINARY(GT,         >)
+REF_BINARY(LE,         <=)
+REF_BINARY(GE,         >=)
+REF_BINARY(AndBitwise, &)
+REF_BINARY(OrBitwise,  |)
+REF_BINARY(EorBitwise, ^)
+REF_BINARY(LShift,     <<)
+REF_BINARY(RShift,     >>)
+
+REF_COMMAND(AndLogical)
+{
+    DE_UNUSED(vars, base);
+    m.locals.push(m.locals.pop() && m.locals.pop());
+    return acs::Continue;
+}
+
+REF_COMMAND(OrLogical)
+{
+    DE_UNUSED(vars, base);
+    m.locals.push(m.locals.pop() || m.locals.pop());
+    return acs::Continue;
+}
+
+REF_COMMAND(NegateLogical)
+{
+    DE_UNUSED(vars, base);
+    m.locals.push(!m.locals.pop());
+    return acs::Continue;
+}
+
+REF_COMMAND(UnaryMinus)
+{
+    DE_UNUSED(vars, base);
+    m.locals.push(-m.locals.pop());
+    return acs::Continue;
+}
+
+#define REF_VARIABLE_OPS(Kind, Array) \
+    REF_COMMAND(Assign##Kind##Var) { DE_UNUSED(vars, base); Array[REF_OPERAND()] = m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Push##Kind##Var)   { DE_UNUSED(vars, base); m.locals.push(Array[REF_OPERAND()]); return acs::Continue; } \
+    REF_COMMAND(Add##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()] += m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Sub##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()] -= m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Mul##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()] *= m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Div##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()] /= m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Mod##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()] %= m.locals.pop(); return acs::Continue; } \
+    REF_COMMAND(Inc##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()]++; return acs::Continue; } \
+    REF_COMMAND(Dec##Kind##Var)    { DE_UNUSED(vars, base); Array[REF_OPERAND()]--; return acs::Continue; }
+
+REF_VARIABLE_OPS(Script, m.args)
+REF_VARIABLE_OPS(Map,    vars.mapVars)
+REF_VARIABLE_OPS(World,  vars.worldVars)
+
+REF_COMMAND(Goto)
+{
+    DE_UNUSED(vars);
+    m.pcodePtr = base + fromLittleEndian(*m.pcodePtr) / 4;
+    return acs::Continue;
+}
+
+REF_COMMAND(IfGoto)
+{
+    DE_UNUSED(vars);
+    if (m.locals.pop())
+    {
+        m.pcodePtr = base + fromLittleEndian(*m.pcodePtr) / 4;
+    }
+    else
+    {
+        m.pcodePtr++;
+    }
+    return acs::Continue;
+}
+
+REF_COMMAND(IfNotGoto)
+{
+    DE_UNUSED(vars);
+    if (m.locals.pop())
+    {
+        m.pcodePtr++;
+    }
+    else
+    {
+        m.pcodePtr = base + fromLittleEndian(*m.pcodePtr) / 4;
+    }
+    return acs::Continue;
+}
+
+REF_COMMAND(CaseGoto)
+{
+    DE_UNUSED(vars);
+    if (m.locals.top() == REF_OPERAND())
+    {
+        m.pcodePtr = base + fromLittleEndian(*m.pcodePtr) / 4;
+        m.locals.drop();
+    }
+    else
+    {
+        m.pcodePtr++;
+    }
+    return acs::Continue;
+}
+
+REF_COMMAND(Drop)        { DE_UNUSED(vars, base); m.locals.drop(); return acs::Continue; }
+REF_COMMAND(Delay)       { DE_UNUSED(vars, base); m.delayCount = m.locals.pop(); return acs::Stop; }
+REF_COMMAND(DelayDirect) { DE_UNUSED(vars, base); m.delayCount = REF_OPERAND(); return acs::Stop; }
+REF_COMMAND(Restart)     { DE_UNUSED(vars, base); m.pcodePtr = m.entryPcodePtr; return acs::Continue; }
+REF_COMMAND(LineSide)    { DE_UNUSED(vars, base); m.locals.push(m.side); return acs::Continue; }
+
+static const RefCommand &findRefCommand(int name)
+{
+    static RefCommand cmds[int(Opcode::Invalid)];
+    if (!cmds[0])
+    {
+#define REF_SET(Name) cmds[int(Opcode::Name)] = ref##Name
+        REF_SET(NOP); REF_SET(Terminate); REF_SET(PushNumber);
+        REF_SET(Add); REF_SET(Subtract); REF_SET(Multiply); REF_SET(Divide); REF_SET(Modulus);
+        REF_SET(EQ); REF_SET(NE); REF_SET(LT); REF_SET(GT); REF_SET(LE); REF_SET(GE);
+        REF_SET(AndBitwise); REF_SET(OrBitwise); REF_SET(EorBitwise); REF_SET(LShift); REF_SET(RShift);
+        REF_SET(AndLogical); REF_SET(OrLogical); REF_SET(NegateLogical); REF_SET(UnaryMinus);
+#define REF_SET_VARIABLE_OPS(Kind) \
+        REF_SET(Assign##Kind##Var); REF_SET(Push##Kind##Var); REF_SET(Add##Kind##Var); \
+        REF_SET(Sub##Kind##Var); REF_SET(Mul##Kind##Var); REF_SET(Div##Kind##Var); \
+        REF_SET(Mod##Kind##Var); REF_SET(Inc##Kind##Var); REF_SET(Dec##Kind##Var)
+        REF_SET_VARIABLE_OPS(Script); REF_SET_VARIABLE_OPS(Map); REF_SET_VARIABLE_OPS(World);
+#undef REF_SET_VARIABLE_OPS
+        REF_SET(Goto); REF_SET(IfGoto); REF_SET(IfNotGoto); REF_SET(CaseGoto);
+        REF_SET(Drop); REF_SET(Delay); REF_SET(DelayDirect); REF_SET(Restart); REF_SET(LineSide);
+#undef REF_SET
+    }
+    if (name >= 0 && name < int(Opcode::Invalid) && cmds[name]) return cmds[name];
+    throw Error("findRefCommand", "Unknown command #" + String::asText(name));
+}
+
+//---------------------------------------------------------------------------------------
+
+struct Simulation
+{
+    const GeneratedModule &module;
+    const Bytecode &bytecode;
+    Variables vars;
+    List<Machine> machines;
+
+    Simulation(const GeneratedModule &module, const Bytecode &bytecode)
+        : module(module)
+        , bytecode(bytecode)
+    {
+        vars.mapVars.fill(0);
+        vars.worldVars.fill(0);
+        const dint32 *base = reinterpret_cast<const dint32 *>(module.pcode.data());
+        for (dsize i = 0; i < module.entryOffsets.size(); ++i)
+        {
+            Machine m;
+            std::memset(&m, 0, sizeof(m));
+            m.entryPcodePtr = m.pcodePtr = base + module.entryOffsets[i] / 4;
+            m.entryCode     = m.ip       = bytecode.at(module.entryOffsets[i]);
+            m.side          = module.entrySides[i];
+            machines << m;
+        }
+    }
+
+    void referenceTic()
+    {
+        const dint32 *base = reinterpret_cast<const dint32 *>(module.pcode.data());
+        for (Machine &m : machines)
+        {
+            if (m.terminated) continue;
+            if (m.delayCount)
+            {
+                m.delayCount--;
+                continue;
+            }
+            CommandResult action;
+            while ((action = findRefCommand(fromLittleEndian(*m.pcodePtr++))(m, vars, base)) ==
+                   acs::Continue)
+            {}
+            if (action == acs::Terminate) m.terminated = true;
+        }
+    }
+
+    void bytecodeTic()
+    {
+        for (Machine &m : machines)
+        {
+            if (m.terminated) continue;
+            if (m.delayCount)
+            {
+                m.delayCount--;
+                continue;
+            }
+            if (bytecode.execute(m, vars.mapVars.data(), vars.worldVars.data()) == acs::Terminate)
+            {
+                m.terminated = true;
+            }
+        }
+    }
+
+    /**
+     * Moves the bytecode position of each script to where the reference
+     * interpreter is in @a ref, like restoring a saved game would.
+     */
+    void restoreBytecodePositions(const Simulation &ref)
+    {
+        for (dsize i = 0; i < machines.size(); ++i)
+        {
+            if (!machines[i].terminated)
+            {
+                machines[i].ip = bytecode.at(ref.referenceOffset(ref.machines[i]));
+            }
+        }
+    }
+
+    dint32 referenceOffset(const Machine &m) const
+    {
+        return dint32(4 * (m.pcodePtr - reinterpret_cast<const dint32 *>(module.pcode.data())));
+    }
+};
+
+/**
+ * Compares the state of two simulations, one of which has been run with the
+ * reference interpreter.
+ */
+static bool compare(const Simulation &ref, const Simulation &sim, int tic)
+{
+    if (ref.vars.mapVars != sim.vars.mapVars || ref.vars.worldVars != sim.vars.worldVars)
+    {
+        LOG_WARNING("Tic %i: map or world variables differ") << tic;
+        return false;
+    }
+    for (dsize i = 0; i < ref.machines.size(); ++i)
+    {
+        const Machine &a = ref.machines[i];
+        const Machine &b = sim.machines[i];
+        bool same = a.terminated == b.terminated && a.delayCount == b.delayCount &&
+                    a.locals.height == b.locals.height && a.locals.errors == b.locals.errors &&
+                    std::equal(a.args, a.args + MAX_SCRIPT_ARGS, b.args);
+        for (int k = 0; same && k < a.locals.height; ++k)
+        {
+            same = a.locals.values[k] == b.locals.values[k];
+        }
+        if (same && !a.terminated)
+        {
+            // This is what a saved game would contain.
+            same = ref.referenceOffset(a) == b.ip->pcodeOffset;
+        }
+        if (!same)
+        {
+            LOG_WARNING("Tic %i: script %i differs") << tic << i;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "ACS Interpreter Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int scriptCount = 200;
+        int loopCount   = 40;
+        int tics        = 1000;
+        int rounds      = 5;
+        for (dsize i = 1; i + 1 < cmdLine.count(); i += 2)
+        {
+            const int value = de::max(1, cmdLine.at(i + 1).toInt());
+            if      (cmdLine.at(i) == "--scripts") scriptCount = value;
+            else if (cmdLine.at(i) == "--loops")   loopCount   = value;
+            else if (cmdLine.at(i) == "--tics")    tics        = value;
+            else if (cmdLine.at(i) == "--rounds")  rounds      = value;
+        }
+
+        const GeneratedModule module(scriptCount, loopCount);
+
+        Time decodeStartedAt;
+        Bytecode bytecode;
+        bytecode.decode(module.pcode, module.entryOffsets);
+        const ddouble decodeTime = decodeStartedAt.since();
+
+        LOG_MSG("Note: the interpreter state and the reference interpreter are copies "
+                "made for this tool; only acs::Bytecode is the game's code");
+        LOG_MSG("%i scripts (%i bytes of bytecode) decoded to %i instructions in %.2f ms")
+                << module.entryOffsets.sizei() << int(module.pcode.size())
+                << bytecode.instructionCount() << decodeTime * 1000.0;
+
+        // Run both interpreters in lockstep and compare after every tic.
+        {
+            Simulation ref(module, bytecode);
+            Simulation sim(module, bytecode);
+            for (int tic = 0; tic < tics && !result; ++tic)
+            {
+                ref.referenceTic();
+                sim.bytecodeTic();
+                if (!compare(ref, sim, tic))
+                {
+                    result = 1;
+                }
+                else if (tic == tics / 2)
+                {
+                    // Continuing from the saved offsets must work, too.
+                    sim.restoreBytecodePositions(ref);
+                }
+            }
+            if (!result)
+            {
+                LOG_MSG("Results are identical after %i tics") << tics;
+            }
+        }
+
+        ddouble bestRef  = 1.0e9; // seconds
+        ddouble bestCode = 1.0e9;
+        for (int round = 0; round < rounds; ++round)
+        {
+            {
+                Simulation ref(module, bytecode);
+                Time startedAt;
+                for (int tic = 0; tic < tics; ++tic) ref.referenceTic();
+                bestRef = de::min(bestRef, ddouble(startedAt.since()));
+            }
+            {
+                Simulation sim(module, bytecode);
+                Time startedAt;
+                for (int tic = 0; tic < tics; ++tic) sim.bytecodeTic();
+                bestCode = de::min(bestCode, ddouble(startedAt.since()));
+            }
+        }
+
+        LOG_MSG("Best of %i rounds of %i tics:") << rounds << tics;
+        LOG_MSG("  Decoding as executed: %.2f ms") << bestRef * 1000.0;
+#ifdef ACS_THREADED_DISPATCH
+        LOG_MSG("  Pre-decoded (threaded): %.2f ms, %.2fx") << bestCode * 1000.0
+                << bestRef / de::max(bestCode, 1.0e-9);
+#else
+        LOG_MSG("  Pre-decoded (switch): %.2f ms, %.2fx") << bestCode * 1000.0
+                << bestRef / de::max(bestCode, 1.0e-9);
+#endif
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}
@@ -0,0 +1,259 @@
+/** @file linkedblockmap.cpp  Linked-cell blockmap, for reference.
+ *
+ * @authors Copyright © 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2006-2016 Daniel Swanson <danij@dengine.net>
+ * @authors Copyright © 1993-1996 by id Software, Inc.
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "linkedblockmap.h"
+
+#include <de/math.h>
+
+using namespace de;
+
+LinkedBlockmap::LinkedBlockmap(const AABoxd &bounds, duint cellSize)
+    : _geometry(bounds, cellSize)
+{
+    // Quadtree must subdivide the space equally into 1x1 unit cells.
+    const Cell &dims = _geometry.dimensions();
+    _nodes.emplace_back(Cell(0, 0), ceilPow2(de::max(dims.x, dims.y)));
+}
+
+LinkedBlockmap::~LinkedBlockmap()
+{
+    for (Node &node : _nodes)
+    {
+        if (!node.isLeaf() || !node.leafData) continue;
+
+        for (RingNode *ring = node.leafData->ringNodes; ring; )
+        {
+            RingNode *next = ring->next;
+            delete ring;
+            ring = next;
+        }
+        delete node.leafData;
+    }
+}
+
+const AABoxd &LinkedBlockmap::bounds() const
+{
+    return _geometry.bounds();
+}
+
+LinkedBlockmap::Cell LinkedBlockmap::toCell(const Vec2d &point) const
+{
+    return _geometry.toCell(point);
+}
+
+LinkedBlockmap::Node *LinkedBlockmap::findLeaf(Node *node, const Cell &at, bool canSubdivide) const
+{
+    if (node->isLeaf()) return node;
+
+    // Into which quadrant do we need to descend?
+    const duint subSize = node->size >> 1;
+    const int q = (at.x < node->cell.x + subSize? 0 : 1) + (at.y < node->cell.y + subSize? 0 : 2);
+
+    Node **childAdr = &node->children[q];
+    if (!*childAdr)
+    {
+        if (!canSubdivide) return nullptr;
+
+        // Subdivide the space.
+        _nodes.emplace_back(Cell(node->cell.x + (q & 1? subSize : 0),
+                                 node->cell.y + (q & 2? subSize : 0)), subSize);
+        *childAdr = &_nodes.back();
+    }
+    return findLeaf(*childAdr, at, canSubdivide);
+}
+
+LinkedBlockmap::CellData *LinkedBlockmap::cellData(const Cell &cell, bool canCreate) const
+{
+    const Cell &dims = _geometry.dimensions();
+    if (cell.x >= dims.x || cell.y >= dims.y) return nullptr;
+
+    if (Node *node = findLeaf(&_nodes.front(), cell, canCreate))
+    {
+        if (!node->leafData && canCreate)
+        {
+            node->leafData = new CellData;
+        }
+        return node->leafData;
+    }
+    return nullptr;
+}
+
+LinkedBlockmap::CellBlock LinkedBlockmap::clippedCellBlock(const AABoxd &box) const
+{
+    CellBlock block = _geometry.toCellBlock(box);
+    const Cell &dims = _geometry.dimensions();
+    block.min = block.min.min(dims);
+    block.max = block.max.min(dims);
+    return block;
+}
+
+bool LinkedBlockmap::link(const Cell &cell, void *elem)
+{
+    CellData *data = cellData(cell, true);
+    if (!data) return false;
+
+    // Is there an available node in the ring we can reuse?
+    RingNode *node = data->ringNodes;
+    if (node)
+    {
+        while (node->next && node->elem) node = node->next;
+        if (node->elem)
+        {
+            // Add a new node to the ring.
+            node->next = new RingNode{nullptr, node, nullptr};
+            node = node->next;
+        }
+    }
+    else
+    {
+        node = data->ringNodes = new RingNode{nullptr, nullptr, nullptr};
+    }
+    node->elem = elem;
+    data->elemCount++;
+    return true;
+}
+
+bool LinkedBlockmap::link(const AABoxd &region, void *elem)
+{
+    bool didLink = false;
+    const CellBlock block = clippedCellBlock(region);
+    Cell cell;
+    for (cell.y = block.min.y; cell.y < block.max.y; ++cell.y)
+    for (cell.x = block.min.x; cell.x < block.max.x; ++cell.x)
+    {
+        if (link(cell, elem)) didLink = true;
+    }
+    return didLink;
+}
+
+bool LinkedBlockmap::unlink(const Cell &cell, void *elem)
+{
+    if (CellData *data = cellData(cell))
+    {
+        for (RingNode *node = data->ringNodes; node; node = node->next)
+        {
+            if (node->elem == elem)
+            {
+                node->elem = nullptr;
+                data->elemCount--;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+LoopResult LinkedBlockmap::forAllInCell(const Cell &cell, const Func &func) const
+{
+    if (CellData *data = cellData(cell))
+    {
+        RingNode *node = data->ringNodes;
+        while (node)
+        {
+            RingNode *next = node->next;
+            if (node->elem)
+            {
+                if (auto result = func(node->elem)) return result;
+            }
+            node = next;
+        }
+    }
+    return LoopContinue;
+}
+
+LoopResult LinkedBlockmap::forAllInBox(const AABoxd &box, const Func &func) const
+{
+    const CellBlock block = clippedCellBlock(box);
+    Cell cell;
+    for (cell.y = block.min.y; cell.y < block.max.y; ++cell.y)
+    for (cell.x = block.min.x; cell.x < block.max.x; ++cell.x)
+    {
+        if (auto result = forAllInCell(cell, func)) return result;
+    }
+    return LoopContinue;
+}
+
+LoopResult LinkedBlockmap::forAllInPath(const Vec2d &from, const Vec2d &to_, const Func &func) const
+{
+    const AABoxd &bounds = _geometry.bounds();
+    const Vec2d origin = _geometry.origin();
+    const double cellSize = _geometry.cellSize();
+    DE_ASSERT(from.x >= bounds.minX && from.x <= bounds.maxX &&
+              from.y >= bounds.minY && from.y <= bounds.maxY);
+    DE_UNUSED(bounds);
+
+    // Trace lines should not be perfectly parallel to a blockmap axis.
+    Vec2d to = to_;
+    const Vec2d delta = (to - origin) / cellSize;
+    if (de::fequal(delta.x, 0, 1.0)) to.x += 1;
+    if (de::fequal(delta.y, 0, 1.0)) to.y += 1;
+
+    const Cell originCell = toCell(from);
+    const Cell destCell   = toCell(to);
+
+    Vec2d intercept = (from - origin) / cellSize;
+    Vec2i cellStep;
+    Vec2d interceptStep;
+    Vec2d frac;
+    if (destCell.x == originCell.x)
+    {
+        interceptStep.y = 256;
+        frac.y          = 1;
+    }
+    else
+    {
+        cellStep.x      = destCell.x > originCell.x? 1 : -1;
+        interceptStep.y = (to.y - from.y) / de::abs(to.x - from.x);
+        frac.y          = cellStep.x > 0? 1 - (intercept.x - int(intercept.x))
+                                        : intercept.x - int(intercept.x);
+    }
+    if (destCell.y == originCell.y)
+    {
+        interceptStep.x = 256;
+        frac.x          = 1;
+    }
+    else
+    {
+        cellStep.y      = destCell.y > originCell.y? 1 : -1;
+        interceptStep.x = (to.x - from.x) / de::abs(to.y - from.y);
+        frac.x          = cellStep.y > 0? 1 - (intercept.y - int(intercept.y))
+                                        : intercept.y - int(intercept.y);
+    }
+    intercept += frac * interceptStep;
+
+    Cell cell = originCell;
+    for (int pass = 0; pass < 64; ++pass)
+    {
+        if (auto result = forAllInCell(cell, func)) return result;
+        if (cell == destCell) break;
+
+        if (cell.y == duint(intercept.y))
+        {
+            cell.x      += cellStep.x;
+            intercept.y += interceptStep.y;
+        }
+        else if (cell.x == duint(intercept.x))
+        {
+            cell.y      += cellStep.y;
+            intercept.x += interceptStep.x;
+        }
+    }
+    return LoopContinue;
+}
@@ -0,0 +1,95 @@
+/** @file linkedblockmap.h  Linked-cell blockmap, for reference.
+ *
+ * This is the blockmap of libdoomsday before the cell lists were moved into
+ * flat arrays: a quadtree of cells, each leaf owning a ring of individually
+ * allocated nodes, iterated through std::function. It is kept here only so
+ * that blockmapbench can time the current world::Blockmap against it. The
+ * original allocated the nodes from the memory zone; here they come from the
+ * heap, so the bench does not need to initialize libdoomsday.
+ *
+ * @authors Copyright © 2003-2017 Jaakko Keränen <jaakko.keranen@iki.fi>
+ * @authors Copyright © 2006-2016 Daniel Swanson <danij@dengine.net>
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef BLOCKMAPBENCH_LINKEDBLOCKMAP_H
+#define BLOCKMAPBENCH_LINKEDBLOCKMAP_H
+
+#include <doomsday/world/blockmap.h>
+
+#include <functional>
+#include <list>
+
+class LinkedBlockmap
+{
+public:
+    typedef world::BlockmapCell      Cell;
+    typedef world::BlockmapCellBlock CellBlock;
+    typedef std::function<de::LoopResult (void *object)> Func;
+
+public:
+    LinkedBlockmap(const AABoxd &bounds, de::duint cellSize = 128);
+    ~LinkedBlockmap();
+
+    const AABoxd &bounds() const;
+    Cell toCell(const de::Vec2d &point) const;
+
+    bool link(const Cell &cell, void *elem);
+    bool link(const AABoxd &region, void *elem);
+    bool unlink(const Cell &cell, void *elem);
+
+    de::LoopResult forAllInCell(const Cell &cell, const Func &func) const;
+    de::LoopResult forAllInBox(const AABoxd &box, const Func &func) const;
+
+    /**
+     * Same cell walk as world::Blockmap::forAllInPath(), except that both
+     * points must be inside the blockmap (the bench never traces outside it).
+     */
+    de::LoopResult forAllInPath(const de::Vec2d &from, const de::Vec2d &to, const Func &func) const;
+
+private:
+    struct RingNode
+    {
+        void *    elem;
+        RingNode *prev;
+        RingNode *next;
+    };
+
+    struct CellData
+    {
+        RingNode *ringNodes = nullptr;
+        de::dint  elemCount = 0;
+    };
+
+    struct Node
+    {
+        Cell      cell;
+        de::duint size;
+        Node *    children[4] {};
+        CellData *leafData = nullptr;
+
+        Node(const Cell &cell, de::duint size) : cell(cell), size(size) {}
+        bool isLeaf() const { return size == 1; }
+    };
+
+    Node *findLeaf(Node *node, const Cell &at, bool canSubdivide) const;
+    CellData *cellData(const Cell &cell, bool canCreate = false) const;
+    CellBlock clippedCellBlock(const AABoxd &box) const;
+
+    world::Blockmap _geometry; ///< Coordinate conversions only; nothing is linked in it.
+    mutable std::list<Node> _nodes;
+};
+
+#endif // BLOCKMAPBENCH_LINKEDBLOCKMAP_H
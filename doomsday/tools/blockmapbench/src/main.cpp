@@ -0,0 +1,232 @@
+/** @file main.cpp  Benchmark for world::Blockmap queries.
+ *
+ * Builds line and mobj blockmaps for a large synthetic map and times the
+ * query patterns of the playsim: mobjs moving around and checking the lines
+ * and mobjs near them (P_TryMove), and line of sight traces between mobjs
+ * (P_CheckSight). Three runs are timed: the old linked-cell blockmap as a
+ * baseline (see linkedblockmap.h), and world::Blockmap with its line blockmap
+ * in the dynamic and in the compacted layout.
+ *
+ * Usage: blockmapbench [--lines N] [--mobjs N] [--tics N] [--size UNITS]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "linkedblockmap.h"
+
+#include <doomsday/world/blockmap.h>
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace de;
+using world::Blockmap;
+
+struct BenchLine
+{
+    AABoxd bounds;
+};
+
+struct BenchMobj
+{
+    Vec2d  origin;
+    double radius;
+};
+
+static const double MAXMOVE = 30;
+
+template <typename BlockmapType>
+struct Scene
+{
+    std::vector<BenchLine> lines;
+    std::vector<BenchMobj> mobjs;
+    std::unique_ptr<BlockmapType> lineBlockmap;
+    std::unique_ptr<BlockmapType> mobjBlockmap;
+
+    Scene(int lineCount, int mobjCount, double size)
+    {
+        const AABoxd bounds(0, 0, size, size);
+        lineBlockmap.reset(new BlockmapType(bounds));
+        mobjBlockmap.reset(new BlockmapType(bounds));
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<double> pos(0, size);
+        std::uniform_real_distribution<double> len(-256, 256);
+
+        lines.resize(dsize(lineCount));
+        for (BenchLine &line : lines)
+        {
+            const Vec2d a(pos(rng), pos(rng));
+            const Vec2d b = (a + Vec2d(len(rng), len(rng))).max(Vec2d()).min(Vec2d(size - 1, size - 1));
+            line.bounds = AABoxd(de::min(a.x, b.x), de::min(a.y, b.y),
+                                 de::max(a.x, b.x), de::max(a.y, b.y));
+            lineBlockmap->link(line.bounds, &line);
+        }
+
+        mobjs.resize(dsize(mobjCount));
+        for (BenchMobj &mob : mobjs)
+        {
+            mob.origin = Vec2d(pos(rng), pos(rng));
+            mob.radius = 16 + (rng() % 3) * 8;
+            mobjBlockmap->link(mobjBlockmap->toCell(mob.origin), &mob);
+        }
+    }
+
+    /// Moves each mobj and checks what it touches at the new position.
+    dsize runMovement(int tics)
+    {
+        std::mt19937 rng(5678);
+        std::uniform_real_distribution<double> step(-MAXMOVE / 2, MAXMOVE / 2);
+        const double size = lineBlockmap->bounds().maxX;
+
+        dsize hits = 0;
+        for (int tic = 0; tic < tics; ++tic)
+        {
+            for (BenchMobj &mob : mobjs)
+            {
+                const Vec2d dest = (mob.origin + Vec2d(step(rng), step(rng)))
+                                       .max(Vec2d()).min(Vec2d(size - 1, size - 1));
+                const AABoxd box(dest.x - mob.radius, dest.y - mob.radius,
+                                 dest.x + mob.radius, dest.y + mob.radius);
+
+                lineBlockmap->forAllInBox(box, [&hits, &box] (void *object)
+                {
+                    const auto &line = *reinterpret_cast<const BenchLine *>(object);
+                    if (!(box.minX >= line.bounds.maxX || box.minY >= line.bounds.maxY ||
+                          box.maxX <= line.bounds.minX || box.maxY <= line.bounds.minY))
+                    {
+                        hits++;
+                    }
+                    return LoopContinue;
+                });
+
+                // Mobjs are linked by their origin, so look further out for them.
+                const AABoxd mobBox(box.minX - 32, box.minY - 32, box.maxX + 32, box.maxY + 32);
+                mobjBlockmap->forAllInBox(mobBox, [&hits, &mob] (void *object)
+                {
+                    if (object != &mob) hits++;
+                    return LoopContinue;
+                });
+
+                const auto oldCell = mobjBlockmap->toCell(mob.origin);
+                const auto newCell = mobjBlockmap->toCell(dest);
+                if (oldCell != newCell)
+                {
+                    mobjBlockmap->unlink(oldCell, &mob);
+                    mobjBlockmap->link(newCell, &mob);
+                }
+                mob.origin = dest;
+            }
+        }
+        return hits;
+    }
+
+    /// Traces lines of sight between pairs of mobjs.
+    dsize runSight(int traces)
+    {
+        std::mt19937 rng(9012);
+        dsize hits = 0;
+        for (int i = 0; i < traces; ++i)
+        {
+            const BenchMobj &from = mobjs[rng() % mobjs.size()];
+            const BenchMobj &to   = mobjs[rng() % mobjs.size()];
+            lineBlockmap->forAllInPath(from.origin, to.origin, [&hits] (void *)
+            {
+                hits++;
+                return LoopContinue;
+            });
+        }
+        return hits;
+    }
+};
+
+template <typename BlockmapType>
+static void runPass(const char *label, int lineCount, int mobjCount, int tics, double size,
+                    const std::function<void (Scene<BlockmapType> &)> &prepare = {})
+{
+    Scene<BlockmapType> scene(lineCount, mobjCount, size);
+    if (prepare) prepare(scene);
+
+    Time startedAt;
+    const dsize moveHits = scene.runMovement(tics);
+    const TimeSpan moveTime = startedAt.since();
+
+    const int traces = mobjCount * tics / 8;
+    startedAt = Time();
+    const dsize sightHits = scene.runSight(traces);
+    const TimeSpan sightTime = startedAt.since();
+
+    LOG_MSG("%s:") << label;
+    LOG_MSG("  movement: %.1f ms, %.0f moves/s (%i hits)")
+            << ddouble(moveTime) * 1000.0
+            << double(mobjCount) * tics / de::max(ddouble(moveTime), 1.0e-9)
+            << int(moveHits);
+    LOG_MSG("  sight:    %.1f ms, %.0f traces/s (%i hits)")
+            << ddouble(sightTime) * 1000.0
+            << traces / de::max(ddouble(sightTime), 1.0e-9)
+            << int(sightHits);
+}
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Blockmap Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int lineCount = 60000;
+        int mobjCount = 4000;
+        int tics      = 35 * 10;
+        double size   = 32768;
+        for (dsize i = 1; i + 1 < cmdLine.count(); ++i)
+        {
+            if      (cmdLine.at(i) == "--lines") lineCount = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--mobjs") mobjCount = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--tics")  tics      = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--size")  size      = de::max(1024, cmdLine.at(++i).toInt());
+        }
+
+        LOG_MSG("%i lines and %i mobjs on a %.0f x %.0f map, %i tics")
+                << lineCount << mobjCount << size << size << tics;
+
+        // The hit counts of all runs should be equal.
+        runPass<LinkedBlockmap>("Baseline (linked cells)", lineCount, mobjCount, tics, size);
+        runPass<Blockmap>("Dynamic line layout", lineCount, mobjCount, tics, size);
+        runPass<Blockmap>("Compacted line layout", lineCount, mobjCount, tics, size,
+                          [] (Scene<Blockmap> &scene) { scene.lineBlockmap->compact(); });
+    }
+    catch (const Error &err)
+    {
+        err.warnPlainText();
+    }
+    deinit_Foundation();
+    return 0;
+}
@@ -36,6 +36,8 @@
 #include <de/regexp.h>
 #include <de/serverfinder.h>
 
+#include <fstream>
+
 using namespace de;
 using namespace de::term;
 
@@ -49,6 +51,7 @@ DE_PIMPL(ShellApp)
     StatusWidget *     status;
     network::Link *    link = nullptr;
     ServerFinder       finder;
+    std::ofstream      metricsCsv; ///< Received metrics are appended here (optional).
 
     Impl(Public &i) : Base(i)
     {
@@ -137,6 +140,50 @@ DE_PIMPL(ShellApp)
     {
         self().sendCommandToServer(command);
     }
+
+    void openMetricsCsv(const NativePath &path)
+    {
+        metricsCsv.open(path.c_str(), std::ios::out | std::ios::app);
+        if (!metricsCsv)
+        {
+            LOG_WARNING("Failed to open %s for writing metrics") << path;
+            return;
+        }
+        metricsCsv << "time,tickAvg,tickP50,tickP90,tickP99,tickMax,transmitAvg,transmitP99,"
+                      "transmitMax,outputBytesPerSec,compressionRatio,thinkers,zoneAllocated,"
+                      "zoneTotal,clients,unackedDeltasTotal,unackedDeltasMax,"
+                      "clientBytesPerSecMax\n";
+    }
+
+    void writeMetrics(const Record &metrics)
+    {
+        if (!metricsCsv) return;
+
+        duint unackedTotal = 0, unackedMax = 0;
+        for (const auto *value : metrics.geta("unackedDeltas").elements())
+        {
+            unackedTotal += duint(value->asNumber());
+            unackedMax    = de::max(unackedMax, duint(value->asNumber()));
+        }
+        ddouble clientRateMax = 0;
+        for (const auto *value : metrics.geta("bytesPerSecond").elements())
+        {
+            clientRateMax = de::max(clientRateMax, value->asNumber());
+        }
+
+        metricsCsv << Time().asText(Time::ISOFormat).c_str();
+        for (const char *name : {"tickTimeAvg", "tickTimeP50", "tickTimeP90", "tickTimeP99",
+                                 "tickTimeMax", "transmitTimeAvg", "transmitTimeP99",
+                                 "transmitTimeMax", "outputBytesPerSecond", "compressionRatio",
+                                 "thinkers", "zoneAllocated", "zoneTotal"})
+        {
+            metricsCsv << "," << metrics.getd(name, 0.0);
+        }
+        metricsCsv << "," << metrics.geta("consoles").size()
+                   << "," << unackedTotal << "," << unackedMax
+                   << "," << clientRateMax << "\n";
+        metricsCsv.flush();
+    }
 };
 
 ShellApp::ShellApp(int &argc, char **argv)
@@ -155,10 +202,24 @@ ShellApp::ShellApp(int &argc, char **argv)
     buf.addSink(d->log->logSink());
 
     auto &cmdLine = commandLine();
-    if (cmdLine.size() > 1)
+
+    // Received performance metrics can be saved in a CSV file.
+    String csvPath;
+    if (cmdLine.getParameter("--metrics-csv", csvPath))
+    {
+        d->openMetricsCsv(csvPath);
+    }
+
+    for (dsize i = 1; i < cmdLine.size(); ++i)
     {
+        if (cmdLine.isOption(i))
+        {
+            if (cmdLine.at(i) == "--metrics-csv") ++i; // skip the parameter
+            continue;
+        }
         // Open a connection.
-        openConnection(cmdLine.at(1));
+        openConnection(cmdLine.at(i));
+        break;
     }
 }
 
@@ -334,6 +395,12 @@ void ShellApp::handleIncomingPackets()
                     rec["mapId"].value().asText());
             break; }
 
+        case network::Protocol::Metrics: {
+            const Record &rec = static_cast<RecordPacket *>(packet.get())->record();
+            d->status->setMetrics(rec);
+            d->writeMetrics(rec);
+            break; }
+
         default:
             break;
         }
@@ -29,6 +29,7 @@ DE_PIMPL(StatusWidget)
     String         gameMode;
     String         rules;
     String         mapId;
+    String         metrics;
 
     Impl(Public * i) : Base(i) {}
 
@@ -77,6 +78,15 @@ void StatusWidget::setGameState(const String &mode, const String &rules, const S
     redraw();
 }
 
+void StatusWidget::setMetrics(const Record &metrics)
+{
+    d->metrics = Stringf("tick %.1f ms (p99 %.1f) | %.0f KB/s",
+                         metrics.getd("tickTimeAvg", 0.0),
+                         metrics.getd("tickTimeP99", 0.0),
+                         metrics.getd("outputBytesPerSecond", 0.0) / 1024);
+    redraw();
+}
+
 void StatusWidget::draw()
 {
     Rectanglei pos = rule().recti();
@@ -119,6 +129,17 @@ void StatusWidget::draw()
 
         x -= host.size() + 1;
         buf.drawText(x, host);
+
+        // Metrics fit in between if there is enough room.
+        if (!d->metrics.isEmpty())
+        {
+            const String metrics = "| " + d->metrics;
+            x -= metrics.size() + 1;
+            if (x > msg.sizei() + 1)
+            {
+                buf.drawText(x, metrics);
+            }
+        }
     }
 
     targetCanvas().draw(buf, pos.topLeft);
@@ -19,6 +19,7 @@
 #ifndef STATUSWIDGET_H
 #define STATUSWIDGET_H
 
+#include <de/record.h>
 #include <de/term/widget.h>
 #include <doomsday/network/link.h>
 
@@ -36,6 +37,13 @@ public:
 
     void setGameState(const de::String &mode, const de::String &rules, const de::String &mapId);
 
+    /**
+     * Shows a summary of the server's performance metrics.
+     *
+     * @param metrics  Contents of a metrics packet.
+     */
+    void setMetrics(const de::Record &metrics);
+
     void draw();
 
 private:
@@ -0,0 +1,233 @@
+/** @file main.cpp  Benchmark for populating a large native directory tree.
+ *
+ * Generates a tree of native files, then populates it into the file system one
+ * folder at a time and concurrently (Folder::PopulateConcurrently). Both the
+ * initial population and a repopulation of the unchanged tree are timed. The
+ * resulting file trees are compared, and the exit status is non-zero if they
+ * differ.
+ *
+ * Usage: folderbench [--files N] [--per-folder N] [--rounds N] [--dir path] [--keep]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include <de/commandline.h>
+#include <de/directoryfeed.h>
+#include <de/filesystem.h>
+#include <de/folder.h>
+#include <de/logbuffer.h>
+#include <de/nativepath.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <fstream>
+#include <memory>
+
+using namespace de;
+
+namespace {
+
+/**
+ * Native directory tree with @a fileCount files. There are @a perFolder files in
+ * each directory, and the directories are grouped under parent directories.
+ * Every hundredth file has a status override file.
+ */
+struct GeneratedTree
+{
+    NativePath root;
+    List<NativePath> files;
+    List<NativePath> dirs;
+    bool keep = false;
+
+    GeneratedTree(const NativePath &root, int fileCount, int perFolder)
+        : root(root)
+    {
+        const int dirCount = (fileCount + perFolder - 1) / perFolder;
+        const int groupSize = 20;
+        for (int dir = 0; dir < dirCount; ++dir)
+        {
+            const NativePath group = root / Stringf("group%03i", dir / groupSize);
+            const NativePath path  = group / Stringf("dir%05i", dir);
+            if (dir % groupSize == 0) dirs << group;
+            dirs << path;
+            NativePath::createPath(path);
+
+            const int count = de::min(perFolder, fileCount - dir * perFolder);
+            for (int i = 0; i < count; ++i)
+            {
+                const NativePath filePath = path / Stringf("file%05i.dat", i);
+                std::ofstream f(filePath.toString().c_str(), std::ios::binary);
+                f << String(dsize(i % 97), 'x');
+                files << filePath;
+                if (i % 100 == 50)
+                {
+                    DirectoryFeed::setFileModifiedTime(filePath, Time(2020, 1, 1, 12, 0, 0));
+                }
+            }
+        }
+    }
+
+    ~GeneratedTree()
+    {
+        if (keep) return;
+        for (const auto &path : files)
+        {
+            DirectoryFeed::setFileModifiedTime(path, Time::invalidTime());
+            path.destroy();
+        }
+        for (auto i = dirs.rbegin(); i != dirs.rend(); ++i)
+        {
+            i->destroy();
+        }
+        root.destroy();
+    }
+};
+
+/// Describes every file in the tree, in order.
+void listContents(const Folder &folder, String &listing, int &count)
+{
+    folder.forContents([&listing, &count] (String, File &file) {
+        listing += Stringf("%s %zu %s\n", file.path().c_str(), file.size(),
+                           file.status().modifiedAt.asText().c_str());
+        ++count;
+        if (const auto *sub = maybeAs<Folder>(file))
+        {
+            listContents(*sub, listing, count);
+        }
+        return LoopContinue;
+    });
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int failures = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Folder Population Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int fileCount = 100000;
+        int perFolder = 250;
+        int rounds    = 3;
+        bool keep     = false;
+        NativePath rootPath = NativePath::workPath() / "folderbench-tree";
+        for (dsize i = 1; i < cmdLine.count(); ++i)
+        {
+            if (cmdLine.at(i) == "--files" && i + 1 < cmdLine.count())
+            {
+                fileCount = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--per-folder" && i + 1 < cmdLine.count())
+            {
+                perFolder = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--rounds" && i + 1 < cmdLine.count())
+            {
+                rounds = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--dir" && i + 1 < cmdLine.count())
+            {
+                rootPath = cmdLine.at(++i);
+            }
+            else if (cmdLine.at(i) == "--keep")
+            {
+                keep = true;
+            }
+        }
+        if (rootPath.exists())
+        {
+            throw Error("main", rootPath.pretty() + " already exists");
+        }
+
+        Time generatedAt;
+        std::unique_ptr<GeneratedTree> tree(new GeneratedTree(rootPath, fileCount, perFolder));
+        LOG_MSG("Generated %i files in %i directories in %.1f s")
+                << tree->files.sizei() << tree->dirs.sizei() << ddouble(generatedAt.since());
+
+        Folder &folder = FS::get().makeFolderWithFeed("/folderbench", new DirectoryFeed(rootPath),
+                                                      Folder::PopulateFullTree,
+                                                      FS::DontInheritFeeds);
+        struct Mode
+        {
+            const char *name;
+            Folder::PopulationBehaviors behavior;
+        };
+        const Mode modes[] = {
+            {"One folder at a time", Folder::PopulateFullTree},
+            {"Concurrently",         Folder::PopulateFullTree | Folder::PopulateConcurrently},
+        };
+
+        String expected;
+        for (const auto &mode : modes)
+        {
+            ddouble bestPopulate = 1.0e9, bestRepopulate = 1.0e9;
+            String listing;
+            int count = 0;
+            for (int round = 0; round < rounds; ++round)
+            {
+                folder.clear();
+                {
+                    Time startedAt;
+                    folder.populate(mode.behavior);
+                    bestPopulate = de::min(bestPopulate, ddouble(startedAt.since()));
+                }
+                {
+                    Time startedAt;
+                    folder.populate(mode.behavior);
+                    bestRepopulate = de::min(bestRepopulate, ddouble(startedAt.since()));
+                }
+                listing.clear();
+                count = 0;
+                listContents(folder, listing, count);
+            }
+            if (expected.isEmpty())
+            {
+                expected = listing;
+            }
+            else if (listing != expected)
+            {
+                LOG_WARNING("%s: the populated tree differs") << mode.name;
+                ++failures;
+            }
+            LOG_MSG("%s") << Stringf("%-22s %i files; populate %8.2f ms, repopulate %8.2f ms",
+                                     mode.name, count, bestPopulate * 1000.0, bestRepopulate * 1000.0);
+        }
+
+        folder.clear();
+        if (keep)
+        {
+            tree->keep = true;
+            LOG_MSG("Kept the tree in %s") << rootPath.pretty();
+        }
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        failures = 1;
+    }
+    deinit_Foundation();
+    return failures? 1 : 0;
+}
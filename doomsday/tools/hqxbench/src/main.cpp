@@ -0,0 +1,159 @@
+/** @file main.cpp  Benchmark for the hq2x upscaler.
+ *
+ * Times hq2x on a large generated sprite with every available instruction set,
+ * with and without threads. The output is checked by test_hqx.
+ *
+ * Usage: hqxbench [--size N] [--rounds N]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "resource/hqx.h"
+#include "gl/texfilter.h"
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <vector>
+
+using namespace de;
+
+typedef std::vector<uint8_t> Pixels;
+
+namespace {
+
+struct Config
+{
+    texfilter::InstructionSet isa;
+    bool threads;
+
+    String name() const
+    {
+        return Stringf("%s%s", texfilter::instructionSetName(isa), threads? " + threads" : "");
+    }
+
+    void apply() const
+    {
+        texfilter::setInstructionSet(isa);
+        texfilter::setMultithreaded(threads);
+    }
+};
+
+/**
+ * Sprite-like test image: an opaque ellipse with a few translucent pixels on a
+ * transparent background, filled with a noisy pattern of palette colors.
+ */
+Pixels generateSprite(int width, int height, duint32 seed)
+{
+    static const uint8_t palette[8][3] = {
+        {  0,   0,   0}, {255, 255, 255}, {100, 100, 100}, {110, 104, 100},
+        {200,  40,  40}, {190,  60,  40}, { 30, 160,  60}, { 40,  60, 220},
+    };
+    Pixels image(dsize(width) * height * 4);
+    duint32 rnd = seed;
+    const dint64 w2 = dint64(width) * width, h2 = dint64(height) * height;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            rnd = rnd * 1664525u + 1013904223u;
+            const dint64 dx = 2 * x - width + 1, dy = 2 * y - height + 1;
+            const bool inside = dx * dx * h2 + dy * dy * w2 <= w2 * h2;
+            const int index = ((x / 3) ^ (y / 4) ^ int(rnd >> 30)) & 7;
+            uint8_t *pix = &image[(dsize(y) * width + x) * 4];
+            pix[0] = palette[index][0];
+            pix[1] = palette[index][1];
+            pix[2] = palette[index][2];
+            pix[3] = !inside? 0 : (rnd >> 24) < 8? 128 : 255;
+        }
+    }
+    return image;
+}
+
+Pixels upscale(const Pixels &image, int width, int height, int flags)
+{
+    Pixels out(dsize(width) * height * 16);
+    hqx::upscale(image.data(), width, height, (flags & 1) != 0, (flags & 2) != 0, out.data());
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "hq2x Upscaler Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int size   = 512;
+        int rounds = 5;
+        for (dsize i = 1; i < cmdLine.count(); ++i)
+        {
+            if (cmdLine.at(i) == "--size" && i + 1 < cmdLine.count())
+            {
+                size = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--rounds" && i + 1 < cmdLine.count())
+            {
+                rounds = de::max(1, cmdLine.at(++i).toInt());
+            }
+        }
+
+        const texfilter::InstructionSet best = texfilter::availableInstructionSet();
+        std::vector<Config> configs{{texfilter::Scalar, false}, {texfilter::Scalar, true}};
+        if (best != texfilter::Scalar)
+        {
+            configs.push_back({best, false});
+            configs.push_back({best, true});
+        }
+        LOG_MSG("Best instruction set: %s") << texfilter::instructionSetName(best);
+
+        // Timing.
+        const Pixels image = generateSprite(size, size, 1);
+        LOG_MSG("Best of %i rounds at %ix%i:") << rounds << size << size;
+        for (const auto &config : configs)
+        {
+            config.apply();
+            ddouble bestTime = 1.0e9;
+            for (int round = 0; round < rounds; ++round)
+            {
+                Time startedAt;
+                upscale(image, size, size, 0);
+                bestTime = de::min(bestTime, ddouble(startedAt.since()));
+            }
+            LOG_MSG("  %-16s %8.2f ms") << config.name() << bestTime * 1000.0;
+        }
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}
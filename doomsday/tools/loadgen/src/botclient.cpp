@@ -0,0 +1,345 @@
+/** @file botclient.cpp  Simulated network client for load testing.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "botclient.h"
+
+#include <doomsday/network/protocol.h>
+
+#include <de/byterefarray.h>
+#include <de/fixedbytearray.h>
+#include <de/log.h>
+#include <de/math.h>
+#include <de/message.h>
+#include <de/reader.h>
+#include <de/serverinfo.h>
+#include <de/socket.h>
+#include <de/writer.h>
+
+using namespace de;
+
+static constexpr float WANDER_RADIUS = 128;
+static constexpr int   PING_INTERVAL = 35; // tics
+
+DE_PIMPL(BotClient)
+, DE_OBSERVES(Socket, StateChange)
+, DE_OBSERVES(Socket, Message)
+{
+    enum State {
+        Connecting,
+        WaitingForEnter,
+        WaitingForHandshake,
+        WaitingForGameState,
+        InGame,
+        Disconnected
+    };
+
+    Socket   socket;
+    String   name;
+    String   gameId;
+    duint32  ident;
+    State    state   = Connecting;
+    int      console = -1;
+    int      ticCounter = 0;
+    Time     startedAt;
+    Stats    stats;
+    TimeSpan joinTime;
+    duint64  joinBytes = 0;
+
+    // Player state known to the bot.
+    bool     hasOrigin = false;
+    Vec3f    spawnOrigin;
+    Vec3f    origin;
+    duint32  angle = 0;
+    dint32   fixAcked[3]{}; // angles, origin, mom
+
+    Impl(Public *i, const String &host, const String &name, const String &gameId, duint32 ident)
+        : Base(i)
+        , name(name)
+        , gameId(gameId)
+        , ident(ident)
+    {
+        socket.setQuiet(true);
+        socket.audienceForStateChange() += this;
+        socket.audienceForMessage() += this;
+        socket.open(host, DEFAULT_PORT);
+    }
+
+    void send(const Block &packet)
+    {
+        if (state == Disconnected || !socket.isOpen()) return;
+        socket << packet;
+        stats.bytesSent += packet.size();
+    }
+
+    void sendEmpty(dbyte type)
+    {
+        Block packet;
+        Writer(packet) << type;
+        send(packet);
+    }
+
+    void socketStateChanged(Socket &, Socket::SocketState socketState) override
+    {
+        if (socketState == Socket::Connected && state == Connecting)
+        {
+            state = WaitingForEnter;
+            send(Block(Stringf("Join %04x %s", SV_VERSION, name.c_str())));
+        }
+        else if (socketState == Socket::Disconnected)
+        {
+            if (state != Disconnected)
+            {
+                LOG_NET_WARNING("%s: connection lost") << name;
+            }
+            state = Disconnected;
+        }
+    }
+
+    void messagesIncoming(Socket &) override
+    {
+        for (;;)
+        {
+            std::unique_ptr<Message> packet(socket.receive());
+            if (!packet) break;
+
+            stats.bytesReceived += packet->size();
+            stats.packetsReceived++;
+            if (state != InGame) joinBytes += packet->size();
+
+            if (state == WaitingForEnter)
+            {
+                if (*packet != "Enter")
+                {
+                    LOG_NET_ERROR("%s: server refused to let us join") << name;
+                    disconnect();
+                    return;
+                }
+                sayHello();
+            }
+            else if (!packet->isEmpty())
+            {
+                handleGamePacket(*packet);
+            }
+        }
+    }
+
+    void sayHello()
+    {
+        state = WaitingForHandshake;
+
+        // The game mode is included in the hello packet (max 16 chars).
+        char id[16]{};
+        strncpy(id, gameId.c_str(), sizeof(id));
+
+        Block packet;
+        Writer(packet) << dbyte(PCL_HELLO2) << ident
+                       << FixedByteArray(ByteRefArray(id, sizeof(id)));
+        send(packet);
+    }
+
+    void handleGamePacket(const Block &packet)
+    {
+        Reader reader(packet);
+        dbyte type;
+        reader >> type;
+
+        switch (type)
+        {
+        case PSV_HANDSHAKE: {
+            dbyte remoteVersion, myConsole;
+            reader >> remoteVersion >> myConsole;
+            sendEmpty(PCL_ACK_SHAKE);
+            if (remoteVersion != SV_VERSION)
+            {
+                LOG_NET_ERROR("%s: version conflict (ours:%i, server:%i)")
+                    << name << SV_VERSION << remoteVersion;
+                disconnect();
+                break;
+            }
+            console = myConsole;
+            if (state == WaitingForHandshake) state = WaitingForGameState;
+            break; }
+
+        case PKT_GAME_MARKER: // GPT_GAME_STATE
+            if (state == WaitingForGameState)
+            {
+                // Tell the server we're ready to begin receiving frames.
+                sendEmpty(PKT_OK);
+                state = InGame;
+                joinTime = startedAt.since();
+                LOG_NET_VERBOSE("%s: in game as console %i") << name << console;
+            }
+            break;
+
+        case PSV_FRAME2:
+        case PSV_FIRST_FRAME2:
+            stats.framesReceived++;
+            break;
+
+        case PSV_PLAYER_FIX:
+            handlePlayerFix(reader);
+            break;
+
+        case PKT_PING: {
+            // Our own ping, echoed back by the server.
+            duint32 sentAt;
+            reader >> sentAt;
+            const TimeSpan ping = startedAt.since() - sentAt / 1000.0;
+            stats.pingCount++;
+            stats.pingSum += ping;
+            stats.pingMax = de::max(ddouble(stats.pingMax), ddouble(ping));
+            break; }
+
+        case PSV_SERVER_CLOSE:
+            LOG_NET_NOTE("%s: server closed the connection") << name;
+            state = Disconnected;
+            socket.close();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void handlePlayerFix(Reader &reader)
+    {
+        dbyte plrNum;
+        duint32 fixes;
+        duint16 mobjId;
+        reader >> plrNum >> fixes >> mobjId;
+        if (plrNum != console) return;
+
+        if (fixes & 1)
+        {
+            dfloat lookDir;
+            reader >> fixAcked[0] >> angle >> lookDir;
+        }
+        if (fixes & 2)
+        {
+            reader >> fixAcked[1] >> origin.x >> origin.y >> origin.z;
+            spawnOrigin = origin;
+            hasOrigin = true;
+        }
+        if (fixes & 4)
+        {
+            Vec3f mom;
+            reader >> fixAcked[2] >> mom.x >> mom.y >> mom.z;
+        }
+
+        Block ack;
+        Writer(ack) << dbyte(PCL_ACK_PLAYER_FIX) << fixAcked[0] << fixAcked[1] << fixAcked[2];
+        send(ack);
+    }
+
+    void sendCoords()
+    {
+        // Wander randomly around the spawn spot.
+        origin.x += (randf() - .5f) * 16;
+        origin.y += (randf() - .5f) * 16;
+        origin.x = de::clamp(spawnOrigin.x - WANDER_RADIUS, origin.x, spawnOrigin.x + WANDER_RADIUS);
+        origin.y = de::clamp(spawnOrigin.y - WANDER_RADIUS, origin.y, spawnOrigin.y + WANDER_RADIUS);
+        angle += duint32((randf() - .5f) * 0x10000000);
+
+        Block packet;
+        Writer(packet)
+            << dbyte(PKT_COORDS)
+            << dfloat(startedAt.since())
+            << origin.x << origin.y
+            << dint32(DDMININT) // on the floor
+            << duint16(angle >> 16)
+            << dint16(0)        // look direction
+            << dchar(randf() * 100 - 50)  // forward move
+            << dchar(randf() * 100 - 50); // side move
+        send(packet);
+    }
+
+    void sendPing()
+    {
+        // The server echoes back pings that it did not send itself.
+        Block packet;
+        Writer(packet) << dbyte(PKT_PING) << duint32(startedAt.since() * 1000);
+        send(packet);
+    }
+
+    void disconnect()
+    {
+        if (state == Disconnected) return;
+        if (state != Connecting && state != WaitingForEnter)
+        {
+            sendEmpty(PCL_GOODBYE);
+            socket.flush();
+        }
+        state = Disconnected;
+        socket.close();
+    }
+};
+
+BotClient::BotClient(const String &host, const String &name, const String &gameId, duint32 ident)
+    : d(new Impl(this, host, name, gameId, ident))
+{}
+
+bool BotClient::isInGame() const
+{
+    return d->state == Impl::InGame;
+}
+
+bool BotClient::isDisconnected() const
+{
+    return d->state == Impl::Disconnected;
+}
+
+TimeSpan BotClient::joinTime() const
+{
+    return d->joinTime;
+}
+
+duint64 BotClient::joinBytes() const
+{
+    return d->joinBytes;
+}
+
+int BotClient::console() const
+{
+    return d->console;
+}
+
+void BotClient::tic()
+{
+    if (!isInGame()) return;
+
+    if (d->hasOrigin)
+    {
+        d->sendCoords();
+    }
+    if (d->ticCounter++ % PING_INTERVAL == 0)
+    {
+        d->sendPing();
+    }
+}
+
+void BotClient::disconnect()
+{
+    d->disconnect();
+}
+
+BotClient::Stats BotClient::takeStats()
+{
+    Stats taken = d->stats;
+    d->stats = Stats();
+    return taken;
+}
@@ -0,0 +1,88 @@
+/** @file botclient.h  Simulated network client for load testing.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef LOADGEN_BOTCLIENT_H
+#define LOADGEN_BOTCLIENT_H
+
+#include <de/string.h>
+#include <de/time.h>
+
+/**
+ * Headless client that joins a server and plays like a (very simple) human.
+ *
+ * The bot speaks just enough of the game protocol to get into the game: it
+ * joins, says hello, acknowledges the engine and game handshakes, and then
+ * keeps sending coordinates with random movement every tic. Incoming frames
+ * are consumed but not interpreted. The server echoes the bot's own pings back,
+ * which gives the end-to-end latency through the server's tick loop.
+ */
+class BotClient
+{
+public:
+    /// Traffic observed since the previous call to takeStats().
+    struct Stats
+    {
+        de::duint64 bytesReceived   = 0;
+        de::duint64 bytesSent       = 0;
+        de::duint   packetsReceived = 0;
+        de::duint   framesReceived  = 0;
+        de::duint   pingCount       = 0;
+        de::TimeSpan pingSum;
+        de::TimeSpan pingMax;
+    };
+
+public:
+    /**
+     * @param host    Server address (with optional port).
+     * @param name    Player name.
+     * @param gameId  Identifier of the game being played on the server.
+     * @param ident   Client identifier; must be unique on the server.
+     */
+    BotClient(const de::String &host, const de::String &name, const de::String &gameId,
+              de::duint32 ident);
+
+    bool isInGame() const;
+    bool isDisconnected() const;
+
+    /// Time from the creation of the bot until it got into the game, or zero if
+    /// it has not joined yet.
+    de::TimeSpan joinTime() const;
+
+    /// Number of bytes received before getting into the game.
+    de::duint64 joinBytes() const;
+
+    /// Console number assigned by the server, or -1 before the handshake.
+    int console() const;
+
+    /**
+     * Sends the bot's input for one tic. Called 35 times per second.
+     */
+    void tic();
+
+    /**
+     * Leaves the game.
+     */
+    void disconnect();
+
+    Stats takeStats();
+
+private:
+    DE_PRIVATE(d)
+};
+
+#endif // LOADGEN_BOTCLIENT_H
@@ -0,0 +1,350 @@
+/** @file main.cpp  Load generator for stress-testing a multiplayer server.
+ *
+ * Opens a number of simulated client connections to a server (by default on
+ * the local computer), plays with them for a while, and reports the observed
+ * bandwidth and latency together with the server's own load figures, which are
+ * queried over a separate unjoined connection ("Load?"). The server answers
+ * the query only on the local computer, or if it has no password.
+ *
+ * With --join-storm, all the clients connect at the same moment and the run
+ * ends when every one of them has joined; the report shows how long joining
+ * took and how much data the clients received before getting into the game.
+ *
+ * Usage: loadgen [--host address] [--clients N] [--duration seconds]
+ *                [--ramp seconds] [--join-storm]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "botclient.h"
+
+#include <de/arrayvalue.h>
+#include <de/commandline.h>
+#include <de/json.h>
+#include <de/logbuffer.h>
+#include <de/math.h>
+#include <de/message.h>
+#include <de/serverinfo.h>
+#include <de/socket.h>
+#include <de/textapp.h>
+#include <de/timer.h>
+
+using namespace de;
+
+static constexpr TimeSpan TIC_INTERVAL    = 1.0 / 35;
+static constexpr TimeSpan REPORT_INTERVAL = 1.0_s;
+
+struct LoadGenerator
+    : public Socket::IStateChangeObserver
+    , public Socket::IMessageObserver
+{
+    String   host        = "localhost";
+    int      clientCount = 8;
+    TimeSpan duration    = 60.0;
+    TimeSpan rampDelay   = 0.1;
+    bool     joinStorm   = false;
+
+    String   gameId;
+    Socket   monitor;
+    Timer    rampTimer;
+    Timer    ticTimer;
+    Timer    reportTimer;
+    Time     startedAt;
+    List<BotClient *> bots;
+    Record   serverLoad;
+    bool     finished = false;
+
+    // Totals over the whole run.
+    struct {
+        int     reports = 0;
+        ddouble bytesPerClient = 0;
+        ddouble framesPerClient = 0;
+        ddouble pingSum = 0;
+        duint   pingCount = 0;
+        ddouble pingMax = 0;
+        ddouble tickTimeSum = 0;
+        ddouble tickTimeMax = 0;
+        ddouble transmitTimeSum = 0;
+        ddouble transmitTimeMax = 0;
+        duint   unackedMax = 0;
+    } totals;
+
+    ~LoadGenerator()
+    {
+        deleteAll(bots);
+    }
+
+    void start()
+    {
+        LOG_MSG("Connecting to %s...") << host;
+
+        monitor.audienceForStateChange() += this;
+        monitor.audienceForMessage() += this;
+        monitor.open(host, DEFAULT_PORT);
+
+        rampTimer.setInterval(rampDelay);
+        rampTimer += [this]() { addBot(); };
+
+        ticTimer.setInterval(TIC_INTERVAL);
+        ticTimer += [this]() {
+            for (auto *bot : bots) bot->tic();
+        };
+
+        reportTimer.setInterval(REPORT_INTERVAL);
+        reportTimer += [this]() { report(); };
+    }
+
+    void socketStateChanged(Socket &, Socket::SocketState state) override
+    {
+        if (state == Socket::Connected)
+        {
+            monitor << Block("Info?");
+        }
+        else if (state == Socket::Disconnected)
+        {
+            LOG_ERROR("Lost connection to the server");
+            finish();
+        }
+    }
+
+    void messagesIncoming(Socket &) override
+    {
+        for (;;)
+        {
+            std::unique_ptr<Message> reply(monitor.receive());
+            if (!reply) break;
+
+            if (reply->beginsWith("Info\n"))
+            {
+                if (gameId) continue;
+
+                const ServerInfo info(parseJSON(String::fromUtf8(reply->mid(5))));
+                gameId = info.gameId();
+                LOG_MSG("Server is playing %s on map %s; starting %i clients")
+                    << gameId << info.map() << clientCount;
+
+                startedAt = Time();
+                if (joinStorm)
+                {
+                    while (bots.sizei() < clientCount) addBot();
+                }
+                else
+                {
+                    rampTimer.start();
+                }
+                ticTimer.start();
+                reportTimer.start();
+            }
+            else if (reply->beginsWith("Load\n"))
+            {
+                serverLoad = parseJSON(String::fromUtf8(reply->mid(5)));
+            }
+        }
+    }
+
+    void addBot()
+    {
+        if (bots.sizei() >= clientCount)
+        {
+            rampTimer.stop();
+            return;
+        }
+        const int num = bots.sizei() + 1;
+        bots << new BotClient(host, Stringf("Bot%i", num), gameId, randui32() ^ duint32(num));
+    }
+
+    void report()
+    {
+        if (joinStorm)
+        {
+            reportJoins();
+            return;
+        }
+
+        // Ask for an update for the next report.
+        monitor << Block("Load?");
+
+        BotClient::Stats sum;
+        duint64 maxBytes = 0;
+        int inGame = 0;
+        for (auto *bot : bots)
+        {
+            const auto stats = bot->takeStats();
+            if (!bot->isInGame()) continue;
+            inGame++;
+            sum.bytesReceived  += stats.bytesReceived;
+            sum.bytesSent      += stats.bytesSent;
+            sum.framesReceived += stats.framesReceived;
+            sum.pingCount      += stats.pingCount;
+            sum.pingSum        += stats.pingSum;
+            sum.pingMax         = de::max(ddouble(sum.pingMax), ddouble(stats.pingMax));
+            maxBytes            = de::max(maxBytes, stats.bytesReceived);
+        }
+
+        const ddouble perClient   = inGame ? ddouble(sum.bytesReceived) / inGame : 0.0;
+        const ddouble framesPer   = inGame ? ddouble(sum.framesReceived) / inGame : 0.0;
+        const ddouble pingAvg     = sum.pingCount ? 1000 * ddouble(sum.pingSum) / sum.pingCount : 0.0;
+        const ddouble tickAvg     = serverLoad.getd("tickTimeAvg", 0.0);
+        const ddouble tickMax     = serverLoad.getd("tickTimeMax", 0.0);
+        const ddouble transmitAvg = serverLoad.getd("transmitTimeAvg", 0.0);
+        const ddouble transmitMax = serverLoad.getd("transmitTimeMax", 0.0);
+
+        duint unackedTotal = 0, unackedMax = 0;
+        if (serverLoad.has("unackedDeltas"))
+        {
+            for (const auto *value : serverLoad.geta("unackedDeltas").elements())
+            {
+                const auto count = duint(value->asNumber());
+                unackedTotal += count;
+                unackedMax    = de::max(unackedMax, count);
+            }
+        }
+
+        LOG_MSG("%5.1fs: %2i/%i in game | down %6.1f KB/s per client (max %.1f), up %.1f KB/s "
+                "| %4.1f frames/s | ping %5.1f ms (max %.1f) "
+                "| server tick %.2f ms (max %.2f), transmit %.2f ms (max %.2f) "
+                "| unacked deltas %i (max %i)")
+            << ddouble(startedAt.since())
+            << inGame << clientCount
+            << perClient / 1024 << maxBytes / 1024.0 << sum.bytesSent / 1024.0
+            << framesPer
+            << pingAvg << 1000 * ddouble(sum.pingMax)
+            << tickAvg << tickMax << transmitAvg << transmitMax
+            << unackedTotal << unackedMax;
+
+        if (inGame)
+        {
+            totals.reports++;
+            totals.bytesPerClient  += perClient;
+            totals.framesPerClient += framesPer;
+            totals.pingSum         += sum.pingSum;
+            totals.pingCount       += sum.pingCount;
+            totals.pingMax          = de::max(totals.pingMax, ddouble(sum.pingMax));
+            totals.tickTimeSum     += tickAvg;
+            totals.tickTimeMax      = de::max(totals.tickTimeMax, tickMax);
+            totals.transmitTimeSum += transmitAvg;
+            totals.transmitTimeMax  = de::max(totals.transmitTimeMax, transmitMax);
+            totals.unackedMax       = de::max(totals.unackedMax, unackedMax);
+        }
+
+        if (startedAt.since() > duration)
+        {
+            finish();
+        }
+    }
+
+    void reportJoins()
+    {
+        int joined = 0, pending = 0;
+        for (const auto *bot : bots)
+        {
+            if (bot->isInGame()) joined++;
+            else if (!bot->isDisconnected()) pending++;
+        }
+        LOG_MSG("%5.1fs: %i/%i joined") << ddouble(startedAt.since()) << joined << clientCount;
+
+        if (pending && ddouble(startedAt.since()) <= ddouble(duration)) return;
+
+        TimeSpan joinSum, joinMax;
+        duint64 bytesSum = 0;
+        for (const auto *bot : bots)
+        {
+            if (!bot->isInGame()) continue;
+            joinSum  += bot->joinTime();
+            joinMax   = de::max(ddouble(joinMax), ddouble(bot->joinTime()));
+            bytesSum += bot->joinBytes();
+        }
+        if (joined)
+        {
+            LOG_MSG("Join storm: %i/%i clients joined | join time %.1f ms (max %.1f) "
+                    "| %.1f KB received per client before entering the game")
+                << joined << clientCount
+                << 1000 * ddouble(joinSum) / joined << 1000 * ddouble(joinMax)
+                << bytesSum / 1024.0 / joined;
+            totals.reports++; // Success.
+        }
+        finish();
+    }
+
+    void finish()
+    {
+        if (finished) return;
+        finished = true;
+
+        rampTimer.stop();
+        ticTimer.stop();
+        reportTimer.stop();
+
+        for (auto *bot : bots) bot->disconnect();
+
+        if (totals.reports && !joinStorm)
+        {
+            const ddouble n = totals.reports;
+            LOG_MSG("Summary: %i clients, %.0f s | down %.1f KB/s per client | %.1f frames/s "
+                    "| ping %.1f ms (max %.1f) | server tick %.2f ms (max %.2f), "
+                    "transmit %.2f ms (max %.2f) | unacked deltas per client max %i")
+                << clientCount << ddouble(startedAt.since())
+                << totals.bytesPerClient / n / 1024
+                << totals.framesPerClient / n
+                << (totals.pingCount ? 1000 * totals.pingSum / totals.pingCount : 0.0)
+                << 1000 * totals.pingMax
+                << totals.tickTimeSum / n << totals.tickTimeMax
+                << totals.transmitTimeSum / n << totals.transmitTimeMax
+                << totals.unackedMax;
+        }
+        else if (!totals.reports)
+        {
+            LOG_WARNING("No clients managed to join the game");
+        }
+
+        DE_TEXT_APP->quit(totals.reports ? 0 : 1);
+    }
+};
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Doomsday Server Load Generator");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        LoadGenerator gen;
+        const CommandLine &args = app.commandLine();
+        String param;
+        if (args.getParameter("--host", param))     gen.host        = param;
+        if (args.getParameter("--clients", param))  gen.clientCount = de::max(1, param.toInt());
+        if (args.getParameter("--duration", param)) gen.duration    = param.toDouble();
+        if (args.getParameter("--ramp", param))     gen.rampDelay   = param.toDouble();
+        if (args.has("--join-storm"))               gen.joinStorm   = true;
+
+        result = app.exec([&gen]() { gen.start(); });
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}
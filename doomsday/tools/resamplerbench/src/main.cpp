@@ -0,0 +1,130 @@
+/** @file main.cpp  Accuracy check and benchmark for audio::Resampler.
+ *
+ * Converts a 440 Hz sine between the sample rates used by the sound cache and
+ * compares the output against the analytic sine at the destination rate. The
+ * samples near the ends are not compared, because the filter sees silence
+ * beyond them. The conversion is also timed.
+ *
+ * The exit status is nonzero if the error exceeds the limit, so this can be
+ * run as a check after changing the resampler.
+ *
+ * Usage: resamplerbench [--seconds N] [--rounds N] [--limit PERCENT]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "audio/resampler.h"
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/math.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace de;
+
+static const double TONE      = 440;
+static const double AMPLITUDE = 0.5;
+static const int    EDGE      = 256; ///< Output samples not compared at each end.
+
+static double tone(int index, int rate)
+{
+    return AMPLITUDE * std::sin(2 * PI * TONE * index / rate);
+}
+
+/// @return Maximum error in percent of full scale.
+static double convert(int srcRate, int dstRate, double seconds, int rounds)
+{
+    const int srcCount = int(srcRate * seconds);
+    std::vector<dint16> src(std::size_t(srcCount));
+    for (int i = 0; i < srcCount; ++i)
+    {
+        src[std::size_t(i)] = dint16(std::lround(tone(i, srcRate) * 32768));
+    }
+
+    const audio::Resampler resampler(srcRate, dstRate);
+    std::vector<dint16> dst(std::size_t(resampler.outputLength(srcCount)));
+
+    Time startedAt;
+    for (int i = 0; i < rounds; ++i)
+    {
+        resampler.process(dst.data(), 2, src.data(), 2, srcCount);
+    }
+    const double elapsed = startedAt.since();
+
+    double maxError = 0;
+    for (int n = EDGE; n < int(dst.size()) - EDGE; ++n)
+    {
+        const double error = std::abs(dst[std::size_t(n)] / 32768.0 - tone(n, dstRate));
+        maxError = de::max(maxError, error);
+    }
+
+    LOG_MSG("%5i -> %5i Hz: max error %.4f%% of full scale, %.1f M samples/s")
+            << srcRate << dstRate << maxError * 100
+            << double(dst.size()) * rounds / de::max(elapsed, 1.0e-9) / 1.0e6;
+    return maxError * 100;
+}
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Resampler Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        double seconds = 2;
+        int rounds     = 20;
+        double limit   = 0.05;
+        for (dsize i = 1; i + 1 < cmdLine.count(); ++i)
+        {
+            if      (cmdLine.at(i) == "--seconds") seconds = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--rounds")  rounds  = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--limit")   limit   = cmdLine.at(++i).toFloat();
+        }
+
+        const struct { int src; int dst; } conversions[] = {
+            { 11025, 22050 }, { 11025, 44100 }, { 11025, 48000 },
+            { 22050, 44100 }, { 44100, 11025 }, { 48000, 22050 },
+        };
+        for (const auto &conv : conversions)
+        {
+            if (convert(conv.src, conv.dst, seconds, rounds) > limit)
+            {
+                LOG_WARNING("Error exceeds the limit of %.4f%%") << limit;
+                result = 1;
+            }
+        }
+    }
+    catch (const Error &err)
+    {
+        err.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}
@@ -0,0 +1,291 @@
+/** @file main.cpp  Verification and benchmark for the texture filter kernels.
+ *
+ * Runs each kernel in texfilter.cpp on generated images with every available
+ * instruction set, with and without threads, and checks that the output is
+ * identical to the original scalar filters. Then times the kernels on a large
+ * image. Exits with a non-zero status if any output differs.
+ *
+ * Usage: texfilterbench [--size N] [--rounds N]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "gl/texfilter.h"
+#include "reference.h"
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <cstring>
+#include <functional>
+#include <vector>
+
+using namespace de;
+
+typedef std::vector<uint8_t> Pixels;
+
+namespace {
+
+struct Config
+{
+    texfilter::InstructionSet isa;
+    bool threads;
+
+    String name() const
+    {
+        return Stringf("%s%s", texfilter::instructionSetName(isa), threads? " + threads" : "");
+    }
+
+    void apply() const
+    {
+        texfilter::setInstructionSet(isa);
+        texfilter::setMultithreaded(threads);
+    }
+};
+
+struct Size
+{
+    int width, height;
+};
+
+/**
+ * Test image where alpha has transparent islands and the color channels vary
+ * pseudo-randomly around a gradient.
+ */
+Pixels generateImage(int width, int height, int comps, duint32 seed)
+{
+    Pixels image(dsize(width) * height * comps);
+    duint32 rnd = seed;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            uint8_t *pix = &image[(dsize(y) * width + x) * comps];
+            for (int c = 0; c < comps; ++c)
+            {
+                rnd = rnd * 1664525u + 1013904223u;
+                pix[c] = uint8_t((x * 3 + y * 5 + c * 40) / 4 + (rnd >> 27));
+            }
+            if (comps == 4)
+            {
+                pix[3] = ((x / 7 + y / 5) % 3 == 0 || (rnd >> 24) < 16)? 0 : 255;
+            }
+        }
+    }
+    return image;
+}
+
+/**
+ * Paletted test image: color indices followed by an alpha plane.
+ */
+Pixels generateIndexedImage(int width, int height, duint32 seed)
+{
+    const dsize numpels = dsize(width) * height;
+    Pixels image(numpels * 2);
+    duint32 rnd = seed;
+    for (dsize i = 0; i < numpels; ++i)
+    {
+        rnd = rnd * 1664525u + 1013904223u;
+        image[i]           = uint8_t(rnd >> 24);
+        image[numpels + i] = ((rnd >> 8) & 3) == 0? 0 : 255;
+    }
+    return image;
+}
+
+std::vector<float> toFloats(const Pixels &pixels)
+{
+    return std::vector<float>(pixels.begin(), pixels.end());
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int failures = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Texture Filter Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int size   = 1024;
+        int rounds = 5;
+        for (dsize i = 1; i < cmdLine.count(); ++i)
+        {
+            if (cmdLine.at(i) == "--size" && i + 1 < cmdLine.count())
+            {
+                size = de::max(2, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--rounds" && i + 1 < cmdLine.count())
+            {
+                rounds = de::max(1, cmdLine.at(++i).toInt());
+            }
+        }
+
+        const texfilter::InstructionSet best = texfilter::availableInstructionSet();
+        std::vector<Config> configs{{texfilter::Scalar, false}, {texfilter::Scalar, true}};
+        if (best != texfilter::Scalar)
+        {
+            configs.push_back({best, false});
+            configs.push_back({best, true});
+        }
+        LOG_MSG("Best instruction set: %s") << texfilter::instructionSetName(best);
+
+        /*
+         * Kernels under test. Each one processes a copy of the input, and the
+         * result is compared byte for byte.
+         */
+        struct Kernel
+        {
+            const char *name;
+            std::function<Pixels (const Size &, bool useReference)> run;
+        };
+        const std::vector<Kernel> kernels
+        {
+            { "Scale (magnify)", [] (const Size &sz, bool ref) {
+                Pixels result;
+                for (int comps = 3; comps <= 4; ++comps)
+                {
+                    const auto in = toFloats(generateImage(sz.width, sz.height, comps, 1));
+                    const int w = sz.width * 2 + 1, h = sz.height * 2 + 3;
+                    std::vector<float> out(dsize(w) * h * comps);
+                    (ref? reference::scale : texfilter::scale)(in.data(), sz.width, sz.height, comps, out.data(), w, h);
+                    const auto *bytes = reinterpret_cast<const uint8_t *>(out.data());
+                    result.insert(result.end(), bytes, bytes + out.size() * sizeof(float));
+                }
+                return result;
+            }},
+            { "Scale (shrink)", [] (const Size &sz, bool ref) {
+                Pixels result;
+                for (int comps = 3; comps <= 4; ++comps)
+                {
+                    const auto in = toFloats(generateImage(sz.width, sz.height, comps, 2));
+                    const int w = sz.width / 2 + 1, h = sz.height / 3 + 1;
+                    std::vector<float> out(dsize(w) * h * comps);
+                    (ref? reference::scale : texfilter::scale)(in.data(), sz.width, sz.height, comps, out.data(), w, h);
+                    const auto *bytes = reinterpret_cast<const uint8_t *>(out.data());
+                    result.insert(result.end(), bytes, bytes + out.size() * sizeof(float));
+                }
+                return result;
+            }},
+            { "Down mipmap", [] (const Size &sz, bool ref) {
+                Pixels result;
+                for (int comps = 3; comps <= 4; ++comps)
+                {
+                    Pixels image = generateImage(sz.width, sz.height, comps, 3);
+                    if (sz.width > 1 || sz.height > 1)
+                    {
+                        (ref? reference::downMipmap32 : texfilter::downMipmap32)(image.data(), sz.width, sz.height, comps);
+                    }
+                    result.insert(result.end(), image.begin(), image.end());
+                }
+                return result;
+            }},
+            { "Equalize luma", [] (const Size &sz, bool ref) {
+                Pixels image = generateImage(sz.width, sz.height, 1, 4);
+                for (auto &pix : image) pix = uint8_t(20 + pix / 2);
+                float mul[3]{};
+                (ref? reference::equalizeLuma : texfilter::equalizeLuma)(image.data(), sz.width, sz.height, &mul[0], &mul[1], &mul[2]);
+                const auto *bytes = reinterpret_cast<const uint8_t *>(mul);
+                image.insert(image.end(), bytes, bytes + sizeof(mul));
+                return image;
+            }},
+            { "Sharpen", [] (const Size &sz, bool ref) {
+                Pixels result;
+                for (int comps = 3; comps <= 4; ++comps)
+                {
+                    Pixels image = generateImage(sz.width, sz.height, comps, 5);
+                    (ref? reference::sharpen : texfilter::sharpen)(image.data(), sz.width, sz.height, comps);
+                    result.insert(result.end(), image.begin(), image.end());
+                }
+                return result;
+            }},
+            { "Color outlines (paletted)", [] (const Size &sz, bool ref) {
+                Pixels image = generateIndexedImage(sz.width, sz.height, 6);
+                (ref? reference::colorOutlinesIdx : texfilter::colorOutlinesIdx)(image.data(), sz.width, sz.height);
+                return image;
+            }},
+            { "Color outlines (RGBA)", [] (const Size &sz, bool ref) {
+                Pixels image = generateImage(sz.width, sz.height, 4, 7);
+                (ref? reference::colorOutlinesRGBA : texfilter::colorOutlinesRGBA)(image.data(), sz.width, sz.height);
+                return image;
+            }},
+        };
+
+        // Verification.
+        const Size sizes[] = {
+            {1, 2}, {2, 1}, {3, 3}, {17, 9}, {37, 23}, {64, 64}, {257, 131}, {1024, 512}, {333, 1001}
+        };
+        for (const auto &kernel : kernels)
+        {
+            for (const auto &sz : sizes)
+            {
+                const Pixels expected = kernel.run(sz, true);
+                for (const auto &config : configs)
+                {
+                    config.apply();
+                    if (kernel.run(sz, false) != expected)
+                    {
+                        LOG_WARNING("%s differs from the original at %ix%i with %s")
+                                << kernel.name << sz.width << sz.height << config.name();
+                        ++failures;
+                    }
+                }
+            }
+        }
+        LOG_MSG("Verification: %s") << (failures? Stringf("%i failures", failures) : String("all outputs identical"));
+
+        // Timing.
+        const Size benchSize{size, size};
+        LOG_MSG("Best of %i rounds at %ix%i, including image generation:") << rounds << size << size;
+        for (const auto &kernel : kernels)
+        {
+            auto bestOf = [&] (bool ref) {
+                ddouble bestTime = 1.0e9;
+                for (int round = 0; round < rounds; ++round)
+                {
+                    Time startedAt;
+                    kernel.run(benchSize, ref);
+                    bestTime = de::min(bestTime, ddouble(startedAt.since()));
+                }
+                return bestTime * 1000.0;
+            };
+            String line = Stringf("  %-26s original %8.2f ms", kernel.name, bestOf(true));
+            for (const auto &config : configs)
+            {
+                config.apply();
+                line += Stringf(" | %s %8.2f ms", config.name().c_str(), bestOf(false));
+            }
+            LOG_MSG("%s") << line;
+        }
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        failures = 1;
+    }
+    deinit_Foundation();
+    return failures? 1 : 0;
+}
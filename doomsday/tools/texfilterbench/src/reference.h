@@ -0,0 +1,41 @@
+/** @file reference.h  Original scalar texture filters for verification.
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#ifndef TEXFILTERBENCH_REFERENCE_H
+#define TEXFILTERBENCH_REFERENCE_H
+
+#include <cstdint>
+
+/**
+ * Unmodified copies of the filters in gl_tex.cpp as they were before the kernels
+ * were moved to texfilter.cpp. The optimized kernels must match these exactly.
+ */
+namespace reference {
+
+void scale(const float *tempIn, int widthIn, int heightIn, int bpp,
+           float *tempOut, int widthOut, int heightOut);
+void downMipmap32(uint8_t *in, int width, int height, int comps);
+void equalizeLuma(uint8_t *pixels, int width, int height,
+                  float *rBaMul, float *rHiMul, float *rLoMul);
+void sharpen(uint8_t *pixels, int width, int height, int comps);
+void colorOutlinesIdx(uint8_t *buffer, int width, int height);
+void colorOutlinesRGBA(uint8_t *buffer, int width, int height);
+
+} // namespace reference
+
+#endif // TEXFILTERBENCH_REFERENCE_H
@@ -0,0 +1,194 @@
+/** @file main.cpp  Benchmark for thinker allocation and iteration.
+ *
+ * Allocates a map's worth of mobj-sized thinkers from the memory zone and from
+ * a world::ThinkerPool and compares the two. Each tic a few percent of the
+ * thinkers are removed and replaced with new ones, like monsters dying and
+ * missiles being fired, and then every thinker is visited in link order and
+ * has its think function called.
+ *
+ * Only the thinker storage is measured. The think functions do a trivial
+ * amount of work, because the game logic would need a loaded game.
+ *
+ * Usage: thinkerbench [--thinkers N] [--size BYTES] [--tics N] [--churn PERCENT]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include <doomsday/world/thinker.h>
+#include <doomsday/world/thinkerpool.h>
+
+#include <de/commandline.h>
+#include <de/liblegacy.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+#include <de/legacy/memoryzone.h>
+
+#include <random>
+#include <vector>
+
+using namespace de;
+using world::ThinkerPool;
+
+/// Stands in for a mobj: the think function reads and writes a few fields.
+struct BenchThinker
+{
+    thinker_t thinker;
+    dint      tics;
+    ddouble   origin[3];
+    ddouble   mom[3];
+};
+
+static void benchThink(void *ptr)
+{
+    auto *th = reinterpret_cast<BenchThinker *>(ptr);
+    for (int i = 0; i < 3; ++i) th->origin[i] += th->mom[i];
+    th->tics--;
+}
+
+struct Storage
+{
+    bool pooled;
+    dsize size;
+    thinker_t sentinel;
+    std::vector<thinker_t *> thinkers; ///< Alive thinkers, in spawn order.
+
+    Storage(bool pooled, dsize size) : pooled(pooled), size(size)
+    {
+        sentinel.prev = sentinel.next = &sentinel;
+    }
+
+    ~Storage()
+    {
+        for (thinker_t *th : thinkers) release(th);
+    }
+
+    void spawn()
+    {
+        thinker_t *th = pooled? ThinkerPool::forSize(size).allocate()
+                              : reinterpret_cast<thinker_t *>(Z_Calloc(size, PU_MAP, nullptr));
+        th->function = benchThink;
+        reinterpret_cast<BenchThinker *>(th)->mom[0] = 1;
+
+        // Link at the end, like Thinkers does.
+        sentinel.prev->next = th;
+        th->next = &sentinel;
+        th->prev = sentinel.prev;
+        sentinel.prev = th;
+
+        thinkers.push_back(th);
+    }
+
+    void remove(dsize index)
+    {
+        thinker_t *th = thinkers[index];
+        th->next->prev = th->prev;
+        th->prev->next = th->next;
+        thinkers[index] = thinkers.back();
+        thinkers.pop_back();
+        release(th);
+    }
+
+    void release(thinker_t *th)
+    {
+        if (pooled) ThinkerPool::release(th);
+        else        Z_Free(th);
+    }
+
+    void think()
+    {
+        for (thinker_t *th = sentinel.next; th != &sentinel; th = th->next)
+        {
+            th->function(th);
+        }
+    }
+};
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    Libdeng_Init();
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "Thinker Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int count = 25000;
+        int size  = 512;
+        int tics  = 35 * 20;
+        int churn = 3;
+        for (dsize i = 1; i + 1 < cmdLine.count(); ++i)
+        {
+            if      (cmdLine.at(i) == "--thinkers") count = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--size")     size  = de::max(int(sizeof(BenchThinker)), cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--tics")     tics  = de::max(1, cmdLine.at(++i).toInt());
+            else if (cmdLine.at(i) == "--churn")    churn = de::clamp(0, cmdLine.at(++i).toInt(), 100);
+        }
+
+        LOG_MSG("%i thinkers of %i bytes, %i tics, %i percent replaced per tic")
+                << count << size << tics << churn;
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            const bool pooled = (pass == 1);
+            std::mt19937 rng(4321);
+
+            Time startedAt;
+            Storage storage(pooled, dsize(size));
+            for (int i = 0; i < count; ++i) storage.spawn();
+            const TimeSpan spawnTime = startedAt.since();
+
+            TimeSpan churnTime = 0.0;
+            TimeSpan thinkTime = 0.0;
+            for (int tic = 0; tic < tics; ++tic)
+            {
+                startedAt = Time();
+                const int replaced = count * churn / 100;
+                for (int i = 0; i < replaced; ++i)
+                {
+                    storage.remove(rng() % storage.thinkers.size());
+                    storage.spawn();
+                }
+                churnTime += startedAt.since();
+
+                startedAt = Time();
+                storage.think();
+                thinkTime += startedAt.since();
+            }
+
+            LOG_MSG("%s:") << (pooled? "ThinkerPool" : "Memory zone");
+            LOG_MSG("  initial spawn: %.2f ms") << ddouble(spawnTime) * 1000.0;
+            LOG_MSG("  churn:         %.3f ms per tic") << ddouble(churnTime) * 1000.0 / tics;
+            LOG_MSG("  think:         %.3f ms per tic") << ddouble(thinkTime) * 1000.0 / tics;
+        }
+
+        ThinkerPool::clearAll();
+    }
+    catch (const Error &err)
+    {
+        err.warnPlainText();
+    }
+    Libdeng_Shutdown();
+    deinit_Foundation();
+    return 0;
+}
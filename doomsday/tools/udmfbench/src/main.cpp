@@ -0,0 +1,157 @@
+/** @file main.cpp  Throughput benchmark for the UDMF TEXTMAP parser.
+ *
+ * Parses a TEXTMAP lump (or a generated one) a few times and reports the
+ * throughput and the number of blocks of each type. The parser is set up
+ * with the same kind of property list that the importer uses.
+ *
+ * Usage: udmfbench [--lines N] [--rounds N] [textmap-file]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "udmfparser.h"
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/nativefile.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <algorithm>
+#include <memory>
+
+using namespace de;
+
+/**
+ * Generates a map where each linedef has two sidedefs and its own vertex, and
+ * there is a thing and a sector for every eight lines.
+ */
+static Block generateTextmap(int lineCount)
+{
+    String text = "namespace = \"doom\";\n\n";
+    for (int i = 0; i < lineCount; ++i)
+    {
+        text += Stringf("vertex // %i\n{\nx = %i.0;\ny = %i.5;\n}\n\n", i, i * 64, -i * 32);
+        text += Stringf("linedef // %i\n{\nv1 = %i;\nv2 = %i;\nsidefront = %i;\nsideback = %i;\n"
+                        "twosided = true;\nspecial = 1;\nid = %i;\n}\n\n",
+                        i, i, (i + 1) % lineCount, 2 * i, 2 * i + 1, i % 100);
+        for (int s = 0; s < 2; ++s)
+        {
+            text += Stringf("sidedef\n{\nsector = %i;\ntexturetop = \"STARTAN2\";\n"
+                            "texturemiddle = \"-\";\ntexturebottom = \"BROWN1\";\noffsetx = 16;\n}\n\n",
+                            i / 8);
+        }
+        if (i % 8 == 0)
+        {
+            text += Stringf("thing\n{\nx = %i.0;\ny = %i.0;\nangle = 90;\ntype = 3004;\n"
+                            "skill1 = true;\nskill2 = true;\nskill3 = true;\n}\n\n",
+                            i * 64 + 32, -i * 32);
+            text += Stringf("sector\n{\nheightfloor = 0;\nheightceiling = 128;\n"
+                            "texturefloor = \"FLOOR4_8\";\ntextureceiling = \"CEIL3_5\";\n"
+                            "lightlevel = 160;\n}\n\n");
+        }
+    }
+    return text.toUtf8();
+}
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "UDMF Parser Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int lineCount = 20000;
+        int rounds    = 5;
+        NativePath inputPath;
+        for (dsize i = 1; i < cmdLine.count(); ++i)
+        {
+            if (cmdLine.at(i) == "--lines" && i + 1 < cmdLine.count())
+            {
+                lineCount = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else if (cmdLine.at(i) == "--rounds" && i + 1 < cmdLine.count())
+            {
+                rounds = de::max(1, cmdLine.at(++i).toInt());
+            }
+            else
+            {
+                inputPath = cmdLine.at(i);
+            }
+        }
+
+        Block source;
+        if (!inputPath.isEmpty())
+        {
+            std::unique_ptr<NativeFile> file(NativeFile::newStandalone(inputPath));
+            source = *file;
+            LOG_MSG("Parsing %s (%i bytes)") << inputPath << int(source.size());
+        }
+        else
+        {
+            source = generateTextmap(lineCount);
+            LOG_MSG("Parsing a generated map with %i lines (%i bytes)") << lineCount << int(source.size());
+        }
+
+        UDMFParser parser({
+            "x", "y", "z", "angle", "type", "id", "special", "arg0", "arg1", "arg2",
+            "arg3", "arg4", "v1", "v2", "sidefront", "sideback", "blocking", "twosided",
+            "sector", "offsetx", "offsety", "texturetop", "texturemiddle", "texturebottom",
+            "lightlevel", "heightfloor", "heightceiling", "texturefloor", "textureceiling",
+            "skill1", "skill2", "skill3", "skill4", "skill5",
+        });
+
+        int counts[UDMFParser::Sector + 1];
+        parser.setBlockHandler([&counts] (UDMFParser::BlockType type, const UDMFParser::Block &)
+        {
+            counts[type]++;
+        });
+
+        ddouble best = 1.0e9; // seconds
+        for (int round = 0; round < rounds; ++round)
+        {
+            std::fill(std::begin(counts), std::end(counts), 0);
+            Time startedAt;
+            parser.parse(source);
+            best = de::min(best, ddouble(startedAt.since()));
+        }
+
+        LOG_MSG("%i things, %i vertices, %i linedefs, %i sidedefs, %i sectors")
+                << counts[UDMFParser::Thing]
+                << counts[UDMFParser::Vertex]
+                << counts[UDMFParser::Linedef]
+                << counts[UDMFParser::Sidedef]
+                << counts[UDMFParser::Sector];
+        LOG_MSG("Best of %i rounds: %.2f ms, %.1f MB/s")
+                << rounds
+                << best * 1000.0
+                << source.size() / de::max(best, 1.0e-9) / 1.0e6;
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+    }
+    deinit_Foundation();
+    return 0;
+}
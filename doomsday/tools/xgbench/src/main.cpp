@@ -0,0 +1,456 @@
+/** @file main.cpp  Benchmark for the XG reference index.
+ *
+ * Generates a large map of sectors and lines, some of which have XG types, and
+ * a set of repeaters that look up sectors and lines by tag, act tag and type
+ * every tic, the way XG chains and repeater lines do. Some of the visited
+ * elements change their type, act tag, or tag, like XG sector and line type
+ * changes and sector mimicking do. Each tic is run once with linear scans of the
+ * map (like the lookups used to work) and once with XGIndex. The visited
+ * elements and the final state of the map are compared, and the index is
+ * checked against the map. The exit status is non-zero if anything differs.
+ *
+ * The index is updated with XGIndex::setElement() and traversed with
+ * XGIndex::forAllElements(), which are what XS_FindTagged(), XL_TraversePlanes()
+ * and XL_TraverseLines() use. Only the map is synthetic: p_xgsec.cpp and
+ * p_xgline.cpp cannot be built without the engine, so the elements are plain
+ * structs here.
+ *
+ * Usage: xgbench [--sectors N] [--lines N] [--repeaters N] [--tics N] [--rounds N]
+ *
+ * @authors Copyright © 2026 The Doomsday Engine Project
+ *
+ * @par License
+ * GPL: http://www.gnu.org/licenses/gpl.html
+ *
+ * <small>This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version. This program is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details. You should have received a copy of the GNU
+ * General Public License along with this program; if not, see:
+ * http://www.gnu.org/licenses</small>
+ */
+
+#include "xgindex.h"
+
+#include <de/commandline.h>
+#include <de/logbuffer.h>
+#include <de/textapp.h>
+#include <de/time.h>
+
+#include <functional>
+
+using namespace de;
+
+namespace {
+
+static const int TAG_COUNT     = 200; ///< Tags are 1...TAG_COUNT.
+static const int ACT_TAG_COUNT = 100; ///< Act tags are 1...ACT_TAG_COUNT.
+static const int TYPE_COUNT    = 50;  ///< XG types are 1...TYPE_COUNT.
+
+/// Deterministic pseudo-random numbers (not dependent on the library).
+static duint32 mix(duint32 a, duint32 b = 0, duint32 c = 0)
+{
+    duint32 h = a * 0x9e3779b1u ^ (b + 0x7f4a7c15u) * 0x85ebca6bu ^ (c + 0x165667b1u) * 0xc2b2ae35u;
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    return h;
+}
+
+/// Sector or line, as far as XG references are concerned.
+struct Element
+{
+    int tag;
+    bool xg;
+    int actTag;
+    int type;
+};
+
+enum Which { Sectors, Lines };
+
+struct Map
+{
+    List<Element> elements[2];
+
+    Map(int sectorCount, int lineCount)
+    {
+        const int counts[2] = { sectorCount, lineCount };
+        for (int w = 0; w < 2; ++w)
+        {
+            for (int i = 0; i < counts[w]; ++i)
+            {
+                const duint32 r = mix(duint32(w), duint32(i));
+                Element elem;
+                elem.tag    = (r % 4 == 0? 1 + int((r >> 2) % TAG_COUNT) : 0);
+                elem.xg     = (r >> 10) % 8 == 0;
+                elem.actTag = (elem.xg? 1 + int((r >> 13) % ACT_TAG_COUNT) : 0);
+                elem.type   = (elem.xg? 1 + int((r >> 20) % TYPE_COUNT) : 0);
+                elements[w] << elem;
+            }
+        }
+    }
+
+    bool operator == (const Map &other) const
+    {
+        for (int w = 0; w < 2; ++w)
+        {
+            if (elements[w].size() != other.elements[w].size()) return false;
+            for (dsize i = 0; i < elements[w].size(); ++i)
+            {
+                const Element &a = elements[w][i];
+                const Element &b = other.elements[w][i];
+                if (a.tag != b.tag || a.xg != b.xg || a.actTag != b.actTag || a.type != b.type)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+typedef std::function<LoopResult (int element)> ElementFunc;
+
+/// Finds elements by checking every one of them, like the original lookups.
+struct ScanFinder
+{
+    Map &map;
+
+    ScanFinder(Map &map) : map(map) {}
+
+    static bool matches(const Element &elem, XGIndex::Key key, int value)
+    {
+        switch (key)
+        {
+        case XGIndex::Tag:    return elem.tag == value;
+        case XGIndex::ActTag: return elem.xg && elem.actTag == value;
+        case XGIndex::Type:   return elem.xg && elem.type == value;
+        default:              return false;
+        }
+    }
+
+    int first(Which w, XGIndex::Key key, int value) const
+    {
+        const List<Element> &elems = map.elements[w];
+        for (int i = 0; i < elems.sizei(); ++i)
+        {
+            if (matches(elems[i], key, value)) return i;
+        }
+        return -1;
+    }
+
+    LoopResult forAllElements(Which w, XGIndex::Key key, int value, const ElementFunc &func) const
+    {
+        if (key == XGIndex::Tag && !value) return LoopContinue;
+
+        const List<Element> &elems = map.elements[w];
+        for (int i = 0; i < elems.sizei(); ++i)
+        {
+            if (!matches(elems[i], key, value)) continue;
+            if (auto result = func(i)) return result;
+        }
+        return LoopContinue;
+    }
+
+    void changed(Which, int) {}
+};
+
+/// Finds elements using an index, updated when elements change.
+struct IndexFinder
+{
+    Map &map;
+    XGIndex index[2];
+
+    IndexFinder(Map &map) : map(map)
+    {
+        for (int w = 0; w < 2; ++w)
+        {
+            index[w].clear(map.elements[w].sizei());
+            for (int i = 0; i < map.elements[w].sizei(); ++i)
+            {
+                changed(Which(w), i);
+            }
+        }
+    }
+
+    int first(Which w, XGIndex::Key key, int value) const
+    {
+        return index[w].first(key, value);
+    }
+
+    LoopResult forAllElements(Which w, XGIndex::Key key, int value, const ElementFunc &func) const
+    {
+        return index[w].forAllElements(key, value, func);
+    }
+
+    /// Same update as xsUpdateIndex() and xlUpdateIndex().
+    void changed(Which w, int i)
+    {
+        const Element &elem = map.elements[w][i];
+        index[w].setElement(i, elem.tag, elem.xg, elem.actTag, elem.type);
+    }
+
+    /// Compares the index with a scan of the map. Returns the number of errors.
+    int verify() const
+    {
+        const XGIndex::Key keys[] = { XGIndex::Tag, XGIndex::ActTag, XGIndex::Type };
+        const int valueCounts[]   = { TAG_COUNT, ACT_TAG_COUNT, TYPE_COUNT };
+        int errors = 0;
+        for (int w = 0; w < 2; ++w)
+        {
+            for (int k = 0; k < XGIndex::KeyCount; ++k)
+            {
+                for (int value = 0; value <= valueCounts[k]; ++value)
+                {
+                    List<int> expected;
+                    for (int i = 0; i < map.elements[w].sizei(); ++i)
+                    {
+                        if (ScanFinder::matches(map.elements[w][i], keys[k], value))
+                        {
+                            expected << i;
+                        }
+                    }
+                    if (index[w].elements(keys[k], value) != expected) errors++;
+                }
+            }
+        }
+        return errors;
+    }
+};
+
+/// What a repeater refers to every tic.
+struct Repeater
+{
+    enum Kind {
+        FindTaggedSector,
+        FindActTaggedSector,
+        TaggedPlanes,
+        ActTaggedPlanes,
+        TaggedLines,
+        ActTaggedLines,
+        TypedPlanes,
+        TypedLines,
+
+        KindCount
+    };
+    Kind kind;
+    int ref;
+};
+
+struct Repeaters : public List<Repeater>
+{
+    Repeaters(int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const duint32 r = mix(duint32(i), 0x5eed);
+            const auto kind = Repeater::Kind(r % Repeater::KindCount);
+            const bool act  = (kind == Repeater::FindActTaggedSector ||
+                               kind == Repeater::ActTaggedPlanes ||
+                               kind == Repeater::ActTaggedLines);
+            const bool type = (kind == Repeater::TypedPlanes || kind == Repeater::TypedLines);
+            const int count = (type? TYPE_COUNT : act? ACT_TAG_COUNT : TAG_COUNT);
+            append(Repeater{kind, 1 + int((r >> 8) % count)});
+        }
+    }
+};
+
+template <typename Finder>
+struct Simulation
+{
+    Map map;
+    Finder finder;
+    duint32 checksum = 0;
+    int visits = 0;
+
+    Simulation(int sectorCount, int lineCount)
+        : map(sectorCount, lineCount)
+        , finder(map)
+    {}
+
+    /// Like a traversal callback; sometimes changes the visited element.
+    void visit(Which w, int i, int tic, int repeater)
+    {
+        checksum = checksum * 31 + duint32(i) + 1;
+        visits++;
+
+        const duint32 r = mix(duint32(tic), duint32(repeater), duint32(i));
+        if (r % 97) return;
+
+        Element &elem = map.elements[w][i];
+        switch ((r >> 8) % 4)
+        {
+        case 0: // Type changes to a normal one.
+            elem.xg     = false;
+            elem.actTag = 0;
+            elem.type   = 0;
+            break;
+
+        case 1: // Type changes to another XG type.
+            elem.xg     = true;
+            elem.actTag = 1 + int((r >> 12) % ACT_TAG_COUNT);
+            elem.type   = 1 + int((r >> 20) % TYPE_COUNT);
+            break;
+
+        case 2: // XG state is copied from another element.
+            if (w == Sectors)
+            {
+                // Mimicking copies the tag, too.
+                elem = map.elements[w][(r >> 12) % map.elements[w].size()];
+            }
+            break;
+
+        default:
+            break;
+        }
+        finder.changed(w, i);
+    }
+
+    void traverse(Which w, XGIndex::Key key, int ref, int tic, int repeater)
+    {
+        finder.forAllElements(w, key, ref, [&] (int i) {
+            visit(w, i, tic, repeater);
+            return LoopContinue;
+        });
+    }
+
+    void tic(const Repeaters &repeaters, int tic)
+    {
+        for (int r = 0; r < repeaters.sizei(); ++r)
+        {
+            const Repeater &rep = repeaters[r];
+            switch (rep.kind)
+            {
+            case Repeater::FindTaggedSector:
+            case Repeater::FindActTaggedSector: {
+                const XGIndex::Key key = (rep.kind == Repeater::FindTaggedSector? XGIndex::Tag
+                                                                                 : XGIndex::ActTag);
+                const int found = finder.first(Sectors, key, rep.ref);
+                if (found >= 0) visit(Sectors, found, tic, r);
+                break; }
+
+            case Repeater::TaggedPlanes:    traverse(Sectors, XGIndex::Tag,    rep.ref, tic, r); break;
+            case Repeater::ActTaggedPlanes: traverse(Sectors, XGIndex::ActTag, rep.ref, tic, r); break;
+            case Repeater::TaggedLines:     traverse(Lines,   XGIndex::Tag,    rep.ref, tic, r); break;
+            case Repeater::ActTaggedLines:  traverse(Lines,   XGIndex::ActTag, rep.ref, tic, r); break;
+            case Repeater::TypedPlanes:     traverse(Sectors, XGIndex::Type,   rep.ref, tic, r); break;
+            case Repeater::TypedLines:      traverse(Lines,   XGIndex::Type,   rep.ref, tic, r); break;
+
+            default:
+                break;
+            }
+        }
+    }
+};
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    init_Foundation();
+    int result = 0;
+    try
+    {
+        TextApp app(makeList(argc, argv));
+        {
+            Record &amd = app.metadata();
+            amd.set(App::APP_NAME, "XG Reference Index Benchmark");
+            amd.set(App::CONFIG_PATH, "");
+        }
+        LogBuffer::get().enableStandardOutput();
+        app.initSubsystems(App::DisablePersistentData);
+
+        const CommandLine &cmdLine = app.commandLine();
+        int sectorCount    = 8000;
+        int lineCount      = 32000;
+        int repeaterCount  = 400;
+        int tics           = 100;
+        int rounds         = 3;
+        for (dsize i = 1; i + 1 < cmdLine.count(); i += 2)
+        {
+            const int value = de::max(1, cmdLine.at(i + 1).toInt());
+            if      (cmdLine.at(i) == "--sectors")   sectorCount   = value;
+            else if (cmdLine.at(i) == "--lines")     lineCount     = value;
+            else if (cmdLine.at(i) == "--repeaters") repeaterCount = value;
+            else if (cmdLine.at(i) == "--tics")      tics          = value;
+            else if (cmdLine.at(i) == "--rounds")    rounds        = value;
+        }
+
+        const Repeaters repeaters(repeaterCount);
+
+        LOG_MSG("%i sectors, %i lines, %i repeaters")
+                << sectorCount << lineCount << repeaterCount;
+
+        // Run both in lockstep and compare after every tic.
+        {
+            Simulation<ScanFinder> scan(sectorCount, lineCount);
+            Simulation<IndexFinder> indexed(sectorCount, lineCount);
+            for (int tic = 0; tic < tics && !result; ++tic)
+            {
+                scan.tic(repeaters, tic);
+                indexed.tic(repeaters, tic);
+                if (scan.checksum != indexed.checksum || scan.visits != indexed.visits)
+                {
+                    LOG_MSG("Different elements visited on tic %i") << tic;
+                    result = 1;
+                }
+            }
+            if (!result && !(scan.map == indexed.map))
+            {
+                LOG_MSG("The maps differ after %i tics") << tics;
+                result = 1;
+            }
+            if (!result)
+            {
+                if (const int errors = indexed.finder.verify())
+                {
+                    LOG_MSG("The index does not match the map (%i errors)") << errors;
+                    result = 1;
+                }
+            }
+            if (!result)
+            {
+                LOG_MSG("Results are identical after %i tics (%i visits)")
+                        << tics << indexed.visits;
+            }
+        }
+
+        ddouble bestScan  = 1.0e9; // seconds
+        ddouble bestIndex = 1.0e9;
+        ddouble bestBuild = 1.0e9;
+        for (int round = 0; round < rounds; ++round)
+        {
+            {
+                Simulation<ScanFinder> scan(sectorCount, lineCount);
+                Time startedAt;
+                for (int tic = 0; tic < tics; ++tic) scan.tic(repeaters, tic);
+                bestScan = de::min(bestScan, ddouble(startedAt.since()));
+            }
+            {
+                Time buildStartedAt;
+                Simulation<IndexFinder> indexed(sectorCount, lineCount);
+                bestBuild = de::min(bestBuild, ddouble(buildStartedAt.since()));
+                Time startedAt;
+                for (int tic = 0; tic < tics; ++tic) indexed.tic(repeaters, tic);
+                bestIndex = de::min(bestIndex, ddouble(startedAt.since()));
+            }
+        }
+
+        LOG_MSG("Best of %i rounds of %i tics:") << rounds << tics;
+        LOG_MSG("  Linear scans: %.3f ms per tic") << bestScan * 1000.0 / tics;
+        LOG_MSG("  Index: %.3f ms per tic, %.1fx (map generation and indexing %.2f ms)")
+                << bestIndex * 1000.0 / tics
+                << bestScan / de::max(bestIndex, 1.0e-9)
+                << bestBuild * 1000.0;
+    }
+    catch (const Error &er)
+    {
+        er.warnPlainText();
+        result = 1;
+    }
+    deinit_Foundation();
+    return result;
+}